@@ -17,12 +17,14 @@
 #include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 #include <itkImageFileReader.h>
 #include <itkImageIOBase.h>
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <atomic>
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -132,158 +134,263 @@ void FlipAboutXAxis(DataArray<T>& dataArray, Vec3<usize>& dims)
 
 namespace cxITKImportImageStackFilter
 {
+struct ImageStackReadInputs
+{
+  DataPath ImageGeomPath;
+  std::string CellDataName;
+  std::string ImageArrayName;
+  ChoicesParameter::ValueType TransformType;
+  bool ConvertToGrayscale;
+  VectorFloat32Parameter::ValueType LuminosityValues;
+  bool Resample;
+  float32 ScalingFactor;
+  bool ChangeDataType;
+  ChoicesParameter::ValueType DestType;
+  const IFilter* GrayScaleFilter;
+  const IFilter* ResampleImageGeomFilter;
+};
+
+/**
+ * @brief Reads a single image file into its own DataStructure, applies the optional grayscale
+ * conversion, resampling and flip to it and then copies it into its slice of the output store.
+ * Each slice only touches its own DataStructure and its own range of the output store so
+ * several slices can be read at the same time.
+ */
 template <class T>
-Result<> ReadImageStack(DataStructure& dataStructure, const DataPath& imageGeomPath, const std::string& cellDataName, const std::string& imageArrayName, const std::vector<std::string>& files,
-                        ChoicesParameter::ValueType transformType, bool convertToGrayscale, const VectorFloat32Parameter::ValueType& luminosityValues, bool resample, float32 scalingFactor,
-                        bool changeDataType, ChoicesParameter::ValueType destType, const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
+Result<> ReadImageSlice(const ImageStackReadInputs& inputs, const std::string& filePath, usize slice, SizeVec3 dims, AbstractDataStore<T>& outputDataStore)
 {
-  auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-  DataPath imageDataPath = imageGeomPath.createChildPath(cellDataName).createChildPath(imageArrayName);
-  SizeVec3 dims = imageGeom.getDimensions();
+  const DataPath imageDataPath = inputs.ImageGeomPath.createChildPath(inputs.CellDataName).createChildPath(inputs.ImageArrayName);
   const usize tuplesPerSlice = dims[0] * dims[1];
-
-  auto& outputData = dataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
-  auto& outputDataStore = outputData.getDataStoreRef();
-
-  // Variables for the progress Reporting
-  usize slice = 0;
-
-  auto* filterListPtr = Application::Instance()->getFilterList();
-
-  if(convertToGrayscale && !filterListPtr->containsPlugin(k_SimplnxCorePluginId))
-  {
-    return MakeErrorResult(-18542, "SimplnxCore was not instantiated in this instance, so color to grayscale is not a valid option.");
-  }
-  auto grayScaleFilter = filterListPtr->createFilter(k_ColorToGrayScaleFilterHandle);
-  auto resampleImageGeomFilter = filterListPtr->createFilter(k_ResampleImageGeomFilterHandle);
   Result<> outputResult = {};
 
-  // Loop over all the files importing them one by one and copying the data into the data array
-  for(const auto& filePath : files)
+  DataStructure importedDataStructure;
   {
-    messageHandler(IFilter::Message::Type::Info, fmt::format("Importing: {}", filePath));
-
-    DataStructure importedDataStructure;
+    // Create a sub-filter to read each image, although for preflight we are going to read the first image in the
+    // list and hope the rest are correct.
+    const ITKImageReaderFilter imageReader;
+
+    Arguments args;
+    args.insertOrAssign(ITKImageReaderFilter::k_ImageGeometryPath_Key, std::make_any<DataPath>(inputs.ImageGeomPath));
+    args.insertOrAssign(ITKImageReaderFilter::k_CellDataName_Key, std::make_any<std::string>(inputs.CellDataName));
+    args.insertOrAssign(ITKImageReaderFilter::k_ImageDataArrayPath_Key, std::make_any<std::string>(inputs.ImageArrayName));
+    args.insertOrAssign(ITKImageReaderFilter::k_FileName_Key, std::make_any<fs::path>(filePath));
+    args.insertOrAssign(ITKImageReaderFilter::k_ChangeDataType_Key, std::make_any<bool>(inputs.ChangeDataType));
+    args.insertOrAssign(ITKImageReaderFilter::k_ImageDataType_Key, std::make_any<ChoicesParameter::ValueType>(inputs.DestType));
+
+    auto executeResult = imageReader.execute(importedDataStructure, args);
+    if(executeResult.result.invalid())
     {
-      // Create a sub-filter to read each image, although for preflight we are going to read the first image in the
-      // list and hope the rest are correct.
-      const ITKImageReaderFilter imageReader;
-
-      Arguments args;
-      args.insertOrAssign(ITKImageReaderFilter::k_ImageGeometryPath_Key, std::make_any<DataPath>(imageGeomPath));
-      args.insertOrAssign(ITKImageReaderFilter::k_CellDataName_Key, std::make_any<std::string>(cellDataName));
-      args.insertOrAssign(ITKImageReaderFilter::k_ImageDataArrayPath_Key, std::make_any<std::string>(imageArrayName));
-      args.insertOrAssign(ITKImageReaderFilter::k_FileName_Key, std::make_any<fs::path>(filePath));
-      args.insertOrAssign(ITKImageReaderFilter::k_ChangeDataType_Key, std::make_any<bool>(changeDataType));
-      args.insertOrAssign(ITKImageReaderFilter::k_ImageDataType_Key, std::make_any<ChoicesParameter::ValueType>(destType));
-
-      auto executeResult = imageReader.execute(importedDataStructure, args);
-      if(executeResult.result.invalid())
-      {
-        return executeResult.result;
-      }
+      return executeResult.result;
     }
+  }
 
-    // ======================= Convert to GrayScale Section ===================
-    bool validInputForGrayScaleConversion = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath).getDataType() == DataType::uint8;
-    if(convertToGrayscale && validInputForGrayScaleConversion && nullptr != grayScaleFilter.get())
-    {
-
-      // This same filter was used to preflight so as long as nothing changes on disk this really should work....
-      Arguments colorToGrayscaleArgs;
-      colorToGrayscaleArgs.insertOrAssign("conversion_algorithm", std::make_any<ChoicesParameter::ValueType>(0));
-      colorToGrayscaleArgs.insertOrAssign("color_weights", std::make_any<VectorFloat32Parameter::ValueType>(luminosityValues));
-      colorToGrayscaleArgs.insertOrAssign("input_data_array_paths", std::make_any<std::vector<DataPath>>(std::vector<DataPath>{imageDataPath}));
-      colorToGrayscaleArgs.insertOrAssign("output_array_prefix", std::make_any<std::string>("gray"));
-
-      // Run grayscale filter and process results and messages
-      auto result = grayScaleFilter->execute(importedDataStructure, colorToGrayscaleArgs).result;
-      if(result.invalid())
-      {
-        return result;
-      }
+  // ======================= Convert to GrayScale Section ===================
+  bool validInputForGrayScaleConversion = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath).getDataType() == DataType::uint8;
+  if(inputs.ConvertToGrayscale && validInputForGrayScaleConversion && nullptr != inputs.GrayScaleFilter)
+  {
 
-      // deletion of non-grayscale array
-      DataObject::IdType id;
-      { // scoped for safety since this reference will be nonexistent in a moment
-        auto& oldArray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath);
-        id = oldArray.getId();
-      }
-      importedDataStructure.removeData(id);
+    // This same filter was used to preflight so as long as nothing changes on disk this really should work....
+    Arguments colorToGrayscaleArgs;
+    colorToGrayscaleArgs.insertOrAssign("conversion_algorithm", std::make_any<ChoicesParameter::ValueType>(0));
+    colorToGrayscaleArgs.insertOrAssign("color_weights", std::make_any<VectorFloat32Parameter::ValueType>(inputs.LuminosityValues));
+    colorToGrayscaleArgs.insertOrAssign("input_data_array_paths", std::make_any<std::vector<DataPath>>(std::vector<DataPath>{imageDataPath}));
+    colorToGrayscaleArgs.insertOrAssign("output_array_prefix", std::make_any<std::string>("gray"));
 
-      // rename grayscale array to reflect original
-      {
-        auto& gray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath.replaceName("gray" + imageDataPath.getTargetName()));
-        if(!gray.canRename(imageDataPath.getTargetName()))
-        {
-          return MakeErrorResult(-64543, fmt::format("Unable to rename the internal grayscale array to {}", imageDataPath.getTargetName()));
-        }
-        gray.rename(imageDataPath.getTargetName());
-      }
-    }
-    else if(convertToGrayscale && !validInputForGrayScaleConversion)
+    // Run grayscale filter and process results and messages
+    auto result = inputs.GrayScaleFilter->execute(importedDataStructure, colorToGrayscaleArgs).result;
+    if(result.invalid())
     {
-      outputResult.warnings().emplace_back(Warning{
-          -74320, fmt::format("The array ({}) resulting from reading the input image file is not a UInt8Array. The input image will not be converted to grayscale.", imageDataPath.getTargetName())});
+      return result;
     }
 
-    // ======================= Resample Image Geometry Section ===================
-    if(resample && scalingFactor != 1.0f)
+    // deletion of non-grayscale array
+    DataObject::IdType id;
+    { // scoped for safety since this reference will be nonexistent in a moment
+      auto& oldArray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath);
+      id = oldArray.getId();
+    }
+    importedDataStructure.removeData(id);
+
+    // rename grayscale array to reflect original
     {
-      auto scaling = scalingFactor * 100;
-      const auto& importedImageGeom = importedDataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-      auto spacing = importedImageGeom.getSpacing() / scalingFactor;
-
-      Arguments resampleImageGeomArgs;
-      resampleImageGeomArgs.insertOrAssign("input_image_geometry_path", std::make_any<DataPath>(imageGeomPath));
-      resampleImageGeomArgs.insertOrAssign("resampling_mode_index", std::make_any<ChoicesParameter::ValueType>(1));
-      resampleImageGeomArgs.insertOrAssign("scaling", std::make_any<VectorFloat32Parameter::ValueType>(std::vector<float32>{scaling, scaling, scaling}));
-      resampleImageGeomArgs.insertOrAssign("spacing", std::make_any<VectorFloat32Parameter::ValueType>(spacing.toContainer<std::vector<float32>>()));
-
-      // Run resample image geometry filter and process results and messages
-      auto result = resampleImageGeomFilter->execute(importedDataStructure, resampleImageGeomArgs).result;
-      if(result.invalid())
+      auto& gray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath.replaceName("gray" + imageDataPath.getTargetName()));
+      if(!gray.canRename(imageDataPath.getTargetName()))
       {
-        return result;
+        return MakeErrorResult(-64543, fmt::format("Unable to rename the internal grayscale array to {}", imageDataPath.getTargetName()));
       }
+      gray.rename(imageDataPath.getTargetName());
     }
+  }
+  else if(inputs.ConvertToGrayscale && !validInputForGrayScaleConversion)
+  {
+    outputResult.warnings().emplace_back(Warning{
+        -74320, fmt::format("The array ({}) resulting from reading the input image file is not a UInt8Array. The input image will not be converted to grayscale.", imageDataPath.getTargetName())});
+  }
 
-    // Check the ImageGeometry of the imported Image matches the destination
-    const auto& importedImageGeom = importedDataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-    SizeVec3 importedDims = importedImageGeom.getDimensions();
-    if(dims[0] != importedDims[0] || dims[1] != importedDims[1])
+  // ======================= Resample Image Geometry Section ===================
+  if(inputs.Resample && inputs.ScalingFactor != 1.0f)
+  {
+    auto scaling = inputs.ScalingFactor * 100;
+    const auto& importedImageGeom = importedDataStructure.getDataRefAs<ImageGeom>(inputs.ImageGeomPath);
+    auto spacing = importedImageGeom.getSpacing() / inputs.ScalingFactor;
+
+    Arguments resampleImageGeomArgs;
+    resampleImageGeomArgs.insertOrAssign("input_image_geometry_path", std::make_any<DataPath>(inputs.ImageGeomPath));
+    resampleImageGeomArgs.insertOrAssign("resampling_mode_index", std::make_any<ChoicesParameter::ValueType>(1));
+    resampleImageGeomArgs.insertOrAssign("scaling", std::make_any<VectorFloat32Parameter::ValueType>(std::vector<float32>{scaling, scaling, scaling}));
+    resampleImageGeomArgs.insertOrAssign("spacing", std::make_any<VectorFloat32Parameter::ValueType>(spacing.toContainer<std::vector<float32>>()));
+
+    // Run resample image geometry filter and process results and messages
+    auto result = inputs.ResampleImageGeomFilter->execute(importedDataStructure, resampleImageGeomArgs).result;
+    if(result.invalid())
     {
-      return MakeErrorResult(-64510, fmt::format("Slice {} image dimensions are different than the first slice.\n  First Slice Dims are:  {} x {}\n  Current Slice Dims are:{} x {}\n", slice,
-                                                 importedDims[0], importedDims[1], dims[0], dims[1]));
+      return result;
     }
+  }
+
+  // Check the ImageGeometry of the imported Image matches the destination
+  const auto& importedImageGeom = importedDataStructure.getDataRefAs<ImageGeom>(inputs.ImageGeomPath);
+  SizeVec3 importedDims = importedImageGeom.getDimensions();
+  if(dims[0] != importedDims[0] || dims[1] != importedDims[1])
+  {
+    return MakeErrorResult(-64510, fmt::format("Slice {} image dimensions are different than the first slice.\n  First Slice Dims are:  {} x {}\n  Current Slice Dims are:{} x {}\n", slice,
+                                               importedDims[0], importedDims[1], dims[0], dims[1]));
+  }
 
-    // Compute the Tuple Index we are at:
-    const usize tupleIndex = (slice * dims[0] * dims[1]);
-    // get the current Slice data...
-    auto& tempData = importedDataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
-    auto& tempDataStore = tempData.getDataStoreRef();
+  // Compute the Tuple Index we are at:
+  const usize tupleIndex = (slice * dims[0] * dims[1]);
+  // get the current Slice data...
+  auto& tempData = importedDataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
+  auto& tempDataStore = tempData.getDataStoreRef();
 
-    if(transformType == k_FlipAboutYAxis)
+  if(inputs.TransformType == k_FlipAboutYAxis)
+  {
+    FlipAboutYAxis<T>(tempData, dims);
+  }
+  else if(inputs.TransformType == k_FlipAboutXAxis)
+  {
+    FlipAboutXAxis<T>(tempData, dims);
+  }
+
+  // Copy that into the output array...
+  if(outputDataStore.copyFrom(tupleIndex, tempDataStore, 0, tuplesPerSlice).invalid())
+  {
+    return MakeErrorResult(-64511, fmt::format("Error copying source image data into destination array.\n  Slice:{}\n  TupleIndex:{}\n  MaxTupleIndex:{}", slice, tupleIndex, outputDataStore.getSize()));
+  }
+
+  return outputResult;
+}
+
+/**
+ * @brief Task that reads one slice of the stack and stores its result in the slot for that slice.
+ * Once any slice fails the remaining queued slices are skipped.
+ */
+template <class T>
+class ReadImageSliceTask
+{
+public:
+  ReadImageSliceTask(const ImageStackReadInputs& inputs, const std::string& filePath, usize slice, const SizeVec3& dims, AbstractDataStore<T>& outputDataStore, Result<>& sliceResult,
+                     std::atomic_bool& readFailed, const std::atomic_bool& shouldCancel)
+  : m_Inputs(inputs)
+  , m_FilePath(filePath)
+  , m_Slice(slice)
+  , m_Dims(dims)
+  , m_OutputDataStore(outputDataStore)
+  , m_SliceResult(sliceResult)
+  , m_ReadFailed(readFailed)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()() const
+  {
+    if(m_ReadFailed || m_ShouldCancel)
     {
-      FlipAboutYAxis<T>(tempData, dims);
+      return;
     }
-    else if(transformType == k_FlipAboutXAxis)
+    m_SliceResult = ReadImageSlice<T>(m_Inputs, m_FilePath, m_Slice, m_Dims, m_OutputDataStore);
+    if(m_SliceResult.invalid())
     {
-      FlipAboutXAxis<T>(tempData, dims);
+      m_ReadFailed = true;
     }
+  }
+
+private:
+  const ImageStackReadInputs& m_Inputs;
+  const std::string& m_FilePath;
+  usize m_Slice;
+  SizeVec3 m_Dims;
+  AbstractDataStore<T>& m_OutputDataStore;
+  Result<>& m_SliceResult;
+  std::atomic_bool& m_ReadFailed;
+  const std::atomic_bool& m_ShouldCancel;
+};
 
-    // Copy that into the output array...
-    if(outputDataStore.copyFrom(tupleIndex, tempDataStore, 0, tuplesPerSlice).invalid())
+template <class T>
+Result<> ReadImageStack(DataStructure& dataStructure, const DataPath& imageGeomPath, const std::string& cellDataName, const std::string& imageArrayName, const std::vector<std::string>& files,
+                        ChoicesParameter::ValueType transformType, bool convertToGrayscale, const VectorFloat32Parameter::ValueType& luminosityValues, bool resample, float32 scalingFactor,
+                        bool changeDataType, ChoicesParameter::ValueType destType, const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
+{
+  auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
+  DataPath imageDataPath = imageGeomPath.createChildPath(cellDataName).createChildPath(imageArrayName);
+  SizeVec3 dims = imageGeom.getDimensions();
+
+  auto& outputData = dataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
+  auto& outputDataStore = outputData.getDataStoreRef();
+
+  auto* filterListPtr = Application::Instance()->getFilterList();
+
+  if(convertToGrayscale && !filterListPtr->containsPlugin(k_SimplnxCorePluginId))
+  {
+    return MakeErrorResult(-18542, "SimplnxCore was not instantiated in this instance, so color to grayscale is not a valid option.");
+  }
+  auto grayScaleFilter = filterListPtr->createFilter(k_ColorToGrayScaleFilterHandle);
+  auto resampleImageGeomFilter = filterListPtr->createFilter(k_ResampleImageGeomFilterHandle);
+
+  ImageStackReadInputs inputs;
+  inputs.ImageGeomPath = imageGeomPath;
+  inputs.CellDataName = cellDataName;
+  inputs.ImageArrayName = imageArrayName;
+  inputs.TransformType = transformType;
+  inputs.ConvertToGrayscale = convertToGrayscale;
+  inputs.LuminosityValues = luminosityValues;
+  inputs.Resample = resample;
+  inputs.ScalingFactor = scalingFactor;
+  inputs.ChangeDataType = changeDataType;
+  inputs.DestType = destType;
+  inputs.GrayScaleFilter = grayScaleFilter.get();
+  inputs.ResampleImageGeomFilter = resampleImageGeomFilter.get();
+
+  // Read up to one slice per thread at a time. Every slice is decoded into its own
+  // DataStructure and copied into its own z-offset of the output store, so the slices
+  // can finish in any order.
+  std::vector<Result<>> sliceResults(files.size());
+  std::atomic_bool readFailed = false;
+  ParallelTaskAlgorithm taskRunner;
+  taskRunner.requireArraysInMemory({&outputData});
+  for(usize slice = 0; slice < files.size(); slice++)
+  {
+    // Check to see if the filter got canceled or a slice could not be read.
+    if(shouldCancel || readFailed)
     {
-      return MakeErrorResult(-64511, fmt::format("Error copying source image data into destination array.\n  Slice:{}\n  TupleIndex:{}\n  MaxTupleIndex:{}", slice, tupleIndex, outputData.getSize()));
+      break;
     }
+    messageHandler(IFilter::Message::Type::Info, fmt::format("Importing: {}", files[slice]));
+    taskRunner.execute(ReadImageSliceTask<T>(inputs, files[slice], slice, dims, outputDataStore, sliceResults[slice], readFailed, shouldCancel));
+  }
+  taskRunner.wait();
 
-    slice++;
-
-    // Check to see if the filter got canceled.
-    if(shouldCancel)
+  // Report the first slice that failed, otherwise gather the warnings of every slice
+  Result<> outputResult = {};
+  for(auto& sliceResult : sliceResults)
+  {
+    if(sliceResult.invalid())
+    {
+      return std::move(sliceResult);
+    }
+    for(auto& warning : sliceResult.warnings())
     {
-      return outputResult;
+      outputResult.warnings().push_back(std::move(warning));
     }
   }
 
@@ -5,6 +5,7 @@
 #include "simplnx/DataStructure/Geometry/IGridGeometry.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
@@ -12,6 +13,166 @@
 
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief Finds the in-plane shift between each slice and the slice above it. The search is a hill
+ * climb over a 7x7 neighborhood of candidate shifts that compares every 4th voxel of the slice pair.
+ * When the coarse-to-fine search is enabled the hill climb is first run on candidate shifts that are
+ * 2^level voxels apart (sampling every 4*2^level voxels) and each level starts from the shift that
+ * the previous, coarser level found. Level 0 is the original full resolution search.
+ */
+class FindSliceShiftsImpl
+{
+public:
+  FindSliceShiftsImpl(const AlignSectionsMisorientationInputValues* inputValues, const std::array<int64_t, 3>& dims, const Float32Array& quats, const Int32Array& cellPhases,
+                      const UInt32Array& crystalStructures, const MaskCompare* maskCompare, std::vector<int64_t>& relativeXShifts, std::vector<int64_t>& relativeYShifts,
+                      const std::atomic_bool& shouldCancel)
+  : m_InputValues(inputValues)
+  , m_Dims(dims)
+  , m_Quats(quats)
+  , m_CellPhases(cellPhases)
+  , m_CrystalStructures(crystalStructures)
+  , m_MaskCompare(maskCompare)
+  , m_RelativeXShifts(relativeXShifts)
+  , m_RelativeYShifts(relativeYShifts)
+  , m_ShouldCancel(shouldCancel)
+  , m_OrientationOps(LaueOps::GetAllOrientationOps())
+  , m_MisorientationTolerance(static_cast<float>(inputValues->misorientationTolerance * (nx::core::numbers::pi / 180.0)))
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    // Allocate a 2D Array which will be reused from slice to slice
+    std::vector<bool> misorients(m_Dims[0] * m_Dims[1], false);
+
+    const int32_t numLevels = m_InputValues->useCoarseToFineSearch ? m_InputValues->coarseToFineLevels : 1;
+
+    for(usize iter = range.min(); iter < range.max(); iter++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      // Work from the largest Slice Value to the lowest Slice Value.
+      int64_t slice = (m_Dims[2] - 1) - static_cast<int64_t>(iter);
+      int64_t newxshift = 0;
+      int64_t newyshift = 0;
+      for(int32_t level = numLevels - 1; level >= 0; level--)
+      {
+        const int64_t step = int64_t{1} << level;
+        searchShift(slice, step, step * 4, newxshift, newyshift, misorients);
+      }
+      m_RelativeXShifts[iter] = newxshift;
+      m_RelativeYShifts[iter] = newyshift;
+    }
+  }
+
+private:
+  void searchShift(int64_t slice, int64_t step, int64_t sampleStride, int64_t& newxshift, int64_t& newyshift, std::vector<bool>& misorients) const
+  {
+    const auto halfDim0 = static_cast<int64_t>(m_Dims[0] * 0.5f);
+    const auto halfDim1 = static_cast<int64_t>(m_Dims[1] * 0.5f);
+
+    float minDisorientation = std::numeric_limits<float>::max();
+    int64_t oldxshift = newxshift - 1;
+    int64_t oldyshift = newyshift - 1;
+
+    // Initialize everything to false
+    std::fill(misorients.begin(), misorients.end(), false);
+
+    while(newxshift != oldxshift || newyshift != oldyshift)
+    {
+      oldxshift = newxshift;
+      oldyshift = newyshift;
+      for(int32_t j = -3; j < 4; j++)
+      {
+        for(int32_t k = -3; k < 4; k++)
+        {
+          const int64_t xShift = (k * step) + oldxshift;
+          const int64_t yShift = (j * step) + oldyshift;
+          if(llabs(xShift) >= halfDim0 || llabs(yShift) >= halfDim1)
+          {
+            continue;
+          }
+          const int64_t idx = (m_Dims[0] * (yShift + halfDim1)) + (xShift + halfDim0);
+          if(misorients[idx])
+          {
+            continue;
+          }
+          float disorientation = 0.0f;
+          float count = 0.0f;
+          for(int64_t l = 0; l < m_Dims[1]; l = l + sampleStride)
+          {
+            for(int64_t n = 0; n < m_Dims[0]; n = n + sampleStride)
+            {
+              if((l + yShift) >= 0 && (l + yShift) < m_Dims[1] && (n + xShift) >= 0 && (n + xShift) < m_Dims[0])
+              {
+                count++;
+                int64_t refposition = ((slice + 1) * m_Dims[0] * m_Dims[1]) + (l * m_Dims[0]) + n;
+                int64_t curposition = (slice * m_Dims[0] * m_Dims[1]) + ((l + yShift) * m_Dims[0]) + (n + xShift);
+                if(!m_InputValues->useGoodVoxels || m_MaskCompare->bothTrue(refposition, curposition))
+                {
+                  float angle = std::numeric_limits<float>::max();
+                  if(m_CellPhases[refposition] > 0 && m_CellPhases[curposition] > 0)
+                  {
+                    QuatF quat1(m_Quats[refposition * 4], m_Quats[refposition * 4 + 1], m_Quats[refposition * 4 + 2], m_Quats[refposition * 4 + 3]); // Makes a copy into voxQuat!!!!
+                    auto phase1 = static_cast<int32_t>(m_CrystalStructures[m_CellPhases[refposition]]);
+                    QuatF quat2(m_Quats[curposition * 4], m_Quats[curposition * 4 + 1], m_Quats[curposition * 4 + 2], m_Quats[curposition * 4 + 3]); // Makes a copy into voxQuat!!!!
+                    auto phase2 = static_cast<int32_t>(m_CrystalStructures[m_CellPhases[curposition]]);
+                    if(phase1 == phase2 && phase1 < static_cast<uint32_t>(m_OrientationOps.size()))
+                    {
+                      OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(quat1, quat2);
+                      angle = axisAngle[3];
+                    }
+                  }
+                  if(angle > m_MisorientationTolerance)
+                  {
+                    disorientation++;
+                  }
+                }
+                if(m_InputValues->useGoodVoxels)
+                {
+                  if(m_MaskCompare->isTrue(refposition) && !m_MaskCompare->isTrue(curposition))
+                  {
+                    disorientation++;
+                  }
+                  if(!m_MaskCompare->isTrue(refposition) && m_MaskCompare->isTrue(curposition))
+                  {
+                    disorientation++;
+                  }
+                }
+              }
+            }
+          }
+          disorientation = disorientation / count;
+          misorients[idx] = true;
+          if(disorientation < minDisorientation || (disorientation == minDisorientation && ((llabs(xShift) < llabs(newxshift)) || (llabs(yShift) < llabs(newyshift)))))
+          {
+            newxshift = xShift;
+            newyshift = yShift;
+            minDisorientation = disorientation;
+          }
+        }
+      }
+    }
+  }
+
+  const AlignSectionsMisorientationInputValues* m_InputValues = nullptr;
+  const std::array<int64_t, 3> m_Dims;
+  const Float32Array& m_Quats;
+  const Int32Array& m_CellPhases;
+  const UInt32Array& m_CrystalStructures;
+  const MaskCompare* m_MaskCompare = nullptr;
+  std::vector<int64_t>& m_RelativeXShifts;
+  std::vector<int64_t>& m_RelativeYShifts;
+  const std::atomic_bool& m_ShouldCancel;
+  std::vector<LaueOps::Pointer> m_OrientationOps;
+  float m_MisorientationTolerance = 0.0f;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 AlignSectionsMisorientation::AlignSectionsMisorientation(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                          AlignSectionsMisorientationInputValues* inputValues)
@@ -108,125 +269,40 @@ Result<> AlignSectionsMisorientation::findShifts(std::vector<int64_t>& xShifts,
       static_cast<int64_t>(udims[2]),
   };
 
-  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  // Each slice pair is independent of every other pair, so the relative shifts are found
+  // in parallel and then accumulated in slice order below.
+  std::vector<int64_t> relativeXShifts(dims[2], 0);
+  std::vector<int64_t> relativeYShifts(dims[2], 0);
 
-  int32_t progInt = 0;
+  m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Determining Shifts for {} Slice Pairs", dims[2] - 1));
 
-  // Allocate a 2D Array which will be reused from slice to slice
-  std::vector<bool> misorients(dims[0] * dims[1], false);
+  ParallelDataAlgorithm::AlgorithmArrays algArrays;
+  algArrays.push_back(&cellPhases);
+  algArrays.push_back(&quats);
+  algArrays.push_back(&crystalStructures);
+  if(m_InputValues->useGoodVoxels)
+  {
+    algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->goodVoxelsArrayPath));
+  }
 
-  const auto halfDim0 = static_cast<int64_t>(dims[0] * 0.5f);
-  const auto halfDim1 = static_cast<int64_t>(dims[1] * 0.5f);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, udims[2]);
+  dataAlg.requireArraysInMemory(algArrays);
+  dataAlg.execute(FindSliceShiftsImpl(m_InputValues, dims, quats, cellPhases, crystalStructures, maskCompare.get(), relativeXShifts, relativeYShifts, getCancel()));
+
+  if(getCancel())
+  {
+    return {};
+  }
 
-  double deg2Rad = (nx::core::numbers::pi / 180.0);
-  auto start = std::chrono::steady_clock::now();
-  // Loop over the Z Direction
   for(int64_t iter = 1; iter < dims[2]; iter++)
   {
-    progInt = static_cast<float>(iter) / static_cast<float>(dims[2]) * 100.0f;
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      std::string message = fmt::format("Determining Shifts || {}% Complete", progInt);
-      m_MessageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, progInt});
-      start = std::chrono::steady_clock::now();
-    }
-    if(getCancel())
-    {
-      return {};
-    }
-    float minDisorientation = std::numeric_limits<float>::max();
-    // Work from the largest Slice Value to the lowest Slice Value.
     int64_t slice = (dims[2] - 1) - iter;
-    int64_t oldxshift = -1;
-    int64_t oldyshift = -1;
-    int64_t newxshift = 0;
-    int64_t newyshift = 0;
-
-    // Initialize everything to false
-    std::fill(misorients.begin(), misorients.end(), false);
-
-    float misorientationTolerance = static_cast<float>(m_InputValues->misorientationTolerance * deg2Rad);
-
-    while(newxshift != oldxshift || newyshift != oldyshift)
-    {
-      oldxshift = newxshift;
-      oldyshift = newyshift;
-      for(int32_t j = -3; j < 4; j++)
-      {
-        for(int32_t k = -3; k < 4; k++)
-        {
-          float disorientation = 0.0f;
-          float count = 0.0f;
-          int64_t xIdx = k + oldxshift + halfDim0;
-          int64_t yIdx = j + oldyshift + halfDim1;
-          int64_t idx = (dims[0] * yIdx) + xIdx;
-          if(!misorients[idx] && llabs(k + oldxshift) < halfDim0 && llabs(j + oldyshift) < halfDim1)
-          {
-            for(int64_t l = 0; l < dims[1]; l = l + 4)
-            {
-              for(int64_t n = 0; n < dims[0]; n = n + 4)
-              {
-                if((l + j + oldyshift) >= 0 && (l + j + oldyshift) < dims[1] && (n + k + oldxshift) >= 0 && (n + k + oldxshift) < dims[0])
-                {
-                  count++;
-                  int64_t refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
-                  int64_t curposition = (slice * dims[0] * dims[1]) + ((l + j + oldyshift) * dims[0]) + (n + k + oldxshift);
-                  if(!m_InputValues->useGoodVoxels || maskCompare->bothTrue(refposition, curposition))
-                  {
-                    float angle = std::numeric_limits<float>::max();
-                    if(cellPhases[refposition] > 0 && cellPhases[curposition] > 0)
-                    {
-                      QuatF quat1(quats[refposition * 4], quats[refposition * 4 + 1], quats[refposition * 4 + 2], quats[refposition * 4 + 3]); // Makes a copy into voxQuat!!!!
-                      auto phase1 = static_cast<int32_t>(crystalStructures[cellPhases[refposition]]);
-                      QuatF quat2(quats[curposition * 4], quats[curposition * 4 + 1], quats[curposition * 4 + 2], quats[curposition * 4 + 3]); // Makes a copy into voxQuat!!!!
-                      auto phase2 = static_cast<int32_t>(crystalStructures[cellPhases[curposition]]);
-                      if(phase1 == phase2 && phase1 < static_cast<uint32_t>(orientationOps.size()))
-                      {
-                        OrientationF axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-                        angle = axisAngle[3];
-                      }
-                    }
-                    if(angle > misorientationTolerance)
-                    {
-                      disorientation++;
-                    }
-                  }
-                  if(m_InputValues->useGoodVoxels)
-                  {
-                    if(maskCompare->isTrue(refposition) && !maskCompare->isTrue(curposition))
-                    {
-                      disorientation++;
-                    }
-                    if(!maskCompare->isTrue(refposition) && maskCompare->isTrue(curposition))
-                    {
-                      disorientation++;
-                    }
-                  }
-                }
-              }
-            }
-            disorientation = disorientation / count;
-            xIdx = k + oldxshift + halfDim0;
-            yIdx = j + oldyshift + halfDim1;
-            idx = (dims[0] * yIdx) + xIdx;
-            misorients[idx] = true;
-            if(disorientation < minDisorientation || (disorientation == minDisorientation && ((llabs(k + oldxshift) < llabs(newxshift)) || (llabs(j + oldyshift) < llabs(newyshift)))))
-            {
-              newxshift = k + oldxshift;
-              newyshift = j + oldyshift;
-              minDisorientation = disorientation;
-            }
-          }
-        }
-      }
-    }
-    xShifts[iter] = xShifts[iter - 1] + newxshift;
-    yShifts[iter] = yShifts[iter - 1] + newyshift;
+    xShifts[iter] = xShifts[iter - 1] + relativeXShifts[iter];
+    yShifts[iter] = yShifts[iter - 1] + relativeYShifts[iter];
     if(m_InputValues->writeAlignmentShifts)
     {
-      outFile << slice << "\t" << slice + 1 << "\t" << newxshift << "\t" << newyshift << "\t" << xShifts[iter] << "\t" << yShifts[iter] << "\n";
+      outFile << slice << "\t" << slice + 1 << "\t" << relativeXShifts[iter] << "\t" << relativeYShifts[iter] << "\t" << xShifts[iter] << "\t" << yShifts[iter] << "\n";
     }
   }
   if(m_InputValues->writeAlignmentShifts)
@@ -28,6 +28,8 @@ struct ORIENTATIONANALYSIS_EXPORT AlignSectionsMisorientationInputValues
   DataPath cellPhasesArrayPath;
   DataPath goodVoxelsArrayPath;
   DataPath crystalStructuresArrayPath;
+  bool useCoarseToFineSearch = false;
+  int32 coarseToFineLevels = 1;
 };
 
 /**
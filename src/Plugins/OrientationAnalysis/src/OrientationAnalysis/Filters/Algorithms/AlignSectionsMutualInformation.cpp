@@ -5,6 +5,7 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
@@ -13,6 +14,318 @@
 
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief Segments each slice into 2D features by flood filling across neighboring cells whose
+ * misorientation is below the tolerance. Every slice owns its own range of feature ids.
+ */
+class FormFeatureSectionsImpl
+{
+public:
+  FormFeatureSectionsImpl(const AlignSectionsMutualInformationInputValues* inputValues, const int64* dims, const Float32Array& quats, const Int32Array& cellPhases,
+                          const UInt32Array& crystalStructures, const MaskCompare* maskCompare, std::vector<int32>& miFeatureIds, std::vector<int32>& featureCounts,
+                          const std::atomic_bool& shouldCancel)
+  : m_InputValues(inputValues)
+  , m_Dims{dims[0], dims[1], dims[2]}
+  , m_Quats(quats)
+  , m_CellPhases(cellPhases)
+  , m_CrystalStructures(crystalStructures)
+  , m_MaskCompare(maskCompare)
+  , m_MiFeatureIds(miFeatureIds)
+  , m_FeatureCounts(featureCounts)
+  , m_ShouldCancel(shouldCancel)
+  , m_OrientationOps(LaueOps::GetAllOrientationOps())
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const int64* dims = m_Dims.data();
+    size_t initialVoxelsListSize = 1000;
+
+    float misorientationTolerance = m_InputValues->MisorientationTolerance * nx::core::Constants::k_PiOver180F;
+
+    std::vector<int64_t> voxelList(initialVoxelsListSize, -1);
+    int64_t neighborPoints[4] = {-dims[0], -1, 1, dims[0]};
+
+    for(int64_t slice = static_cast<int64_t>(range.min()); slice < static_cast<int64_t>(range.max()); slice++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+
+      int64 startPoint = slice * dims[0] * dims[1];
+      int64 endPoint = (slice + 1) * dims[0] * dims[1];
+      int64 currentStartPoint = startPoint;
+
+      int32 featureCount = 1;
+      bool noSeeds = false;
+      while(!noSeeds)
+      {
+        int64 seed = -1;
+
+        for(int64 point = currentStartPoint; point < endPoint; point++)
+        {
+          if((!m_InputValues->UseMask || (m_MaskCompare != nullptr && m_MaskCompare->isTrue(point))) && m_MiFeatureIds[point] == 0 && m_CellPhases[point] > 0)
+          {
+            seed = point;
+            currentStartPoint = point;
+          }
+          if(seed > -1)
+          {
+            break;
+          }
+        }
+
+        if(seed == -1)
+        {
+          noSeeds = true;
+        }
+        if(seed >= 0)
+        {
+          usize size = 0;
+          m_MiFeatureIds[seed] = featureCount;
+          voxelList[size] = seed;
+          size++;
+          for(size_t j = 0; j < size; ++j)
+          {
+            int64_t currentpoint = voxelList[j];
+            int64 col = currentpoint % dims[0];
+            int64 row = (currentpoint / dims[0]) % dims[1];
+
+            auto q1TupleIndex = currentpoint * 4;
+            QuatF quat1(m_Quats[q1TupleIndex], m_Quats[q1TupleIndex + 1], m_Quats[q1TupleIndex + 2], m_Quats[q1TupleIndex + 3]);
+            uint32_t phase1 = m_CrystalStructures[m_CellPhases[currentpoint]];
+            for(int32_t i = 0; i < 4; i++)
+            {
+              int64 neighbor = currentpoint + neighborPoints[i];
+              if((i == 0) && row == 0)
+              {
+                continue;
+              }
+              if((i == 3) && row == (dims[1] - 1))
+              {
+                continue;
+              }
+              if((i == 1) && col == 0)
+              {
+                continue;
+              }
+              if((i == 2) && col == (dims[0] - 1))
+              {
+                continue;
+              }
+              if(m_MiFeatureIds[neighbor] <= 0 && m_CellPhases[neighbor] > 0)
+              {
+                float32 angle = std::numeric_limits<float>::max();
+                auto q2TupleIndex = neighbor * 4;
+                QuatF quat2(m_Quats[q2TupleIndex], m_Quats[q2TupleIndex + 1], m_Quats[q2TupleIndex + 2], m_Quats[q2TupleIndex + 3]);
+                uint32_t phase2 = m_CrystalStructures[m_CellPhases[neighbor]];
+
+                if(phase1 == phase2)
+                {
+                  OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(quat1, quat2);
+                  angle = axisAngle[3];
+                }
+                if(angle < misorientationTolerance)
+                {
+                  m_MiFeatureIds[neighbor] = featureCount;
+                  voxelList[size] = neighbor;
+                  size++;
+                  if(std::vector<int64_t>::size_type(size) >= voxelList.size())
+                  {
+                    size = voxelList.size();
+                    voxelList.resize(size + initialVoxelsListSize);
+                    for(std::vector<int64_t>::size_type v = size; v < voxelList.size(); ++v)
+                    {
+                      voxelList[v] = -1;
+                    }
+                  }
+                }
+              }
+            }
+          }
+          voxelList.erase(std::remove(voxelList.begin(), voxelList.end(), -1), voxelList.end());
+          featureCount++;
+          voxelList.assign(initialVoxelsListSize, -1);
+        }
+      }
+      m_FeatureCounts[slice] = featureCount;
+    }
+  }
+
+private:
+  const AlignSectionsMutualInformationInputValues* m_InputValues = nullptr;
+  const std::array<int64, 3> m_Dims;
+  const Float32Array& m_Quats;
+  const Int32Array& m_CellPhases;
+  const UInt32Array& m_CrystalStructures;
+  const MaskCompare* m_MaskCompare = nullptr;
+  std::vector<int32>& m_MiFeatureIds;
+  std::vector<int32>& m_FeatureCounts;
+  const std::atomic_bool& m_ShouldCancel;
+  std::vector<LaueOps::Pointer> m_OrientationOps;
+};
+
+/**
+ * @brief Finds the in-plane shift between each slice and the slice above it by maximizing the
+ * mutual information of the 2D feature ids of the two slices.
+ */
+class FindSliceShiftsImpl
+{
+public:
+  FindSliceShiftsImpl(const int64* dims, const std::vector<int32>& miFeatureIds, const std::vector<int32>& featureCounts, std::vector<int64>& relativeXShifts, std::vector<int64>& relativeYShifts,
+                      const std::atomic_bool& shouldCancel)
+  : m_Dims{dims[0], dims[1], dims[2]}
+  , m_MiFeatureIds(miFeatureIds)
+  , m_FeatureCounts(featureCounts)
+  , m_RelativeXShifts(relativeXShifts)
+  , m_RelativeYShifts(relativeYShifts)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const int64* dims = m_Dims.data();
+
+    std::vector<std::vector<float32>> mutualInfo12;
+    std::vector<float32> mutualInfo1;
+    std::vector<float32> mutualInfo2;
+
+    std::vector<std::vector<float32>> misorientations(dims[0]);
+    for(int64 i = 0; i < dims[0]; i++)
+    {
+      misorientations[i].assign(dims[1], 0.0f);
+    }
+
+    for(int64 iter = static_cast<int64>(range.min()); iter < static_cast<int64>(range.max()); iter++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+
+      float32 minDisorientation = std::numeric_limits<float32>::max();
+      int64 slice = (dims[2] - 1) - iter;
+      int32 featureCount1 = m_FeatureCounts[slice];
+      int32 featureCount2 = m_FeatureCounts[slice + 1];
+      mutualInfo12 = std::vector<std::vector<float32>>(featureCount1, std::vector<float32>(featureCount2, 0.0f));
+      mutualInfo1 = std::vector<float32>(featureCount1, 0.0f);
+      mutualInfo2 = std::vector<float32>(featureCount2, 0.0f);
+
+      int64 oldXShift = -1;
+      int64 oldYShift = -1;
+      int64 newXShift = 0;
+      int64 newYShift = 0;
+      for(int64 i = 0; i < dims[0]; i++)
+      {
+        for(int64 j = 0; j < dims[1]; j++)
+        {
+          misorientations[i][j] = 0.0F;
+        }
+      }
+      while(newXShift != oldXShift || newYShift != oldYShift)
+      {
+        oldXShift = newXShift;
+        oldYShift = newYShift;
+        for(int32 j = -3; j < 4; j++)
+        {
+          for(int32 k = -3; k < 4; k++)
+          {
+            float32 disorientation = 0.0F;
+            float32 count = 0.0F;
+            if(misorientations[k + oldXShift + dims[0] / 2][j + oldYShift + dims[1] / 2] == 0 && llabs(k + oldXShift) < (dims[0] / 2) && (j + oldYShift) < (dims[1] / 2))
+            {
+              for(int64 dim1Index = 0; dim1Index < dims[1]; dim1Index = dim1Index + 4)
+              {
+                for(int64 dim0Index = 0; dim0Index < dims[0]; dim0Index = dim0Index + 4)
+                {
+                  if((dim1Index + j + oldYShift) >= 0 && (dim1Index + j + oldYShift) < dims[1] && (dim0Index + k + oldXShift) >= 0 && (dim0Index + k + oldXShift) < dims[0])
+                  {
+                    int64 refPosition = ((slice + 1) * dims[0] * dims[1]) + (dim1Index * dims[0]) + dim0Index;
+                    int64 curPosition = (slice * dims[0] * dims[1]) + ((dim1Index + j + oldYShift) * dims[0]) + (dim0Index + k + oldXShift);
+                    int32 refGNum = m_MiFeatureIds[refPosition];
+                    int32 curGNum = m_MiFeatureIds[curPosition];
+                    if(curGNum >= 0 && refGNum >= 0)
+                    {
+                      mutualInfo12[curGNum][refGNum]++;
+                      mutualInfo1[curGNum]++;
+                      mutualInfo2[refGNum]++;
+                      count++;
+                    }
+                  }
+                  else
+                  {
+                    mutualInfo12[0][0]++;
+                    mutualInfo1[0]++;
+                    mutualInfo2[0]++;
+                  }
+                }
+              }
+              for(int32 featureCount1Index = 0; featureCount1Index < featureCount1; featureCount1Index++)
+              {
+                mutualInfo1[featureCount1Index] = mutualInfo1[featureCount1Index] / count;
+              }
+              for(int32 featureCount2Index = 0; featureCount2Index < featureCount2; featureCount2Index++)
+              {
+                mutualInfo2[featureCount2Index] = mutualInfo2[featureCount2Index] / float32(count);
+              }
+              for(int32 featureCount1Index = 0; featureCount1Index < featureCount1; featureCount1Index++)
+              {
+                for(int32 featureCount2Index = 0; featureCount2Index < featureCount2; featureCount2Index++)
+                {
+                  mutualInfo12[featureCount1Index][featureCount2Index] = mutualInfo12[featureCount1Index][featureCount2Index] / count;
+
+                  float32 value = 0.0f;
+                  if(mutualInfo1[featureCount1Index] > 0 && mutualInfo2[featureCount2Index] > 0)
+                  {
+                    value = (mutualInfo12[featureCount1Index][featureCount2Index] / (mutualInfo1[featureCount1Index] * mutualInfo2[featureCount2Index]));
+                  }
+                  if(value != 0)
+                  {
+                    disorientation = disorientation + (mutualInfo12[featureCount1Index][featureCount2Index] * logf(value));
+                  }
+                }
+              }
+              for(int32 featureCount1Index = 0; featureCount1Index < featureCount1; featureCount1Index++)
+              {
+                for(int32 featureCount2Index = 0; featureCount2Index < featureCount2; featureCount2Index++)
+                {
+                  mutualInfo12[featureCount1Index][featureCount2Index] = 0.0f;
+                  mutualInfo1[featureCount1Index] = 0.0f;
+                  mutualInfo2[featureCount2Index] = 0.0f;
+                }
+              }
+              disorientation = 1.0f / disorientation;
+              misorientations[k + oldXShift + dims[0] / 2][j + oldYShift + dims[1] / 2] = disorientation;
+              if(disorientation < minDisorientation)
+              {
+                newXShift = k + oldXShift;
+                newYShift = j + oldYShift;
+                minDisorientation = disorientation;
+              }
+            }
+          }
+        }
+      }
+      m_RelativeXShifts[iter] = newXShift;
+      m_RelativeYShifts[iter] = newYShift;
+    }
+  }
+
+private:
+  const std::array<int64, 3> m_Dims;
+  const std::vector<int32>& m_MiFeatureIds;
+  const std::vector<int32>& m_FeatureCounts;
+  std::vector<int64>& m_RelativeXShifts;
+  std::vector<int64>& m_RelativeYShifts;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 AlignSectionsMutualInformation::AlignSectionsMutualInformation(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                                AlignSectionsMutualInformationInputValues* inputValues)
@@ -110,131 +423,37 @@ Result<> AlignSectionsMutualInformation::findShifts(std::vector<int64>& xShifts,
   std::vector<int32> miFeatureIds(totalPoints, 0);
   std::vector<int32> featureCounts(dims[2], 0);
 
-  std::vector<std::vector<float32>> mutualInfo12;
-  std::vector<float32> mutualInfo1;
-  std::vector<float32> mutualInfo2;
-
   // Segment each slice
   formFeaturesSections(miFeatureIds, featureCounts);
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
+
+  m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Determining Shifts for {} Slice Pairs", dims[2] - 1));
+
+  // Each slice pair is independent of every other pair, so the relative shifts are found
+  // in parallel and then accumulated in slice order below.
+  std::vector<int64> relativeXShifts(dims[2], 0);
+  std::vector<int64> relativeYShifts(dims[2], 0);
 
-  std::vector<std::vector<float32>> misorientations(dims[0]);
-  for(int64 i = 0; i < dims[0]; i++)
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, udims[2]);
+  dataAlg.execute(FindSliceShiftsImpl(dims, miFeatureIds, featureCounts, relativeXShifts, relativeYShifts, m_ShouldCancel));
+
+  if(m_ShouldCancel)
   {
-    misorientations[i].assign(dims[1], 0.0f);
+    return {};
   }
 
   for(int64 iter = 1; iter < dims[2]; iter++)
   {
-    m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Determining Shifts: Slice {}/{} complete", iter, dims[2]));
-
-    float32 minDisorientation = std::numeric_limits<float32>::max();
     int64 slice = (dims[2] - 1) - iter;
-    int32 featureCount1 = featureCounts[slice];
-    int32 featureCount2 = featureCounts[slice + 1];
-    mutualInfo12 = std::vector<std::vector<float32>>(featureCount1, std::vector<float32>(featureCount2, 0.0f));
-    mutualInfo1 = std::vector<float32>(featureCount1, 0.0f);
-    mutualInfo2 = std::vector<float32>(featureCount2, 0.0f);
-
-    int64 oldXShift = -1;
-    int64 oldYShift = -1;
-    int64 newXShift = 0;
-    int64 newYShift = 0;
-    for(int64 i = 0; i < dims[0]; i++)
-    {
-      for(int64 j = 0; j < dims[1]; j++)
-      {
-        misorientations[i][j] = 0.0F;
-      }
-    }
-    while(newXShift != oldXShift || newYShift != oldYShift)
-    {
-      oldXShift = newXShift;
-      oldYShift = newYShift;
-      for(int32 j = -3; j < 4; j++)
-      {
-        for(int32 k = -3; k < 4; k++)
-        {
-          float32 disorientation = 0.0F;
-          float32 count = 0.0F;
-          if(misorientations[k + oldXShift + dims[0] / 2][j + oldYShift + dims[1] / 2] == 0 && llabs(k + oldXShift) < (dims[0] / 2) && (j + oldYShift) < (dims[1] / 2))
-          {
-            for(int64 dim1Index = 0; dim1Index < dims[1]; dim1Index = dim1Index + 4)
-            {
-              for(int64 dim0Index = 0; dim0Index < dims[0]; dim0Index = dim0Index + 4)
-              {
-                if((dim1Index + j + oldYShift) >= 0 && (dim1Index + j + oldYShift) < dims[1] && (dim0Index + k + oldXShift) >= 0 && (dim0Index + k + oldXShift) < dims[0])
-                {
-                  int64 refPosition = ((slice + 1) * dims[0] * dims[1]) + (dim1Index * dims[0]) + dim0Index;
-                  int64 curPosition = (slice * dims[0] * dims[1]) + ((dim1Index + j + oldYShift) * dims[0]) + (dim0Index + k + oldXShift);
-                  int32 refGNum = miFeatureIds[refPosition];
-                  int32 curGNum = miFeatureIds[curPosition];
-                  if(curGNum >= 0 && refGNum >= 0)
-                  {
-                    mutualInfo12[curGNum][refGNum]++;
-                    mutualInfo1[curGNum]++;
-                    mutualInfo2[refGNum]++;
-                    count++;
-                  }
-                }
-                else
-                {
-                  mutualInfo12[0][0]++;
-                  mutualInfo1[0]++;
-                  mutualInfo2[0]++;
-                }
-              }
-            }
-            for(int32 featureCount1Index = 0; featureCount1Index < featureCount1; featureCount1Index++)
-            {
-              mutualInfo1[featureCount1Index] = mutualInfo1[featureCount1Index] / count;
-            }
-            for(int32 featureCount2Index = 0; featureCount2Index < featureCount2; featureCount2Index++)
-            {
-              mutualInfo2[featureCount2Index] = mutualInfo2[featureCount2Index] / float32(count);
-            }
-            for(int32 featureCount1Index = 0; featureCount1Index < featureCount1; featureCount1Index++)
-            {
-              for(int32 featureCount2Index = 0; featureCount2Index < featureCount2; featureCount2Index++)
-              {
-                mutualInfo12[featureCount1Index][featureCount2Index] = mutualInfo12[featureCount1Index][featureCount2Index] / count;
-
-                float32 value = 0.0f;
-                if(mutualInfo1[featureCount1Index] > 0 && mutualInfo2[featureCount2Index] > 0)
-                {
-                  value = (mutualInfo12[featureCount1Index][featureCount2Index] / (mutualInfo1[featureCount1Index] * mutualInfo2[featureCount2Index]));
-                }
-                if(value != 0)
-                {
-                  disorientation = disorientation + (mutualInfo12[featureCount1Index][featureCount2Index] * logf(value));
-                }
-              }
-            }
-            for(int32 featureCount1Index = 0; featureCount1Index < featureCount1; featureCount1Index++)
-            {
-              for(int32 featureCount2Index = 0; featureCount2Index < featureCount2; featureCount2Index++)
-              {
-                mutualInfo12[featureCount1Index][featureCount2Index] = 0.0f;
-                mutualInfo1[featureCount1Index] = 0.0f;
-                mutualInfo2[featureCount2Index] = 0.0f;
-              }
-            }
-            disorientation = 1.0f / disorientation;
-            misorientations[k + oldXShift + dims[0] / 2][j + oldYShift + dims[1] / 2] = disorientation;
-            if(disorientation < minDisorientation)
-            {
-              newXShift = k + oldXShift;
-              newYShift = j + oldYShift;
-              minDisorientation = disorientation;
-            }
-          }
-        }
-      }
-    }
-    xShifts[iter] = xShifts[iter - 1] + newXShift;
-    yShifts[iter] = yShifts[iter - 1] + newYShift;
+    xShifts[iter] = xShifts[iter - 1] + relativeXShifts[iter];
+    yShifts[iter] = yShifts[iter - 1] + relativeYShifts[iter];
     if(m_InputValues->WriteAlignmentShifts)
     {
-      outFile << slice << "\t" << slice + 1 << "\t" << newXShift << "\t" << newYShift << "\t" << xShifts[iter] << "\t" << yShifts[iter] << "\n";
+      outFile << slice << "\t" << slice + 1 << "\t" << relativeXShifts[iter] << "\t" << relativeYShifts[iter] << "\t" << xShifts[iter] << "\t" << yShifts[iter] << "\n";
     }
   }
 
@@ -258,121 +477,26 @@ void AlignSectionsMutualInformation::formFeaturesSections(std::vector<int32>& mi
       static_cast<int64>(udims[2]),
   };
 
-  auto orientationOps = LaueOps::GetAllOrientationOps();
-
-  auto& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath);
-  auto& m_CellPhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath);
-  auto& m_CrystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
-
-  size_t initialVoxelsListSize = 1000;
-
-  float misorientationTolerance = m_InputValues->MisorientationTolerance * nx::core::Constants::k_PiOver180F;
+  const auto& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath);
+  const auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath);
+  const auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
 
   featureCounts.resize(dims[2]);
 
-  std::vector<int64_t> voxelList(initialVoxelsListSize, -1);
-  int64_t neighborPoints[4] = {-dims[0], -1, 1, dims[0]};
+  m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Identifying Features in {} Slices", dims[2]));
 
-  for(int64_t slice = 0; slice < dims[2]; slice++)
+  ParallelDataAlgorithm::AlgorithmArrays algArrays;
+  algArrays.push_back(&quats);
+  algArrays.push_back(&cellPhases);
+  algArrays.push_back(&crystalStructures);
+  if(m_InputValues->UseMask)
   {
-    m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Identifying Features: Slice {}/{} complete", slice, dims[2]));
-
-    int64 startPoint = slice * dims[0] * dims[1];
-    int64 endPoint = (slice + 1) * dims[0] * dims[1];
-    int64 currentStartPoint = startPoint;
-
-    int32 featureCount = 1;
-    bool noSeeds = false;
-    while(!noSeeds)
-    {
-      int64 seed = -1;
-
-      for(int64 point = currentStartPoint; point < endPoint; point++)
-      {
-        if((!m_InputValues->UseMask || (m_MaskCompare != nullptr && m_MaskCompare->isTrue(point))) && miFeatureIds[point] == 0 && m_CellPhases[point] > 0)
-        {
-          seed = point;
-          currentStartPoint = point;
-        }
-        if(seed > -1)
-        {
-          break;
-        }
-      }
-
-      if(seed == -1)
-      {
-        noSeeds = true;
-      }
-      if(seed >= 0)
-      {
-        usize size = 0;
-        miFeatureIds[seed] = featureCount;
-        voxelList[size] = seed;
-        size++;
-        for(size_t j = 0; j < size; ++j)
-        {
-          int64_t currentpoint = voxelList[j];
-          int64 col = currentpoint % dims[0];
-          int64 row = (currentpoint / dims[0]) % dims[1];
-
-          auto q1TupleIndex = currentpoint * 4;
-          QuatF quat1(quats[q1TupleIndex], quats[q1TupleIndex + 1], quats[q1TupleIndex + 2], quats[q1TupleIndex + 3]);
-          uint32_t phase1 = m_CrystalStructures[m_CellPhases[currentpoint]];
-          for(int32_t i = 0; i < 4; i++)
-          {
-            int64 neighbor = currentpoint + neighborPoints[i];
-            if((i == 0) && row == 0)
-            {
-              continue;
-            }
-            if((i == 3) && row == (dims[1] - 1))
-            {
-              continue;
-            }
-            if((i == 1) && col == 0)
-            {
-              continue;
-            }
-            if((i == 2) && col == (dims[0] - 1))
-            {
-              continue;
-            }
-            if(miFeatureIds[neighbor] <= 0 && m_CellPhases[neighbor] > 0)
-            {
-              float32 angle = std::numeric_limits<float>::max();
-              auto q2TupleIndex = neighbor * 4;
-              QuatF quat2(quats[q2TupleIndex], quats[q2TupleIndex + 1], quats[q2TupleIndex + 2], quats[q2TupleIndex + 3]);
-              uint32_t phase2 = m_CrystalStructures[m_CellPhases[neighbor]];
-
-              if(phase1 == phase2)
-              {
-                OrientationF axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-                angle = axisAngle[3];
-              }
-              if(angle < misorientationTolerance)
-              {
-                miFeatureIds[neighbor] = featureCount;
-                voxelList[size] = neighbor;
-                size++;
-                if(std::vector<int64_t>::size_type(size) >= voxelList.size())
-                {
-                  size = voxelList.size();
-                  voxelList.resize(size + initialVoxelsListSize);
-                  for(std::vector<int64_t>::size_type v = size; v < voxelList.size(); ++v)
-                  {
-                    voxelList[v] = -1;
-                  }
-                }
-              }
-            }
-          }
-        }
-        voxelList.erase(std::remove(voxelList.begin(), voxelList.end(), -1), voxelList.end());
-        featureCount++;
-        voxelList.assign(initialVoxelsListSize, -1);
-      }
-    }
-    featureCounts[slice] = featureCount;
+    algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath));
   }
+
+  // Features never cross a slice boundary so every slice can be segmented independently
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, udims[2]);
+  dataAlg.requireArraysInMemory(algArrays);
+  dataAlg.execute(FormFeatureSectionsImpl(m_InputValues, dims, quats, cellPhases, crystalStructures, m_MaskCompare.get(), miFeatureIds, featureCounts, m_ShouldCancel));
 }
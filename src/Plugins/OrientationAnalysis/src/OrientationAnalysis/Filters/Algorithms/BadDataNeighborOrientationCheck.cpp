@@ -6,11 +6,177 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 
-#include "EbsdLib/Core/Orientation.hpp"
-#include "EbsdLib/LaueOps/LaueOps.h"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include "OrientationAnalysis/utilities/MisorientationCalculator.hpp"
 
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief Returns true if the face neighbor 'j' (0 = -Z, 1 = -Y, 2 = -X, 3 = +X, 4 = +Y, 5 = +Z) of the voxel exists
+ */
+inline bool IsValidFaceNeighbor(usize j, int64 column, int64 row, int64 plane, const int64* dims)
+{
+  switch(j)
+  {
+  case 0:
+    return plane != 0;
+  case 1:
+    return row != 0;
+  case 2:
+    return column != 0;
+  case 3:
+    return column != (dims[0] - 1);
+  case 4:
+    return row != (dims[1] - 1);
+  case 5:
+    return plane != (dims[2] - 1);
+  default:
+    return false;
+  }
+}
+
+/**
+ * @brief Decides if two voxels have a similar orientation. Voxels of different phases, or of phase 0, never do.
+ */
+class NeighborMisorientationCheck
+{
+public:
+  NeighborMisorientationCheck(const Int32Array& cellPhases, const Float32Array& quats, const UInt32Array& crystalStructures, const MisorientationCalculator& misorientationCalculator,
+                              float64 cosHalfTolerance)
+  : m_CellPhases(cellPhases)
+  , m_Quats(quats)
+  , m_CrystalStructures(crystalStructures)
+  , m_MisorientationCalculator(misorientationCalculator)
+  , m_CosHalfTolerance(cosHalfTolerance)
+  {
+  }
+
+  bool operator()(int64 voxel1, int64 voxel2) const
+  {
+    if(m_CellPhases[voxel1] != m_CellPhases[voxel2] || m_CellPhases[voxel1] <= 0)
+    {
+      return false;
+    }
+    const uint32 phase1 = m_CrystalStructures[m_CellPhases[voxel1]];
+    const QuatF quat1(m_Quats[voxel1 * 4], m_Quats[voxel1 * 4 + 1], m_Quats[voxel1 * 4 + 2], m_Quats[voxel1 * 4 + 3]);
+    const QuatF quat2(m_Quats[voxel2 * 4], m_Quats[voxel2 * 4 + 1], m_Quats[voxel2 * 4 + 2], m_Quats[voxel2 * 4 + 3]);
+    return m_MisorientationCalculator.isWithinTolerance(phase1, quat1, quat2, m_CosHalfTolerance);
+  }
+
+private:
+  const Int32Array& m_CellPhases;
+  const Float32Array& m_Quats;
+  const UInt32Array& m_CrystalStructures;
+  const MisorientationCalculator& m_MisorientationCalculator;
+  const float64 m_CosHalfTolerance;
+};
+
+/**
+ * @brief Counts the good face neighbors of each bad voxel that have a similar orientation
+ */
+class CountGoodNeighborsImpl
+{
+public:
+  CountGoodNeighborsImpl(const int64* dims, const MaskCompare& maskCompare, const NeighborMisorientationCheck& misorientationCheck, std::vector<int32>& neighborCount,
+                         const std::atomic_bool& shouldCancel)
+  : m_Dims{dims[0], dims[1], dims[2]}
+  , m_MaskCompare(maskCompare)
+  , m_MisorientationCheck(misorientationCheck)
+  , m_NeighborCount(neighborCount)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const int64* dims = m_Dims.data();
+    const int64 neighpoints[6] = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      if(m_MaskCompare.isTrue(i))
+      {
+        continue;
+      }
+      const auto voxel = static_cast<int64>(i);
+      const int64 column = voxel % dims[0];
+      const int64 row = (voxel / dims[0]) % dims[1];
+      const int64 plane = voxel / (dims[0] * dims[1]);
+      for(usize j = 0; j < 6; j++)
+      {
+        const int64 neighbor = voxel + neighpoints[j];
+        if(IsValidFaceNeighbor(j, column, row, plane, dims) && m_MaskCompare.isTrue(neighbor) && m_MisorientationCheck(voxel, neighbor))
+        {
+          m_NeighborCount[i]++;
+        }
+      }
+    }
+  }
+
+private:
+  const std::array<int64, 3> m_Dims;
+  const MaskCompare& m_MaskCompare;
+  const NeighborMisorientationCheck& m_MisorientationCheck;
+  std::vector<int32>& m_NeighborCount;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Adds the face neighbors that were flipped to good in the current round, and that have a similar
+ * orientation, to the neighbor count of each candidate voxel. Every candidate is unique so each count is
+ * only written by one thread.
+ */
+class CountFlippedNeighborsImpl
+{
+public:
+  CountFlippedNeighborsImpl(const int64* dims, const std::vector<int64>& candidates, const std::vector<int32>& flipStamp, int32 round, const NeighborMisorientationCheck& misorientationCheck,
+                            std::vector<int32>& neighborCount)
+  : m_Dims{dims[0], dims[1], dims[2]}
+  , m_Candidates(candidates)
+  , m_FlipStamp(flipStamp)
+  , m_Round(round)
+  , m_MisorientationCheck(misorientationCheck)
+  , m_NeighborCount(neighborCount)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const int64* dims = m_Dims.data();
+    const int64 neighpoints[6] = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+    for(usize n = range.min(); n < range.max(); n++)
+    {
+      const int64 voxel = m_Candidates[n];
+      const int64 column = voxel % dims[0];
+      const int64 row = (voxel / dims[0]) % dims[1];
+      const int64 plane = voxel / (dims[0] * dims[1]);
+      for(usize j = 0; j < 6; j++)
+      {
+        const int64 neighbor = voxel + neighpoints[j];
+        if(IsValidFaceNeighbor(j, column, row, plane, dims) && m_FlipStamp[neighbor] == m_Round && m_MisorientationCheck(neighbor, voxel))
+        {
+          m_NeighborCount[voxel]++;
+        }
+      }
+    }
+  }
+
+private:
+  const std::array<int64, 3> m_Dims;
+  const std::vector<int64>& m_Candidates;
+  const std::vector<int32>& m_FlipStamp;
+  const int32 m_Round;
+  const NeighborMisorientationCheck& m_MisorientationCheck;
+  std::vector<int32>& m_NeighborCount;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 BadDataNeighborOrientationCheck::BadDataNeighborOrientationCheck(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                                  BadDataNeighborOrientationCheckInputValues* inputValues)
@@ -34,6 +200,7 @@ const std::atomic_bool& BadDataNeighborOrientationCheck::getCancel()
 Result<> BadDataNeighborOrientationCheck::operator()()
 {
   float misorientationTolerance = m_InputValues->MisorientationTolerance * numbers::pi_v<float> / 180.0f;
+  const float64 cosHalfTolerance = MisorientationCalculator::ToleranceToCosHalfAngle(misorientationTolerance);
 
   auto* imageGeomPtr = m_DataStructure.getDataAs<ImageGeom>(m_InputValues->ImageGeomPath);
   SizeVec3 udims = imageGeomPtr->getDimensions();
@@ -60,173 +227,110 @@ Result<> BadDataNeighborOrientationCheck::operator()()
       static_cast<int64_t>(udims[2]),
   };
 
-  int32_t good = 1;
-  int64_t neighbor = 0;
-  int64_t column = 0, row = 0, plane = 0;
+  const int64 neighpoints[6] = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
 
-  int64_t neighpoints[6] = {0, 0, 0, 0, 0, 0};
-  neighpoints[0] = static_cast<int64_t>(-dims[0] * dims[1]);
-  neighpoints[1] = static_cast<int64_t>(-dims[0]);
-  neighpoints[2] = static_cast<int64_t>(-1);
-  neighpoints[3] = static_cast<int64_t>(1);
-  neighpoints[4] = static_cast<int64_t>(dims[0]);
-  neighpoints[5] = static_cast<int64_t>(dims[0] * dims[1]);
+  MisorientationCalculator misorientationCalculator;
+  const NeighborMisorientationCheck misorientationCheck(cellPhases, quats, crystalStructures, misorientationCalculator, cosHalfTolerance);
 
-  float w = 10000.0f;
+  ParallelDataAlgorithm::AlgorithmArrays algArrays;
+  algArrays.push_back(&cellPhases);
+  algArrays.push_back(&quats);
+  algArrays.push_back(&crystalStructures);
+  algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath));
 
-  uint32_t phase1 = 0;
+  // Count the good face neighbors of every bad voxel that have a similar orientation
+  std::vector<int32_t> neighborCount(totalPoints, 0);
+  m_MessageHandler({IFilter::Message::Type::Info, "Counting similar neighbors of bad voxels"});
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalPoints);
+    dataAlg.requireArraysInMemory(algArrays);
+    dataAlg.execute(CountGoodNeighborsImpl(dims, *maskCompare, misorientationCheck, neighborCount, m_ShouldCancel));
+  }
+  if(getCancel())
+  {
+    return {};
+  }
 
-  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  std::vector<int64> badVoxels;
+  for(usize i = 0; i < totalPoints; i++)
+  {
+    if(!maskCompare->isTrue(i))
+    {
+      badVoxels.push_back(static_cast<int64>(i));
+    }
+  }
 
-  std::vector<int32_t> neighborCount(totalPoints, 0);
+  // Each level flips bad voxels to good until no bad voxel has enough similar good neighbors. Flipping
+  // only ever adds to the neighbor counts, so rather than sweeping the whole volume until nothing
+  // changes, only the bad neighbors of the voxels flipped in the last round are re-examined.
+  std::vector<int32> flipStamp(totalPoints, -1);
+  std::vector<int32> candidateStamp(totalPoints, -1);
+  std::vector<int64> frontier;
+  std::vector<int64> candidates;
+  int32 round = 0;
 
-  int64_t progressInt = 0;
-  auto start = std::chrono::steady_clock::now();
-  for(size_t i = 0; i < totalPoints; i++)
+  const int32_t startLevel = 6;
+  for(int32_t currentLevel = startLevel; currentLevel > m_InputValues->NumberOfNeighbors; currentLevel--)
   {
-    auto now = std::chrono::steady_clock::now();
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Level '{}' of '{}' || Processing {} bad voxels", (startLevel - currentLevel) + 1, startLevel - m_InputValues->NumberOfNeighbors,
+                                                                badVoxels.size())});
+
+    frontier.clear();
+    for(int64 voxel : badVoxels)
     {
-      progressInt = static_cast<int64_t>((static_cast<float>(i) / totalPoints) * 100.0f);
-      std::string ss = fmt::format("Processing Data '{}'% completed", progressInt);
-      m_MessageHandler({IFilter::Message::Type::Info, ss});
-      start = std::chrono::steady_clock::now();
+      if(neighborCount[voxel] >= currentLevel)
+      {
+        frontier.push_back(voxel);
+      }
     }
 
-    if(!maskCompare->isTrue(i))
+    while(!frontier.empty())
     {
-      column = i % dims[0];
-      row = (i / dims[0]) % dims[1];
-      plane = i / (dims[0] * dims[1]);
-      for(int32_t j = 0; j < 6; j++)
+      if(getCancel())
       {
-        good = 1;
-        neighbor = i + neighpoints[j];
-        if(j == 0 && plane == 0)
-        {
-          good = 0;
-        }
-        if(j == 5 && plane == (dims[2] - 1))
-        {
-          good = 0;
-        }
-        if(j == 1 && row == 0)
-        {
-          good = 0;
-        }
-        if(j == 4 && row == (dims[1] - 1))
-        {
-          good = 0;
-        }
-        if(j == 2 && column == 0)
-        {
-          good = 0;
-        }
-        if(j == 3 && column == (dims[0] - 1))
-        {
-          good = 0;
-        }
-        if(good == 1 && maskCompare->isTrue(neighbor))
-        {
-          phase1 = crystalStructures[cellPhases[i]];
-          QuatF quat1(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-          QuatF quat2(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
+        return {};
+      }
+      round++;
+      for(int64 voxel : frontier)
+      {
+        maskCompare->setValue(voxel, true);
+        flipStamp[voxel] = round;
+      }
 
-          if(cellPhases[i] == cellPhases[neighbor] && cellPhases[i] > 0)
-          {
-            OrientationD axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-            w = axisAngle[3];
-          }
-          if(w < misorientationTolerance)
+      candidates.clear();
+      for(int64 voxel : frontier)
+      {
+        const int64 column = voxel % dims[0];
+        const int64 row = (voxel / dims[0]) % dims[1];
+        const int64 plane = voxel / (dims[0] * dims[1]);
+        for(usize j = 0; j < 6; j++)
+        {
+          const int64 neighbor = voxel + neighpoints[j];
+          if(IsValidFaceNeighbor(j, column, row, plane, dims) && !maskCompare->isTrue(neighbor) && candidateStamp[neighbor] != round)
           {
-            neighborCount[i]++;
+            candidateStamp[neighbor] = round;
+            candidates.push_back(neighbor);
           }
         }
       }
-    }
-  }
 
-  const int32_t startLevel = 6;
-  int32_t currentLevel = startLevel;
-  int32_t counter = 0;
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, candidates.size());
+      dataAlg.requireArraysInMemory(algArrays);
+      dataAlg.execute(CountFlippedNeighborsImpl(dims, candidates, flipStamp, round, misorientationCheck, neighborCount));
 
-  while(currentLevel > m_InputValues->NumberOfNeighbors)
-  {
-    counter = 1;
-    int32_t loopNumber = 0;
-    while(counter > 0)
-    {
-      counter = 0;
-      progressInt = 0;
-      start = std::chrono::steady_clock::now();
-      for(size_t i = 0; i < totalPoints; i++)
+      frontier.clear();
+      for(int64 voxel : candidates)
       {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+        if(neighborCount[voxel] >= currentLevel)
         {
-          progressInt = static_cast<int64_t>((static_cast<float>(i) / totalPoints) * 100.0f);
-          std::string ss =
-              fmt::format("Level '{}' of '{}' || Processing Data ('{}') '{}'% completed", (startLevel - currentLevel) + 1, startLevel - m_InputValues->NumberOfNeighbors, loopNumber, progressInt);
-          m_MessageHandler({IFilter::Message::Type::Info, ss});
-          start = std::chrono::steady_clock::now();
-        }
-
-        if(neighborCount[i] >= currentLevel && !maskCompare->isTrue(i))
-        {
-          maskCompare->setValue(i, true);
-          counter++;
-          column = i % dims[0];
-          row = (i / dims[0]) % dims[1];
-          plane = i / (dims[0] * dims[1]);
-          for(int64_t j = 0; j < 6; j++)
-          {
-            good = 1;
-            neighbor = i + neighpoints[j];
-            if(j == 0 && plane == 0)
-            {
-              good = 0;
-            }
-            if(j == 5 && plane == (dims[2] - 1))
-            {
-              good = 0;
-            }
-            if(j == 1 && row == 0)
-            {
-              good = 0;
-            }
-            if(j == 4 && row == (dims[1] - 1))
-            {
-              good = 0;
-            }
-            if(j == 2 && column == 0)
-            {
-              good = 0;
-            }
-            if(j == 3 && column == (dims[0] - 1))
-            {
-              good = 0;
-            }
-            if(good == 1 && !maskCompare->isTrue(neighbor))
-            {
-              QuatF quat1(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-              QuatF quat2(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
-
-              if(cellPhases[i] == cellPhases[neighbor] && cellPhases[i] > 0)
-              {
-                OrientationD axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-                w = axisAngle[3];
-              }
-              if(w < misorientationTolerance)
-              {
-                neighborCount[neighbor]++;
-              }
-            }
-          }
+          frontier.push_back(voxel);
         }
       }
-      ++loopNumber;
     }
-    currentLevel = currentLevel - 1;
+
+    badVoxels.erase(std::remove_if(badVoxels.begin(), badVoxels.end(), [&maskCompare](int64 voxel) { return maskCompare->isTrue(voxel); }), badVoxels.end());
   }
 
   return {};
@@ -6,7 +6,7 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/ParallelData3DAlgorithm.hpp"
 
-#include "EbsdLib/LaueOps/LaueOps.h"
+#include "OrientationAnalysis/utilities/MisorientationCalculator.hpp"
 
 #include <chrono>
 
@@ -43,13 +43,15 @@ public:
     auto& kernelAvgMisorientationsArray = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->KernelAverageMisorientationsArrayName);
     auto& kernelAvgMisorientations = kernelAvgMisorientationsArray.getDataStoreRef();
 
-    std::vector<LaueOps::Pointer> m_OrientationOps = LaueOps::GetAllOrientationOps();
-
     auto* gridGeom = m_DataStructure.getDataAs<ImageGeom>(m_InputValues->InputImageGeometry);
     SizeVec3 udims = gridGeom->getDimensions();
 
-    QuatD q1;
-    QuatD q2;
+    QuatF q1;
+
+    // The neighbors of each kernel are gathered first and then evaluated as one batch
+    std::vector<QuatF> kernelQuats;
+    kernelQuats.reserve(static_cast<usize>(2 * kernelSize[0] + 1) * static_cast<usize>(2 * kernelSize[1] + 1) * static_cast<usize>(2 * kernelSize[2] + 1));
+    std::vector<float32> kernelAngles(kernelQuats.capacity(), 0.0f);
 
     // messenger values
     usize counter = 0;
@@ -86,6 +88,7 @@ public:
           {
             float totalMisorientation = 0.0f;
             int32 numVoxel = 0;
+            kernelQuats.clear();
 
             size_t quatIndex = point * 4;
             q1[0] = quats[quatIndex];
@@ -118,17 +121,17 @@ public:
                   if(featureIds[point] == featureIds[neighbor])
                   {
                     quatIndex = neighbor * 4;
-                    q2[0] = quats[quatIndex];
-                    q2[1] = quats[quatIndex + 1];
-                    q2[2] = quats[quatIndex + 2];
-                    q2[3] = quats[quatIndex + 3];
-                    OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-                    totalMisorientation = totalMisorientation + (axisAngle[3] * nx::core::Constants::k_180OverPiD);
-                    numVoxel++;
+                    kernelQuats.emplace_back(quats[quatIndex], quats[quatIndex + 1], quats[quatIndex + 2], quats[quatIndex + 3]);
                   }
                 }
               }
             }
+            m_MisorientationCalculator.calculateAngles(phase1, q1, kernelQuats.data(), kernelQuats.size(), kernelAngles.data());
+            for(usize n = 0; n < kernelQuats.size(); n++)
+            {
+              totalMisorientation = totalMisorientation + (kernelAngles[n] * nx::core::Constants::k_180OverPiD);
+              numVoxel++;
+            }
             kernelAvgMisorientations[point] = totalMisorientation / static_cast<float>(numVoxel);
             if(numVoxel == 0)
             {
@@ -157,6 +160,7 @@ private:
   DataStructure& m_DataStructure;
   const ComputeKernelAvgMisorientationsInputValues* m_InputValues = nullptr;
   const std::atomic_bool& m_ShouldCancel;
+  MisorientationCalculator m_MisorientationCalculator;
 };
 
 } // namespace
@@ -5,6 +5,7 @@
 #include "simplnx/Common/Numbers.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/FeatureReductionUtilities.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/Eigenvalues>
@@ -89,6 +90,22 @@ std::array<size_t, 3> TripletSort(T a, T b, T c, bool lowToHigh)
   return idx;
 }
 
+struct MomentAccumulator
+{
+  // Compensated sums so that large features do not lose the small per voxel contributions
+  std::array<FeatureReduction::KahanSum, 6> moments = {};
+  size_t volume = 0;
+};
+
+void MergeMoments(MomentAccumulator& target, const MomentAccumulator& source)
+{
+  for(size_t i = 0; i < 6; i++)
+  {
+    target.moments[i].merge(source.moments[i]);
+  }
+  target.volume += source.volume;
+}
+
 } // namespace
 using namespace nx::core;
 
@@ -169,7 +186,6 @@ void ComputeShapes::find_moments()
   float u110 = 0.0f;
   float u011 = 0.0f;
   float u101 = 0.0f;
-  float xx = 0.0f, yy = 0.0f, zz = 0.0f, xy = 0.0f, xz = 0.0f, yz = 0.0f;
 
   size_t xPoints = imageGeom.getNumXCells();
   size_t yPoints = imageGeom.getNumYCells();
@@ -185,79 +201,106 @@ void ComputeShapes::find_moments()
 
   size_t numfeatures = centroids.getNumberOfTuples();
 
-  float x = 0.0f, y = 0.0f, z = 0.0f, x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f, z1 = 0.0f, z2 = 0.0f;
-  float xdist1 = 0.0f, xdist2 = 0.0f, xdist3 = 0.0f, xdist4 = 0.0f, xdist5 = 0.0f, xdist6 = 0.0f, xdist7 = 0.0f, xdist8 = 0.0f;
-  float ydist1 = 0.0f, ydist2 = 0.0f, ydist3 = 0.0f, ydist4 = 0.0f, ydist5 = 0.0f, ydist6 = 0.0f, ydist7 = 0.0f, ydist8 = 0.0f;
-  float zdist1 = 0.0f, zdist2 = 0.0f, zdist3 = 0.0f, zdist4 = 0.0f, zdist5 = 0.0f, zdist6 = 0.0f, zdist7 = 0.0f, zdist8 = 0.0f;
-  size_t zStride = 0, yStride = 0;
-  for(size_t i = 0; i < zPoints; i++)
+  const usize xyPoints = xPoints * yPoints;
+  const auto& featureIdsStore = featureIds.getDataStoreRef();
+  const auto& centroidsStore = centroids.getDataStoreRef();
+
+  // Accumulate the second moments and voxel counts of every feature in one parallel pass
+  std::vector<MomentAccumulator> accumulators = FeatureReduction::ReduceByFeature(
+      xyPoints * zPoints, numfeatures, MomentAccumulator{},
+      [&](MomentAccumulator* featureMoments, usize voxelBegin, usize voxelEnd) {
+        float x = 0.0f, y = 0.0f, z = 0.0f, x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f, z1 = 0.0f, z2 = 0.0f;
+        float xdist1 = 0.0f, xdist2 = 0.0f, xdist3 = 0.0f, xdist4 = 0.0f, xdist5 = 0.0f, xdist6 = 0.0f, xdist7 = 0.0f, xdist8 = 0.0f;
+        float ydist1 = 0.0f, ydist2 = 0.0f, ydist3 = 0.0f, ydist4 = 0.0f, ydist5 = 0.0f, ydist6 = 0.0f, ydist7 = 0.0f, ydist8 = 0.0f;
+        float zdist1 = 0.0f, zdist2 = 0.0f, zdist3 = 0.0f, zdist4 = 0.0f, zdist5 = 0.0f, zdist6 = 0.0f, zdist7 = 0.0f, zdist8 = 0.0f;
+        float xx = 0.0f, yy = 0.0f, zz = 0.0f, xy = 0.0f, xz = 0.0f, yz = 0.0f;
+        usize k = voxelBegin % xPoints;
+        usize j = (voxelBegin / xPoints) % yPoints;
+        usize i = voxelBegin / xyPoints;
+        for(usize voxelIndex = voxelBegin; voxelIndex < voxelEnd; voxelIndex++)
+        {
+          const int32 gnum = featureIdsStore[voxelIndex];
+          if(gnum >= 0 && static_cast<usize>(gnum) < numfeatures)
+          {
+            x = float(k * modXRes) + (origin[0] * static_cast<float>(m_ScaleFactor));
+            y = float(j * modYRes) + (origin[1] * static_cast<float>(m_ScaleFactor));
+            z = float(i * modZRes) + (origin[2] * static_cast<float>(m_ScaleFactor));
+            x1 = x + (modXRes / 4.0f);
+            x2 = x - (modXRes / 4.0f);
+            y1 = y + (modYRes / 4.0f);
+            y2 = y - (modYRes / 4.0f);
+            z1 = z + (modZRes / 4.0f);
+            z2 = z - (modZRes / 4.0f);
+            xdist1 = (x1 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            ydist1 = (y1 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            zdist1 = (z1 - (centroidsStore[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
+            xdist2 = (x1 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            ydist2 = (y1 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            zdist2 = (z2 - (centroidsStore[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
+            xdist3 = (x1 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            ydist3 = (y2 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            zdist3 = (z1 - (centroidsStore[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
+            xdist4 = (x1 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            ydist4 = (y2 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            zdist4 = (z2 - (centroidsStore[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
+            xdist5 = (x2 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            ydist5 = (y1 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            zdist5 = (z1 - (centroidsStore[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
+            xdist6 = (x2 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            ydist6 = (y1 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            zdist6 = (z2 - (centroidsStore[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
+            xdist7 = (x2 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            ydist7 = (y2 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            zdist7 = (z1 - (centroidsStore[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
+            xdist8 = (x2 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            ydist8 = (y2 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            zdist8 = (z2 - (centroidsStore[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
+
+            xx = ((ydist1) * (ydist1)) + ((zdist1) * (zdist1)) + ((ydist2) * (ydist2)) + ((zdist2) * (zdist2)) + ((ydist3) * (ydist3)) + ((zdist3) * (zdist3)) + ((ydist4) * (ydist4)) +
+                 ((zdist4) * (zdist4)) + ((ydist5) * (ydist5)) + ((zdist5) * (zdist5)) + ((ydist6) * (ydist6)) + ((zdist6) * (zdist6)) + ((ydist7) * (ydist7)) + ((zdist7) * (zdist7)) +
+                 ((ydist8) * (ydist8)) + ((zdist8) * (zdist8));
+            yy = ((xdist1) * (xdist1)) + ((zdist1) * (zdist1)) + ((xdist2) * (xdist2)) + ((zdist2) * (zdist2)) + ((xdist3) * (xdist3)) + ((zdist3) * (zdist3)) + ((xdist4) * (xdist4)) +
+                 ((zdist4) * (zdist4)) + ((xdist5) * (xdist5)) + ((zdist5) * (zdist5)) + ((xdist6) * (xdist6)) + ((zdist6) * (zdist6)) + ((xdist7) * (xdist7)) + ((zdist7) * (zdist7)) +
+                 ((xdist8) * (xdist8)) + ((zdist8) * (zdist8));
+            zz = ((xdist1) * (xdist1)) + ((ydist1) * (ydist1)) + ((xdist2) * (xdist2)) + ((ydist2) * (ydist2)) + ((xdist3) * (xdist3)) + ((ydist3) * (ydist3)) + ((xdist4) * (xdist4)) +
+                 ((ydist4) * (ydist4)) + ((xdist5) * (xdist5)) + ((ydist5) * (ydist5)) + ((xdist6) * (xdist6)) + ((ydist6) * (ydist6)) + ((xdist7) * (xdist7)) + ((ydist7) * (ydist7)) +
+                 ((xdist8) * (xdist8)) + ((ydist8) * (ydist8));
+            xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4)) + ((xdist5) * (ydist5)) + ((xdist6) * (ydist6)) + ((xdist7) * (ydist7)) +
+                 ((xdist8) * (ydist8));
+            yz = ((ydist1) * (zdist1)) + ((ydist2) * (zdist2)) + ((ydist3) * (zdist3)) + ((ydist4) * (zdist4)) + ((ydist5) * (zdist5)) + ((ydist6) * (zdist6)) + ((ydist7) * (zdist7)) +
+                 ((ydist8) * (zdist8));
+            xz = ((xdist1) * (zdist1)) + ((xdist2) * (zdist2)) + ((xdist3) * (zdist3)) + ((xdist4) * (zdist4)) + ((xdist5) * (zdist5)) + ((xdist6) * (zdist6)) + ((xdist7) * (zdist7)) +
+                 ((xdist8) * (zdist8));
+
+            MomentAccumulator& accumulator = featureMoments[gnum];
+            accumulator.moments[0].add(static_cast<double>(xx));
+            accumulator.moments[1].add(static_cast<double>(yy));
+            accumulator.moments[2].add(static_cast<double>(zz));
+            accumulator.moments[3].add(static_cast<double>(xy));
+            accumulator.moments[4].add(static_cast<double>(yz));
+            accumulator.moments[5].add(static_cast<double>(xz));
+            accumulator.volume++;
+          }
+          if(++k == xPoints)
+          {
+            k = 0;
+            if(++j == yPoints)
+            {
+              j = 0;
+              i++;
+            }
+          }
+        }
+      },
+      MergeMoments, m_ShouldCancel, {&featureIds});
+
+  for(size_t featureId = 0; featureId < numfeatures; featureId++)
   {
-    zStride = i * xPoints * yPoints;
-    for(size_t j = 0; j < yPoints; j++)
+    for(usize m = 0; m < 6; m++)
     {
-      yStride = j * xPoints;
-      for(size_t k = 0; k < xPoints; k++)
-      {
-        int32_t gnum = featureIds[zStride + yStride + k];
-        x = float(k * modXRes) + (origin[0] * static_cast<float>(m_ScaleFactor));
-        y = float(j * modYRes) + (origin[1] * static_cast<float>(m_ScaleFactor));
-        z = float(i * modZRes) + (origin[2] * static_cast<float>(m_ScaleFactor));
-        x1 = x + (modXRes / 4.0f);
-        x2 = x - (modXRes / 4.0f);
-        y1 = y + (modYRes / 4.0f);
-        y2 = y - (modYRes / 4.0f);
-        z1 = z + (modZRes / 4.0f);
-        z2 = z - (modZRes / 4.0f);
-        xdist1 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist1 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist1 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist2 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist2 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist2 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist3 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist3 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist3 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist4 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist4 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist4 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist5 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist5 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist5 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist6 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist6 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist6 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist7 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist7 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist7 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist8 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist8 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist8 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-
-        xx = ((ydist1) * (ydist1)) + ((zdist1) * (zdist1)) + ((ydist2) * (ydist2)) + ((zdist2) * (zdist2)) + ((ydist3) * (ydist3)) + ((zdist3) * (zdist3)) + ((ydist4) * (ydist4)) +
-             ((zdist4) * (zdist4)) + ((ydist5) * (ydist5)) + ((zdist5) * (zdist5)) + ((ydist6) * (ydist6)) + ((zdist6) * (zdist6)) + ((ydist7) * (ydist7)) + ((zdist7) * (zdist7)) +
-             ((ydist8) * (ydist8)) + ((zdist8) * (zdist8));
-        yy = ((xdist1) * (xdist1)) + ((zdist1) * (zdist1)) + ((xdist2) * (xdist2)) + ((zdist2) * (zdist2)) + ((xdist3) * (xdist3)) + ((zdist3) * (zdist3)) + ((xdist4) * (xdist4)) +
-             ((zdist4) * (zdist4)) + ((xdist5) * (xdist5)) + ((zdist5) * (zdist5)) + ((xdist6) * (xdist6)) + ((zdist6) * (zdist6)) + ((xdist7) * (xdist7)) + ((zdist7) * (zdist7)) +
-             ((xdist8) * (xdist8)) + ((zdist8) * (zdist8));
-        zz = ((xdist1) * (xdist1)) + ((ydist1) * (ydist1)) + ((xdist2) * (xdist2)) + ((ydist2) * (ydist2)) + ((xdist3) * (xdist3)) + ((ydist3) * (ydist3)) + ((xdist4) * (xdist4)) +
-             ((ydist4) * (ydist4)) + ((xdist5) * (xdist5)) + ((ydist5) * (ydist5)) + ((xdist6) * (xdist6)) + ((ydist6) * (ydist6)) + ((xdist7) * (xdist7)) + ((ydist7) * (ydist7)) +
-             ((xdist8) * (xdist8)) + ((ydist8) * (ydist8));
-        xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4)) + ((xdist5) * (ydist5)) + ((xdist6) * (ydist6)) + ((xdist7) * (ydist7)) +
-             ((xdist8) * (ydist8));
-        yz = ((ydist1) * (zdist1)) + ((ydist2) * (zdist2)) + ((ydist3) * (zdist3)) + ((ydist4) * (zdist4)) + ((ydist5) * (zdist5)) + ((ydist6) * (zdist6)) + ((ydist7) * (zdist7)) +
-             ((ydist8) * (zdist8));
-        xz = ((xdist1) * (zdist1)) + ((xdist2) * (zdist2)) + ((xdist3) * (zdist3)) + ((xdist4) * (zdist4)) + ((xdist5) * (zdist5)) + ((xdist6) * (zdist6)) + ((xdist7) * (zdist7)) +
-             ((xdist8) * (zdist8));
-
-        m_FeatureMoments[gnum * 6 + 0] = m_FeatureMoments[gnum * 6 + 0] + static_cast<double>(xx);
-        m_FeatureMoments[gnum * 6 + 1] = m_FeatureMoments[gnum * 6 + 1] + static_cast<double>(yy);
-        m_FeatureMoments[gnum * 6 + 2] = m_FeatureMoments[gnum * 6 + 2] + static_cast<double>(zz);
-        m_FeatureMoments[gnum * 6 + 3] = m_FeatureMoments[gnum * 6 + 3] + static_cast<double>(xy);
-        m_FeatureMoments[gnum * 6 + 4] = m_FeatureMoments[gnum * 6 + 4] + static_cast<double>(yz);
-        m_FeatureMoments[gnum * 6 + 5] = m_FeatureMoments[gnum * 6 + 5] + static_cast<double>(xz);
-        volumes[gnum] = volumes[gnum] + 1.0;
-      }
+      m_FeatureMoments[featureId * 6 + m] += accumulators[featureId].moments[m].value();
     }
+    volumes[featureId] = volumes[featureId] + static_cast<float32>(accumulators[featureId].volume);
   }
   double sphere = (2000.0 * M_PI * M_PI) / 9.0;
   // constant for moments because voxels are broken into smaller voxels
@@ -349,7 +392,6 @@ void ComputeShapes::find_moments2D()
 
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeometryPath);
 
-  float xx = 0.0f, yy = 0.0f, xy = 0.0f;
   size_t numfeatures = centroids.getNumberOfTuples();
 
   size_t xPoints = 0, yPoints = 0;
@@ -384,36 +426,62 @@ void ComputeShapes::find_moments2D()
     m_FeatureMoments[featureId] = 0.0;
   }
 
-  size_t yStride = 0;
-  for(size_t yPoint = 0; yPoint < yPoints; yPoint++)
+  const auto& featureIdsStore = featureIds.getDataStoreRef();
+  const auto& centroidsStore = centroids.getDataStoreRef();
+
+  std::vector<MomentAccumulator> accumulators = FeatureReduction::ReduceByFeature(
+      xPoints * yPoints, numfeatures, MomentAccumulator{},
+      [&](MomentAccumulator* featureMoments, usize voxelBegin, usize voxelEnd) {
+        float xx = 0.0f, yy = 0.0f, xy = 0.0f;
+        usize xPoint = voxelBegin % xPoints;
+        usize yPoint = voxelBegin / xPoints;
+        for(usize voxelIndex = voxelBegin; voxelIndex < voxelEnd; voxelIndex++)
+        {
+          const int32 gnum = featureIdsStore[voxelIndex];
+          if(gnum >= 0 && static_cast<usize>(gnum) < numfeatures)
+          {
+            float x = static_cast<float>(xPoint * modXRes) + (origin[0] * static_cast<float>(m_ScaleFactor));
+            float y = static_cast<float>(yPoint * modYRes) + (origin[1] * static_cast<float>(m_ScaleFactor));
+            float x1 = x + (modXRes / 4.0f);
+            float x2 = x - (modXRes / 4.0f);
+            float y1 = y + (modYRes / 4.0f);
+            float y2 = y - (modYRes / 4.0f);
+            float xdist1 = (x1 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            float ydist1 = (y1 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            float xdist2 = (x1 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            float ydist2 = (y2 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            float xdist3 = (x2 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            float ydist3 = (y1 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            float xdist4 = (x2 - (centroidsStore[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
+            float ydist4 = (y2 - (centroidsStore[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
+            xx = ((ydist1) * (ydist1)) + ((ydist2) * (ydist2)) + ((ydist3) * (ydist3)) + ((ydist4) * (ydist4));
+            yy = ((xdist1) * (xdist1)) + ((xdist2) * (xdist2)) + ((xdist3) * (xdist3)) + ((xdist4) * (xdist4));
+            xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4));
+
+            MomentAccumulator& accumulator = featureMoments[gnum];
+            accumulator.moments[0].add(static_cast<double>(xx));
+            accumulator.moments[1].add(static_cast<double>(yy));
+            accumulator.moments[2].add(static_cast<double>(xy));
+            accumulator.volume++;
+          }
+          if(++xPoint == xPoints)
+          {
+            xPoint = 0;
+            yPoint++;
+          }
+        }
+      },
+      MergeMoments, m_ShouldCancel, {&featureIds});
+
+  for(size_t featureId = 0; featureId < numfeatures; featureId++)
   {
-    yStride = yPoint * xPoints;
-    for(size_t xPoint = 0; xPoint < xPoints; xPoint++)
+    for(usize m = 0; m < 3; m++)
     {
-      int32_t gnum = featureIds[yStride + xPoint];
-      float x = static_cast<float>(xPoint * modXRes) + (origin[0] * static_cast<float>(m_ScaleFactor));
-      float y = static_cast<float>(yPoint * modYRes) + (origin[1] * static_cast<float>(m_ScaleFactor));
-      float x1 = x + (modXRes / 4.0f);
-      float x2 = x - (modXRes / 4.0f);
-      float y1 = y + (modYRes / 4.0f);
-      float y2 = y - (modYRes / 4.0f);
-      float xdist1 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist1 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      float xdist2 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist2 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      float xdist3 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist3 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      float xdist4 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist4 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      xx = ((ydist1) * (ydist1)) + ((ydist2) * (ydist2)) + ((ydist3) * (ydist3)) + ((ydist4) * (ydist4));
-      yy = ((xdist1) * (xdist1)) + ((xdist2) * (xdist2)) + ((xdist3) * (xdist3)) + ((xdist4) * (xdist4));
-      xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4));
-      m_FeatureMoments[gnum * 6 + 0] = m_FeatureMoments[gnum * 6 + 0] + xx;
-      m_FeatureMoments[gnum * 6 + 1] = m_FeatureMoments[gnum * 6 + 1] + yy;
-      m_FeatureMoments[gnum * 6 + 2] = m_FeatureMoments[gnum * 6 + 2] + xy;
-      volumes[gnum] = volumes[gnum] + 1.0;
+      m_FeatureMoments[featureId * 6 + m] += accumulators[featureId].moments[m].value();
     }
+    volumes[featureId] = volumes[featureId] + static_cast<float32>(accumulators[featureId].volume);
   }
+
   double konst1 = static_cast<double>((modXRes / 2.0f) * (modYRes / 2.0f));
   double konst2 = static_cast<double>(spacing[0] * spacing[1]);
   for(size_t featureId = 1; featureId < numfeatures; featureId++)
@@ -13,6 +13,7 @@ EBSDSegmentFeatures::EBSDSegmentFeatures(DataStructure& dataStructure, const IFi
 , m_InputValues(inputValues)
 {
   m_OrientationOps = LaueOps::GetAllOrientationOps();
+  m_CosHalfTolerance = MisorientationCalculator::ToleranceToCosHalfAngle(m_InputValues->MisorientationTolerance);
 }
 
 // -----------------------------------------------------------------------------
@@ -134,16 +135,15 @@ bool EBSDSegmentFeatures::determineGrouping(int64 referencePoint, int64 neighbor
 
   if(featureIds[neighborPoint] == 0 && (m_GoodVoxelsArray == nullptr || neighborPointIsGood))
   {
-    float w = std::numeric_limits<float>::max();
+    bool withinTolerance = false;
     QuatF q1(currentQuatPtr[referencePoint * 4], currentQuatPtr[referencePoint * 4 + 1], currentQuatPtr[referencePoint * 4 + 2], currentQuatPtr[referencePoint * 4 + 3]);
     QuatF q2(currentQuatPtr[neighborPoint * 4 + 0], currentQuatPtr[neighborPoint * 4 + 1], currentQuatPtr[neighborPoint * 4 + 2], currentQuatPtr[neighborPoint * 4 + 3]);
 
     if((*cellPhases)[referencePoint] == (*cellPhases)[neighborPoint])
     {
-      OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-      w = axisAngle[3];
+      withinTolerance = m_MisorientationCalculator.isWithinTolerance(phase1, q1, q2, m_CosHalfTolerance);
     }
-    if(w < m_InputValues->MisorientationTolerance)
+    if(withinTolerance)
     {
       group = true;
       featureIds[neighborPoint] = gnum;
@@ -10,6 +10,8 @@
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/SegmentFeatures.hpp"
 
+#include "OrientationAnalysis/utilities/MisorientationCalculator.hpp"
+
 #include "EbsdLib/LaueOps/LaueOps.h"
 
 #include <vector>
@@ -85,6 +87,8 @@ private:
   FeatureIdsArrayType* m_FeatureIdsArray = nullptr;
 
   std::vector<LaueOps::Pointer> m_OrientationOps;
+  MisorientationCalculator m_MisorientationCalculator;
+  float64 m_CosHalfTolerance = 1.0;
 };
 
 } // namespace nx::core
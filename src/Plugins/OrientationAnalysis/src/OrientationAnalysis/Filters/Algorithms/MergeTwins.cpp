@@ -13,6 +13,12 @@
 
 using namespace nx::core;
 
+namespace
+{
+// Degrees. Only used to reject candidate twin pairs early, see MergeTwins::determineGrouping()
+constexpr float64 k_FastAngleMargin = 0.01;
+} // namespace
+
 // -----------------------------------------------------------------------------
 MergeTwins::MergeTwins(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, MergeTwinsInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -87,6 +93,13 @@ bool MergeTwins::determineGrouping(int32 referenceFeature, int32 neighborFeature
     uint32 phase2 = crystalStructures[phases[neighborFeature]];
     if(phase1 == phase2 && (phase1 == EbsdLib::CrystalStructure::Cubic_High))
     {
+      // Most neighbors are nowhere near the 60 degree twin misorientation so reject them with the angle
+      // alone before asking LaueOps for the axis. The small margin absorbs rounding differences between the two.
+      float64 fastAngle = m_MisorientationCalculator.calculateAngle(phase1, q1, q2) * (180.0 / numbers::pi);
+      if(std::fabs(fastAngle - 60.0) > m_InputValues->AngleTolerance + k_FastAngleMargin)
+      {
+        return false;
+      }
       OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
       double w = axisAngle[3];
       w *= (180.0f / numbers::pi);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "OrientationAnalysis/OrientationAnalysis_export.hpp"
+#include "OrientationAnalysis/utilities/MisorientationCalculator.hpp"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 #include "simplnx/DataStructure/DataPath.hpp"
@@ -53,6 +54,7 @@ private:
   const IFilter::MessageHandler& m_MessageHandler;
 
   std::vector<LaueOps::Pointer> m_OrientationOps;
+  MisorientationCalculator m_MisorientationCalculator;
 };
 
 } // namespace nx::core
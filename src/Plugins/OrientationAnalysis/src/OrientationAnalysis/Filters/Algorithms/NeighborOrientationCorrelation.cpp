@@ -5,28 +5,150 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
-#ifdef SIMPLNX_ENABLE_MULTICORE
-#define RUN_TASK g->run
-#else
-#define RUN_TASK
-#endif
+#include "OrientationAnalysis/utilities/MisorientationCalculator.hpp"
 
-#include "EbsdLib/LaueOps/LaueOps.h"
+#include <numeric>
 
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief Returns true if the face neighbor 'j' (0 = -Z, 1 = -Y, 2 = -X, 3 = +X, 4 = +Y, 5 = +Z) of the voxel exists
+ */
+inline bool IsValidFaceNeighbor(usize j, int64 column, int64 row, int64 plane, const int64* dims)
+{
+  switch(j)
+  {
+  case 0:
+    return plane != 0;
+  case 1:
+    return row != 0;
+  case 2:
+    return column != 0;
+  case 3:
+    return column != (dims[0] - 1);
+  case 4:
+    return row != (dims[1] - 1);
+  case 5:
+    return plane != (dims[2] - 1);
+  default:
+    return false;
+  }
+}
+
+/**
+ * @brief Finds the best neighbor of every low confidence voxel in the frontier. The best neighbor is the
+ * last face neighbor (in neighbor order) that has a similar orientation to at least one other face neighbor.
+ * Only the data arrays are read so the voxels can be evaluated in any order.
+ */
+class FindBestNeighborsImpl
+{
+public:
+  FindBestNeighborsImpl(const NeighborOrientationCorrelationInputValues* inputValues, const int64* dims, const Float32Array& confidenceIndex, const Int32Array& cellPhases, const Float32Array& quats,
+                        const UInt32Array& crystalStructures, const MisorientationCalculator& misorientationCalculator, float64 cosHalfTolerance, const std::vector<int64>& frontier,
+                        std::vector<int64>& bestNeighbor, const std::atomic_bool& shouldCancel)
+  : m_InputValues(inputValues)
+  , m_Dims{dims[0], dims[1], dims[2]}
+  , m_ConfidenceIndex(confidenceIndex)
+  , m_CellPhases(cellPhases)
+  , m_Quats(quats)
+  , m_CrystalStructures(crystalStructures)
+  , m_MisorientationCalculator(misorientationCalculator)
+  , m_CosHalfTolerance(cosHalfTolerance)
+  , m_Frontier(frontier)
+  , m_BestNeighbor(bestNeighbor)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const int64* dims = m_Dims.data();
+    const int64 neighpoints[6] = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+
+    for(usize frontierIndex = range.min(); frontierIndex < range.max(); frontierIndex++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const int64 i = m_Frontier[frontierIndex];
+      if(m_ConfidenceIndex[i] >= m_InputValues->MinConfidence)
+      {
+        continue;
+      }
+      const int64 column = i % dims[0];
+      const int64 row = (i / dims[0]) % dims[1];
+      const int64 plane = i / (dims[0] * dims[1]);
+
+      std::array<int32, 6> neighborSimCount = {0, 0, 0, 0, 0, 0};
+      for(usize j = 0; j < 6; j++)
+      {
+        if(!IsValidFaceNeighbor(j, column, row, plane, dims))
+        {
+          continue;
+        }
+        const int64 neighbor = i + neighpoints[j];
+        const QuatF quat2(m_Quats[neighbor * 4], m_Quats[neighbor * 4 + 1], m_Quats[neighbor * 4 + 2], m_Quats[neighbor * 4 + 3]);
+        for(usize k = j + 1; k < 6; k++)
+        {
+          if(!IsValidFaceNeighbor(k, column, row, plane, dims))
+          {
+            continue;
+          }
+          const int64 neighbor2 = i + neighpoints[k];
+          if(m_CellPhases[neighbor2] == m_CellPhases[neighbor] && m_CellPhases[neighbor2] > 0)
+          {
+            const uint32 phase1 = m_CrystalStructures[m_CellPhases[neighbor2]];
+            const QuatF quat1(m_Quats[neighbor2 * 4], m_Quats[neighbor2 * 4 + 1], m_Quats[neighbor2 * 4 + 2], m_Quats[neighbor2 * 4 + 3]);
+            if(m_MisorientationCalculator.isWithinTolerance(phase1, quat1, quat2, m_CosHalfTolerance))
+            {
+              neighborSimCount[j]++;
+              neighborSimCount[k]++;
+            }
+          }
+        }
+      }
+      for(usize j = 0; j < 6; j++)
+      {
+        if(IsValidFaceNeighbor(j, column, row, plane, dims) && neighborSimCount[j] > 0)
+        {
+          m_BestNeighbor[i] = i + neighpoints[j];
+        }
+      }
+    }
+  }
+
+private:
+  const NeighborOrientationCorrelationInputValues* m_InputValues = nullptr;
+  const std::array<int64, 3> m_Dims;
+  const Float32Array& m_ConfidenceIndex;
+  const Int32Array& m_CellPhases;
+  const Float32Array& m_Quats;
+  const UInt32Array& m_CrystalStructures;
+  const MisorientationCalculator& m_MisorientationCalculator;
+  const float64 m_CosHalfTolerance;
+  const std::vector<int64>& m_Frontier;
+  std::vector<int64>& m_BestNeighbor;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Copies the tuple of each voxel's best neighbor into the voxel. The copies are done in voxel order
+ * so a voxel can pick up a value that was copied into its neighbor earlier in the same pass.
+ */
 class NeighborOrientationCorrelationTransferDataImpl
 {
 public:
   NeighborOrientationCorrelationTransferDataImpl() = delete;
   NeighborOrientationCorrelationTransferDataImpl(const NeighborOrientationCorrelationTransferDataImpl&) = default;
 
-  NeighborOrientationCorrelationTransferDataImpl(NeighborOrientationCorrelation* filterAlg, size_t totalPoints, const std::vector<int64_t>& bestNeighbor, std::shared_ptr<IDataArray> dataArrayPtr)
-  : m_FilterAlg(filterAlg)
-  , m_TotalPoints(totalPoints)
-  , m_BestNeighbor(bestNeighbor)
+  NeighborOrientationCorrelationTransferDataImpl(const std::vector<std::pair<int64, int64>>& gatherList, std::shared_ptr<IDataArray> dataArrayPtr)
+  : m_GatherList(gatherList)
   , m_DataArrayPtr(dataArrayPtr)
   {
   }
@@ -38,31 +160,17 @@ public:
 
   void operator()() const
   {
-    auto start = std::chrono::steady_clock::now();
-    for(size_t i = 0; i < m_TotalPoints; i++)
+    for(const auto& [voxel, neighbor] : m_GatherList)
     {
-      auto now = std::chrono::steady_clock::now();
-      //// Only send updates every 1 second
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-      {
-        float progress = static_cast<float>(i) / static_cast<float>(m_TotalPoints) * 100.0f;
-        m_FilterAlg->updateProgress(fmt::format("Processing {}: {}% completed", m_DataArrayPtr->getName(), static_cast<int>(progress)));
-        start = std::chrono::steady_clock::now();
-      }
-      int64_t neighbor = m_BestNeighbor[i];
-      if(neighbor != -1)
-      {
-        m_DataArrayPtr->copyTuple(neighbor, i);
-      }
+      m_DataArrayPtr->copyTuple(neighbor, voxel);
     }
   }
 
 private:
-  NeighborOrientationCorrelation* m_FilterAlg = nullptr;
-  size_t m_TotalPoints = 0;
-  std::vector<int64_t> m_BestNeighbor;
+  const std::vector<std::pair<int64, int64>>& m_GatherList;
   std::shared_ptr<IDataArray> m_DataArrayPtr;
 };
+} // namespace
 
 // -----------------------------------------------------------------------------
 NeighborOrientationCorrelation::NeighborOrientationCorrelation(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
@@ -92,18 +200,16 @@ void NeighborOrientationCorrelation::updateProgress(const std::string& progMessa
 // -----------------------------------------------------------------------------
 Result<> NeighborOrientationCorrelation::operator()()
 {
-  size_t progress = 0;
-  size_t totalProgress = 0;
-
-  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  MisorientationCalculator misorientationCalculator;
 
   const auto& confidenceIndex = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->ConfidenceIndexArrayPath);
   const auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath);
   const auto& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath);
   const auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
-  size_t totalPoints = confidenceIndex.getNumberOfTuples();
+  usize totalPoints = confidenceIndex.getNumberOfTuples();
 
   float misorientationToleranceR = m_InputValues->MisorientationTolerance * numbers::pi_v<float> / 180.0f;
+  const float64 cosHalfTolerance = MisorientationCalculator::ToleranceToCosHalfAngle(misorientationToleranceR);
 
   auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeomPath);
   SizeVec3 udims = imageGeom.getDimensions();
@@ -114,203 +220,102 @@ Result<> NeighborOrientationCorrelation::operator()()
       static_cast<int64_t>(udims[2]),
   };
 
-  size_t count = 1;
-  int32_t best = 0;
-  bool good = true;
-  bool good2 = true;
-  int64_t neighbor = 0;
-  int64_t neighbor2 = 0;
-  int64_t column = 0, row = 0, plane = 0;
-
-  int64_t neighpoints[6] = {0, 0, 0, 0, 0, 0};
-  neighpoints[0] = static_cast<int64_t>(-dims[0] * dims[1]);
-  neighpoints[1] = static_cast<int64_t>(-dims[0]);
-  neighpoints[2] = static_cast<int64_t>(-1);
-  neighpoints[3] = static_cast<int64_t>(1);
-  neighpoints[4] = static_cast<int64_t>(dims[0]);
-  neighpoints[5] = static_cast<int64_t>(dims[0] * dims[1]);
-
-  uint32_t phase1 = 0;
-
-  std::vector<int32_t> neighborDiffCount(totalPoints, 0);
-  std::vector<int32_t> neighborSimCount(6, 0);
-  std::vector<int64_t> bestNeighbor(totalPoints, -1);
-  const int32_t startLevel = 6;
-  float* currentQuatPtr = nullptr;
+  const int64 neighpoints[6] = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+
+  // Build up a list of the DataArrays that we are going to operate on.
+  std::vector<std::shared_ptr<IDataArray>> voxelArrays = nx::core::GenerateDataArrayList(m_DataStructure, m_InputValues->ConfidenceIndexArrayPath, m_InputValues->IgnoredDataArrayPaths);
+
+  ParallelDataAlgorithm::AlgorithmArrays algArrays;
+  algArrays.push_back(&confidenceIndex);
+  algArrays.push_back(&cellPhases);
+  algArrays.push_back(&quats);
+  algArrays.push_back(&crystalStructures);
 
+  // The best neighbor of a voxel is kept from one level to the next, exactly as the data
+  // transfer keeps copying from it.
+  std::vector<int64> bestNeighbor(totalPoints, -1);
+
+  // The first level has to look at every voxel. After that only the voxels whose own data or
+  // whose face neighbors' data changed during the transfer can find a different best neighbor.
+  std::vector<int64> frontier(totalPoints);
+  std::iota(frontier.begin(), frontier.end(), 0);
+  std::vector<int32> frontierStamp(totalPoints, -1);
+
+  const int32_t startLevel = 6;
   for(int32_t currentLevel = startLevel; currentLevel > m_InputValues->Level; currentLevel--)
   {
     if(getCancel())
     {
       break;
     }
+    m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Level '{}' of '{}' || Processing {} Voxels", (startLevel - currentLevel) + 1, startLevel - m_InputValues->Level, frontier.size())});
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, frontier.size());
+    dataAlg.requireArraysInMemory(algArrays);
+    dataAlg.execute(
+        FindBestNeighborsImpl(m_InputValues, dims, confidenceIndex, cellPhases, quats, crystalStructures, misorientationCalculator, cosHalfTolerance, frontier, bestNeighbor, m_ShouldCancel));
 
-    int64_t progressInt = 0;
-    auto start = std::chrono::steady_clock::now();
-    for(size_t i = 0; i < totalPoints; i++)
+    if(getCancel())
     {
-      auto now = std::chrono::steady_clock::now();
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-      {
-        progressInt = static_cast<int64_t>((static_cast<float>(i) / totalPoints) * 100.0f);
-        std::string ss = fmt::format("Level '{}' of '{}' || Processing Data '{}'% completed", (startLevel - currentLevel) + 1, startLevel - m_InputValues->Level, progressInt);
-        m_MessageHandler({IFilter::Message::Type::Info, ss});
-        start = std::chrono::steady_clock::now();
-      }
+      return {};
+    }
 
-      if(confidenceIndex[i] < m_InputValues->MinConfidence)
+    // Gather every voxel that will receive data along with the values that decide the best neighbors
+    // so the voxels that actually change can be found after the transfer.
+    std::vector<std::pair<int64, int64>> gatherList;
+    for(usize i = 0; i < totalPoints; i++)
+    {
+      if(bestNeighbor[i] != -1)
       {
-        count = 0;
-        column = static_cast<int64_t>(i % dims[0]);
-        row = (i / dims[0]) % dims[1];
-        plane = i / (dims[0] * dims[1]);
-        for(size_t j = 0; j < 6; j++)
-        {
-          good = true;
-          neighbor = int64_t(i) + neighpoints[j];
-          if(j == 0 && plane == 0)
-          {
-            good = false;
-          }
-          if(j == 5 && plane == (dims[2] - 1))
-          {
-            good = false;
-          }
-          if(j == 1 && row == 0)
-          {
-            good = false;
-          }
-          if(j == 4 && row == (dims[1] - 1))
-          {
-            good = false;
-          }
-          if(j == 2 && column == 0)
-          {
-            good = false;
-          }
-          if(j == 3 && column == (dims[0] - 1))
-          {
-            good = false;
-          }
-          if(good)
-          {
-            phase1 = crystalStructures[cellPhases[i]];
-            QuatF quat1(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-            QuatF quat2(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
-            OrientationD axisAngle(0.0, 0.0, 0.0, std::numeric_limits<double>::max());
-            if(cellPhases[i] == cellPhases[neighbor] && cellPhases[i] > 0)
-            {
-              axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-            }
-            if(axisAngle[3] > misorientationToleranceR)
-            {
-              neighborDiffCount[i]++;
-            }
-            for(size_t k = j + 1; k < 6; k++)
-            {
-              good2 = true;
-              neighbor2 = int64_t(i) + neighpoints[k];
-              if(k == 0 && plane == 0)
-              {
-                good2 = false;
-              }
-              if(k == 5 && plane == (dims[2] - 1))
-              {
-                good2 = false;
-              }
-              if(k == 1 && row == 0)
-              {
-                good2 = false;
-              }
-              if(k == 4 && row == (dims[1] - 1))
-              {
-                good2 = false;
-              }
-              if(k == 2 && column == 0)
-              {
-                good2 = false;
-              }
-              if(k == 3 && column == (dims[0] - 1))
-              {
-                good2 = false;
-              }
-              if(good2)
-              {
-                phase1 = crystalStructures[cellPhases[neighbor2]];
-                quat1 = QuatF(quats[neighbor2 * 4], quats[neighbor2 * 4 + 1], quats[neighbor2 * 4 + 2], quats[neighbor2 * 4 + 3]);
-                quat2 = QuatF(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
-                axisAngle = OrientationD(0.0, 0.0, 0.0, std::numeric_limits<double>::max());
-                if(cellPhases[neighbor2] == cellPhases[neighbor] && cellPhases[neighbor2] > 0)
-                {
-                  axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-                }
-                if(axisAngle[3] < misorientationToleranceR)
-                {
-                  neighborSimCount[j]++;
-                  neighborSimCount[k]++;
-                }
-              }
-            }
-          }
-        }
-        for(size_t j = 0; j < 6; j++)
-        {
-          best = 0;
-          good = true;
-          neighbor = int64_t(i) + neighpoints[j];
-          if(j == 0 && plane == 0)
-          {
-            good = false;
-          }
-          if(j == 5 && plane == (dims[2] - 1))
-          {
-            good = false;
-          }
-          if(j == 1 && row == 0)
-          {
-            good = false;
-          }
-          if(j == 4 && row == (dims[1] - 1))
-          {
-            good = false;
-          }
-          if(j == 2 && column == 0)
-          {
-            good = false;
-          }
-          if(j == 3 && column == (dims[0] - 1))
-          {
-            good = false;
-          }
-          if(good)
-          {
-            if(neighborSimCount[j] > best)
-            {
-              best = neighborSimCount[j];
-              bestNeighbor[i] = neighbor;
-            }
-            neighborSimCount[j] = 0;
-          }
-        }
+        gatherList.emplace_back(static_cast<int64>(i), bestNeighbor[i]);
       }
     }
-
-    if(getCancel())
+    std::vector<std::array<float32, 6>> previousValues(gatherList.size());
+    for(usize n = 0; n < gatherList.size(); n++)
     {
-      return {};
+      const int64 voxel = gatherList[n].first;
+      previousValues[n] = {quats[voxel * 4], quats[voxel * 4 + 1], quats[voxel * 4 + 2], quats[voxel * 4 + 3], static_cast<float32>(cellPhases[voxel]), confidenceIndex[voxel]};
     }
 
-    // Build up a list of the DataArrays that we are going to operate on.
-    std::vector<std::shared_ptr<IDataArray>> voxelArrays = nx::core::GenerateDataArrayList(m_DataStructure, m_InputValues->ConfidenceIndexArrayPath, m_InputValues->IgnoredDataArrayPaths);
-    // The idea for this parallel section is to parallelize over each Data Array that
-    // will need it's data adjusted. This should go faster than before by about 2x.
-    // Better speed up could be achieved if we had better data locality.
+    // Every data array is gathered through the same list, one array per task
     ParallelTaskAlgorithm parallelTask;
     for(const auto& dataArrayPtr : voxelArrays)
     {
-      parallelTask.execute(NeighborOrientationCorrelationTransferDataImpl(this, totalPoints, bestNeighbor, dataArrayPtr));
+      parallelTask.execute(NeighborOrientationCorrelationTransferDataImpl(gatherList, dataArrayPtr));
+    }
+    parallelTask.wait();
+
+    frontier.clear();
+    for(usize n = 0; n < gatherList.size(); n++)
+    {
+      const int64 voxel = gatherList[n].first;
+      const std::array<float32, 6> currentValues = {quats[voxel * 4], quats[voxel * 4 + 1], quats[voxel * 4 + 2], quats[voxel * 4 + 3], static_cast<float32>(cellPhases[voxel]), confidenceIndex[voxel]};
+      if(currentValues == previousValues[n])
+      {
+        continue;
+      }
+      const int64 column = voxel % dims[0];
+      const int64 row = (voxel / dims[0]) % dims[1];
+      const int64 plane = voxel / (dims[0] * dims[1]);
+      if(frontierStamp[voxel] != currentLevel)
+      {
+        frontierStamp[voxel] = currentLevel;
+        frontier.push_back(voxel);
+      }
+      for(usize j = 0; j < 6; j++)
+      {
+        const int64 neighbor = voxel + neighpoints[j];
+        if(IsValidFaceNeighbor(j, column, row, plane, dims) && frontierStamp[neighbor] != currentLevel)
+        {
+          frontierStamp[neighbor] = currentLevel;
+          frontier.push_back(neighbor);
+        }
+      }
     }
+    std::sort(frontier.begin(), frontier.end());
 
+    // Together with the loop decrement this steps two levels per pass, as the filter always has
     currentLevel = currentLevel - 1;
   }
 
@@ -15,6 +15,7 @@
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <algorithm>
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -30,6 +31,7 @@ constexpr nx::core::int32 k_InputComponentDimensionError = -68003;
 constexpr nx::core::int32 k_InputComponentCountError = -68004;
 constexpr nx::core::int32 k_InconsistentTupleCount = -68063;
 constexpr nx::core::int32 k_OutputFilePathEmpty = -68063;
+constexpr nx::core::int32 k_InvalidSearchLevels = -68064;
 
 } // namespace
 
@@ -76,6 +78,12 @@ Parameters AlignSectionsMisorientationFilter::parameters() const
                                                    "Tolerance used to decide if Cells above/below one another should be considered to be the same. The value selected should be similar to the "
                                                    "tolerance one would use to define Features (i.e., 2-10 degrees)",
                                                    5.0f));
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseCoarseToFineSearch_Key, "Use Coarse To Fine Search",
+                                                                 "Whether to search for each shift on a coarse grid of candidate shifts first and refine the result at finer levels", false));
+  params.insert(std::make_unique<Int32Parameter>(k_CoarseToFineLevels_Key, "Number of Search Levels",
+                                                 "The number of levels in the coarse to fine search. Level N tests shifts that are 2^N voxels apart. Level 0 is the full resolution search. "
+                                                 "At most floor(log2(min(X Dimension, Y Dimension) / 4)) levels may be used.", 3));
+  params.linkParameters(k_UseCoarseToFineSearch_Key, k_CoarseToFineLevels_Key, true);
 
   params.insertSeparator(Parameters::Separator{"Optional Data Mask"});
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseMask_Key, "Use Mask Array", "Whether to remove some Cells from consideration in the alignment process", false));
@@ -110,7 +118,11 @@ Parameters AlignSectionsMisorientationFilter::parameters() const
 //------------------------------------------------------------------------------
 IFilter::VersionType AlignSectionsMisorientationFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added 'use_coarse_to_fine_search' and 'coarse_to_fine_levels'
 }
 
 //------------------------------------------------------------------------------
@@ -132,6 +144,8 @@ IFilter::PreflightResult AlignSectionsMisorientationFilter::preflightImpl(const
   auto pGoodVoxelsArrayPath = filterArgs.value<DataPath>(k_MaskArrayPath_Key);
   auto pCrystalStructuresArrayPath = filterArgs.value<DataPath>(k_CrystalStructuresArrayPath_Key);
   auto inputImageGeometry = filterArgs.value<DataPath>(k_SelectedImageGeometryPath_Key);
+  auto pUseCoarseToFineSearch = filterArgs.value<bool>(k_UseCoarseToFineSearch_Key);
+  auto pCoarseToFineLevels = filterArgs.value<int32>(k_CoarseToFineLevels_Key);
 
   PreflightResult preflightResult;
 
@@ -141,6 +155,11 @@ IFilter::PreflightResult AlignSectionsMisorientationFilter::preflightImpl(const
 
   std::vector<DataPath> dataPaths;
 
+  if(pUseCoarseToFineSearch && pCoarseToFineLevels < 1)
+  {
+    return {MakeErrorResult<OutputActions>(k_InvalidSearchLevels, fmt::format("The number of search levels must be at least 1 but was {}.", pCoarseToFineLevels))};
+  }
+
   const auto* quats = dataStructure.getDataAs<Float32Array>(pQuatsArrayPath);
   if(quats->getNumberOfComponents() != 4)
   {
@@ -172,6 +191,26 @@ IFilter::PreflightResult AlignSectionsMisorientationFilter::preflightImpl(const
   {
     return {MakeErrorResult<OutputActions>(k_InputRepresentationTypeError, fmt::format("Cannot find cell data Attribute Matrix in the selected Image geometry '{}'", inputImageGeometry.toString()))};
   }
+
+  // With N levels the coarsest level compares every (4 x 2^(N-1))th cell, so at least two cells per row and column are
+  // compared as long as 4 x 2^N <= min(dimX, dimY). This also keeps the (1 << level) step of the search well defined.
+  if(pUseCoarseToFineSearch)
+  {
+    const SizeVec3 dims = inputGeom->getDimensions();
+    const usize minDim = std::min(dims[0], dims[1]);
+    int32 maxLevels = 0;
+    while((usize{8} << maxLevels) <= minDim)
+    {
+      maxLevels++;
+    }
+    maxLevels = std::max(maxLevels, 1);
+    if(pCoarseToFineLevels > maxLevels)
+    {
+      return {MakeErrorResult<OutputActions>(k_InvalidSearchLevels, fmt::format("The number of search levels must be at most {} for a {}x{} slice but was {}. The coarsest level must compare at "
+                                                                                "least 2 cells in each direction.",
+                                                                                maxLevels, dims[0], dims[1], pCoarseToFineLevels))};
+    }
+  }
   // Ensure the file path is not blank if they user wants to write the alignment shifts.
   if(pWriteAlignmentShifts && pAlignmentShiftFileName.empty())
   {
@@ -202,6 +241,8 @@ Result<> AlignSectionsMisorientationFilter::executeImpl(DataStructure& dataStruc
   inputValues.cellPhasesArrayPath = filterArgs.value<DataPath>(k_CellPhasesArrayPath_Key);
   inputValues.goodVoxelsArrayPath = filterArgs.value<DataPath>(k_MaskArrayPath_Key);
   inputValues.crystalStructuresArrayPath = filterArgs.value<DataPath>(k_CrystalStructuresArrayPath_Key);
+  inputValues.useCoarseToFineSearch = filterArgs.value<bool>(k_UseCoarseToFineSearch_Key);
+  inputValues.coarseToFineLevels = filterArgs.value<int32>(k_CoarseToFineLevels_Key);
 
   return AlignSectionsMisorientation(dataStructure, messageHandler, shouldCancel, &inputValues)();
 }
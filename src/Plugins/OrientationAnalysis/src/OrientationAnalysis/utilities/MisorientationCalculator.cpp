@@ -0,0 +1,175 @@
+#include "MisorientationCalculator.hpp"
+
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+using namespace nx::core;
+
+namespace
+{
+// Symmetry operators are checked in groups of this size before testing for an early exit
+constexpr usize k_EarlyExitStride = 4;
+
+QuatD RelativeRotation(const QuatF& q1, const QuatF& q2)
+{
+  QuatD qd1(q1.x(), q1.y(), q1.z(), q1.w());
+  QuatD qd2(q2.x(), q2.y(), q2.z(), q2.w());
+  return qd1 * qd2.conjugate();
+}
+
+float32 ScalarToAngle(float64 maxScalar)
+{
+  return static_cast<float32>(2.0 * std::acos(std::min(maxScalar, 1.0)));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+MisorientationCalculator::MisorientationCalculator()
+{
+  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  m_Tables.resize(orientationOps.size());
+  for(usize laueClass = 0; laueClass < orientationOps.size(); laueClass++)
+  {
+    const int32 numSymOps = orientationOps[laueClass]->getNumSymOps();
+    SymmetryTable& table = m_Tables[laueClass];
+    table.x.resize(numSymOps);
+    table.y.resize(numSymOps);
+    table.z.resize(numSymOps);
+    table.w.resize(numSymOps);
+    for(int32 i = 0; i < numSymOps; i++)
+    {
+      QuatD symOp = orientationOps[laueClass]->getQuatSymOp(i);
+      table.x[i] = symOp.x();
+      table.y[i] = symOp.y();
+      table.z[i] = symOp.z();
+      table.w[i] = symOp.w();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+float64 MisorientationCalculator::ToleranceToCosHalfAngle(float64 tolerance)
+{
+  return std::cos(tolerance * 0.5);
+}
+
+// -----------------------------------------------------------------------------
+bool MisorientationCalculator::isValidLaueClass(uint32 laueClass) const
+{
+  return laueClass < m_Tables.size();
+}
+
+// -----------------------------------------------------------------------------
+float64 MisorientationCalculator::maxSymmetricScalar(const SymmetryTable& table, const QuatF& q1, const QuatF& q2) const
+{
+  const QuatD qr = RelativeRotation(q1, q2);
+  const float64 rx = qr.x();
+  const float64 ry = qr.y();
+  const float64 rz = qr.z();
+  const float64 rw = qr.w();
+
+  const usize numSymOps = table.w.size();
+  float64 maxScalar = 0.0;
+  for(usize i = 0; i < numSymOps; i++)
+  {
+    // Scalar part of symOp * qr. It does not depend on the handedness of the quaternion product.
+    const float64 scalar = std::fabs(table.w[i] * rw - table.x[i] * rx - table.y[i] * ry - table.z[i] * rz);
+    maxScalar = std::max(maxScalar, scalar);
+  }
+  return maxScalar;
+}
+
+// -----------------------------------------------------------------------------
+float32 MisorientationCalculator::calculateAngle(uint32 laueClass, const QuatF& q1, const QuatF& q2) const
+{
+  if(!isValidLaueClass(laueClass))
+  {
+    return std::numeric_limits<float32>::max();
+  }
+  return ScalarToAngle(maxSymmetricScalar(m_Tables[laueClass], q1, q2));
+}
+
+// -----------------------------------------------------------------------------
+bool MisorientationCalculator::isWithinTolerance(uint32 laueClass, const QuatF& q1, const QuatF& q2, float64 cosHalfTolerance) const
+{
+  if(!isValidLaueClass(laueClass))
+  {
+    return false;
+  }
+  const SymmetryTable& table = m_Tables[laueClass];
+  const QuatD qr = RelativeRotation(q1, q2);
+  const float64 rx = qr.x();
+  const float64 ry = qr.y();
+  const float64 rz = qr.z();
+  const float64 rw = qr.w();
+
+  // angle < tolerance  <=>  2 * acos(|scalar|) < tolerance  <=>  |scalar| > cos(tolerance / 2)
+  const usize numSymOps = table.w.size();
+  for(usize start = 0; start < numSymOps; start += k_EarlyExitStride)
+  {
+    const usize end = std::min(start + k_EarlyExitStride, numSymOps);
+    float64 maxScalar = 0.0;
+    for(usize i = start; i < end; i++)
+    {
+      const float64 scalar = std::fabs(table.w[i] * rw - table.x[i] * rx - table.y[i] * ry - table.z[i] * rz);
+      maxScalar = std::max(maxScalar, scalar);
+    }
+    if(std::min(maxScalar, 1.0) > cosHalfTolerance)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+void MisorientationCalculator::calculateAngles(uint32 laueClass, const QuatF& reference, const QuatF* others, usize count, float32* angles) const
+{
+  if(!isValidLaueClass(laueClass))
+  {
+    std::fill(angles, angles + count, std::numeric_limits<float32>::max());
+    return;
+  }
+  const SymmetryTable& table = m_Tables[laueClass];
+  const usize numSymOps = table.w.size();
+
+  std::array<float64, k_BatchSize> rx = {};
+  std::array<float64, k_BatchSize> ry = {};
+  std::array<float64, k_BatchSize> rz = {};
+  std::array<float64, k_BatchSize> rw = {};
+  std::array<float64, k_BatchSize> maxScalar = {};
+
+  for(usize batchStart = 0; batchStart < count; batchStart += k_BatchSize)
+  {
+    const usize batchCount = std::min(k_BatchSize, count - batchStart);
+    for(usize n = 0; n < batchCount; n++)
+    {
+      const QuatD qr = RelativeRotation(reference, others[batchStart + n]);
+      rx[n] = qr.x();
+      ry[n] = qr.y();
+      rz[n] = qr.z();
+      rw[n] = qr.w();
+      maxScalar[n] = 0.0;
+    }
+    for(usize i = 0; i < numSymOps; i++)
+    {
+      const float64 sx = table.x[i];
+      const float64 sy = table.y[i];
+      const float64 sz = table.z[i];
+      const float64 sw = table.w[i];
+      for(usize n = 0; n < batchCount; n++)
+      {
+        const float64 scalar = std::fabs(sw * rw[n] - sx * rx[n] - sy * ry[n] - sz * rz[n]);
+        maxScalar[n] = maxScalar[n] < scalar ? scalar : maxScalar[n];
+      }
+    }
+    for(usize n = 0; n < batchCount; n++)
+    {
+      angles[batchStart + n] = ScalarToAngle(maxScalar[n]);
+    }
+  }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "OrientationAnalysis/OrientationAnalysis_export.hpp"
+
+#include "simplnx/Common/Types.hpp"
+
+#include "EbsdLib/Core/Quaternion.hpp"
+
+#include <vector>
+
+namespace nx::core
+{
+
+/**
+ * @brief The MisorientationCalculator class computes the misorientation angle between pairs of
+ * quaternions without going through the virtual LaueOps::calculateMisorientation() call for every
+ * pair. The quaternion symmetry operators of every Laue class are copied once into flat
+ * (structure of arrays) tables so the loop over the symmetry operators is a straight run of
+ * multiply-adds that the compiler can vectorize.
+ *
+ * The misorientation angle only depends on the largest absolute scalar part of the symmetric
+ * equivalents of the relative rotation, so a tolerance check does not need the trigonometry at
+ * all and stops as soon as one symmetry operator brings the pair within the tolerance.
+ *
+ * Only the angle is computed. Filters that need the misorientation axis still use LaueOps.
+ *
+ * This class is thread safe once constructed and is intended to be created once per filter execution.
+ */
+class ORIENTATIONANALYSIS_EXPORT MisorientationCalculator
+{
+public:
+  /**
+   * @brief The number of quaternion pairs that are evaluated together by calculateAngles()
+   */
+  static constexpr usize k_BatchSize = 64;
+
+  MisorientationCalculator();
+  ~MisorientationCalculator() noexcept = default;
+
+  MisorientationCalculator(const MisorientationCalculator&) = default;
+  MisorientationCalculator(MisorientationCalculator&&) noexcept = default;
+  MisorientationCalculator& operator=(const MisorientationCalculator&) = default;
+  MisorientationCalculator& operator=(MisorientationCalculator&&) noexcept = default;
+
+  /**
+   * @brief Converts a misorientation tolerance (radians) into the value that isWithinTolerance() compares against.
+   * @param tolerance
+   * @return cos(tolerance / 2)
+   */
+  static float64 ToleranceToCosHalfAngle(float64 tolerance);
+
+  /**
+   * @brief Returns true if the Laue class has a symmetry table
+   * @param laueClass EbsdLib::CrystalStructure value
+   */
+  bool isValidLaueClass(uint32 laueClass) const;
+
+  /**
+   * @brief Returns the misorientation angle (radians) between the two orientations. Invalid Laue
+   * classes return the largest float32 value which is never within any tolerance.
+   * @param laueClass EbsdLib::CrystalStructure value shared by both orientations
+   * @param q1
+   * @param q2
+   * @return
+   */
+  float32 calculateAngle(uint32 laueClass, const QuatF& q1, const QuatF& q2) const;
+
+  /**
+   * @brief Returns true if the misorientation angle between the two orientations is strictly
+   * less than the tolerance. This is equivalent to 'calculateAngle(laueClass, q1, q2) < tolerance'.
+   * @param laueClass EbsdLib::CrystalStructure value shared by both orientations
+   * @param q1
+   * @param q2
+   * @param cosHalfTolerance Value returned from ToleranceToCosHalfAngle()
+   * @return
+   */
+  bool isWithinTolerance(uint32 laueClass, const QuatF& q1, const QuatF& q2, float64 cosHalfTolerance) const;
+
+  /**
+   * @brief Computes the misorientation angles (radians) between one reference orientation and
+   * many other orientations of the same Laue class. The pairs are processed in batches of
+   * k_BatchSize with the symmetry operators in the outer loop so the inner loop runs over pairs.
+   * @param laueClass EbsdLib::CrystalStructure value shared by all orientations
+   * @param reference
+   * @param others Pointer to 'count' orientations
+   * @param count
+   * @param angles Output pointer with room for 'count' values
+   */
+  void calculateAngles(uint32 laueClass, const QuatF& reference, const QuatF* others, usize count, float32* angles) const;
+
+private:
+  struct SymmetryTable
+  {
+    std::vector<float64> x;
+    std::vector<float64> y;
+    std::vector<float64> z;
+    std::vector<float64> w;
+  };
+
+  /**
+   * @brief Returns the largest absolute scalar part of the symmetric equivalents of q1 * q2^-1
+   */
+  float64 maxSymmetricScalar(const SymmetryTable& table, const QuatF& q1, const QuatF& q2) const;
+
+  std::vector<SymmetryTable> m_Tables;
+};
+
+} // namespace nx::core
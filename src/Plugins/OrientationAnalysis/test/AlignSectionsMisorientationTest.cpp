@@ -6,6 +6,8 @@
 
 #include "simplnx/Common/Types.hpp"
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/Parameters/DataStoreFormatParameter.hpp"
 #include "simplnx/Parameters/Dream3dImportParameter.hpp"
@@ -14,13 +16,102 @@
 #include "simplnx/Parameters/NumericTypeParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+#include <cmath>
 #include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
 
 namespace fs = std::filesystem;
 using namespace nx::core;
 using namespace nx::core::Constants;
 using namespace nx::core::UnitTest;
 
+namespace
+{
+constexpr int64 k_GrainSize = 5;
+constexpr int64 k_SliceShiftX = 5;
+constexpr int64 k_SliceShiftY = -3;
+
+const DataPath k_ShiftGeomPath({"ShiftedGrains"});
+const DataPath k_ShiftCellDataPath = k_ShiftGeomPath.createChildPath(k_CellData);
+const DataPath k_ShiftEnsembleDataPath = k_ShiftGeomPath.createChildPath(k_CellEnsembleData);
+
+/**
+ * @brief Creates square grains with random orientations where every slice is the slice below it
+ * moved by (k_SliceShiftX, k_SliceShiftY) cells.
+ */
+DataStructure CreateShiftedGrainsDataStructure(usize dimX, usize dimY, usize dimZ)
+{
+  DataStructure dataStructure;
+  auto* imageGeom = ImageGeom::Create(dataStructure, k_ShiftGeomPath.getTargetName());
+  imageGeom->setDimensions({dimX, dimY, dimZ});
+  imageGeom->setSpacing({1.0f, 1.0f, 1.0f});
+  imageGeom->setOrigin({0.0f, 0.0f, 0.0f});
+
+  const std::vector<usize> tupleDims = {dimZ, dimY, dimX};
+  auto* cellData = AttributeMatrix::Create(dataStructure, k_CellData, tupleDims, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+  auto* quats = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, k_Quats, tupleDims, {4}, cellData->getId());
+  auto* phases = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, k_Phases, tupleDims, {1}, cellData->getId());
+  phases->fill(1);
+
+  auto* ensembleData = AttributeMatrix::Create(dataStructure, k_CellEnsembleData, {2}, imageGeom->getId());
+  auto* crystalStructures = UInt32Array::CreateWithStore<UInt32DataStore>(dataStructure, k_CrystalStructures, {2}, {1}, ensembleData->getId());
+  (*crystalStructures)[0] = EbsdLib::CrystalStructure::UnknownCrystalStructure;
+  (*crystalStructures)[1] = EbsdLib::CrystalStructure::Cubic_High;
+
+  for(usize z = 0; z < dimZ; z++)
+  {
+    for(usize y = 0; y < dimY; y++)
+    {
+      for(usize x = 0; x < dimX; x++)
+      {
+        // Every grain gets its own random orientation, seeded by its position on the unshifted grid
+        const auto grainX = static_cast<int64>(std::floor(static_cast<float64>(static_cast<int64>(x) + static_cast<int64>(z) * k_SliceShiftX) / k_GrainSize));
+        const auto grainY = static_cast<int64>(std::floor(static_cast<float64>(static_cast<int64>(y) + static_cast<int64>(z) * k_SliceShiftY) / k_GrainSize));
+        std::mt19937_64 generator(static_cast<uint64>((grainY + 1000) * 4096 + (grainX + 1000)));
+        std::normal_distribution<float32> distribution(0.0f, 1.0f);
+        std::array<float32, 4> quat = {distribution(generator), distribution(generator), distribution(generator), distribution(generator)};
+        const float32 norm = std::sqrt(quat[0] * quat[0] + quat[1] * quat[1] + quat[2] * quat[2] + quat[3] * quat[3]);
+        const usize index = (z * dimY + y) * dimX + x;
+        for(usize c = 0; c < 4; c++)
+        {
+          (*quats)[index * 4 + c] = quat[c] / norm;
+        }
+      }
+    }
+  }
+  return dataStructure;
+}
+
+Arguments CreateShiftedGrainsArguments(bool useCoarseToFineSearch, int32 coarseToFineLevels, const fs::path& shiftsFile)
+{
+  Arguments args;
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_WriteAlignmentShifts_Key, std::make_any<bool>(true));
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_AlignmentShiftFileName_Key, std::make_any<FileSystemPathParameter::ValueType>(shiftsFile));
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_MisorientationTolerance_Key, std::make_any<float32>(5.0F));
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_UseCoarseToFineSearch_Key, std::make_any<bool>(useCoarseToFineSearch));
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_CoarseToFineLevels_Key, std::make_any<int32>(coarseToFineLevels));
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_UseMask_Key, std::make_any<bool>(false));
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_QuatsArrayPath_Key, std::make_any<DataPath>(k_ShiftCellDataPath.createChildPath(k_Quats)));
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_CellPhasesArrayPath_Key, std::make_any<DataPath>(k_ShiftCellDataPath.createChildPath(k_Phases)));
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_CrystalStructuresArrayPath_Key, std::make_any<DataPath>(k_ShiftEnsembleDataPath.createChildPath(k_CrystalStructures)));
+  args.insertOrAssign(AlignSectionsMisorientationFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ShiftGeomPath));
+  return args;
+}
+
+std::string ReadShiftsFile(const fs::path& shiftsFile)
+{
+  std::ifstream inStream(shiftsFile);
+  std::stringstream contents;
+  contents << inStream.rdbuf();
+  return contents.str();
+}
+} // namespace
+
 /**
  * Read H5Ebsd File
  * MultiThreshold Objects
@@ -165,3 +256,92 @@ TEST_CASE("OrientationAnalysis::AlignSectionsMisorientation Small IN100 Pipeline
   // Compare the shift values
   CompareArrays<int32>(dataStructure, k_CalculatedShiftsPath, k_ExemplarShiftsPath);
 }
+
+TEST_CASE("OrientationAnalysis::AlignSectionsMisorientation Coarse To Fine Search", "[OrientationAnalysis][AlignSectionsMisorientation]")
+{
+  const usize dimX = 64;
+  const usize dimY = 48;
+  const usize dimZ = 6;
+  const uint64_t millisFromEpoch = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+  const fs::path exhaustiveShiftsFile = fmt::format("{}/{}/AlignSectionsMisorientation_Exhaustive.txt", unit_test::k_BinaryTestOutputDir, millisFromEpoch);
+  const fs::path coarseToFineShiftsFile = fmt::format("{}/{}/AlignSectionsMisorientation_CoarseToFine.txt", unit_test::k_BinaryTestOutputDir, millisFromEpoch);
+
+  AlignSectionsMisorientationFilter filter;
+
+  // Exhaustive (full resolution) search
+  DataStructure exhaustiveDataStructure = CreateShiftedGrainsDataStructure(dimX, dimY, dimZ);
+  {
+    Arguments args = CreateShiftedGrainsArguments(false, 1, exhaustiveShiftsFile);
+    auto preflightResult = filter.preflight(exhaustiveDataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+    auto executeResult = filter.execute(exhaustiveDataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  }
+
+  // Coarse to fine search with the largest number of levels that the 64x48 slices allow (floor(log2(48 / 4)) = 3)
+  DataStructure coarseToFineDataStructure = CreateShiftedGrainsDataStructure(dimX, dimY, dimZ);
+  {
+    Arguments args = CreateShiftedGrainsArguments(true, 3, coarseToFineShiftsFile);
+    auto preflightResult = filter.preflight(coarseToFineDataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+    auto executeResult = filter.execute(coarseToFineDataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  }
+
+  // Both searches find the same shifts, which are the shifts the slices were created with
+  const std::string exhaustiveShifts = ReadShiftsFile(exhaustiveShiftsFile);
+  REQUIRE(exhaustiveShifts == ReadShiftsFile(coarseToFineShiftsFile));
+  std::istringstream shiftsStream(exhaustiveShifts);
+  usize numShifts = 0;
+  int64 slice = 0;
+  int64 refSlice = 0;
+  int64 relativeXShift = 0;
+  int64 relativeYShift = 0;
+  int64 xShift = 0;
+  int64 yShift = 0;
+  while(shiftsStream >> slice >> refSlice >> relativeXShift >> relativeYShift >> xShift >> yShift)
+  {
+    REQUIRE(relativeXShift == k_SliceShiftX);
+    REQUIRE(relativeYShift == k_SliceShiftY);
+    numShifts++;
+  }
+  REQUIRE(numShifts == dimZ - 1);
+
+  const DataPath quatsPath = k_ShiftCellDataPath.createChildPath(k_Quats);
+  const auto& exhaustiveQuats = exhaustiveDataStructure.getDataRefAs<Float32Array>(quatsPath);
+  const auto& coarseToFineQuats = coarseToFineDataStructure.getDataRefAs<Float32Array>(quatsPath);
+  usize numMismatches = 0;
+  for(usize i = 0; i < exhaustiveQuats.getSize(); i++)
+  {
+    if(exhaustiveQuats[i] != coarseToFineQuats[i])
+    {
+      numMismatches++;
+    }
+  }
+  REQUIRE(numMismatches == 0);
+}
+
+TEST_CASE("OrientationAnalysis::AlignSectionsMisorientation Invalid Search Levels", "[OrientationAnalysis][AlignSectionsMisorientation]")
+{
+  DataStructure dataStructure = CreateShiftedGrainsDataStructure(64, 48, 2);
+  const fs::path shiftsFile = fmt::format("{}/AlignSectionsMisorientation_InvalidLevels.txt", unit_test::k_BinaryTestOutputDir);
+  AlignSectionsMisorientationFilter filter;
+
+  int32 coarseToFineLevels = 0;
+  SECTION("No Levels")
+  {
+    coarseToFineLevels = 0;
+  }
+  SECTION("Coarsest Level Larger Than The Slice")
+  {
+    coarseToFineLevels = 4;
+  }
+  SECTION("Shift Step Overflow")
+  {
+    coarseToFineLevels = 63;
+  }
+
+  Arguments args = CreateShiftedGrainsArguments(true, coarseToFineLevels, shiftsFile);
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions)
+}
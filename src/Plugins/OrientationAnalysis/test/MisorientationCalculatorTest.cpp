@@ -0,0 +1,81 @@
+#include <catch2/catch.hpp>
+
+#include "simplnx/Common/Numbers.hpp"
+
+#include "OrientationAnalysis/utilities/MisorientationCalculator.hpp"
+
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+#include <cmath>
+#include <random>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr usize k_NumPairs = 500;
+
+std::vector<QuatF> GenerateRandomQuats(usize count, std::mt19937_64& generator)
+{
+  std::normal_distribution<float32> distribution(0.0f, 1.0f);
+  std::vector<QuatF> quats;
+  quats.reserve(count);
+  while(quats.size() < count)
+  {
+    float32 x = distribution(generator);
+    float32 y = distribution(generator);
+    float32 z = distribution(generator);
+    float32 w = distribution(generator);
+    float32 norm = std::sqrt(x * x + y * y + z * z + w * w);
+    if(norm < 1.0E-3f)
+    {
+      continue;
+    }
+    quats.emplace_back(x / norm, y / norm, z / norm, w / norm);
+  }
+  return quats;
+}
+} // namespace
+
+TEST_CASE("OrientationAnalysis::MisorientationCalculator", "[OrientationAnalysis][MisorientationCalculator]")
+{
+  std::mt19937_64 generator(5489u);
+  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  MisorientationCalculator calculator;
+
+  REQUIRE_FALSE(calculator.isValidLaueClass(static_cast<uint32>(orientationOps.size())));
+
+  const float64 tolerance = 5.0 * (nx::core::numbers::pi / 180.0);
+  const float64 cosHalfTolerance = MisorientationCalculator::ToleranceToCosHalfAngle(tolerance);
+
+  for(uint32 laueClass = 0; laueClass < static_cast<uint32>(orientationOps.size()); laueClass++)
+  {
+    DYNAMIC_SECTION("Laue Class " << laueClass)
+    {
+      REQUIRE(calculator.isValidLaueClass(laueClass));
+
+      std::vector<QuatF> quats1 = GenerateRandomQuats(k_NumPairs, generator);
+      std::vector<QuatF> quats2 = GenerateRandomQuats(k_NumPairs, generator);
+      std::vector<float32> batchAngles(k_NumPairs, 0.0f);
+      calculator.calculateAngles(laueClass, quats1[0], quats2.data(), k_NumPairs, batchAngles.data());
+
+      for(usize i = 0; i < k_NumPairs; i++)
+      {
+        OrientationF axisAngle = orientationOps[laueClass]->calculateMisorientation(quats1[i], quats2[i]);
+        float32 angle = calculator.calculateAngle(laueClass, quats1[i], quats2[i]);
+        REQUIRE(angle == Approx(axisAngle[3]).margin(1.0E-4));
+
+        // Keep away from the tolerance itself where rounding may decide either way
+        if(std::fabs(angle - tolerance) > 1.0E-4)
+        {
+          REQUIRE(calculator.isWithinTolerance(laueClass, quats1[i], quats2[i], cosHalfTolerance) == (angle < tolerance));
+        }
+
+        REQUIRE(batchAngles[i] == Approx(calculator.calculateAngle(laueClass, quats1[0], quats2[i])).margin(1.0E-6));
+      }
+
+      // An orientation is always within the tolerance of itself
+      REQUIRE(calculator.isWithinTolerance(laueClass, quats1[0], quats1[0], cosHalfTolerance));
+    }
+  }
+}
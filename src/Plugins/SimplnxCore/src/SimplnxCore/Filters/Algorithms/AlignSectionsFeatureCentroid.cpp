@@ -4,11 +4,75 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include <iostream>
 
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief Computes the centroid of the masked cells of each slice. The centroid for iteration
+ * 'iter' belongs to slice (dims[2] - 1) - iter.
+ */
+class ComputeSliceCentroidsImpl
+{
+public:
+  ComputeSliceCentroidsImpl(const SizeVec3& dims, const FloatVec3& spacing, const MaskCompare& maskCompare, std::vector<float>& xCentroid, std::vector<float>& yCentroid,
+                            const std::atomic_bool& shouldCancel)
+  : m_Dims(dims)
+  , m_Spacing(spacing)
+  , m_MaskCompare(maskCompare)
+  , m_XCentroid(xCentroid)
+  , m_YCentroid(yCentroid)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(size_t iter = range.min(); iter < range.max(); iter++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+
+      size_t count = 0;
+      float xCentroid = 0.0f;
+      float yCentroid = 0.0f;
+
+      const size_t slice = (m_Dims[2] - 1) - iter;
+      for(size_t l = 0; l < m_Dims[1]; l++)
+      {
+        for(size_t n = 0; n < m_Dims[0]; n++)
+        {
+          size_t point = (slice * m_Dims[0] * m_Dims[1]) + (l * m_Dims[0]) + n;
+
+          if(m_MaskCompare.isTrue(point))
+          {
+            xCentroid = xCentroid + (static_cast<float>(n) * m_Spacing[0]);
+            yCentroid = yCentroid + (static_cast<float>(l) * m_Spacing[1]);
+            count++;
+          }
+        }
+      }
+      m_XCentroid[iter] = xCentroid / static_cast<float>(count);
+      m_YCentroid[iter] = yCentroid / static_cast<float>(count);
+    }
+  }
+
+private:
+  const SizeVec3 m_Dims;
+  const FloatVec3 m_Spacing;
+  const MaskCompare& m_MaskCompare;
+  std::vector<float>& m_XCentroid;
+  std::vector<float>& m_YCentroid;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 AlignSectionsFeatureCentroid::AlignSectionsFeatureCentroid(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                            AlignSectionsFeatureCentroidInputValues* inputValues)
@@ -100,56 +164,24 @@ Result<> AlignSectionsFeatureCentroid::findShifts(std::vector<int64_t>& xShifts,
       static_cast<int64_t>(dims[2]),
   };
 
-  int32_t progInt = 0;
-
   size_t newxshift = 0;
   size_t newyshift = 0;
 
   size_t slice = 0;
-  size_t point = 0;
   nx::core::FloatVec3 spacing = gridGeom->getSpacing();
   std::vector<float> xCentroid(dims[2], 0.0f);
   std::vector<float> yCentroid(dims[2], 0.0f);
 
-  auto start = std::chrono::steady_clock::now();
-  // Loop over the Z Direction
-  for(size_t iter = 0; iter < dims[2]; iter++)
-  {
-    progInt = static_cast<float>(iter) / static_cast<float>(dims[2]) * 100.0f;
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      std::string message = fmt::format("Determining Shifts || {}% Complete", progInt);
-      m_MessageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, progInt});
-      start = std::chrono::steady_clock::now();
-    }
-    if(getCancel())
-    {
-      return {};
-    }
-
-    size_t count = 0;
-    xCentroid[iter] = 0;
-    yCentroid[iter] = 0;
+  m_MessageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, fmt::format("Computing Centroids for {} Slices", dims[2])});
 
-    slice = static_cast<size_t>((dims[2] - 1) - iter);
-    for(size_t l = 0; l < dims[1]; l++)
-    {
-      for(size_t n = 0; n < dims[0]; n++)
-      {
-        point = ((slice)*dims[0] * dims[1]) + (l * dims[0]) + n;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, dims[2]);
+  dataAlg.requireArraysInMemory({m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath)});
+  dataAlg.execute(ComputeSliceCentroidsImpl(dims, spacing, *maskCompare, xCentroid, yCentroid, getCancel()));
 
-        if(maskCompare->isTrue(point))
-        {
-          xCentroid[iter] = xCentroid[iter] + (static_cast<float>(n) * spacing[0]);
-          yCentroid[iter] = yCentroid[iter] + (static_cast<float>(l) * spacing[1]);
-          count++;
-        }
-      }
-    }
-    xCentroid[iter] = xCentroid[iter] / static_cast<float>(count);
-    yCentroid[iter] = yCentroid[iter] / static_cast<float>(count);
+  if(getCancel())
+  {
+    return {};
   }
 
   bool xWarning = false;
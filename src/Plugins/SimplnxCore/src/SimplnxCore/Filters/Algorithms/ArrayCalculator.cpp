@@ -29,16 +29,25 @@
 
 #include "simplnx/Common/TypesUtility.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
+#include <cmath>
+#include <limits>
+#include <optional>
 #include <regex>
 
 using namespace nx::core;
 
 namespace
 {
+// Number of values evaluated together. Every instruction is applied to a whole block before
+// the next one so the inner loops are simple enough to be vectorized.
+constexpr usize k_BlockSize = 4096;
+
 struct CreateCalculatorArrayFunctor
 {
   template <typename T>
@@ -50,50 +59,496 @@ struct CreateCalculatorArrayFunctor
   }
 };
 
-struct CopyArrayFunctor
+struct InitializeArrayFunctor
 {
   template <typename T>
-  void operator()(DataStructure& dataStructure, const DataPath& calculatedArrayPath, const Float64Array* inputArray)
+  void operator()(DataStructure& dataStructure, const DataPath& calculatedArrayPath, float64 value)
   {
-    const auto& inputDataStore = inputArray->getDataStoreRef();
-    if(nullptr != inputArray)
+    auto& convertedDataStore = dataStructure.getDataAsUnsafe<DataArray<T>>(calculatedArrayPath)->getDataStoreRef();
+    if constexpr(std::is_same_v<float64, T>)
+    {
+      convertedDataStore.fill(value);
+    }
+    else
     {
-      auto& convertedDataStore = dataStructure.getDataAsUnsafe<DataArray<T>>(calculatedArrayPath)->getDataStoreRef();
+      convertedDataStore.fill(static_cast<T>(value));
+    }
+  }
+};
 
-      const usize count = inputDataStore.getSize();
-      for(usize i = 0; i < count; i++)
+/**
+ * @brief The operations a CalculatorProgram can execute. The unary operations replace the value on
+ * top of the register stack, the binary ones combine the two values on top of the stack into one.
+ */
+enum class CalculatorOpCode : uint8
+{
+  Negate,
+  Abs,
+  Sin,
+  Cos,
+  Tan,
+  ASin,
+  ACos,
+  ATan,
+  Sqrt,
+  Log10,
+  Ln,
+  Exp,
+  Floor,
+  Ceil,
+  Add,
+  Subtract,
+  Multiply,
+  Divide,
+  Pow,
+  Root,
+  Log
+};
+
+std::optional<CalculatorOpCode> ToOpCode(const CalculatorItem::Pointer& item)
+{
+  // The operators with two arguments ('root' and 'log') derive from UnaryOperator, so the concrete class decides
+  const std::vector<std::pair<bool, CalculatorOpCode>> opCodes = {
+      {nullptr != std::dynamic_pointer_cast<NegativeOperator>(item), CalculatorOpCode::Negate},
+      {nullptr != std::dynamic_pointer_cast<ABSOperator>(item), CalculatorOpCode::Abs},
+      {nullptr != std::dynamic_pointer_cast<SinOperator>(item), CalculatorOpCode::Sin},
+      {nullptr != std::dynamic_pointer_cast<CosOperator>(item), CalculatorOpCode::Cos},
+      {nullptr != std::dynamic_pointer_cast<TanOperator>(item), CalculatorOpCode::Tan},
+      {nullptr != std::dynamic_pointer_cast<ASinOperator>(item), CalculatorOpCode::ASin},
+      {nullptr != std::dynamic_pointer_cast<ACosOperator>(item), CalculatorOpCode::ACos},
+      {nullptr != std::dynamic_pointer_cast<ATanOperator>(item), CalculatorOpCode::ATan},
+      {nullptr != std::dynamic_pointer_cast<SqrtOperator>(item), CalculatorOpCode::Sqrt},
+      {nullptr != std::dynamic_pointer_cast<Log10Operator>(item), CalculatorOpCode::Log10},
+      {nullptr != std::dynamic_pointer_cast<LnOperator>(item), CalculatorOpCode::Ln},
+      {nullptr != std::dynamic_pointer_cast<ExpOperator>(item), CalculatorOpCode::Exp},
+      {nullptr != std::dynamic_pointer_cast<FloorOperator>(item), CalculatorOpCode::Floor},
+      {nullptr != std::dynamic_pointer_cast<CeilOperator>(item), CalculatorOpCode::Ceil},
+      {nullptr != std::dynamic_pointer_cast<AdditionOperator>(item), CalculatorOpCode::Add},
+      {nullptr != std::dynamic_pointer_cast<SubtractionOperator>(item), CalculatorOpCode::Subtract},
+      {nullptr != std::dynamic_pointer_cast<MultiplicationOperator>(item), CalculatorOpCode::Multiply},
+      {nullptr != std::dynamic_pointer_cast<DivisionOperator>(item), CalculatorOpCode::Divide},
+      {nullptr != std::dynamic_pointer_cast<PowOperator>(item), CalculatorOpCode::Pow},
+      {nullptr != std::dynamic_pointer_cast<RootOperator>(item), CalculatorOpCode::Root},
+      {nullptr != std::dynamic_pointer_cast<LogOperator>(item), CalculatorOpCode::Log},
+  };
+  for(const auto& [matches, opCode] : opCodes)
+  {
+    if(matches)
+    {
+      return opCode;
+    }
+  }
+  return {};
+}
+
+bool IsBinary(CalculatorOpCode opCode)
+{
+  return opCode >= CalculatorOpCode::Add;
+}
+
+/**
+ * @brief Calls the visitor with a function object computing the unary operation. Trigonometric
+ * operations convert to or from degrees when the expression uses degrees.
+ */
+template <typename VisitorType>
+void VisitUnaryOperation(CalculatorOpCode opCode, CalculatorParameter::AngleUnits units, VisitorType&& visitor)
+{
+  const bool degrees = units == CalculatorParameter::AngleUnits::Degrees;
+  switch(opCode)
+  {
+  case CalculatorOpCode::Negate:
+    visitor([](float64 num) { return -1 * num; });
+    break;
+  case CalculatorOpCode::Abs:
+    visitor([](float64 num) { return std::fabs(num); });
+    break;
+  case CalculatorOpCode::Sin:
+    degrees ? visitor([](float64 num) { return std::sin(CalculatorOperator::toRadians(num)); }) : visitor([](float64 num) { return std::sin(num); });
+    break;
+  case CalculatorOpCode::Cos:
+    degrees ? visitor([](float64 num) { return std::cos(CalculatorOperator::toRadians(num)); }) : visitor([](float64 num) { return std::cos(num); });
+    break;
+  case CalculatorOpCode::Tan:
+    degrees ? visitor([](float64 num) { return std::tan(CalculatorOperator::toRadians(num)); }) : visitor([](float64 num) { return std::tan(num); });
+    break;
+  case CalculatorOpCode::ASin:
+    degrees ? visitor([](float64 num) { return CalculatorOperator::toDegrees(std::asin(num)); }) : visitor([](float64 num) { return std::asin(num); });
+    break;
+  case CalculatorOpCode::ACos:
+    degrees ? visitor([](float64 num) { return CalculatorOperator::toDegrees(std::acos(num)); }) : visitor([](float64 num) { return std::acos(num); });
+    break;
+  case CalculatorOpCode::ATan:
+    degrees ? visitor([](float64 num) { return CalculatorOperator::toDegrees(std::atan(num)); }) : visitor([](float64 num) { return std::atan(num); });
+    break;
+  case CalculatorOpCode::Sqrt:
+    visitor([](float64 num) { return std::sqrt(num); });
+    break;
+  case CalculatorOpCode::Log10:
+    visitor([](float64 num) { return std::log10(num); });
+    break;
+  case CalculatorOpCode::Ln:
+    visitor([](float64 num) { return std::log(num); });
+    break;
+  case CalculatorOpCode::Exp:
+    visitor([](float64 num) { return std::exp(num); });
+    break;
+  case CalculatorOpCode::Floor:
+    visitor([](float64 num) { return std::floor(num); });
+    break;
+  case CalculatorOpCode::Ceil:
+    visitor([](float64 num) { return std::ceil(num); });
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief Calls the visitor with a function object computing the binary operation 'left op right'
+ */
+template <typename VisitorType>
+void VisitBinaryOperation(CalculatorOpCode opCode, VisitorType&& visitor)
+{
+  switch(opCode)
+  {
+  case CalculatorOpCode::Add:
+    visitor([](float64 left, float64 right) { return left + right; });
+    break;
+  case CalculatorOpCode::Subtract:
+    visitor([](float64 left, float64 right) { return left - right; });
+    break;
+  case CalculatorOpCode::Multiply:
+    visitor([](float64 left, float64 right) { return left * right; });
+    break;
+  case CalculatorOpCode::Divide:
+    visitor([](float64 left, float64 right) { return left / right; });
+    break;
+  case CalculatorOpCode::Pow:
+    visitor([](float64 left, float64 right) { return std::pow(left, right); });
+    break;
+  case CalculatorOpCode::Root:
+    visitor([](float64 left, float64 right) { return right == 0 ? std::numeric_limits<float64>::infinity() : std::pow(left, 1 / right); });
+    break;
+  case CalculatorOpCode::Log:
+    visitor([](float64 left, float64 right) { return std::log(right) / std::log(left); });
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief The RPN expression compiled into a list of instructions for a stack of block sized
+ * registers. Sub expressions that only use numbers are folded into constants while compiling, and a
+ * binary operation with a constant operand reads the constant from the instruction instead of
+ * a register. Evaluating a block of values never allocates anything the size of the arrays.
+ */
+class CalculatorProgram
+{
+public:
+  enum class OperandMode : uint8
+  {
+    Registers,
+    LeftConstant,
+    RightConstant
+  };
+
+  struct Instruction
+  {
+    bool isLoad = false;
+    CalculatorOpCode opCode = CalculatorOpCode::Add;
+    OperandMode operandMode = OperandMode::Registers;
+    float64 constant = 0.0;
+    const AbstractDataStore<float64>* inputStore = nullptr;
+    const float64* inputData = nullptr;
+    bool broadcast = false;
+  };
+
+  static Result<CalculatorProgram> Compile(const std::vector<CalculatorItem::Pointer>& rpn, CalculatorParameter::AngleUnits units)
+  {
+    // Every entry is either a constant or a value that is held in a register when the program runs
+    struct CompiledValue
+    {
+      bool isConstant = false;
+      float64 constant = 0.0;
+    };
+
+    CalculatorProgram program;
+    program.m_Units = units;
+    std::vector<CompiledValue> compileStack;
+    usize numRegisters = 0;
+    for(const auto& rpnItem : rpn)
+    {
+      if(ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(rpnItem); nullptr != calcArray)
       {
-        if constexpr(std::is_same_v<float64, T>)
+        if(calcArray->getType() == ICalculatorArray::Number)
         {
-          convertedDataStore[i] = inputDataStore[i];
+          compileStack.push_back({true, calcArray->getValue(0)});
+          continue;
         }
-        else
+        const Float64Array* inputArray = calcArray->getArray();
+        Instruction instruction;
+        instruction.isLoad = true;
+        instruction.inputStore = &inputArray->getDataStoreRef();
+        const auto* dataStorePtr = dynamic_cast<const DataStore<float64>*>(instruction.inputStore);
+        instruction.inputData = dataStorePtr != nullptr ? dataStorePtr->data() : nullptr;
+        // Arrays with a single tuple always contribute their first value
+        instruction.broadcast = inputArray->getNumberOfTuples() == 1;
+        program.m_Instructions.push_back(instruction);
+        program.m_InputArrays.push_back(inputArray);
+        compileStack.push_back({false, 0.0});
+        numRegisters++;
+        program.m_NumRegisters = std::max(program.m_NumRegisters, numRegisters);
+        continue;
+      }
+
+      std::optional<CalculatorOpCode> opCode = ToOpCode(rpnItem);
+      if(!opCode.has_value())
+      {
+        return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::UnrecognizedItem), "An unrecognized item was found in the postfix expression.");
+      }
+
+      if(!IsBinary(*opCode))
+      {
+        if(compileStack.empty())
+        {
+          return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::InvalidEquation), "The chosen infix equation is not a valid equation.");
+        }
+        CompiledValue& operand = compileStack.back();
+        if(operand.isConstant)
         {
-          convertedDataStore[i] = static_cast<T>(inputDataStore[i]);
+          VisitUnaryOperation(*opCode, units, [&operand](auto operation) { operand.constant = operation(operand.constant); });
+          continue;
         }
+        Instruction instruction;
+        instruction.opCode = *opCode;
+        program.m_Instructions.push_back(instruction);
+        continue;
+      }
+
+      if(compileStack.size() < 2)
+      {
+        return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::InvalidEquation), "The chosen infix equation is not a valid equation.");
+      }
+      const CompiledValue right = compileStack.back();
+      compileStack.pop_back();
+      CompiledValue& left = compileStack.back();
+      if(left.isConstant && right.isConstant)
+      {
+        VisitBinaryOperation(*opCode, [&left, &right](auto operation) { left.constant = operation(left.constant, right.constant); });
+        continue;
+      }
+      Instruction instruction;
+      instruction.opCode = *opCode;
+      if(left.isConstant)
+      {
+        instruction.operandMode = OperandMode::LeftConstant;
+        instruction.constant = left.constant;
+      }
+      else if(right.isConstant)
+      {
+        instruction.operandMode = OperandMode::RightConstant;
+        instruction.constant = right.constant;
+      }
+      else
+      {
+        numRegisters--;
+      }
+      left.isConstant = false;
+      program.m_Instructions.push_back(instruction);
+    }
+
+    if(compileStack.size() != 1)
+    {
+      return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::InvalidEquation), "The chosen infix equation is not a valid equation.");
+    }
+    program.m_IsConstant = compileStack.back().isConstant;
+    program.m_Constant = compileStack.back().constant;
+    return {std::move(program)};
+  }
+
+  /**
+   * @brief True if the whole expression folded into getConstant()
+   */
+  bool isConstant() const
+  {
+    return m_IsConstant;
+  }
+
+  float64 getConstant() const
+  {
+    return m_Constant;
+  }
+
+  usize getNumberOfInstructions() const
+  {
+    return m_Instructions.size();
+  }
+
+  /**
+   * @brief Number of block sized registers evaluate() needs
+   */
+  usize getNumberOfRegisters() const
+  {
+    return m_NumRegisters;
+  }
+
+  const IParallelAlgorithm::AlgorithmArrays& getInputArrays() const
+  {
+    return m_InputArrays;
+  }
+
+  /**
+   * @brief Evaluates count values starting at start. The result ends up in the first register.
+   * @param registers getNumberOfRegisters() * k_BlockSize values
+   */
+  void evaluate(usize start, usize count, float64* registers) const
+  {
+    float64* top = registers - k_BlockSize;
+    for(const auto& instruction : m_Instructions)
+    {
+      if(instruction.isLoad)
+      {
+        top += k_BlockSize;
+        load(instruction, start, count, top);
+      }
+      else if(!IsBinary(instruction.opCode))
+      {
+        VisitUnaryOperation(instruction.opCode, m_Units, [top, count](auto operation) {
+          for(usize i = 0; i < count; i++)
+          {
+            top[i] = operation(top[i]);
+          }
+        });
+      }
+      else if(instruction.operandMode == OperandMode::Registers)
+      {
+        float64* left = top - k_BlockSize;
+        const float64* right = top;
+        VisitBinaryOperation(instruction.opCode, [left, right, count](auto operation) {
+          for(usize i = 0; i < count; i++)
+          {
+            left[i] = operation(left[i], right[i]);
+          }
+        });
+        top = left;
+      }
+      else if(instruction.operandMode == OperandMode::LeftConstant)
+      {
+        const float64 constant = instruction.constant;
+        VisitBinaryOperation(instruction.opCode, [top, count, constant](auto operation) {
+          for(usize i = 0; i < count; i++)
+          {
+            top[i] = operation(constant, top[i]);
+          }
+        });
+      }
+      else
+      {
+        const float64 constant = instruction.constant;
+        VisitBinaryOperation(instruction.opCode, [top, count, constant](auto operation) {
+          for(usize i = 0; i < count; i++)
+          {
+            top[i] = operation(top[i], constant);
+          }
+        });
+      }
+    }
+  }
+
+private:
+  static void load(const Instruction& instruction, usize start, usize count, float64* destination)
+  {
+    if(instruction.broadcast)
+    {
+      std::fill_n(destination, count, instruction.inputStore->getValue(0));
+    }
+    else if(instruction.inputData != nullptr)
+    {
+      std::copy_n(instruction.inputData + start, count, destination);
+    }
+    else
+    {
+      for(usize i = 0; i < count; i++)
+      {
+        destination[i] = instruction.inputStore->getValue(start + i);
       }
     }
   }
+
+  std::vector<Instruction> m_Instructions;
+  IParallelAlgorithm::AlgorithmArrays m_InputArrays;
+  CalculatorParameter::AngleUnits m_Units = CalculatorParameter::AngleUnits::Radians;
+  usize m_NumRegisters = 0;
+  bool m_IsConstant = false;
+  float64 m_Constant = 0.0;
 };
 
-struct InitializeArrayFunctor
+/**
+ * @brief Evaluates the calculator program over a range of values one block at a time and
+ * writes each block straight into the output array in its own type.
+ */
+template <typename T>
+class EvaluateCalculatorProgramImpl
 {
-  template <typename T>
-  void operator()(DataStructure& dataStructure, const DataPath& calculatedArrayPath, const Float64Array* inputArray)
+public:
+  EvaluateCalculatorProgramImpl(const CalculatorProgram& program, AbstractDataStore<T>& outputStore, const std::atomic_bool& shouldCancel)
+  : m_Program(program)
+  , m_OutputStore(outputStore)
+  , m_ShouldCancel(shouldCancel)
   {
-    auto& convertedDataStore = dataStructure.getDataAsUnsafe<DataArray<T>>(calculatedArrayPath)->getDataStoreRef();
-    if(nullptr != inputArray && inputArray->getSize() == 1)
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<float64> registers(m_Program.getNumberOfRegisters() * k_BlockSize, 0.0);
+    auto* outputDataStorePtr = dynamic_cast<DataStore<T>*>(&m_OutputStore);
+    for(usize start = range.min(); start < range.max(); start += k_BlockSize)
     {
-      if constexpr(std::is_same_v<float64, T>)
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const usize count = std::min(k_BlockSize, range.max() - start);
+      m_Program.evaluate(start, count, registers.data());
+      if(outputDataStorePtr != nullptr)
       {
-        convertedDataStore.fill(inputArray->at(0));
+        T* outputData = outputDataStorePtr->data() + start;
+        for(usize i = 0; i < count; i++)
+        {
+          outputData[i] = static_cast<T>(registers[i]);
+        }
       }
       else
       {
-        convertedDataStore.fill(static_cast<T>(inputArray->at(0)));
+        for(usize i = 0; i < count; i++)
+        {
+          m_OutputStore.setValue(start + i, static_cast<T>(registers[i]));
+        }
       }
     }
   }
+
+private:
+  const CalculatorProgram& m_Program;
+  AbstractDataStore<T>& m_OutputStore;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+struct EvaluateCalculatorProgramFunctor
+{
+  template <typename T>
+  void operator()(const CalculatorProgram& program, IDataArray& outputArray, const std::atomic_bool& shouldCancel)
+  {
+    auto& outputStore = outputArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    IParallelAlgorithm::AlgorithmArrays algArrays = program.getInputArrays();
+    algArrays.push_back(&outputArray);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, outputStore.getSize());
+    dataAlg.requireArraysInMemory(algArrays);
+    dataAlg.execute(EvaluateCalculatorProgramImpl<T>(program, outputStore, shouldCancel));
+  }
 };
 } // namespace
 
@@ -145,67 +600,26 @@ Result<> ArrayCalculator::operator()()
     return results;
   }
 
-  // Execute the RPN expression
-  DataPath temporaryCalculatedArrayPath = DataPath({m_InputValues->CalculatedArray.getTargetName() + "_TEMPORARY"});
-  std::stack<ICalculatorArray::Pointer> executionStack;
-  int totalItems = rpn.size();
-  for(int rpnCount = 0; rpnCount < totalItems; rpnCount++)
-  {
-    m_MessageHandler({IFilter::Message::Type::Info, "Computing Operator " + StringUtilities::number(rpnCount + 1) + "/" + StringUtilities::number(totalItems)});
-
-    CalculatorItem::Pointer rpnItem = rpn[rpnCount];
-    ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(rpnItem);
-    if(nullptr != calcArray)
-    {
-      // This is an array
-      executionStack.push(calcArray);
-    }
-    else
-    {
-      // This is an operator
-      CalculatorOperator::Pointer rpnOperator = std::dynamic_pointer_cast<CalculatorOperator>(rpnItem);
-
-      rpnOperator->calculate(parser.m_TemporaryDataStructure, m_InputValues->Units, temporaryCalculatedArrayPath, executionStack);
-    }
-
-    if(getCancel())
-    {
-      return results;
-    }
-  }
-
-  // Grab the result from the stack
-  ICalculatorArray::Pointer arrayItem = ICalculatorArray::NullPointer();
-  if(executionStack.size() != 1)
+  // Compile the RPN expression once and evaluate it in parallel blocks straight into the output array
+  Result<CalculatorProgram> programResults = CalculatorProgram::Compile(rpn, m_InputValues->Units);
+  if(programResults.invalid())
   {
-    results.errors().push_back(Error{static_cast<int>(CalculatorItem::ErrorCode::InvalidEquation), "The chosen infix equation is not a valid equation."});
+    results.errors() = programResults.errors();
     return results;
   }
-  if(!executionStack.empty())
-  {
-    arrayItem = executionStack.top();
-    executionStack.pop();
-  }
+  const CalculatorProgram& program = programResults.value();
 
-  if(arrayItem != ICalculatorArray::NullPointer())
+  // A constant result has nothing left to evaluate per value
+  if(program.isConstant())
   {
-    const Float64Array* resultArray = arrayItem->getArray();
-    if(arrayItem->isNumber() && m_DataStructure.getDataAs<AttributeMatrix>(m_InputValues->CalculatedArray.getParent()) != nullptr)
-    {
-      ExecuteDataFunction(InitializeArrayFunctor{}, ConvertNumericTypeToDataType(m_InputValues->ScalarType), m_DataStructure, m_InputValues->CalculatedArray, resultArray);
-    }
-    else
-    {
-      ExecuteDataFunction(CopyArrayFunctor{}, ConvertNumericTypeToDataType(m_InputValues->ScalarType), m_DataStructure, m_InputValues->CalculatedArray, resultArray);
-    }
-  }
-  else
-  {
-    results.errors().push_back(Error{static_cast<int>(CalculatorItem::ErrorCode::UnexpectedOutput), "Unexpected output item from chosen infix expression; the output item must be an array\n"
-                                                                                                    "Please contact the DREAM.3D developers for more information"});
-    return results;
+    ExecuteDataFunction(InitializeArrayFunctor{}, ConvertNumericTypeToDataType(m_InputValues->ScalarType), m_DataStructure, m_InputValues->CalculatedArray, program.getConstant());
+    return {};
   }
 
+  m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Evaluating {} instructions", program.getNumberOfInstructions())});
+  auto& calculatedArray = m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->CalculatedArray);
+  ExecuteDataFunction(EvaluateCalculatorProgramFunctor{}, calculatedArray.getDataType(), program, calculatedArray, m_ShouldCancel);
+
   return {};
 }
 
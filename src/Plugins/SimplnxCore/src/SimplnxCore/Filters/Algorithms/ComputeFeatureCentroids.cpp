@@ -3,84 +3,17 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
-#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/FeatureReductionUtilities.hpp"
 
 using namespace nx::core;
 
 namespace
 {
-class ComputeFeatureCentroidsImpl1
+struct CentroidAccumulator
 {
-public:
-  ComputeFeatureCentroidsImpl1(double* sum, double* center, size_t* count, std::array<size_t, 3> dims, const nx::core::ImageGeom& imageGeom, const Int32AbstractDataStore& featureIds)
-  : m_Sum(sum)
-  , m_Center(center)
-  , m_Count(count)
-  , m_Dims(dims)
-  , m_ImageGeom(imageGeom)
-  , m_FeatureIds(featureIds)
-  {
-  }
-  ~ComputeFeatureCentroidsImpl1() = default;
-  void compute(usize minFeatureId, usize maxFeatureId) const
-  {
-    for(size_t i = 0; i < m_Dims[2]; i++)
-    {
-      size_t zStride = i * m_Dims[0] * m_Dims[1];
-      for(size_t j = 0; j < m_Dims[1]; j++)
-      {
-        size_t yStride = j * m_Dims[0];
-        for(size_t k = 0; k < m_Dims[0]; k++)
-        {
-          int32 featureId = m_FeatureIds[zStride + yStride + k]; // Get the current FeatureId
-          if(featureId < minFeatureId || featureId >= maxFeatureId)
-          {
-            continue;
-          }
-          nx::core::Point3Dd voxel_center = m_ImageGeom.getCoords(k, j, i); // Get the voxel center based on XYZ index from Image Geom
-
-          // Kahan Sum for X Coord
-          size_t featureId_idx = featureId * 3ULL;
-          auto componentValue = static_cast<double>(voxel_center[0] - m_Center[featureId_idx]);
-          double temp = m_Sum[featureId_idx] + componentValue;
-          m_Center[featureId_idx] = (temp - m_Sum[featureId_idx]) - componentValue;
-          m_Sum[featureId_idx] = temp;
-          m_Count[featureId_idx]++;
-
-          // Kahan Sum for Y Coord
-          featureId_idx = featureId * 3ULL + 1;
-          componentValue = static_cast<double>(voxel_center[1] - m_Center[featureId_idx]);
-          temp = m_Sum[featureId_idx] + componentValue;
-          m_Center[featureId_idx] = (temp - m_Sum[featureId_idx]) - componentValue;
-          m_Sum[featureId_idx] = temp;
-          m_Count[featureId_idx]++;
-
-          // Kahan Sum for Z Coord
-          featureId_idx = featureId * 3ULL + 2;
-          componentValue = static_cast<double>(voxel_center[2] - m_Center[featureId_idx]);
-          temp = m_Sum[featureId_idx] + componentValue;
-          m_Center[featureId_idx] = (temp - m_Sum[featureId_idx]) - componentValue;
-          m_Sum[featureId_idx] = temp;
-          m_Count[featureId_idx]++;
-        }
-      }
-    }
-  }
-
-  void operator()(const Range& range) const
-  {
-    compute(range.min(), range.max());
-  }
-
-private:
-  double* m_Sum = nullptr;
-  double* m_Center = nullptr;
-  size_t* m_Count = nullptr;
-  std::array<size_t, 3> m_Dims = {0, 0, 0};
-  const nx::core::ImageGeom& m_ImageGeom;
-  const Int32AbstractDataStore& m_FeatureIds;
+  std::array<FeatureReduction::KahanSum, 3> sum;
+  usize count = 0;
 };
-
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -106,7 +39,8 @@ const std::atomic_bool& ComputeFeatureCentroids::getCancel()
 Result<> ComputeFeatureCentroids::operator()()
 {
   // Input Cell Data
-  const auto& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
+  const auto* featureIdsArray = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
+  const auto& featureIds = featureIdsArray->getDataStoreRef();
 
   // Output Feature Data
   auto& centroids = m_DataStructure.getDataAs<Float32Array>(m_InputValues->CentroidsArrayPath)->getDataStoreRef();
@@ -116,43 +50,68 @@ Result<> ComputeFeatureCentroids::operator()()
 
   size_t totalFeatures = centroids.getNumberOfTuples();
 
-  size_t xPoints = imageGeom.getNumXCells();
-  size_t yPoints = imageGeom.getNumYCells();
-  size_t zPoints = imageGeom.getNumZCells();
-
-  std::vector<double> sum(totalFeatures * 3, 0.0);
-  std::vector<double> center(totalFeatures * 3, 0.0);
-  std::vector<size_t> count(totalFeatures * 3, 0.0);
+  const usize xPoints = imageGeom.getNumXCells();
+  const usize yPoints = imageGeom.getNumYCells();
+  const usize zPoints = imageGeom.getNumZCells();
+  const usize xyPoints = xPoints * yPoints;
+
+  // Single parallel pass over the voxels; every block of voxels accumulates into its own
+  // per feature Kahan sums which are merged in a fixed order afterwards.
+  std::vector<CentroidAccumulator> accumulators = FeatureReduction::ReduceByFeature(
+      xyPoints * zPoints, totalFeatures, CentroidAccumulator{},
+      [&](CentroidAccumulator* featureAccumulators, usize voxelBegin, usize voxelEnd) {
+        usize x = voxelBegin % xPoints;
+        usize y = (voxelBegin / xPoints) % yPoints;
+        usize z = voxelBegin / xyPoints;
+        for(usize voxelIndex = voxelBegin; voxelIndex < voxelEnd; voxelIndex++)
+        {
+          const int32 featureId = featureIds[voxelIndex];
+          if(featureId >= 0 && static_cast<usize>(featureId) < totalFeatures)
+          {
+            const Point3Dd voxelCenter = imageGeom.getCoords(x, y, z);
+            CentroidAccumulator& accumulator = featureAccumulators[featureId];
+            accumulator.sum[0].add(voxelCenter[0]);
+            accumulator.sum[1].add(voxelCenter[1]);
+            accumulator.sum[2].add(voxelCenter[2]);
+            accumulator.count++;
+          }
+          if(++x == xPoints)
+          {
+            x = 0;
+            if(++y == yPoints)
+            {
+              y = 0;
+              z++;
+            }
+          }
+        }
+      },
+      [](CentroidAccumulator& target, const CentroidAccumulator& source) {
+        for(usize i = 0; i < 3; i++)
+        {
+          target.sum[i].merge(source.sum[i]);
+        }
+        target.count += source.count;
+      },
+      m_ShouldCancel, {featureIdsArray});
 
-  // The first part can be expensive so parallelize the algorithm
-  ParallelDataAlgorithm dataAlg;
-  dataAlg.setRange(0, totalFeatures);
-  // This is OFF because we spend more time spinning up threads than actually
-  // computing things. Maybe if we were to break teh total number of features
-  // by the total number of cores/threads and do a ParallelTask Algorithm instead
-  // we might see some speedup.
-  dataAlg.setParallelizationEnabled(false);
-  dataAlg.execute(ComputeFeatureCentroidsImpl1(sum.data(), center.data(), count.data(), {xPoints, yPoints, zPoints}, imageGeom, featureIds));
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
 
   // Here we are only looping over the number of features so let this just go in serial mode.
-  for(size_t featureId = 0; featureId < totalFeatures; featureId++)
+  for(usize featureId = 0; featureId < totalFeatures; featureId++)
   {
-    auto featureId_idx = static_cast<size_t>(featureId * 3);
-    if(static_cast<float>(count[featureId_idx]) > 0.0f)
+    const CentroidAccumulator& accumulator = accumulators[featureId];
+    if(accumulator.count == 0)
     {
-      centroids[featureId_idx] = static_cast<float>(sum[featureId_idx] / static_cast<double>(count[featureId_idx]));
+      continue;
     }
-
-    featureId_idx++; // featureId * 3 + 1
-    if(static_cast<float>(count[featureId_idx]) > 0.0f)
-    {
-      centroids[featureId_idx] = static_cast<float>(sum[featureId_idx] / static_cast<double>(count[featureId_idx]));
-    }
-
-    featureId_idx++; // featureId * 3 + 2
-    if(static_cast<float>(count[featureId_idx]) > 0.0f)
+    const auto count = static_cast<float64>(accumulator.count);
+    for(usize i = 0; i < 3; i++)
     {
-      centroids[featureId_idx] = static_cast<float>(sum[featureId_idx] / static_cast<double>(count[featureId_idx]));
+      centroids[featureId * 3 + i] = static_cast<float32>(accumulator.sum[i].value() / count);
     }
   }
 
@@ -1,16 +1,17 @@
 #include "ComputeFeatureRect.hpp"
 
 #include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/Utilities/FeatureReductionUtilities.hpp"
 
 using namespace nx::core;
 
 namespace
 {
-// -----------------------------------------------------------------------------
-usize IndexFromCoord(const std::vector<usize>& tDims, usize x, usize y, usize z)
+struct RectAccumulator
 {
-  return (tDims[1] * tDims[0] * z) + (tDims[0] * y) + x;
-}
+  std::array<uint32, 6> corners = {std::numeric_limits<uint32>::max(), std::numeric_limits<uint32>::max(), std::numeric_limits<uint32>::max(),
+                                   std::numeric_limits<uint32>::min(), std::numeric_limits<uint32>::min(), std::numeric_limits<uint32>::min()};
+};
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -39,16 +40,7 @@ Result<> ComputeFeatureRect::operator()()
   auto* corners = m_DataStructure.getDataAs<UInt32Array>(m_InputValues->FeatureRectArrayPath);
   auto& cornersStore = corners->getDataStoreRef();
 
-  // Create corners array, which stores pixel coordinates for the top-left and bottom-right coordinates of each feature object
-  for(usize i = 0; i < cornersStore.getNumberOfTuples(); i++)
-  {
-    cornersStore.setComponent(i, 0, std::numeric_limits<uint32>::max());
-    cornersStore.setComponent(i, 1, std::numeric_limits<uint32>::max());
-    cornersStore.setComponent(i, 2, std::numeric_limits<uint32>::max());
-    cornersStore.setComponent(i, 3, std::numeric_limits<uint32>::min());
-    cornersStore.setComponent(i, 4, std::numeric_limits<uint32>::min());
-    cornersStore.setComponent(i, 5, std::numeric_limits<uint32>::min());
-  }
+  const usize numFeatures = cornersStore.getNumberOfTuples();
   std::vector<usize> imageDims = featureIdsStore.getTupleShape();
 
   /*
@@ -60,49 +52,75 @@ Result<> ComputeFeatureRect::operator()()
   const usize xDim = imageDims[0];
   const usize yDim = imageDims[1];
   const usize zDim = imageDims[2];
-
-  usize index = 0;
-  // Store the coordinates in the corners array
-  for(uint32 z = 0; z < zDim; z++)
-  {
-    if(getCancel())
-    {
-      return {};
-    }
-
-    for(uint32 y = 0; y < yDim; y++)
-    {
-      for(uint32 x = 0; x < xDim; x++)
-      {
-        index = IndexFromCoord(imageDims, x, y, z); // Index into featureIds array
-
-        const int32 featureId = featureIdsStore[index];
-        if(featureId == 0)
-        {
-          continue;
-        }
-
-        if(featureId >= cornersStore.getNumberOfTuples())
+  const usize xyDim = xDim * yDim;
+
+  std::atomic_bool featureIdOutOfRange = false;
+
+  // Store the coordinates in the corners array. The corners array stores pixel coordinates for the
+  // top-left and bottom-right coordinates of each feature object
+  std::vector<RectAccumulator> rects = FeatureReduction::ReduceByFeature(
+      xyDim * zDim, numFeatures, RectAccumulator{},
+      [&](RectAccumulator* featureRects, usize voxelBegin, usize voxelEnd) {
+        auto x = static_cast<uint32>(voxelBegin % xDim);
+        auto y = static_cast<uint32>((voxelBegin / xDim) % yDim);
+        auto z = static_cast<uint32>(voxelBegin / xyDim);
+        for(usize index = voxelBegin; index < voxelEnd; index++)
         {
-          const DataPath parentPath = m_InputValues->FeatureRectArrayPath.getParent();
-          return MakeErrorResult(-31000, fmt::format("The parent data object '{}' of output array '{}' has a smaller tuple count than the maximum feature id in '{}'", parentPath.getTargetName(),
-                                                     corners->getName(), featureIds->getName()));
-        }
-
-        const uint32 indices[3] = {x, y, z}; // Sequence dependent DO NOT REORDER
-        const int32 featureShift = featureId * 6;
-        for(uint8 l = 0; l < 6; l++) // unsigned is faster with modulo
-        {
-          if(l > 2)
+          const int32 featureId = featureIdsStore[index];
+          if(featureId != 0)
           {
-            cornersStore[featureShift + l] = std::max(cornersStore[featureShift + l], indices[l - 3]);
+            if(featureId < 0 || static_cast<usize>(featureId) >= numFeatures)
+            {
+              featureIdOutOfRange = true;
+            }
+            else
+            {
+              const uint32 indices[3] = {x, y, z}; // Sequence dependent DO NOT REORDER
+              std::array<uint32, 6>& featureCorners = featureRects[featureId].corners;
+              for(uint8 l = 0; l < 3; l++)
+              {
+                featureCorners[l] = std::min(featureCorners[l], indices[l]);
+                featureCorners[l + 3] = std::max(featureCorners[l + 3], indices[l]);
+              }
+            }
           }
-          else
+          if(++x == xDim)
           {
-            cornersStore[featureShift + l] = std::min(cornersStore[featureShift + l], indices[l]);
+            x = 0;
+            if(++y == yDim)
+            {
+              y = 0;
+              z++;
+            }
           }
         }
-      }
+      },
+      [](RectAccumulator& target, const RectAccumulator& source) {
+        for(uint8 l = 0; l < 3; l++)
+        {
+          target.corners[l] = std::min(target.corners[l], source.corners[l]);
+          target.corners[l + 3] = std::max(target.corners[l + 3], source.corners[l + 3]);
+        }
+      },
+      m_ShouldCancel, {featureIds});
+
+  if(getCancel())
+  {
+    return {};
+  }
+
+  if(featureIdOutOfRange)
+  {
+    const DataPath parentPath = m_InputValues->FeatureRectArrayPath.getParent();
+    return MakeErrorResult(-31000, fmt::format("The parent data object '{}' of output array '{}' has a smaller tuple count than the maximum feature id in '{}'", parentPath.getTargetName(),
+                                               corners->getName(), featureIds->getName()));
+  }
+
+  for(usize featureId = 0; featureId < numFeatures; featureId++)
+  {
+    for(usize l = 0; l < 6; l++)
+    {
+      cornersStore[featureId * 6 + l] = rects[featureId].corners[l];
     }
   }
 
@@ -4,27 +4,365 @@
 #include "simplnx/Utilities/ClusteringUtilities.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 
 using namespace nx::core;
 
 namespace
 {
+constexpr usize k_MinTuplesPerBlock = 16384;
+constexpr usize k_MaxBlocks = 128;
+
+/**
+ * @brief Splits the tuples into a fixed set of contiguous blocks. Every block owns its own partial sums, so the
+ * parallel passes never share an accumulator, and merging the blocks in order keeps the result independent of the
+ * number of threads.
+ */
+struct TupleBlocks
+{
+  explicit TupleBlocks(usize numTuples)
+  : NumTuples(numTuples)
+  , NumBlocks(std::clamp<usize>((numTuples + k_MinTuplesPerBlock - 1) / k_MinTuplesPerBlock, 1, k_MaxBlocks))
+  , BlockSize((numTuples + NumBlocks - 1) / NumBlocks)
+  {
+  }
+
+  usize begin(usize block) const
+  {
+    return std::min(block * BlockSize, NumTuples);
+  }
+
+  usize end(usize block) const
+  {
+    return std::min((block + 1) * BlockSize, NumTuples);
+  }
+
+  usize NumTuples = 0;
+  usize NumBlocks = 1;
+  usize BlockSize = 0;
+};
+
+/**
+ * @brief Per block centroid sums of one assignment pass.
+ */
+struct BlockAccumulator
+{
+  std::vector<float64> Sums;
+  std::vector<uint64> Counts;
+  usize NumChanged = 0;
+};
+
+/**
+ * @brief The Hamerly bounds are only valid for metrics that satisfy the triangle inequality. Squared Euclidean
+ * produces the same assignment as Euclidean, so the bounds are kept in Euclidean distance for it.
+ */
+bool SupportsPruning(ClusterUtilities::DistanceMetric distMetric)
+{
+  return distMetric == ClusterUtilities::Euclidean || distMetric == ClusterUtilities::SquaredEuclidean || distMetric == ClusterUtilities::Manhattan;
+}
+
+ClusterUtilities::DistanceMetric BoundsMetric(ClusterUtilities::DistanceMetric distMetric)
+{
+  return distMetric == ClusterUtilities::SquaredEuclidean ? ClusterUtilities::Euclidean : distMetric;
+}
+
+template <typename T>
+void LoadTuple(const AbstractDataStore<T>& inputStore, usize tupleIndex, usize numComps, std::vector<float64>& point)
+{
+  const usize offset = tupleIndex * numComps;
+  for(usize comp = 0; comp < numComps; comp++)
+  {
+    point[comp] = static_cast<float64>(inputStore[offset + comp]);
+  }
+}
+
+/**
+ * @brief Returns the closest of the clusters 1..numClusters and the distances to the closest and second closest.
+ */
+int32 FindClosestCluster(const std::vector<float64>& point, const std::vector<float64>& centroids, usize numClusters, usize numComps, ClusterUtilities::DistanceMetric distMetric,
+                         float64& closestDist, float64& secondDist)
+{
+  int32 closest = 1;
+  closestDist = std::numeric_limits<float64>::max();
+  secondDist = std::numeric_limits<float64>::max();
+  for(usize cluster = 1; cluster <= numClusters; cluster++)
+  {
+    const float64 dist = ClusterUtilities::GetDistance(point, 0, centroids, numComps * cluster, numComps, distMetric);
+    if(dist < closestDist)
+    {
+      secondDist = closestDist;
+      closestDist = dist;
+      closest = static_cast<int32>(cluster);
+    }
+    else if(dist < secondDist)
+    {
+      secondDist = dist;
+    }
+  }
+  return closest;
+}
+
+/**
+ * @brief Center movement of the last update, used to loosen the Hamerly bounds at the start of the next pass.
+ */
+struct CentroidShifts
+{
+  std::vector<float64> Shifts;
+  int32 MaxShiftCluster = 0;
+  float64 MaxShift = 0.0;
+  float64 SecondMaxShift = 0.0;
+};
+
+/**
+ * @brief One Lloyd assignment pass over a range of blocks. Each tuple is assigned to its nearest centroid and its
+ * values are added to the block's centroid sums. When pruning is enabled the per tuple upper/lower bounds skip the
+ * distance computations for tuples that provably keep their cluster.
+ */
+template <typename T>
+class AssignClustersImpl
+{
+public:
+  AssignClustersImpl(const AbstractDataStore<T>& inputStore, const MaskCompare& mask, Int32AbstractDataStore& featureIds, const std::vector<float64>& centroids, usize numClusters, usize numComps,
+                     ClusterUtilities::DistanceMetric distMetric, const TupleBlocks& blocks, std::vector<BlockAccumulator>& accumulators, const std::atomic_bool& shouldCancel)
+  : m_InputStore(inputStore)
+  , m_Mask(mask)
+  , m_FeatureIds(featureIds)
+  , m_Centroids(centroids)
+  , m_NumClusters(numClusters)
+  , m_NumComps(numComps)
+  , m_DistMetric(distMetric)
+  , m_Blocks(blocks)
+  , m_Accumulators(accumulators)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void enablePruning(std::vector<float64>* upperBounds, std::vector<float64>* lowerBounds, const std::vector<float64>* halfMinCenterDist, const CentroidShifts* shifts, bool boundsValid)
+  {
+    m_UpperBounds = upperBounds;
+    m_LowerBounds = lowerBounds;
+    m_HalfMinCenterDist = halfMinCenterDist;
+    m_Shifts = shifts;
+    m_BoundsValid = boundsValid;
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<float64> point(m_NumComps);
+    const bool usePruning = m_UpperBounds != nullptr;
+    const ClusterUtilities::DistanceMetric searchMetric = usePruning ? BoundsMetric(m_DistMetric) : m_DistMetric;
+
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      BlockAccumulator& accumulator = m_Accumulators[block];
+      std::fill(accumulator.Sums.begin(), accumulator.Sums.end(), 0.0);
+      std::fill(accumulator.Counts.begin(), accumulator.Counts.end(), 0);
+      accumulator.NumChanged = 0;
+
+      for(usize tupleIndex = m_Blocks.begin(block); tupleIndex < m_Blocks.end(block); tupleIndex++)
+      {
+        if(m_ShouldCancel)
+        {
+          return;
+        }
+        LoadTuple(m_InputStore, tupleIndex, m_NumComps, point);
+
+        int32 cluster = 0;
+        if(m_Mask.isTrue(tupleIndex))
+        {
+          const int32 current = m_FeatureIds[tupleIndex];
+          float64 closestDist = 0.0;
+          float64 secondDist = 0.0;
+          if(usePruning && m_BoundsValid)
+          {
+            float64& upper = (*m_UpperBounds)[tupleIndex];
+            float64& lower = (*m_LowerBounds)[tupleIndex];
+            upper += m_Shifts->Shifts[current];
+            lower -= (current == m_Shifts->MaxShiftCluster) ? m_Shifts->SecondMaxShift : m_Shifts->MaxShift;
+
+            cluster = current;
+            const float64 bound = std::max((*m_HalfMinCenterDist)[current], lower);
+            if(upper > bound)
+            {
+              upper = ClusterUtilities::GetDistance(point, 0, m_Centroids, m_NumComps * current, m_NumComps, searchMetric);
+              if(upper > bound)
+              {
+                cluster = FindClosestCluster(point, m_Centroids, m_NumClusters, m_NumComps, searchMetric, closestDist, secondDist);
+                upper = closestDist;
+                lower = secondDist;
+              }
+            }
+          }
+          else
+          {
+            cluster = FindClosestCluster(point, m_Centroids, m_NumClusters, m_NumComps, searchMetric, closestDist, secondDist);
+            if(usePruning)
+            {
+              (*m_UpperBounds)[tupleIndex] = closestDist;
+              (*m_LowerBounds)[tupleIndex] = secondDist;
+            }
+          }
+          if(cluster != current)
+          {
+            accumulator.NumChanged++;
+          }
+        }
+        m_FeatureIds[tupleIndex] = cluster;
+
+        const usize offset = static_cast<usize>(cluster) * m_NumComps;
+        for(usize comp = 0; comp < m_NumComps; comp++)
+        {
+          accumulator.Sums[offset + comp] += point[comp];
+        }
+        accumulator.Counts[cluster]++;
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<T>& m_InputStore;
+  const MaskCompare& m_Mask;
+  Int32AbstractDataStore& m_FeatureIds;
+  const std::vector<float64>& m_Centroids;
+  usize m_NumClusters;
+  usize m_NumComps;
+  ClusterUtilities::DistanceMetric m_DistMetric;
+  const TupleBlocks& m_Blocks;
+  std::vector<BlockAccumulator>& m_Accumulators;
+  const std::atomic_bool& m_ShouldCancel;
+
+  std::vector<float64>* m_UpperBounds = nullptr;
+  std::vector<float64>* m_LowerBounds = nullptr;
+  const std::vector<float64>* m_HalfMinCenterDist = nullptr;
+  const CentroidShifts* m_Shifts = nullptr;
+  bool m_BoundsValid = false;
+};
+
+/**
+ * @brief k-means++ helper: lowers every usable tuple's seeding weight to its (squared) distance from the newest
+ * centroid and sums the weights of each block.
+ */
+template <typename T>
+class UpdateSeedWeightsImpl
+{
+public:
+  UpdateSeedWeightsImpl(const AbstractDataStore<T>& inputStore, const MaskCompare& mask, const std::vector<float64>& centroids, usize newCluster, usize numComps,
+                        ClusterUtilities::DistanceMetric distMetric, const TupleBlocks& blocks, std::vector<float64>& weights, std::vector<float64>& blockTotals)
+  : m_InputStore(inputStore)
+  , m_Mask(mask)
+  , m_Centroids(centroids)
+  , m_NewCluster(newCluster)
+  , m_NumComps(numComps)
+  , m_DistMetric(distMetric)
+  , m_Blocks(blocks)
+  , m_Weights(weights)
+  , m_BlockTotals(blockTotals)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<float64> point(m_NumComps);
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      float64 total = 0.0;
+      for(usize tupleIndex = m_Blocks.begin(block); tupleIndex < m_Blocks.end(block); tupleIndex++)
+      {
+        if(!m_Mask.isTrue(tupleIndex))
+        {
+          m_Weights[tupleIndex] = 0.0;
+          continue;
+        }
+        LoadTuple(m_InputStore, tupleIndex, m_NumComps, point);
+        float64 dist = std::max(ClusterUtilities::GetDistance(point, 0, m_Centroids, m_NumComps * m_NewCluster, m_NumComps, m_DistMetric), 0.0);
+        if(m_DistMetric != ClusterUtilities::SquaredEuclidean)
+        {
+          dist *= dist;
+        }
+        m_Weights[tupleIndex] = (m_NewCluster == 1) ? dist : std::min(m_Weights[tupleIndex], dist);
+        total += m_Weights[tupleIndex];
+      }
+      m_BlockTotals[block] = total;
+    }
+  }
+
+private:
+  const AbstractDataStore<T>& m_InputStore;
+  const MaskCompare& m_Mask;
+  const std::vector<float64>& m_Centroids;
+  usize m_NewCluster;
+  usize m_NumComps;
+  ClusterUtilities::DistanceMetric m_DistMetric;
+  const TupleBlocks& m_Blocks;
+  std::vector<float64>& m_Weights;
+  std::vector<float64>& m_BlockTotals;
+};
+
+/**
+ * @brief Mini-batch helper: finds the closest centroid of every sampled tuple.
+ */
+template <typename T>
+class AssignBatchImpl
+{
+public:
+  AssignBatchImpl(const AbstractDataStore<T>& inputStore, const std::vector<usize>& batch, const std::vector<float64>& centroids, usize numClusters, usize numComps,
+                  ClusterUtilities::DistanceMetric distMetric, std::vector<int32>& batchClusters)
+  : m_InputStore(inputStore)
+  , m_Batch(batch)
+  , m_Centroids(centroids)
+  , m_NumClusters(numClusters)
+  , m_NumComps(numComps)
+  , m_DistMetric(distMetric)
+  , m_BatchClusters(batchClusters)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<float64> point(m_NumComps);
+    float64 closestDist = 0.0;
+    float64 secondDist = 0.0;
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      LoadTuple(m_InputStore, m_Batch[i], m_NumComps, point);
+      m_BatchClusters[i] = FindClosestCluster(point, m_Centroids, m_NumClusters, m_NumComps, m_DistMetric, closestDist, secondDist);
+    }
+  }
+
+private:
+  const AbstractDataStore<T>& m_InputStore;
+  const std::vector<usize>& m_Batch;
+  const std::vector<float64>& m_Centroids;
+  usize m_NumClusters;
+  usize m_NumComps;
+  ClusterUtilities::DistanceMetric m_DistMetric;
+  std::vector<int32>& m_BatchClusters;
+};
+
 template <typename T>
 class ComputeKMeansTemplate
 {
 public:
-  ComputeKMeansTemplate(ComputeKMeans* filter, const IDataArray* inputIDataArray, IDataArray* meansIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
-                        Int32AbstractDataStore& fIds, ClusterUtilities::DistanceMetric distMetric, std::mt19937_64::result_type seed)
+  ComputeKMeansTemplate(ComputeKMeans* filter, const IDataArray* inputIDataArray, IDataArray* meansIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, Int32Array& featureIdsArray,
+                        const ComputeKMeansInputValues* inputValues)
   : m_Filter(filter)
+  , m_InputIDataArray(inputIDataArray)
   , m_InputArray(inputIDataArray->template getIDataStoreRefAs<AbstractDataStoreT>())
   , m_Means(meansIDataArray->template getIDataStoreRefAs<AbstractDataStoreT>())
   , m_Mask(maskDataArray)
-  , m_NumClusters(numClusters)
-  , m_FeatureIds(fIds)
-  , m_DistMetric(distMetric)
-  , m_Seed(seed)
+  , m_NumClusters(inputValues->InitClusters)
+  , m_FeatureIdsArray(featureIdsArray)
+  , m_FeatureIds(featureIdsArray.getDataStoreRef())
+  , m_DistMetric(inputValues->DistanceMetric)
+  , m_InputValues(inputValues)
+  , m_NumTuples(m_InputArray.getNumberOfTuples())
+  , m_NumComps(m_InputArray.getNumberOfComponents())
+  , m_Blocks(m_NumTuples)
+  , m_Generator(inputValues->Seed)
   {
   }
   ~ComputeKMeansTemplate() = default;
@@ -35,147 +373,334 @@ public:
   // -----------------------------------------------------------------------------
   void operator()()
   {
-    usize numTuples = m_InputArray.getNumberOfTuples();
-    int32 numCompDims = m_InputArray.getNumberOfComponents();
+    // Row 0 holds the mean of the masked out tuples (cluster 0); rows 1..k are the actual clusters
+    m_Centroids.assign((m_NumClusters + 1) * m_NumComps, 0.0);
+    m_Accumulators.resize(m_Blocks.NumBlocks);
+    for(auto& accumulator : m_Accumulators)
+    {
+      accumulator.Sums.resize(m_Centroids.size());
+      accumulator.Counts.resize(m_NumClusters + 1);
+    }
 
-    const usize rangeMax = numTuples - 1;
+    if(m_InputValues->UseKMeansPlusPlus)
+    {
+      seedKMeansPlusPlus();
+    }
+    else
+    {
+      seedRandom();
+    }
+    if(m_Filter->getCancel())
+    {
+      return;
+    }
 
-    std::mt19937_64 gen(m_Seed);
-    std::uniform_real_distribution<float64> dist(0.0, 1.0);
+    if(m_InputValues->UseMiniBatch)
+    {
+      runMiniBatch();
+    }
+    else
+    {
+      runLloyd();
+    }
+    if(m_Filter->getCancel())
+    {
+      return;
+    }
+
+    for(usize i = 0; i < m_Centroids.size(); i++)
+    {
+      m_Means[i] = static_cast<T>(m_Centroids[i]);
+    }
+  }
+
+private:
+  using AbstractDataStoreT = AbstractDataStore<T>;
+  ComputeKMeans* m_Filter;
+  const IDataArray* m_InputIDataArray;
+  const AbstractDataStoreT& m_InputArray;
+  AbstractDataStoreT& m_Means;
+  const std::unique_ptr<MaskCompare>& m_Mask;
+  usize m_NumClusters;
+  Int32Array& m_FeatureIdsArray;
+  Int32AbstractDataStore& m_FeatureIds;
+  ClusterUtilities::DistanceMetric m_DistMetric;
+  const ComputeKMeansInputValues* m_InputValues;
+  usize m_NumTuples;
+  usize m_NumComps;
+  TupleBlocks m_Blocks;
+  std::mt19937_64 m_Generator;
+  std::vector<float64> m_Centroids;
+  std::vector<BlockAccumulator> m_Accumulators;
+
+  // -----------------------------------------------------------------------------
+  usize randomMaskedTuple()
+  {
+    std::uniform_int_distribution<usize> dist(0, m_NumTuples - 1);
+    usize index = dist(m_Generator);
+    while(!m_Mask->isTrue(index))
+    {
+      index = dist(m_Generator);
+    }
+    return index;
+  }
+
+  // -----------------------------------------------------------------------------
+  void copyTupleToCentroid(usize tupleIndex, usize cluster)
+  {
+    for(usize comp = 0; comp < m_NumComps; comp++)
+    {
+      m_Centroids[cluster * m_NumComps + comp] = static_cast<float64>(m_InputArray[tupleIndex * m_NumComps + comp]);
+    }
+  }
 
-    std::vector<usize> clusterIdxs(m_NumClusters);
+  // -----------------------------------------------------------------------------
+  ParallelDataAlgorithm makeBlockAlgorithm() const
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, m_Blocks.NumBlocks);
+    dataAlg.requireArraysInMemory({m_InputIDataArray, &m_FeatureIdsArray});
+    return dataAlg;
+  }
 
-    usize clusterChoices = 0;
-    while(clusterChoices < m_NumClusters)
+  // -----------------------------------------------------------------------------
+  void seedRandom()
+  {
+    // Draw the tuples exactly like version 1 of the filter so that the same seed picks the same initial centroids.
+    // That draw never reaches the last tuple, so the last tuple is only taken when it is the one usable tuple.
+    if(m_Mask->isTrue(m_NumTuples - 1) && m_Mask->countTrueValues() == 1)
     {
-      usize index = std::floor(dist(gen) * static_cast<float64>(rangeMax));
-      if(m_Mask->isTrue(index))
-      {
-        clusterIdxs[clusterChoices] = index;
-        clusterChoices++;
-      }
+      copyTupleToCentroid(m_NumTuples - 1, 1);
+      return;
     }
 
-    for(usize i = 0; i < m_NumClusters; i++)
+    std::uniform_real_distribution<float64> dist(0.0, 1.0);
+    const auto rangeMax = static_cast<float64>(m_NumTuples - 1);
+    usize cluster = 1;
+    while(cluster <= m_NumClusters)
     {
-      for(int32 j = 0; j < numCompDims; j++)
+      const auto index = static_cast<usize>(std::floor(dist(m_Generator) * rangeMax));
+      if(m_Mask->isTrue(index))
       {
-        m_Means[numCompDims * (i + 1) + j] = m_InputArray[numCompDims * clusterIdxs[i] + j];
+        copyTupleToCentroid(index, cluster);
+        cluster++;
       }
     }
+  }
 
-    std::vector<float64> oldMeans(m_NumClusters);
-    std::vector<float64> differences(m_NumClusters);
-    usize iteration = 1;
-    usize updateCheck = 0;
-    while(updateCheck != m_NumClusters)
+  // -----------------------------------------------------------------------------
+  void seedKMeansPlusPlus()
+  {
+    copyTupleToCentroid(randomMaskedTuple(), 1);
+
+    std::vector<float64> weights(m_NumTuples, 0.0);
+    std::vector<float64> blockTotals(m_Blocks.NumBlocks, 0.0);
+    std::uniform_real_distribution<float64> uniform(0.0, 1.0);
+    for(usize cluster = 2; cluster <= m_NumClusters; cluster++)
     {
       if(m_Filter->getCancel())
       {
         return;
       }
-      findClusters(numTuples, numCompDims);
+      m_Filter->updateProgress(fmt::format("Seeding Clusters || {}/{}", cluster, m_NumClusters));
+      makeBlockAlgorithm().execute(UpdateSeedWeightsImpl<T>(m_InputArray, *m_Mask, m_Centroids, cluster - 1, m_NumComps, m_DistMetric, m_Blocks, weights, blockTotals));
 
-      for(usize i = 0; i < m_NumClusters; i++)
+      const float64 total = std::accumulate(blockTotals.begin(), blockTotals.end(), 0.0);
+      if(total <= 0.0)
       {
-        oldMeans[i] = m_Means[i + 1];
+        // Every usable tuple sits on a centroid already
+        copyTupleToCentroid(randomMaskedTuple(), cluster);
+        continue;
       }
 
-      findMeans(numTuples, numCompDims);
-
-      updateCheck = 0;
-      for(usize i = 0; i < m_NumClusters; i++)
+      // Pick a tuple with probability proportional to its weight: first the block, then the tuple inside it
+      float64 target = uniform(m_Generator) * total;
+      usize block = 0;
+      while(block + 1 < m_Blocks.NumBlocks && target >= blockTotals[block])
       {
-        differences[i] = oldMeans[i] - m_Means[i + 1];
-        if(closeEnough<float64>(differences[i], 0.0))
+        target -= blockTotals[block];
+        block++;
+      }
+      usize chosen = m_Blocks.begin(block);
+      for(usize tupleIndex = m_Blocks.begin(block); tupleIndex < m_Blocks.end(block); tupleIndex++)
+      {
+        if(weights[tupleIndex] <= 0.0)
+        {
+          continue;
+        }
+        chosen = tupleIndex;
+        if(target < weights[tupleIndex])
         {
-          updateCheck++;
+          break;
         }
+        target -= weights[tupleIndex];
       }
-
-      float64 sum = std::accumulate(std::begin(differences), std::end(differences), 0.0);
-      m_Filter->updateProgress(fmt::format("Clustering Data || Iteration {} || Total Mean Shift: {}", iteration, sum));
-      iteration++;
+      copyTupleToCentroid(chosen, cluster);
     }
   }
 
-private:
-  using AbstractDataStoreT = AbstractDataStore<T>;
-  ComputeKMeans* m_Filter;
-  const AbstractDataStoreT& m_InputArray;
-  AbstractDataStoreT& m_Means;
-  const std::unique_ptr<MaskCompare>& m_Mask;
-  usize m_NumClusters;
-  Int32AbstractDataStore& m_FeatureIds;
-  ClusterUtilities::DistanceMetric m_DistMetric;
-  std::mt19937_64::result_type m_Seed;
-
   // -----------------------------------------------------------------------------
-  template <typename K>
-  bool closeEnough(const K& a, const K& b, const K& epsilon = std::numeric_limits<K>::epsilon())
+  usize runAssignment(AssignClustersImpl<T>& assignImpl)
   {
-    return (epsilon > fabs(a - b));
+    makeBlockAlgorithm().execute(assignImpl);
+
+    std::vector<float64> sums(m_Centroids.size(), 0.0);
+    std::vector<uint64> counts(m_NumClusters + 1, 0);
+    usize numChanged = 0;
+    for(const auto& accumulator : m_Accumulators)
+    {
+      for(usize i = 0; i < sums.size(); i++)
+      {
+        sums[i] += accumulator.Sums[i];
+      }
+      for(usize i = 0; i <= m_NumClusters; i++)
+      {
+        counts[i] += accumulator.Counts[i];
+      }
+      numChanged += accumulator.NumChanged;
+    }
+
+    // Empty clusters keep their previous centroid
+    for(usize cluster = 0; cluster <= m_NumClusters; cluster++)
+    {
+      if(counts[cluster] == 0)
+      {
+        continue;
+      }
+      for(usize comp = 0; comp < m_NumComps; comp++)
+      {
+        m_Centroids[cluster * m_NumComps + comp] = sums[cluster * m_NumComps + comp] / static_cast<float64>(counts[cluster]);
+      }
+    }
+    return numChanged;
   }
 
   // -----------------------------------------------------------------------------
-  void findClusters(usize tuples, int32 dims)
+  void runLloyd()
   {
-    for(usize i = 0; i < tuples; i++)
+    const bool usePruning = SupportsPruning(m_DistMetric);
+    const ClusterUtilities::DistanceMetric boundsMetric = BoundsMetric(m_DistMetric);
+
+    std::vector<float64> upperBounds;
+    std::vector<float64> lowerBounds;
+    std::vector<float64> halfMinCenterDist(m_NumClusters + 1, 0.0);
+    CentroidShifts shifts;
+    if(usePruning)
+    {
+      upperBounds.resize(m_NumTuples, 0.0);
+      lowerBounds.resize(m_NumTuples, 0.0);
+      shifts.Shifts.resize(m_NumClusters + 1, 0.0);
+    }
+
+    std::vector<float64> oldCentroids;
+    usize iteration = 1;
+    usize numChanged = 1;
+    while(numChanged != 0)
     {
       if(m_Filter->getCancel())
       {
         return;
       }
-      if(m_Mask->isTrue(i))
+
+      if(usePruning)
       {
-        float64 minDist = std::numeric_limits<float64>::max();
-        for(int32 j = 0; j < m_NumClusters; j++)
+        // Half the distance to the nearest other centroid: a tuple closer than this to its centroid cannot switch
+        for(usize i = 1; i <= m_NumClusters; i++)
         {
-          float64 dist = ClusterUtilities::GetDistance(m_InputArray, (dims * i), m_Means, (dims * (j + 1)), dims, m_DistMetric);
-          if(dist < minDist)
+          float64 minDist = std::numeric_limits<float64>::max();
+          for(usize j = 1; j <= m_NumClusters; j++)
           {
-            minDist = dist;
-            m_FeatureIds[i] = j + 1;
+            if(i != j)
+            {
+              minDist = std::min(minDist, ClusterUtilities::GetDistance(m_Centroids, m_NumComps * i, m_Centroids, m_NumComps * j, m_NumComps, boundsMetric));
+            }
           }
+          halfMinCenterDist[i] = 0.5 * minDist;
         }
       }
+
+      AssignClustersImpl<T> assignImpl(m_InputArray, *m_Mask, m_FeatureIds, m_Centroids, m_NumClusters, m_NumComps, m_DistMetric, m_Blocks, m_Accumulators, m_Filter->getCancel());
+      if(usePruning)
+      {
+        assignImpl.enablePruning(&upperBounds, &lowerBounds, &halfMinCenterDist, &shifts, iteration > 1);
+      }
+
+      oldCentroids = m_Centroids;
+      numChanged = runAssignment(assignImpl);
+
+      float64 totalShift = 0.0;
+      shifts.MaxShift = 0.0;
+      shifts.SecondMaxShift = 0.0;
+      shifts.MaxShiftCluster = 0;
+      for(usize cluster = 1; cluster <= m_NumClusters; cluster++)
+      {
+        const float64 shift = ClusterUtilities::GetDistance(oldCentroids, m_NumComps * cluster, m_Centroids, m_NumComps * cluster, m_NumComps, boundsMetric);
+        totalShift += shift;
+        if(usePruning)
+        {
+          shifts.Shifts[cluster] = shift;
+          if(shift > shifts.MaxShift)
+          {
+            shifts.SecondMaxShift = shifts.MaxShift;
+            shifts.MaxShift = shift;
+            shifts.MaxShiftCluster = static_cast<int32>(cluster);
+          }
+          else if(shift > shifts.SecondMaxShift)
+          {
+            shifts.SecondMaxShift = shift;
+          }
+        }
+      }
+
+      m_Filter->updateProgress(fmt::format("Clustering Data || Iteration {} || Total Mean Shift: {}", iteration, totalShift));
+      iteration++;
     }
   }
 
   // -----------------------------------------------------------------------------
-  void findMeans(usize tuples, int32 dims)
+  void runMiniBatch()
   {
-    std::vector<usize> counts(m_NumClusters + 1, 0);
+    const usize batchSize = m_InputValues->BatchSize;
+    std::vector<usize> batch(batchSize);
+    std::vector<int32> batchClusters(batchSize);
+    std::vector<uint64> centroidCounts(m_NumClusters + 1, 0);
 
-    for(usize i = 0; i <= m_NumClusters; i++)
+    for(usize iteration = 1; iteration <= m_InputValues->MaxIterations; iteration++)
     {
-      for(usize j = 0; j < dims; j++)
+      if(m_Filter->getCancel())
       {
-        m_Means[dims * i + j] = 0.0;
+        return;
       }
-    }
-
-    for(usize i = 0; i < dims; i++)
-    {
-      for(usize j = 0; j < tuples; j++)
+      for(auto& tupleIndex : batch)
       {
-        int32 feature = m_FeatureIds[j];
-        m_Means[dims * feature + i] += static_cast<float64>(m_InputArray[dims * j + i]);
-        counts[feature] += 1;
+        tupleIndex = randomMaskedTuple();
       }
-      for(usize j = 0; j <= m_NumClusters; j++)
+
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, batchSize);
+      dataAlg.requireArraysInMemory({m_InputIDataArray});
+      dataAlg.execute(AssignBatchImpl<T>(m_InputArray, batch, m_Centroids, m_NumClusters, m_NumComps, m_DistMetric, batchClusters));
+
+      // Per centroid learning rate of 1/count (Sculley, "Web-Scale K-Means Clustering")
+      for(usize i = 0; i < batchSize; i++)
       {
-        if(counts[j] == 0)
+        const usize cluster = batchClusters[i];
+        centroidCounts[cluster]++;
+        const float64 eta = 1.0 / static_cast<float64>(centroidCounts[cluster]);
+        for(usize comp = 0; comp < m_NumComps; comp++)
         {
-          m_Means[dims * j + i] = 0.0;
-        }
-        else
-        {
-          m_Means[dims * j + i] /= static_cast<float64>(counts[j]);
+          float64& centroid = m_Centroids[cluster * m_NumComps + comp];
+          centroid += eta * (static_cast<float64>(m_InputArray[batch[i] * m_NumComps + comp]) - centroid);
         }
       }
-      std::fill(std::begin(counts), std::end(counts), 0);
+
+      m_Filter->updateProgress(fmt::format("Clustering Data || Mini-Batch Iteration {}/{}", iteration, m_InputValues->MaxIterations));
     }
+
+    // Assign every tuple to the final centroids and store the exact means of that assignment
+    m_Filter->updateProgress("Clustering Data || Assigning all tuples");
+    AssignClustersImpl<T> assignImpl(m_InputArray, *m_Mask, m_FeatureIds, m_Centroids, m_NumClusters, m_NumComps, m_DistMetric, m_Blocks, m_Accumulators, m_Filter->getCancel());
+    runAssignment(assignImpl);
   }
 };
 } // namespace
@@ -221,9 +746,14 @@ Result<> ComputeKMeans::operator()()
     return MakeErrorResult(-54060, message);
   }
 
+  const usize numUsable = maskCompare->countTrueValues();
+  if(numUsable < m_InputValues->InitClusters)
+  {
+    return MakeErrorResult(-54061, fmt::format("The number of clusters ({}) is larger than the number of tuples that may be clustered ({})", m_InputValues->InitClusters, numUsable));
+  }
+
   RunTemplateClass<ComputeKMeansTemplate, types::NoBooleanType>(clusteringArray->getDataType(), this, clusteringArray, m_DataStructure.getDataAs<IDataArray>(m_InputValues->MeansArrayPath),
-                                                                maskCompare, m_InputValues->InitClusters, m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(),
-                                                                m_InputValues->DistanceMetric, m_InputValues->Seed);
+                                                                maskCompare, m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath), m_InputValues);
 
   return {};
 }
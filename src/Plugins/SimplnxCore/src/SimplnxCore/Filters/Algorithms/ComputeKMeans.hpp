@@ -23,6 +23,10 @@ struct SIMPLNXCORE_EXPORT ComputeKMeansInputValues
   DataPath FeatureIdsArrayPath;
   DataPath MeansArrayPath;
   uint64 Seed;
+  bool UseKMeansPlusPlus;
+  bool UseMiniBatch;
+  uint64 BatchSize;
+  uint64 MaxIterations;
 };
 
 /**
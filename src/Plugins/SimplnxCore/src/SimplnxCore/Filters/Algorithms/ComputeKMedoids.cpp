@@ -4,6 +4,7 @@
 #include "simplnx/Utilities/ClusteringUtilities.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include <random>
 
@@ -11,20 +12,134 @@ using namespace nx::core;
 
 namespace
 {
+constexpr usize k_CandidateBlockSize = 64;
+constexpr usize k_MemberTileSize = 1024;
+
+/**
+ * @brief Assigns every usable tuple in the range to its closest medoid.
+ */
+template <typename T>
+class FindMedoidClustersImpl
+{
+public:
+  FindMedoidClustersImpl(const AbstractDataStore<T>& inputArray, const MaskCompare& mask, const std::vector<float64>& medoids, usize numClusters, usize numComps,
+                         ClusterUtilities::DistanceMetric distMetric, Int32AbstractDataStore& featureIds, const std::atomic_bool& shouldCancel)
+  : m_InputArray(inputArray)
+  , m_Mask(mask)
+  , m_Medoids(medoids)
+  , m_NumClusters(numClusters)
+  , m_NumComps(numComps)
+  , m_DistMetric(distMetric)
+  , m_FeatureIds(featureIds)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      if(m_Mask.isTrue(i))
+      {
+        float64 minDist = std::numeric_limits<float64>::max();
+        for(usize j = 0; j < m_NumClusters; j++)
+        {
+          float64 dist = ClusterUtilities::GetDistance(m_InputArray, (m_NumComps * i), m_Medoids, (m_NumComps * (j + 1)), m_NumComps, m_DistMetric);
+          if(dist < minDist)
+          {
+            minDist = dist;
+            m_FeatureIds[i] = static_cast<int32>(j + 1);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<T>& m_InputArray;
+  const MaskCompare& m_Mask;
+  const std::vector<float64>& m_Medoids;
+  usize m_NumClusters;
+  usize m_NumComps;
+  ClusterUtilities::DistanceMetric m_DistMetric;
+  Int32AbstractDataStore& m_FeatureIds;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Sums the distances from every member of a cluster (as candidate medoid) in a range of candidate blocks to
+ * all members of the cluster. The packed member values are walked tile by tile so that a tile stays in cache for a whole candidate block.
+ */
+class MedoidCostsImpl
+{
+public:
+  MedoidCostsImpl(const std::vector<float64>& memberValues, usize numComps, ClusterUtilities::DistanceMetric distMetric, std::vector<float64>& costs, const std::atomic_bool& shouldCancel)
+  : m_MemberValues(memberValues)
+  , m_NumComps(numComps)
+  , m_DistMetric(distMetric)
+  , m_Costs(costs)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numMembers = m_MemberValues.size() / m_NumComps;
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const usize blockStart = block * k_CandidateBlockSize;
+      const usize blockEnd = std::min(blockStart + k_CandidateBlockSize, numMembers);
+      std::fill(m_Costs.begin() + blockStart, m_Costs.begin() + blockEnd, 0.0);
+      for(usize tileStart = 0; tileStart < numMembers; tileStart += k_MemberTileSize)
+      {
+        const usize tileEnd = std::min(tileStart + k_MemberTileSize, numMembers);
+        for(usize c = blockStart; c < blockEnd; c++)
+        {
+          float64 cost = m_Costs[c];
+          for(usize k = tileStart; k < tileEnd; k++)
+          {
+            cost += ClusterUtilities::GetDistance(m_MemberValues, (m_NumComps * k), m_MemberValues, (m_NumComps * c), m_NumComps, m_DistMetric);
+          }
+          m_Costs[c] = cost;
+        }
+      }
+    }
+  }
+
+private:
+  const std::vector<float64>& m_MemberValues;
+  usize m_NumComps;
+  ClusterUtilities::DistanceMetric m_DistMetric;
+  std::vector<float64>& m_Costs;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
 template <typename T>
 class KMedoidsTemplate
 {
 public:
-  KMedoidsTemplate(ComputeKMedoids* filter, const IDataArray* inputIDataArray, IDataArray* medoidsIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
-                   Int32AbstractDataStore& fIds, ClusterUtilities::DistanceMetric distMetric, std::mt19937_64::result_type seed)
+  KMedoidsTemplate(ComputeKMedoids* filter, const IDataArray* inputIDataArray, IDataArray* medoidsIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, Int32Array& featureIdsArray,
+                   const KMedoidsInputValues* inputValues)
   : m_Filter(filter)
+  , m_InputIDataArray(inputIDataArray)
   , m_InputArray(inputIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>())
   , m_Medoids(medoidsIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>())
   , m_Mask(maskDataArray)
-  , m_NumClusters(numClusters)
-  , m_FeatureIds(fIds)
-  , m_DistMetric(distMetric)
-  , m_Seed(seed)
+  , m_NumClusters(inputValues->InitClusters)
+  , m_FeatureIdsArray(featureIdsArray)
+  , m_FeatureIds(featureIdsArray.getDataStoreRef())
+  , m_DistMetric(inputValues->DistanceMetric)
+  , m_Seed(inputValues->Seed)
+  , m_UseSampling(inputValues->UseSampling)
+  , m_SampleSize(inputValues->SampleSize)
   {
   }
   ~KMedoidsTemplate() = default;
@@ -73,6 +188,10 @@ public:
 
     while(update)
     {
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
       findClusters(numTuples, numCompDims);
 
       optClusterIdxs = clusterIdxs;
@@ -91,37 +210,31 @@ private:
   using DataArrayT = DataArray<T>;
   using AbstractDataStoreT = AbstractDataStore<T>;
   ComputeKMedoids* m_Filter;
+  const IDataArray* m_InputIDataArray;
   const AbstractDataStoreT& m_InputArray;
   AbstractDataStoreT& m_Medoids;
   const std::unique_ptr<MaskCompare>& m_Mask;
   usize m_NumClusters;
+  Int32Array& m_FeatureIdsArray;
   Int32AbstractDataStore& m_FeatureIds;
   ClusterUtilities::DistanceMetric m_DistMetric;
   std::mt19937_64::result_type m_Seed;
+  bool m_UseSampling;
+  usize m_SampleSize;
 
   // -----------------------------------------------------------------------------
   void findClusters(usize tuples, int32 dims)
   {
-    for(usize i = 0; i < tuples; i++)
+    std::vector<float64> medoids((m_NumClusters + 1) * dims);
+    for(usize i = 0; i < medoids.size(); i++)
     {
-      if(m_Filter->getCancel())
-      {
-        return;
-      }
-      if(m_Mask->isTrue(i))
-      {
-        float64 minDist = std::numeric_limits<float64>::max();
-        for(int32 j = 0; j < m_NumClusters; j++)
-        {
-          float64 dist = ClusterUtilities::GetDistance(m_InputArray, (dims * i), m_Medoids, (dims * (j + 1)), dims, m_DistMetric);
-          if(dist < minDist)
-          {
-            minDist = dist;
-            m_FeatureIds[i] = j + 1;
-          }
-        }
-      }
+      medoids[i] = static_cast<float64>(m_Medoids[i]);
     }
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, tuples);
+    dataAlg.requireArraysInMemory({m_InputIDataArray, &m_FeatureIdsArray});
+    dataAlg.execute(FindMedoidClustersImpl<T>(m_InputArray, *m_Mask, medoids, m_NumClusters, dims, m_DistMetric, m_FeatureIds, m_Filter->getCancel()));
   }
 
   // -----------------------------------------------------------------------------
@@ -129,41 +242,61 @@ private:
   {
     std::vector<float64> minCosts(m_NumClusters, std::numeric_limits<float64>::max());
 
+    // Group the usable tuples by cluster (ascending) so each cluster only visits its own members
+    std::vector<std::vector<usize>> clusterMembers(m_NumClusters);
+    for(usize j = 0; j < tuples; j++)
+    {
+      if(m_Mask->isTrue(j) && m_FeatureIds[j] > 0)
+      {
+        clusterMembers[m_FeatureIds[j] - 1].push_back(j);
+      }
+    }
+
+    std::vector<float64> memberValues;
+    std::vector<float64> candidateCosts;
     for(usize i = 0; i < m_NumClusters; i++)
     {
       if(m_Filter->getCancel())
       {
         return {};
       }
-      for(usize j = 0; j < tuples; j++)
+
+      // With sampling (CLARA) both the candidates and the cost are restricted to an evenly spaced subset of the cluster
+      std::vector<usize> members = std::move(clusterMembers[i]);
+      if(m_UseSampling)
       {
-        if(m_Filter->getCancel())
+        std::vector<usize> sampled;
+        for(usize position : ClusterUtilities::StratifiedSamplePositions(members.size(), m_SampleSize))
         {
-          return {};
+          sampled.push_back(members[position]);
         }
-        if(m_Mask->isTrue(j))
+        members = std::move(sampled);
+      }
+      if(members.empty())
+      {
+        continue;
+      }
+
+      memberValues.resize(members.size() * dims);
+      for(usize k = 0; k < members.size(); k++)
+      {
+        for(int32 comp = 0; comp < dims; comp++)
         {
-          if(m_FeatureIds[j] == i + 1)
-          {
-            float64 cost = 0.0;
-            for(usize k = 0; k < tuples; k++)
-            {
-              if(m_Filter->getCancel())
-              {
-                return {};
-              }
-              if(m_FeatureIds[k] == i + 1 && m_Mask->isTrue(k))
-              {
-                cost += ClusterUtilities::GetDistance(m_InputArray, (dims * k), m_InputArray, (dims * j), dims, m_DistMetric);
-              }
-            }
-
-            if(cost < minCosts[i])
-            {
-              minCosts[i] = cost;
-              clusterIdxs[i] = j;
-            }
-          }
+          memberValues[dims * k + comp] = static_cast<float64>(m_InputArray[dims * members[k] + comp]);
+        }
+      }
+      candidateCosts.resize(members.size());
+
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, (members.size() + k_CandidateBlockSize - 1) / k_CandidateBlockSize);
+      dataAlg.execute(MedoidCostsImpl(memberValues, dims, m_DistMetric, candidateCosts, m_Filter->getCancel()));
+
+      for(usize c = 0; c < members.size(); c++)
+      {
+        if(candidateCosts[c] < minCosts[i])
+        {
+          minCosts[i] = candidateCosts[c];
+          clusterIdxs[i] = members[c];
         }
       }
     }
@@ -221,8 +354,7 @@ Result<> ComputeKMedoids::operator()()
     return MakeErrorResult(-54070, message);
   }
   RunTemplateClass<KMedoidsTemplate, types::NoBooleanType>(clusteringArray->getDataType(), this, clusteringArray, m_DataStructure.getDataAs<IDataArray>(m_InputValues->MedoidsArrayPath), maskCompare,
-                                                           m_InputValues->InitClusters, m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(),
-                                                           m_InputValues->DistanceMetric, m_InputValues->Seed);
+                                                           m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath), m_InputValues);
 
   return {};
 }
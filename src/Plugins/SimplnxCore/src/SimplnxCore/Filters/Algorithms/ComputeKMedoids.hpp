@@ -19,6 +19,8 @@ struct SIMPLNXCORE_EXPORT KMedoidsInputValues
   DataPath FeatureIdsArrayPath;
   DataPath MedoidsArrayPath;
   uint64 Seed;
+  bool UseSampling;
+  uint64 SampleSize;
 };
 
 /**
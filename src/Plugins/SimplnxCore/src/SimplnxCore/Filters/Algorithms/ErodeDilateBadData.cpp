@@ -4,66 +4,93 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include "SimplnxCore/utils/MorphologyUtilities.hpp"
+
+#include <numeric>
 
 using namespace nx::core;
 namespace
 {
-class ErodeDilateBadDataTransferDataImpl
+/**
+ * @brief Finds the neighbor each voxel of the frontier takes its data from during one erode or dilate pass.
+ * Eroding fills a bad voxel from the neighboring feature with the most face neighbors. Dilating turns a
+ * feature voxel into bad data by copying its last bad face neighbor. Only the feature ids are read so all
+ * the votes of a pass see the same feature ids.
+ */
+class ErodeDilateBadDataVoteImpl
 {
 public:
-  ErodeDilateBadDataTransferDataImpl() = delete;
-  ErodeDilateBadDataTransferDataImpl(const ErodeDilateBadDataTransferDataImpl&) = default;
-
-  ErodeDilateBadDataTransferDataImpl(ErodeDilateBadData* filterAlg, usize totalPoints, ChoicesParameter::ValueType operation, const Int32AbstractDataStore& featureIds,
-                                     const std::vector<int64>& neighbors, const std::shared_ptr<IDataArray>& dataArrayPtr)
-  : m_FilterAlg(filterAlg)
-  , m_TotalPoints(totalPoints)
+  ErodeDilateBadDataVoteImpl(const MorphologyUtilities::FaceNeighborhood& neighborhood, ChoicesParameter::ValueType operation, const Int32AbstractDataStore& featureIds,
+                             const std::vector<int64>& frontier, std::vector<int64>& sources, const std::atomic_bool& shouldCancel)
+  : m_Neighborhood(neighborhood)
   , m_Operation(operation)
   , m_FeatureIds(featureIds)
-  , m_Neighbors(neighbors)
-  , m_DataArrayPtr(dataArrayPtr)
+  , m_Frontier(frontier)
+  , m_Sources(sources)
+  , m_ShouldCancel(shouldCancel)
   {
   }
-  ErodeDilateBadDataTransferDataImpl(ErodeDilateBadDataTransferDataImpl&&) = default;                // Move Constructor Not Implemented
-  ErodeDilateBadDataTransferDataImpl& operator=(const ErodeDilateBadDataTransferDataImpl&) = delete; // Copy Assignment Not Implemented
-  ErodeDilateBadDataTransferDataImpl& operator=(ErodeDilateBadDataTransferDataImpl&&) = delete;      // Move Assignment Not Implemented
 
-  ~ErodeDilateBadDataTransferDataImpl() = default;
-
-  void operator()() const
+  void operator()(const Range& range) const
   {
-    auto start = std::chrono::steady_clock::now();
-    for(usize i = 0; i < m_TotalPoints; i++)
+    std::array<int64, MorphologyUtilities::k_NumFaceNeighbors> neighbors = {};
+    std::array<int32, MorphologyUtilities::k_NumFaceNeighbors> features = {};
+    for(usize frontierIndex = range.min(); frontierIndex < range.max(); frontierIndex++)
     {
-      auto now = std::chrono::steady_clock::now();
-      //// Only send updates every 1 second
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+      if(m_ShouldCancel)
       {
-        const float progress = static_cast<float>(i) / static_cast<float>(m_TotalPoints) * 100.0f;
-        m_FilterAlg->updateProgress(fmt::format("Processing {}: {}% completed", m_DataArrayPtr->getName(), static_cast<int>(progress)));
-        start = std::chrono::steady_clock::now();
+        return;
       }
-
-      const int32 featureName = m_FeatureIds[i];
-      const int64 neighbor = m_Neighbors[i];
-      if(neighbor >= 0)
+      const int64 voxel = m_Frontier[frontierIndex];
+      const int32 featureName = m_FeatureIds[voxel];
+      int64 source = -1;
+      if(m_Operation == detail::k_ErodeIndex && featureName == 0)
+      {
+        const usize numNeighbors = m_Neighborhood.getNeighbors(voxel, neighbors);
+        int32 most = 0;
+        for(usize n = 0; n < numNeighbors; n++)
+        {
+          features[n] = m_FeatureIds[neighbors[n]];
+          if(features[n] <= 0)
+          {
+            continue;
+          }
+          int32 current = 0;
+          for(usize k = 0; k <= n; k++)
+          {
+            current += static_cast<int32>(features[k] == features[n]);
+          }
+          if(current > most)
+          {
+            most = current;
+            source = neighbors[n];
+          }
+        }
+      }
+      if(m_Operation == detail::k_DilateIndex && featureName > 0)
       {
-        if((featureName == 0 && m_FeatureIds[neighbor] > 0 && m_Operation == detail::k_ErodeIndex) || (featureName > 0 && m_FeatureIds[neighbor] == 0 && m_Operation == detail::k_DilateIndex))
+        const usize numNeighbors = m_Neighborhood.getNeighbors(voxel, neighbors);
+        for(usize n = 0; n < numNeighbors; n++)
         {
-          m_DataArrayPtr->copyTuple(neighbor, i);
+          if(m_FeatureIds[neighbors[n]] == 0)
+          {
+            source = neighbors[n];
+          }
         }
       }
+      m_Sources[frontierIndex] = source;
     }
   }
 
 private:
-  ErodeDilateBadData* m_FilterAlg = nullptr;
-  usize m_TotalPoints = 0;
-  ChoicesParameter::ValueType m_Operation = 0;
-  std::vector<int64> m_Neighbors;
-  const std::shared_ptr<IDataArray> m_DataArrayPtr;
+  const MorphologyUtilities::FaceNeighborhood& m_Neighborhood;
+  const ChoicesParameter::ValueType m_Operation;
   const Int32AbstractDataStore& m_FeatureIds;
+  const std::vector<int64>& m_Frontier;
+  std::vector<int64>& m_Sources;
+  const std::atomic_bool& m_ShouldCancel;
 };
 } // namespace
 
@@ -94,156 +121,83 @@ void ErodeDilateBadData::updateProgress(const std::string& progMessage)
 // -----------------------------------------------------------------------------
 Result<> ErodeDilateBadData::operator()()
 {
-  const auto& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
+  auto& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
   const usize totalPoints = featureIds.getNumberOfTuples();
 
-  std::vector<int64> neighbors(totalPoints, -1);
-
   const auto& selectedImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->InputImageGeometry);
-
-  SizeVec3 udims = selectedImageGeom.getDimensions();
-
-  std::array<int64, 3> dims = {
-      static_cast<int64>(udims[0]),
-      static_cast<int64>(udims[1]),
-      static_cast<int64>(udims[2]),
-  };
-
-  usize numFeatures = 0;
-  for(usize i = 0; i < totalPoints; i++)
+  const MorphologyUtilities::FaceNeighborhood neighborhood(selectedImageGeom.getDimensions(), m_InputValues->XDirOn, m_InputValues->YDirOn, m_InputValues->ZDirOn);
+
+  // Dilating turns feature voxels into bad data and eroding turns bad data into feature voxels. A voxel
+  // that changed never changes back, so after the first pass only the voxels next to a voxel that just
+  // changed can change in the next pass.
+  //
+  // Each changed voxel remembers the unchanged voxel its data originally came from so all the cell arrays
+  // other than the feature ids are gathered once after the last pass.
+  std::vector<int64> frontier(totalPoints);
+  std::iota(frontier.begin(), frontier.end(), 0);
+  std::vector<int64> dataSource(totalPoints, -1);
+  std::vector<std::pair<int64, int64>> gatherList;
+  MorphologyUtilities::ActiveFrontier nextFrontier(totalPoints);
+  std::vector<int64> sources;
+  std::array<int64, MorphologyUtilities::k_NumFaceNeighbors> neighbors = {};
+
+  ParallelDataAlgorithm::AlgorithmArrays algArrays;
+  algArrays.push_back(m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath));
+
+  for(int32 iteration = 0; iteration < m_InputValues->NumIterations && !frontier.empty(); iteration++)
   {
-    const int32 featureName = featureIds[i];
-    if(featureName > numFeatures)
+    updateProgress(fmt::format("Iteration {} of {} || Processing {} Voxels", iteration + 1, m_InputValues->NumIterations, frontier.size()));
+
+    sources.resize(frontier.size());
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, frontier.size());
+    dataAlg.requireArraysInMemory(algArrays);
+    dataAlg.execute(ErodeDilateBadDataVoteImpl(neighborhood, m_InputValues->Operation, featureIds, frontier, sources, m_ShouldCancel));
+    if(m_ShouldCancel)
     {
-      numFeatures = featureName;
+      return {};
     }
-  }
-
-  std::array<int64, 6> neighpoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
 
-  std::vector<int32> featureCount(numFeatures + 1, 0);
-
-  for(int32 iteration = 0; iteration < m_InputValues->NumIterations; iteration++)
-  {
-    for(int64 zIndex = 0; zIndex < dims[2]; zIndex++)
+    const usize changedStart = gatherList.size();
+    for(usize n = 0; n < frontier.size(); n++)
     {
-      const int64 zStride = dims[0] * dims[1] * zIndex;
-      for(int64 yIndex = 0; yIndex < dims[1]; yIndex++)
+      const int64 source = sources[n];
+      if(source < 0)
       {
-        const int64 yStride = dims[0] * yIndex;
-        for(int64 xIndex = 0; xIndex < dims[0]; xIndex++)
-        {
-          const int64 voxelIndex = zStride + yStride + xIndex;
-          const int32 featureName = featureIds[voxelIndex];
-          if(featureName == 0)
-          {
-            int32 most = 0;
-            for(int32 neighPointIdx = 0; neighPointIdx < 6; neighPointIdx++)
-            {
-              const int64 neighborPoint = voxelIndex + neighpoints[neighPointIdx];
-              if(neighPointIdx == 0 && (zIndex == 0 || !m_InputValues->ZDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 5 && (zIndex == (dims[2] - 1) || !m_InputValues->ZDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 1 && (yIndex == 0 || !m_InputValues->YDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 4 && (yIndex == (dims[1] - 1) || !m_InputValues->YDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 2 && (xIndex == 0 || !m_InputValues->XDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 3 && (xIndex == (dims[0] - 1) || !m_InputValues->XDirOn))
-              {
-                continue;
-              }
-
-              const int32 feature = featureIds[neighborPoint];
-              if(m_InputValues->Operation == detail::k_DilateIndex && feature > 0)
-              {
-                neighbors[neighborPoint] = voxelIndex;
-              }
-              if(feature > 0 && m_InputValues->Operation == detail::k_ErodeIndex)
-              {
-                featureCount[feature]++;
-                const int32 current = featureCount[feature];
-                if(current > most)
-                {
-                  most = current;
-                  neighbors[voxelIndex] = neighborPoint;
-                }
-              }
-            }
-            if(m_InputValues->Operation == detail::k_ErodeIndex)
-            {
-              for(int32 neighPointIdx = 0; neighPointIdx < 6; neighPointIdx++)
-              {
-                const int64 neighborPoint = voxelIndex + neighpoints[neighPointIdx];
-                if(neighPointIdx == 0 && zIndex == 0)
-                {
-                  continue;
-                }
-                if(neighPointIdx == 5 && zIndex == (dims[2] - 1))
-                {
-                  continue;
-                }
-                if(neighPointIdx == 1 && yIndex == 0)
-                {
-                  continue;
-                }
-                if(neighPointIdx == 4 && yIndex == (dims[1] - 1))
-                {
-                  continue;
-                }
-                if(neighPointIdx == 2 && xIndex == 0)
-                {
-                  continue;
-                }
-                if(neighPointIdx == 3 && xIndex == (dims[0] - 1))
-                {
-                  continue;
-                }
-
-                const int32 feature = featureIds[neighborPoint];
-                featureCount[feature] = 0;
-              }
-            }
-          }
-        }
+        continue;
       }
+      const int64 voxel = frontier[n];
+      featureIds[voxel] = featureIds[source];
+      dataSource[voxel] = dataSource[source] < 0 ? source : dataSource[source];
+      gatherList.emplace_back(voxel, dataSource[voxel]);
     }
 
-    // Build up a list of the DataArrays that we are going to operate on.
-    const std::vector<std::shared_ptr<IDataArray>> voxelArrays = nx::core::GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths);
-
-    ParallelTaskAlgorithm taskRunner;
-    taskRunner.setParallelizationEnabled(true);
-    for(const auto& voxelArray : voxelArrays)
+    for(usize n = changedStart; n < gatherList.size(); n++)
     {
-      // We need to skip updating the FeatureIds until all the other arrays are updated
-      // since we actually depend on the feature Ids values.
-      if(voxelArray->getName() == m_InputValues->FeatureIdsArrayPath.getTargetName())
+      const usize numNeighbors = neighborhood.getNeighbors(gatherList[n].first, neighbors);
+      for(usize k = 0; k < numNeighbors; k++)
       {
-        continue;
+        const int32 feature = featureIds[neighbors[k]];
+        if((m_InputValues->Operation == detail::k_ErodeIndex && feature == 0) || (m_InputValues->Operation == detail::k_DilateIndex && feature > 0))
+        {
+          nextFrontier.add(neighbors[k]);
+        }
       }
-
-      taskRunner.execute(ErodeDilateBadDataTransferDataImpl(this, totalPoints, m_InputValues->Operation, featureIds, neighbors, voxelArray));
     }
-    taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
+    frontier = nextFrontier.takeNext();
+  }
 
-    // Now update the feature Ids
-    auto featureIDataArray = m_DataStructure.getSharedDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath);
-    taskRunner.setParallelizationEnabled(false); // Do this to make the next call synchronous
-    taskRunner.execute(ErodeDilateBadDataTransferDataImpl(this, totalPoints, m_InputValues->Operation, featureIds, neighbors, featureIDataArray));
+  // The feature ids are already up to date. Every other cell array is gathered from the unchanged voxels in one pass.
+  std::vector<std::shared_ptr<IDataArray>> voxelArrays;
+  for(const auto& voxelArray : nx::core::GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths))
+  {
+    if(voxelArray->getName() == m_InputValues->FeatureIdsArrayPath.getTargetName())
+    {
+      continue;
+    }
+    voxelArrays.push_back(voxelArray);
   }
+  MorphologyUtilities::GatherTuples(voxelArrays, gatherList);
 
   return {};
 }
@@ -5,20 +5,13 @@
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 
+#include "SimplnxCore/utils/MorphologyUtilities.hpp"
+
+#include <functional>
+#include <numeric>
+#include <queue>
+
 using namespace nx::core;
-namespace
-{
-struct DataArrayCopyTupleFunctor
-{
-  template <typename T>
-  void operator()(IDataArray& outputIDataArray, size_t sourceIndex, size_t targetIndex)
-  {
-    using DataArrayType = DataArray<T>;
-    DataArrayType outputArray = dynamic_cast<DataArrayType&>(outputIDataArray);
-    outputArray.copyTuple(sourceIndex, targetIndex);
-  }
-};
-} // namespace
 
 // -----------------------------------------------------------------------------
 ErodeDilateCoordinationNumber::ErodeDilateCoordinationNumber(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
@@ -42,171 +35,129 @@ const std::atomic_bool& ErodeDilateCoordinationNumber::getCancel()
 // -----------------------------------------------------------------------------
 Result<> ErodeDilateCoordinationNumber::operator()()
 {
-
   const auto& featureIds = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
   const size_t totalPoints = featureIds.getNumberOfTuples();
 
   std::vector<int64> neighbors(totalPoints, -1);
 
   const auto& selectedImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->InputImageGeometry);
+  const MorphologyUtilities::FaceNeighborhood neighborhood(selectedImageGeom.getDimensions());
 
-  SizeVec3 udims = selectedImageGeom.getDimensions();
-
-  std::array<int64, 3> dims = {
-      static_cast<int64>(udims[0]),
-      static_cast<int64>(udims[1]),
-      static_cast<int64>(udims[2]),
-  };
-
-  size_t numFeatures = 0;
+  const std::vector<std::shared_ptr<IDataArray>> voxelArrays = nx::core::GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths);
 
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    const int32 featureName = featureIds[i];
-    if(featureName > numFeatures)
+  std::vector<int32> coordinationNumber(totalPoints, 0);
+  usize numAtCoordination = m_InputValues->CoordinationNumber <= 0 ? totalPoints : 0;
+
+  std::array<int64, MorphologyUtilities::k_NumFaceNeighbors> voxelNeighbors = {};
+  std::array<int32, MorphologyUtilities::k_NumFaceNeighbors> features = {};
+
+  // Returns true if the voxel took over the data of one of its neighbors
+  auto updateVoxel = [&](int64 voxelIndex) -> bool {
+    const int32 featureName = featureIds[voxelIndex];
+    const usize numNeighbors = neighborhood.getNeighbors(voxelIndex, voxelNeighbors);
+    int32 coordination = 0;
+    int32 most = 0;
+    for(usize n = 0; n < numNeighbors; n++)
     {
-      numFeatures = featureName;
+      features[n] = featureIds[voxelNeighbors[n]];
+      const int32 feature = features[n];
+      if((featureName > 0 && feature == 0) || (featureName == 0 && feature > 0))
+      {
+        coordination = coordination + 1;
+        int32 current = 0;
+        for(usize k = 0; k <= n; k++)
+        {
+          current += static_cast<int32>(features[k] == feature);
+        }
+        if(current > most)
+        {
+          most = current;
+          neighbors[voxelIndex] = voxelNeighbors[n];
+        }
+      }
     }
-  }
-
-  std::array<int64, 6> neighpoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+    numAtCoordination -= static_cast<usize>(coordinationNumber[voxelIndex] >= m_InputValues->CoordinationNumber);
+    numAtCoordination += static_cast<usize>(coordination >= m_InputValues->CoordinationNumber);
+    coordinationNumber[voxelIndex] = coordination;
+    if(coordination >= m_InputValues->CoordinationNumber && coordination > 0)
+    {
+      const int64 neighbor = neighbors[voxelIndex];
+      for(const auto& voxelArray : voxelArrays)
+      {
+        voxelArray->copyTuple(neighbor, voxelIndex);
+      }
+      return true;
+    }
+    return false;
+  };
 
-  const std::string attrMatName = m_InputValues->FeatureIdsArrayPath.getTargetName();
-  const std::vector<std::shared_ptr<IDataArray>> voxelArrays = nx::core::GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths);
+  // The voxels are updated in place in voxel order, so a voxel sees the changes made to the voxels before
+  // it in the same pass. A voxel can only come out differently from its last update if it or one of its
+  // neighbors changed since then. A change schedules the neighbors that come later in this pass and
+  // everything else for the next pass; all the other voxels are skipped.
+  std::vector<int64> pending(totalPoints);
+  std::iota(pending.begin(), pending.end(), 0);
+  std::vector<int32> scheduledPass(totalPoints, 0);
+  MorphologyUtilities::ActiveFrontier nextPass(totalPoints);
+  std::priority_queue<int64, std::vector<int64>, std::greater<>> laterInPass;
 
-  std::vector<int32> featureCount(numFeatures + 1, 0);
-  std::vector<int32> coordinationNumber(totalPoints, 0);
   bool keepGoing = true;
-  int32 counter = 1;
-
-  while(counter > 0 && keepGoing)
+  usize counter = 1;
+  int32 pass = 0;
+  while(counter > 0 && keepGoing && !pending.empty())
   {
-    counter = 0;
     if(!m_InputValues->Loop)
     {
       keepGoing = false;
     }
 
-    for(int64 zIndex = 0; zIndex < dims[2]; zIndex++)
+    usize pendingIndex = 0;
+    while(pendingIndex < pending.size() || !laterInPass.empty())
     {
-      const int64 zStride = dims[0] * dims[1] * zIndex;
-      for(int64 yIndex = 0; yIndex < dims[1]; yIndex++)
+      if(m_ShouldCancel)
       {
-        const int64 yStride = dims[0] * yIndex;
-        for(int64 xIndex = 0; xIndex < dims[0]; xIndex++)
-        {
-          const int64 voxelIndex = zStride + yStride + xIndex;
-          const int32 featureName = featureIds[voxelIndex];
-          int32 coordination = 0;
-          int32 most = 0;
-          for(int32 neighPointIdx = 0; neighPointIdx < 6; neighPointIdx++)
-          {
-            const int64 neighborPoint = voxelIndex + neighpoints[neighPointIdx];
-            if(neighPointIdx == 0 && zIndex == 0)
-            {
-              continue;
-            }
-            if(neighPointIdx == 5 && zIndex == (dims[2] - 1))
-            {
-              continue;
-            }
-            if(neighPointIdx == 1 && yIndex == 0)
-            {
-              continue;
-            }
-            if(neighPointIdx == 4 && yIndex == (dims[1] - 1))
-            {
-              continue;
-            }
-            if(neighPointIdx == 2 && xIndex == 0)
-            {
-              continue;
-            }
-            if(neighPointIdx == 3 && xIndex == (dims[0] - 1))
-            {
-              continue;
-            }
-
-            const int32 feature = featureIds[neighborPoint];
-            if((featureName > 0 && feature == 0) || (featureName == 0 && feature > 0))
-            {
-              coordination = coordination + 1;
-              featureCount[feature]++;
-              const int32 current = featureCount[feature];
-              if(current > most)
-              {
-                most = current;
-                neighbors[voxelIndex] = neighborPoint;
-              }
-            }
-          }
-          coordinationNumber[voxelIndex] = coordination;
-          const int64 neighbor = neighbors[voxelIndex];
-          if(coordinationNumber[voxelIndex] >= m_InputValues->CoordinationNumber && coordinationNumber[voxelIndex] > 0)
-          {
-            /******************************************************************
-             * If this section is slow it is because we are having to use the
-             * ExecuteDataFunction<T>() in order to call "copyTuple()" because
-             * "copyTuple()" isn't in the IArray API set. Oh well.
-             */
-            for(const auto& voxelArray : voxelArrays)
-            {
-              ExecuteDataFunction(DataArrayCopyTupleFunctor{}, voxelArray->getDataType(), *voxelArray, neighbor, voxelIndex);
-            }
-          }
-          for(int32 neighPointIdx = 0; neighPointIdx < 6; neighPointIdx++)
-          {
-            const int64 neighborPoint = voxelIndex + neighpoints[neighPointIdx];
-            if(neighPointIdx == 0 && zIndex == 0)
-            {
-              continue;
-            }
-            if(neighPointIdx == 5 && zIndex == (dims[2] - 1))
-            {
-              continue;
-            }
-            if(neighPointIdx == 1 && yIndex == 0)
-            {
-              continue;
-            }
-            if(neighPointIdx == 4 && yIndex == (dims[1] - 1))
-            {
-              continue;
-            }
-            if(neighPointIdx == 2 && xIndex == 0)
-            {
-              continue;
-            }
-            if(neighPointIdx == 3 && xIndex == (dims[0] - 1))
-            {
-              continue;
-            }
-
-            const int32 feature = featureIds[neighborPoint];
-            if(feature > 0)
-            {
-              featureCount[feature] = 0;
-            }
-          }
-        }
+        return {};
       }
-    }
-    for(int64 zIndex = 0; zIndex < dims[2]; zIndex++)
-    {
-      const auto zStride = static_cast<int64>(dims[0] * dims[1] * zIndex);
-      for(int64 yIndex = 0; yIndex < dims[1]; yIndex++)
+      int64 voxelIndex = 0;
+      if(laterInPass.empty() || (pendingIndex < pending.size() && pending[pendingIndex] < laterInPass.top()))
+      {
+        voxelIndex = pending[pendingIndex];
+        pendingIndex++;
+      }
+      else
+      {
+        voxelIndex = laterInPass.top();
+        laterInPass.pop();
+      }
+
+      if(!updateVoxel(voxelIndex))
+      {
+        continue;
+      }
+      nextPass.add(voxelIndex);
+      const usize numNeighbors = neighborhood.getNeighbors(voxelIndex, voxelNeighbors);
+      for(usize n = 0; n < numNeighbors; n++)
       {
-        const auto yStride = static_cast<int64>(dims[0] * yIndex);
-        for(int64 xIndex = 0; xIndex < dims[0]; xIndex++)
+        const int64 neighbor = voxelNeighbors[n];
+        if(neighbor < voxelIndex)
         {
-          const int64 voxelIndex = zStride + yStride + xIndex;
-          if(coordinationNumber[voxelIndex] >= m_InputValues->CoordinationNumber)
-          {
-            counter++;
-          }
+          nextPass.add(neighbor);
+        }
+        else if(scheduledPass[neighbor] != pass)
+        {
+          scheduledPass[neighbor] = pass;
+          laterInPass.push(neighbor);
         }
       }
     }
+
+    counter = numAtCoordination;
+    pending = nextPass.takeNext();
+    pass++;
+    for(const int64 voxelIndex : pending)
+    {
+      scheduledPass[voxelIndex] = pass;
+    }
   }
 
   return {};
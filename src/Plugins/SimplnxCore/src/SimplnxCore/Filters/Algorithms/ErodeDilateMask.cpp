@@ -3,9 +3,74 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include "SimplnxCore/utils/MorphologyUtilities.hpp"
+
+#include <numeric>
 
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief Finds which voxels of the frontier flip during one erode or dilate pass. Dilating sets a voxel that
+ * has a face neighbor inside the mask, eroding clears a voxel that has a face neighbor outside the mask.
+ * Only the mask is read so all the voxels of a pass see the same mask.
+ */
+class ErodeDilateMaskVoteImpl
+{
+public:
+  ErodeDilateMaskVoteImpl(const MorphologyUtilities::FaceNeighborhood& neighborhood, ChoicesParameter::ValueType operation, const BoolArray& mask, const std::vector<int64>& frontier,
+                          std::vector<uint8>& flips, const std::atomic_bool& shouldCancel)
+  : m_Neighborhood(neighborhood)
+  , m_Operation(operation)
+  , m_Mask(mask)
+  , m_Frontier(frontier)
+  , m_Flips(flips)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    // Dilating looks for 'true' neighbors of 'false' voxels, eroding looks for 'false' neighbors of 'true' voxels
+    const bool flipValue = m_Operation == detail::k_ErodeIndex;
+    std::array<int64, MorphologyUtilities::k_NumFaceNeighbors> neighbors = {};
+    for(usize frontierIndex = range.min(); frontierIndex < range.max(); frontierIndex++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const int64 voxel = m_Frontier[frontierIndex];
+      uint8 flip = 0;
+      if(m_Mask[voxel] == flipValue)
+      {
+        const usize numNeighbors = m_Neighborhood.getNeighbors(voxel, neighbors);
+        for(usize n = 0; n < numNeighbors; n++)
+        {
+          if(m_Mask[neighbors[n]] != flipValue)
+          {
+            flip = 1;
+            break;
+          }
+        }
+      }
+      m_Flips[frontierIndex] = flip;
+    }
+  }
+
+private:
+  const MorphologyUtilities::FaceNeighborhood& m_Neighborhood;
+  const ChoicesParameter::ValueType m_Operation;
+  const BoolArray& m_Mask;
+  const std::vector<int64>& m_Frontier;
+  std::vector<uint8>& m_Flips;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ErodeDilateMask::ErodeDilateMask(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ErodeDilateMaskInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -27,87 +92,59 @@ const std::atomic_bool& ErodeDilateMask::getCancel()
 // -----------------------------------------------------------------------------
 Result<> ErodeDilateMask::operator()()
 {
-
   auto& mask = m_DataStructure.getDataRefAs<BoolArray>(m_InputValues->MaskArrayPath);
   const size_t totalPoints = mask.getNumberOfTuples();
 
-  std::vector<bool> maskCopy(totalPoints, false);
-
   const auto& selectedImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->InputImageGeometry);
+  const MorphologyUtilities::FaceNeighborhood neighborhood(selectedImageGeom.getDimensions(), m_InputValues->XDirOn, m_InputValues->YDirOn, m_InputValues->ZDirOn);
 
-  SizeVec3 udims = selectedImageGeom.getDimensions();
+  // A voxel that flipped never flips back, so after the first pass only the voxels next to a voxel that
+  // just flipped can flip in the next pass.
+  std::vector<int64> frontier(totalPoints);
+  std::iota(frontier.begin(), frontier.end(), 0);
+  MorphologyUtilities::ActiveFrontier nextFrontier(totalPoints);
+  std::vector<uint8> flips;
+  std::array<int64, MorphologyUtilities::k_NumFaceNeighbors> neighbors = {};
 
-  std::array<int64, 3> dims = {
-      static_cast<int64>(udims[0]),
-      static_cast<int64>(udims[1]),
-      static_cast<int64>(udims[2]),
-  };
+  ParallelDataAlgorithm::AlgorithmArrays algArrays;
+  algArrays.push_back(&mask);
 
-  std::array<int64, 6> neighpoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
-
-  for(int32_t iteration = 0; iteration < m_InputValues->NumIterations; iteration++)
+  for(int32_t iteration = 0; iteration < m_InputValues->NumIterations && !frontier.empty(); iteration++)
   {
-    for(size_t j = 0; j < totalPoints; j++)
+    flips.resize(frontier.size());
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, frontier.size());
+    dataAlg.requireArraysInMemory(algArrays);
+    dataAlg.execute(ErodeDilateMaskVoteImpl(neighborhood, m_InputValues->Operation, mask, frontier, flips, m_ShouldCancel));
+    if(m_ShouldCancel)
     {
-      maskCopy[j] = mask[j];
+      return {};
     }
-    for(int64 zIndex = 0; zIndex < dims[2]; zIndex++)
+
+    const bool newValue = m_InputValues->Operation == detail::k_DilateIndex;
+    for(usize n = 0; n < frontier.size(); n++)
     {
-      const int64 zStride = dims[0] * dims[1] * zIndex;
-      for(int64 yIndex = 0; yIndex < dims[1]; yIndex++)
+      if(flips[n] != 0)
       {
-        const int64 yStride = dims[0] * yIndex;
-        for(int64 xIndex = 0; xIndex < dims[0]; xIndex++)
-        {
-          const int64 voxelIndex = zStride + yStride + xIndex;
-
-          if(!mask[voxelIndex])
-          {
-            for(int32_t neighPointIdx = 0; neighPointIdx < 6; neighPointIdx++)
-            {
-              const int64 neighpoint = voxelIndex + neighpoints[neighPointIdx];
-              if(neighPointIdx == 0 && (zIndex == 0 || !m_InputValues->ZDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 5 && (zIndex == (dims[2] - 1) || !m_InputValues->ZDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 1 && (yIndex == 0 || !m_InputValues->YDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 4 && (yIndex == (dims[1] - 1) || !m_InputValues->YDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 2 && (xIndex == 0 || !m_InputValues->XDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 3 && (xIndex == (dims[0] - 1) || !m_InputValues->XDirOn))
-              {
-                continue;
-              }
-
-              if(m_InputValues->Operation == detail::k_DilateIndex && mask[neighpoint])
-              {
-                maskCopy[voxelIndex] = true;
-              }
-              if(m_InputValues->Operation == detail::k_ErodeIndex && mask[neighpoint])
-              {
-                maskCopy[neighpoint] = false;
-              }
-            }
-          }
-        }
+        mask[frontier[n]] = newValue;
       }
     }
-    for(size_t j = 0; j < totalPoints; j++)
+    for(usize n = 0; n < frontier.size(); n++)
     {
-      mask[j] = maskCopy[j];
+      if(flips[n] == 0)
+      {
+        continue;
+      }
+      const usize numNeighbors = neighborhood.getNeighbors(frontier[n], neighbors);
+      for(usize k = 0; k < numNeighbors; k++)
+      {
+        if(mask[neighbors[k]] != newValue)
+        {
+          nextFrontier.add(neighbors[k]);
+        }
+      }
     }
+    frontier = nextFrontier.takeNext();
   }
 
   return {};
@@ -5,45 +5,77 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include "SimplnxCore/utils/MorphologyUtilities.hpp"
 
 using namespace nx::core;
 
 namespace
 {
-template <typename T>
-void FillBadDataUpdateTuples(const Int32AbstractDataStore& featureIds, AbstractDataStore<T>& outputDataStore, const std::vector<int32>& neighbors)
+/**
+ * @brief Finds the neighbor each bad voxel of the frontier takes its data from. The neighboring feature
+ * with the most face neighbors wins, ties go to the feature that reached its count first. Only the
+ * feature ids are read so all the votes of a pass see the same feature ids.
+ */
+class FillBadDataVoteImpl
 {
-  usize start = 0;
-  usize stop = outputDataStore.getNumberOfTuples();
-  const usize numComponents = outputDataStore.getNumberOfComponents();
-  for(usize tupleIndex = start; tupleIndex < stop; tupleIndex++)
+public:
+  FillBadDataVoteImpl(const MorphologyUtilities::FaceNeighborhood& neighborhood, const Int32AbstractDataStore& featureIds, const std::vector<int64>& frontier, std::vector<int64>& sources,
+                      const std::atomic_bool& shouldCancel)
+  : m_Neighborhood(neighborhood)
+  , m_FeatureIds(featureIds)
+  , m_Frontier(frontier)
+  , m_Sources(sources)
+  , m_ShouldCancel(shouldCancel)
   {
-    const int32 featureName = featureIds[tupleIndex];
-    const int32 neighbor = neighbors[tupleIndex];
-    if(neighbor == tupleIndex)
-    {
-      continue;
-    }
+  }
 
-    if(featureName < 0 && neighbor != -1 && featureIds[static_cast<size_t>(neighbor)] > 0)
+  void operator()(const Range& range) const
+  {
+    std::array<int64, MorphologyUtilities::k_NumFaceNeighbors> neighbors = {};
+    std::array<int32, MorphologyUtilities::k_NumFaceNeighbors> features = {};
+    for(usize frontierIndex = range.min(); frontierIndex < range.max(); frontierIndex++)
     {
-      for(usize i = 0; i < numComponents; i++)
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const int64 voxel = m_Frontier[frontierIndex];
+      int64 source = -1;
+      if(m_FeatureIds[voxel] < 0)
       {
-        auto value = outputDataStore[neighbor * numComponents + i];
-        outputDataStore[tupleIndex * numComponents + i] = value;
+        const usize numNeighbors = m_Neighborhood.getNeighbors(voxel, neighbors);
+        int32 most = 0;
+        for(usize n = 0; n < numNeighbors; n++)
+        {
+          features[n] = m_FeatureIds[neighbors[n]];
+          if(features[n] <= 0)
+          {
+            continue;
+          }
+          int32 current = 0;
+          for(usize k = 0; k <= n; k++)
+          {
+            current += static_cast<int32>(features[k] == features[n]);
+          }
+          if(current > most)
+          {
+            most = current;
+            source = neighbors[n];
+          }
+        }
       }
+      m_Sources[frontierIndex] = source;
     }
   }
-}
 
-struct FillBadDataUpdateTuplesFunctor
-{
-  template <typename T>
-  void operator()(const Int32AbstractDataStore& featureIds, IDataArray* outputIDataArray, const std::vector<int32>& neighbors)
-  {
-    auto& outputStore = outputIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
-    FillBadDataUpdateTuples(featureIds, outputStore, neighbors);
-  }
+private:
+  const MorphologyUtilities::FaceNeighborhood& m_Neighborhood;
+  const Int32AbstractDataStore& m_FeatureIds;
+  const std::vector<int64>& m_Frontier;
+  std::vector<int64>& m_Sources;
+  const std::atomic_bool& m_ShouldCancel;
 };
 } // namespace
 
@@ -71,13 +103,8 @@ Result<> FillBadData::operator()()
   auto& featureIdsStore = m_DataStructure.getDataAs<Int32Array>(m_InputValues->featureIdsArrayPath)->getDataStoreRef();
   const size_t totalPoints = featureIdsStore.getNumberOfTuples();
 
-  std::vector<int32> neighbors(totalPoints, -1);
-
-  std::vector<bool> alreadyChecked(totalPoints, false);
-
   const auto& selectedImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->inputImageGeometry);
-
-  const SizeVec3 udims = selectedImageGeom.getDimensions();
+  const MorphologyUtilities::FaceNeighborhood neighborhood(selectedImageGeom.getDimensions());
 
   Int32Array* cellPhasesPtr = nullptr;
 
@@ -86,37 +113,7 @@ Result<> FillBadData::operator()()
     cellPhasesPtr = m_DataStructure.getDataAs<Int32Array>(m_InputValues->cellPhasesArrayPath);
   }
 
-  std::array<int64_t, 3> dims = {
-      static_cast<int64_t>(udims[0]),
-      static_cast<int64_t>(udims[1]),
-      static_cast<int64_t>(udims[2]),
-  };
-
-  size_t count = 1;
-  // int32_t good = 1;
-  // int64_t neighbor = 0;
-  // int64_t index = 0;
-  // float32 x = 0.0F;
-  //  float32 y = 0.0F;
-  //  float32 z = 0.0F;
-  // int64 column = 0;
-  // int64 row = 0;
-  // int64 plane = 0;
-  //  int64 neighborPoint = 0;
-  //  int32 featureName = 0;
-  //  int32 feature = 0;
-  size_t numFeatures = 0;
   size_t maxPhase = 0;
-
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    int32 featureName = featureIdsStore[i];
-    if(featureName > numFeatures)
-    {
-      numFeatures = featureName;
-    }
-  }
-
   if(m_InputValues->storeAsNewPhase)
   {
     for(size_t i = 0; i < totalPoints; i++)
@@ -128,200 +125,125 @@ Result<> FillBadData::operator()()
     }
   }
 
-  std::array<int64_t, 6> neighborPoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
-  std::vector<int64_t> currentVisitedList;
-
-  for(size_t iter = 0; iter < totalPoints; iter++)
+  // Label the connected regions of bad data. Regions that are large enough are kept (optionally as a
+  // new phase) and the small ones are flagged with -1 so they get filled in below.
+  m_MessageHandler({IFilter::Message::Type::Info, "Labeling bad data regions"});
+  std::vector<uint8> badDataMask(totalPoints, 0);
+  for(size_t i = 0; i < totalPoints; i++)
   {
-    alreadyChecked[iter] = false;
-    if(featureIdsStore[iter] != 0)
-    {
-      alreadyChecked[iter] = true;
-    }
+    badDataMask[i] = static_cast<uint8>(featureIdsStore[i] == 0);
+  }
+  const MorphologyUtilities::ConnectedComponents badDataRegions = MorphologyUtilities::LabelConnectedComponents(neighborhood, badDataMask, m_ShouldCancel);
+  badDataMask = std::vector<uint8>();
+  if(m_ShouldCancel)
+  {
+    return {};
   }
 
+  std::vector<int64> frontier;
   for(size_t i = 0; i < totalPoints; i++)
   {
-    if(!alreadyChecked[i] && featureIdsStore[i] == 0)
+    const int64 regionId = badDataRegions.componentIds[i];
+    if(regionId < 0)
     {
-      currentVisitedList.push_back(static_cast<int64_t>(i));
-      count = 0;
-      while(count < currentVisitedList.size())
-      {
-        int64_t index = currentVisitedList[count];
-        int64 column = index % dims[0];
-        int64 row = (index / dims[0]) % dims[1];
-        int64 plane = index / (dims[0] * dims[1]);
-        for(int32_t j = 0; j < 6; j++)
-        {
-          int64_t neighbor = index + neighborPoints[j];
-          if(j == 0 && plane == 0)
-          {
-            continue;
-          }
-          if(j == 5 && plane == (dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && row == 0)
-          {
-            continue;
-          }
-          if(j == 4 && row == (dims[1] - 1))
-          {
-            continue;
-          }
-          if(j == 2 && column == 0)
-          {
-            continue;
-          }
-          if(j == 3 && column == (dims[0] - 1))
-          {
-            continue;
-          }
-          if(featureIdsStore[neighbor] == 0 && !alreadyChecked[neighbor])
-          {
-            currentVisitedList.push_back(neighbor);
-            alreadyChecked[neighbor] = true;
-          }
-        }
-        count++;
-      }
-      if((int32_t)currentVisitedList.size() >= m_InputValues->minAllowedDefectSizeValue)
-      {
-        for(const auto& currentIndex : currentVisitedList)
-        {
-          featureIdsStore[currentIndex] = 0;
-          if(m_InputValues->storeAsNewPhase)
-          {
-            (*cellPhasesPtr)[currentIndex] = static_cast<int32>(maxPhase) + 1;
-          }
-        }
-      }
-      if((int32_t)currentVisitedList.size() < m_InputValues->minAllowedDefectSizeValue)
+      continue;
+    }
+    // The flood fill this replaced counted the first voxel of every region that has more than one voxel twice.
+    // That is kept so the same regions are filled.
+    usize regionSize = badDataRegions.sizes[regionId];
+    regionSize += regionSize > 1 ? 1 : 0;
+    if(static_cast<int32>(regionSize) >= m_InputValues->minAllowedDefectSizeValue)
+    {
+      if(m_InputValues->storeAsNewPhase)
       {
-        for(const auto& currentIndex : currentVisitedList)
-        {
-          featureIdsStore[currentIndex] = -1;
-        }
+        (*cellPhasesPtr)[i] = static_cast<int32>(maxPhase) + 1;
       }
-      currentVisitedList.clear();
+    }
+    else
+    {
+      featureIdsStore[i] = -1;
+      frontier.push_back(static_cast<int64>(i));
     }
   }
 
-  std::vector<int32_t> featureNumber(numFeatures + 1, 0);
-
-  while(count != 0)
+  // The flagged voxels are filled from the outside in. Every pass votes on the voxels in the frontier
+  // using the feature ids from the end of the previous pass, then applies all the votes at once. Only the
+  // flagged voxels next to a voxel that was just filled can receive a vote in the next pass.
+  //
+  // A filled voxel never changes again, so instead of copying every cell array on every pass each filled
+  // voxel remembers the original good voxel its data came from and all the arrays are gathered once at the end.
+  std::vector<int64> dataSource(totalPoints, -1);
+  std::vector<std::pair<int64, int64>> gatherList;
+  MorphologyUtilities::ActiveFrontier nextFrontier(totalPoints);
+  std::vector<int64> sources;
+  std::array<int64, MorphologyUtilities::k_NumFaceNeighbors> neighbors = {};
+
+  ParallelDataAlgorithm::AlgorithmArrays algArrays;
+  algArrays.push_back(m_DataStructure.getDataAs<Int32Array>(m_InputValues->featureIdsArrayPath));
+
+  while(!frontier.empty())
   {
-    count = 0;
-    for(size_t i = 0; i < totalPoints; i++)
+    m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Processing {} bad data voxels", frontier.size())});
+
+    sources.resize(frontier.size());
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, frontier.size());
+    dataAlg.requireArraysInMemory(algArrays);
+    dataAlg.execute(FillBadDataVoteImpl(neighborhood, featureIdsStore, frontier, sources, m_ShouldCancel));
+    if(m_ShouldCancel)
     {
-      int32 featureName = featureIdsStore[i];
-      if(featureName < 0)
-      {
-        count++;
-        // int32 current = 0;
-        int32 most = 0;
-        auto xIndex = static_cast<float32>(i % dims[0]);
-        auto yIndex = static_cast<float32>((i / dims[0]) % dims[1]);
-        auto zIndex = static_cast<float32>(i / (dims[0] * dims[1]));
-        for(int32_t j = 0; j < 6; j++)
-        {
-          auto neighborPoint = static_cast<int64_t>(i + neighborPoints[j]);
-          if(j == 0 && zIndex == 0)
-          {
-            continue;
-          }
-          if(j == 5 && zIndex == static_cast<float32>(dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && yIndex == 0)
-          {
-            continue;
-          }
-          if(j == 4 && yIndex == static_cast<float32>(dims[1] - 1))
-          {
-            continue;
-          }
-          if(j == 2 && xIndex == 0)
-          {
-            continue;
-          }
-          if(j == 3 && xIndex == static_cast<float32>(dims[0] - 1))
-          {
-            continue;
-          }
-
-          int32 feature = featureIdsStore[neighborPoint];
-          if(feature > 0)
-          {
-            featureNumber[feature]++;
-            int32 current = featureNumber[feature];
-            if(current > most)
-            {
-              most = current;
-              neighbors[i] = static_cast<int32>(neighborPoint);
-            }
-          }
-        }
-        for(int32_t j = 0; j < 6; j++)
-        {
-          int64 neighborPoint = static_cast<int64>(i) + neighborPoints[j];
-          if(j == 0 && zIndex == 0)
-          {
-            continue;
-          }
-          if(j == 5 && zIndex == static_cast<float32>(dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && yIndex == 0)
-          {
-            continue;
-          }
-          if(j == 4 && yIndex == static_cast<float32>(dims[1] - 1))
-          {
-            continue;
-          }
-          if(j == 2 && xIndex == 0)
-          {
-            continue;
-          }
-          if(j == 3 && xIndex == static_cast<float32>(dims[0] - 1))
-          {
-            continue;
-          }
+      return {};
+    }
 
-          int32 feature = featureIdsStore[neighborPoint];
-          if(feature > 0)
-          {
-            featureNumber[feature] = 0;
-          }
-        }
+    const usize filledStart = gatherList.size();
+    for(usize n = 0; n < frontier.size(); n++)
+    {
+      const int64 source = sources[n];
+      if(source < 0)
+      {
+        continue;
       }
+      const int64 voxel = frontier[n];
+      featureIdsStore[voxel] = featureIdsStore[source];
+      dataSource[voxel] = dataSource[source] < 0 ? source : dataSource[source];
+      gatherList.emplace_back(voxel, dataSource[voxel]);
     }
 
-    std::optional<std::vector<DataPath>> allChildArrays = GetAllChildDataPaths(m_DataStructure, selectedImageGeom.getCellDataPath(), DataObject::Type::DataArray, m_InputValues->ignoredDataArrayPaths);
-    std::vector<DataPath> voxelArrayNames;
-    if(allChildArrays.has_value())
+    // Flagged voxels that are not connected to any feature can never be filled
+    if(gatherList.size() == filledStart)
     {
-      voxelArrayNames = allChildArrays.value();
+      break;
     }
 
-    for(const auto& cellArrayPath : voxelArrayNames)
+    for(usize n = filledStart; n < gatherList.size(); n++)
+    {
+      const usize numNeighbors = neighborhood.getNeighbors(gatherList[n].first, neighbors);
+      for(usize k = 0; k < numNeighbors; k++)
+      {
+        if(featureIdsStore[neighbors[k]] < 0)
+        {
+          nextFrontier.add(neighbors[k]);
+        }
+      }
+    }
+    frontier = nextFrontier.takeNext();
+  }
+
+  // The feature ids are already up to date. Every other cell array is gathered from the original good voxels in one pass.
+  std::optional<std::vector<DataPath>> allChildArrays = GetAllChildDataPaths(m_DataStructure, selectedImageGeom.getCellDataPath(), DataObject::Type::DataArray, m_InputValues->ignoredDataArrayPaths);
+  std::vector<std::shared_ptr<IDataArray>> voxelArrays;
+  if(allChildArrays.has_value())
+  {
+    for(const auto& cellArrayPath : allChildArrays.value())
     {
       if(cellArrayPath == m_InputValues->featureIdsArrayPath)
       {
         continue;
       }
-      auto* oldCellArray = m_DataStructure.getDataAs<IDataArray>(cellArrayPath);
-
-      ExecuteDataFunction(FillBadDataUpdateTuplesFunctor{}, oldCellArray->getDataType(), featureIdsStore, oldCellArray, neighbors);
+      voxelArrays.push_back(m_DataStructure.getSharedDataAs<IDataArray>(cellArrayPath));
     }
-
-    // We need to update the FeatureIds array _LAST_ since the above operations depend on that values in that array
-    FillBadDataUpdateTuples<int32>(featureIdsStore, featureIdsStore, neighbors);
   }
+  MorphologyUtilities::GatherTuples(voxelArrays, gatherList);
+
   return {};
 }
@@ -7,17 +7,28 @@ using namespace nx::core;
 
 namespace
 {
+struct CreateInterpolatorFunctor
+{
+  template <typename T>
+  std::shared_ptr<AbstractFlyingEdgesInterpolator> operator()(const IDataArray& sourceArray, IDataArray& destinationArray)
+  {
+    return std::make_shared<FlyingEdgesInterpolator<T>>(sourceArray.template getIDataStoreRefAs<AbstractDataStore<T>>(), destinationArray.template getIDataStoreRefAs<AbstractDataStore<T>>());
+  }
+};
+
 struct ExecuteFlyingEdgesFunctor
 {
   template <typename T>
-  void operator()(const ImageGeom& image, const IDataArray* iDataArray, float64 isoVal, TriangleGeom& triangleGeom, Float32AbstractDataStore& normals, AttributeMatrix& normAM)
+  void operator()(const ImageGeom& image, const IDataArray* iDataArray, float64 isoVal, TriangleGeom& triangleGeom, Float32AbstractDataStore& normals, AttributeMatrix& normAM,
+                  const typename FlyingEdgesAlgorithm<T>::InterpolatorsType& interpolators)
   {
-    FlyingEdgesAlgorithm flyingEdges = FlyingEdgesAlgorithm<T>(image, iDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>(), static_cast<T>(isoVal), triangleGeom, normals);
+    FlyingEdgesAlgorithm flyingEdges =
+        FlyingEdgesAlgorithm<T>(image, iDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>(), static_cast<T>(isoVal), triangleGeom, normals, interpolators);
     flyingEdges.pass1();
     flyingEdges.pass2();
     flyingEdges.pass3();
 
-    // pass 3 resized normals so be sure to resize parent AM
+    // pass 3 resized normals so be sure to resize parent AM. This also sizes the interpolated arrays.
     normAM.resizeTuples(normals.getTupleShape());
 
     flyingEdges.pass4();
@@ -50,7 +61,7 @@ Result<> FlyingEdges3D::operator()()
   const auto& image = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->imageGeomPath);
   float64 isoVal = m_InputValues->isoVal;
   const auto* iDataArray = m_DataStructure.getDataAs<IDataArray>(m_InputValues->contouringArrayPath);
-  auto triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->triangleGeomPath);
+  auto& triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->triangleGeomPath);
   auto& normalsStore = m_DataStructure.getDataAs<Float32Array>(m_InputValues->normalsArrayPath)->getDataStoreRef();
 
   // auto created so must have a parent
@@ -58,7 +69,16 @@ Result<> FlyingEdges3D::operator()()
 
   auto& normAM = m_DataStructure.getDataRefAs<AttributeMatrix>(normAMPath);
 
-  ExecuteNeighborFunction(ExecuteFlyingEdgesFunctor{}, iDataArray->getDataType(), image, iDataArray, isoVal, triangleGeom, normalsStore, normAM);
+  // The interpolated arrays live in the same vertex attribute matrix as the normals
+  std::vector<std::shared_ptr<AbstractFlyingEdgesInterpolator>> interpolators;
+  for(usize index = 0; index < m_InputValues->interpolatedArrayPaths.size(); index++)
+  {
+    const auto& sourceArray = m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->interpolatedArrayPaths[index]);
+    auto& destinationArray = m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->createdArrayPaths[index]);
+    interpolators.push_back(ExecuteDataFunction(CreateInterpolatorFunctor{}, sourceArray.getDataType(), sourceArray, destinationArray));
+  }
+
+  ExecuteNeighborFunction(ExecuteFlyingEdgesFunctor{}, iDataArray->getDataType(), image, iDataArray, isoVal, triangleGeom, normalsStore, normAM, interpolators);
 
   return {};
 }
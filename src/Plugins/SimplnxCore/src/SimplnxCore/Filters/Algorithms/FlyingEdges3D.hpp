@@ -13,6 +13,8 @@ struct SIMPLNXCORE_EXPORT FlyingEdges3DInputValues
   DataPath triangleGeomPath;
   DataPath contouringArrayPath;
   DataPath normalsArrayPath;
+  std::vector<DataPath> interpolatedArrayPaths;
+  std::vector<DataPath> createdArrayPaths;
   float64 isoVal;
 };
 
@@ -5,9 +5,103 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/INodeGeometry2D.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <array>
 
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief Vertex to vertex adjacency in compressed sparse row form. The neighbors of vertex i
+ * are Neighbors[Offsets[i]] ... Neighbors[Offsets[i + 1] - 1], listed in shared edge list order.
+ */
+struct VertexAdjacency
+{
+  std::vector<IGeometry::MeshIndexType> Offsets;
+  std::vector<IGeometry::MeshIndexType> Neighbors;
+};
+
+// -----------------------------------------------------------------------------
+VertexAdjacency CreateVertexAdjacency(const AbstractDataStore<IGeometry::SharedEdgeList::value_type>& edges, IGeometry::MeshIndexType numVertices)
+{
+  const IGeometry::MeshIndexType numEdges = edges.getNumberOfTuples();
+
+  VertexAdjacency adjacency;
+  adjacency.Offsets.resize(numVertices + 1, 0);
+  adjacency.Neighbors.resize(2 * numEdges);
+
+  for(IGeometry::MeshIndexType i = 0; i < numEdges; i++)
+  {
+    adjacency.Offsets[edges[2 * i] + 1]++;
+    adjacency.Offsets[edges[2 * i + 1] + 1]++;
+  }
+  for(IGeometry::MeshIndexType i = 0; i < numVertices; i++)
+  {
+    adjacency.Offsets[i + 1] += adjacency.Offsets[i];
+  }
+
+  std::vector<IGeometry::MeshIndexType> insertIndex(adjacency.Offsets.begin(), adjacency.Offsets.end() - 1);
+  for(IGeometry::MeshIndexType i = 0; i < numEdges; i++)
+  {
+    const IGeometry::MeshIndexType in1 = edges[2 * i];
+    const IGeometry::MeshIndexType in2 = edges[2 * i + 1];
+    adjacency.Neighbors[insertIndex[in1]++] = in2;
+    adjacency.Neighbors[insertIndex[in2]++] = in1;
+  }
+  return adjacency;
+}
+
+/**
+ * @brief One Jacobi smoothing pass: every vertex moves by lambda * factor times the mean of the
+ * vectors to its neighbors. Positions are only read from source and only written to destination,
+ * so each vertex gathers its own update and the vertices are split between threads.
+ */
+void SmoothVertices(const VertexAdjacency& adjacency, const std::vector<float32>& lambdas, float32 factor, const std::vector<float32>& source, std::vector<float32>& destination,
+                    const std::atomic_bool& shouldCancel)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, lambdas.size());
+  dataAlg.execute([&](const Range& range) {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(shouldCancel)
+      {
+        return;
+      }
+      const IGeometry::MeshIndexType begin = adjacency.Offsets[i];
+      const IGeometry::MeshIndexType end = adjacency.Offsets[i + 1];
+      if(begin == end)
+      {
+        // A vertex that is not part of any edge stays where it is
+        std::copy_n(source.begin() + 3 * i, 3, destination.begin() + 3 * i);
+        continue;
+      }
+
+      // Accumulated in the same order and precision as the edge loop this replaces
+      std::array<float64, 3> delta = {0.0, 0.0, 0.0};
+      for(IGeometry::MeshIndexType n = begin; n < end; n++)
+      {
+        const IGeometry::MeshIndexType neighbor = adjacency.Neighbors[n];
+        for(usize j = 0; j < 3; j++)
+        {
+          delta[j] += static_cast<float64>(source[3 * neighbor + j] - source[3 * i + j]);
+        }
+      }
+
+      const float32 lambda = lambdas[i] * factor;
+      const auto numConnections = static_cast<float64>(end - begin);
+      for(usize j = 0; j < 3; j++)
+      {
+        destination[3 * i + j] = static_cast<float32>(source[3 * i + j] + lambda * (delta[j] / numConnections));
+      }
+    }
+  });
+}
+} // namespace
+
 LaplacianSmoothing::LaplacianSmoothing(DataStructure& dataStructure, LaplacianSmoothingInputValues* inputValues, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
 : m_DataStructure(dataStructure)
 , m_InputValues(inputValues)
@@ -43,13 +137,14 @@ Result<> LaplacianSmoothing::edgeBasedSmoothing()
     return MakeErrorResult(-560, "Error retrieving the shared edge list");
   }
 
-  AbstractDataStore<IGeometry::SharedEdgeList::value_type>& edges = surfaceMesh.getEdges()->getDataStoreRef();
-  IGeometry::MeshIndexType numEdges = edges.getNumberOfTuples();
-
-  std::vector<int32> numConnections(nvert, 0);
+  // The adjacency never changes, so it is built once and every pass gathers through it
+  m_MessageHandler(IFilter::Message::Type::Info, "Building vertex adjacency");
+  const VertexAdjacency adjacency = CreateVertexAdjacency(surfaceMesh.getEdges()->getDataStoreRef(), nvert);
 
-  std::vector<double> deltaArray(nvert * 3);
-  double dlta = 0.0;
+  // Double buffered positions: each pass reads one buffer and writes the other, the
+  // vertex array itself is only touched once before and once after smoothing
+  std::vector<float32> positions(verts.begin(), verts.begin() + 3 * nvert);
+  std::vector<float32> smoothedPositions(positions.size());
 
   for(int32_t q = 0; q < m_InputValues->pIterationSteps; q++)
   {
@@ -58,88 +153,27 @@ Result<> LaplacianSmoothing::edgeBasedSmoothing()
       return {};
     }
     m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Iteration {} of {}", q, m_InputValues->pIterationSteps));
-    // Compute the Deltas for each point
-    for(IGeometry::MeshIndexType i = 0; i < numEdges; i++)
-    {
-      IGeometry::MeshIndexType in1 = edges[2 * i];     // row of the first vertex
-      IGeometry::MeshIndexType in2 = edges[2 * i + 1]; // row the second vertex
-
-      for(IGeometry::MeshIndexType j = 0; j < 3; j++)
-      {
-#if 0
-        Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-        Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-#endif
-        dlta = static_cast<double>(verts[3 * in2 + j] - verts[3 * in1 + j]);
-        deltaArray[3 * in1 + j] += dlta;
-        deltaArray[3 * in2 + j] += -1.0 * dlta;
-      }
-      numConnections[in1] += 1;
-      numConnections[in2] += 1;
-    }
-
-    // Move each point
-    for(IGeometry::MeshIndexType i = 0; i < nvert; i++)
-    {
-      for(IGeometry::MeshIndexType j = 0; j < 3; j++)
-      {
-        IGeometry::MeshIndexType in0 = 3 * i + j;
-        dlta = deltaArray[in0] / numConnections[i];
-
-        float ll = lambdas[i];
-        verts[3 * i + j] += ll * dlta;
-        deltaArray[in0] = 0.0; // reset for next iteration
-      }
-      numConnections[i] = 0; // reset for next iteration
-    }
+    SmoothVertices(adjacency, lambdas, 1.0f, positions, smoothedPositions, m_ShouldCancel);
 
     // Now optionally apply a negative lambda based on the mu Factor value.
     // This is from Taubin's paper on smoothing without shrinkage. This effectively
-    // runs a low pass filter on the data
+    // runs a low pass filter on the data. The mu pass reads the lambda pass output
+    // straight from the other buffer so both passes leave the results in positions.
     if(m_InputValues->pUseTaubinSmoothing)
     {
-
-      if(m_ShouldCancel)
-      {
-        return {};
-      }
-      m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Iteration {} of {}", q, m_InputValues->pIterationSteps));
-      // Compute the Delta's
-      for(IGeometry::MeshIndexType i = 0; i < numEdges; i++)
-      {
-        IGeometry::MeshIndexType in1 = edges[2 * i];     // row of the first vertex
-        IGeometry::MeshIndexType in2 = edges[2 * i + 1]; // row the second vertex
-
-        for(int32_t j = 0; j < 3; j++)
-        {
-#if 0
-          Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-          Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-#endif
-          dlta = verts[3 * in2 + j] - verts[3 * in1 + j];
-          deltaArray[3 * in1 + j] += dlta;
-          deltaArray[3 * in2 + j] += -1.0 * dlta;
-        }
-        numConnections[in1] += 1;
-        numConnections[in2] += 1;
-      }
-
-      // MOve the points
-      for(IGeometry::MeshIndexType i = 0; i < nvert; i++)
-      {
-        for(IGeometry::MeshIndexType j = 0; j < 3; j++)
-        {
-          IGeometry::MeshIndexType in0 = 3 * i + j;
-          dlta = deltaArray[in0] / numConnections[i];
-
-          float ll = lambdas[i] * m_InputValues->pMuFactor;
-          verts[3 * i + j] += ll * dlta;
-          deltaArray[in0] = 0.0; // reset for next iteration
-        }
-        numConnections[i] = 0; // reset for next iteration
-      }
+      SmoothVertices(adjacency, lambdas, m_InputValues->pMuFactor, smoothedPositions, positions, m_ShouldCancel);
+    }
+    else
+    {
+      positions.swap(smoothedPositions);
     }
   }
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
+
+  std::copy(positions.begin(), positions.end(), verts.begin());
 
   return {};
 }
@@ -7,9 +7,11 @@
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/ParallelData3DAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
+#include <algorithm>
 #include <array>
-#include <unordered_map>
+#include <limits>
 
 using namespace nx::core;
 
@@ -23,206 +25,6 @@ std::mt19937_64 k_Generator(k_RandomDevice()); // Standard mersenne_twister_engi
 std::mt19937_64::result_type k_Seed = 3412341234123412;
 std::uniform_real_distribution<> k_Distribution(k_RangeMin, k_RangeMax);
 
-template <class T>
-void hashCombine(size_t& seed, const T& obj)
-{
-  std::hash<T> hasher;
-  seed ^= hasher(obj) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-}
-
-// -----------------------------------------------------------------------------
-using VertexType = std::array<float, 3>;
-using EdgeType = std::array<IGeometry::MeshIndexType, 2>;
-
-// -----------------------------------------------------------------------------
-struct VertexHasher
-{
-  size_t operator()(const VertexType& vert) const
-  {
-    size_t hash = std::hash<float>()(vert[0]);
-    hashCombine(hash, vert[1]);
-    hashCombine(hash, vert[2]);
-    return hash;
-  }
-};
-
-// -----------------------------------------------------------------------------
-struct EdgeHasher
-{
-  size_t operator()(const EdgeType& edge) const
-  {
-    size_t hash = std::hash<IGeometry::MeshIndexType>()(edge[0]);
-    hashCombine(hash, edge[1]);
-    return hash;
-  }
-};
-
-// -----------------------------------------------------------------------------
-using VertexMap = std::unordered_map<VertexType, IGeometry::MeshIndexType, VertexHasher>;
-using EdgeMap = std::unordered_map<EdgeType, IGeometry::MeshIndexType, EdgeHasher>;
-
-// -----------------------------------------------------------------------------
-struct GenerateTripleLinesImpl
-{
-  using MeshIndexType = typename QuickSurfaceMesh::MeshIndexType;
-
-  GenerateTripleLinesImpl(ImageGeom* imageGeom, Int32AbstractDataStore& featureIdsStore, VertexMap& vertexMapRef, EdgeMap& edgeMapRef)
-  : featureIds(featureIdsStore)
-  , vertexMap(vertexMapRef)
-  , edgeMap(edgeMapRef)
-  , origin(imageGeom->getOrigin())
-  , res(imageGeom->getSpacing())
-  {
-    SizeVec3 udims = imageGeom->getDimensions();
-
-    xP = udims[0];
-    yP = udims[1];
-    zP = udims[2];
-  }
-
-  void compute(usize zStart, usize zEnd, usize yStart, usize yEnd, usize xStart, usize xEnd) const
-  {
-    for(size_t k = zStart; k < zEnd; k++)
-    {
-      for(size_t j = yStart; j < yEnd; j++)
-      {
-        for(size_t i = xStart; i < xEnd; i++)
-        {
-          point = (k * xP * yP) + (j * xP) + i;
-          // Case 1
-          neigh1 = point + 1;
-          neigh2 = point + (xP * yP) + 1;
-          neigh3 = point + (xP * yP);
-
-          VertexType const p0 = {{origin[0] + static_cast<float>(i) * res[0] + res[0], origin[1] + static_cast<float>(j) * res[1] + res[1], origin[2] + static_cast<float>(k) * res[2] + res[2]}};
-
-          VertexType const p1 = {{origin[0] + static_cast<float>(i) * res[0] + res[0], origin[1] + static_cast<float>(j) * res[1], origin[2] + static_cast<float>(k) * res[2] + res[2]}};
-
-          VertexType const p2 = {{origin[0] + static_cast<float>(i) * res[0], origin[1] + static_cast<float>(j) * res[1] + res[1], origin[2] + static_cast<float>(k) * res[2] + res[2]}};
-
-          VertexType const p3 = {{origin[0] + static_cast<float>(i) * res[0] + res[0], origin[1] + static_cast<float>(j) * res[1] + res[1], origin[2] + static_cast<float>(k) * res[2]}};
-
-          uFeatures.clear();
-          uFeatures.insert(featureIds[point]);
-          uFeatures.insert(featureIds[neigh1]);
-          uFeatures.insert(featureIds[neigh2]);
-          uFeatures.insert(featureIds[neigh3]);
-
-          if(uFeatures.size() > 2)
-          {
-            auto iter = vertexMap.find(p0);
-            if(iter == vertexMap.end())
-            {
-              vertexMap[p0] = vertCounter++;
-            }
-            iter = vertexMap.find(p1);
-            if(iter == vertexMap.end())
-            {
-              vertexMap[p1] = vertCounter++;
-            }
-            MeshIndexType i0 = vertexMap[p0];
-            MeshIndexType i1 = vertexMap[p1];
-
-            const EdgeType tmpEdge = {{i0, i1}};
-            auto eiter = edgeMap.find(tmpEdge);
-            if(eiter == edgeMap.end())
-            {
-              edgeMap[tmpEdge] = edgeCounter++;
-            }
-          }
-
-          // Case 2
-          neigh1 = point + xP;
-          neigh2 = point + (xP * yP) + xP;
-          neigh3 = point + (xP * yP);
-
-          uFeatures.clear();
-          uFeatures.insert(featureIds[point]);
-          uFeatures.insert(featureIds[neigh1]);
-          uFeatures.insert(featureIds[neigh2]);
-          uFeatures.insert(featureIds[neigh3]);
-          if(uFeatures.size() > 2)
-          {
-            auto iter = vertexMap.find(p0);
-            if(iter == vertexMap.end())
-            {
-              vertexMap[p0] = vertCounter++;
-            }
-            iter = vertexMap.find(p2);
-            if(iter == vertexMap.end())
-            {
-              vertexMap[p2] = vertCounter++;
-            }
-
-            MeshIndexType i0 = vertexMap[p0];
-            MeshIndexType i2 = vertexMap[p2];
-
-            const EdgeType tmpEdge = {{i0, i2}};
-            auto eiter = edgeMap.find(tmpEdge);
-            if(eiter == edgeMap.end())
-            {
-              edgeMap[tmpEdge] = edgeCounter++;
-            }
-          }
-
-          // Case 3
-          neigh1 = point + 1;
-          neigh2 = point + xP + 1;
-          neigh3 = point + +xP;
-
-          uFeatures.clear();
-          uFeatures.insert(featureIds[point]);
-          uFeatures.insert(featureIds[neigh1]);
-          uFeatures.insert(featureIds[neigh2]);
-          uFeatures.insert(featureIds[neigh3]);
-          if(uFeatures.size() > 2)
-          {
-            auto iter = vertexMap.find(p0);
-            if(iter == vertexMap.end())
-            {
-              vertexMap[p0] = vertCounter++;
-            }
-            iter = vertexMap.find(p3);
-            if(iter == vertexMap.end())
-            {
-              vertexMap[p3] = vertCounter++;
-            }
-
-            MeshIndexType i0 = vertexMap[p0];
-            MeshIndexType i3 = vertexMap[p3];
-
-            const EdgeType tmpEdge = {{i0, i3}};
-            auto eiter = edgeMap.find(tmpEdge);
-            if(eiter == edgeMap.end())
-            {
-              edgeMap[tmpEdge] = edgeCounter++;
-            }
-          }
-        }
-      }
-    }
-  }
-
-  void operator()(const Range3D& range) const
-  {
-    compute(range[0], range[1], range[2], range[3], range[4], range[5]);
-  }
-
-private:
-  mutable MeshIndexType point = 0, neigh1 = 0, neigh2 = 0, neigh3 = 0;
-  mutable MeshIndexType vertCounter = 0;
-  mutable MeshIndexType edgeCounter = 0;
-  mutable MeshIndexType xP;
-  mutable MeshIndexType yP;
-  mutable MeshIndexType zP;
-  FloatVec3 origin;
-  FloatVec3 res;
-  Int32AbstractDataStore& featureIds;
-  VertexMap& vertexMap;
-  EdgeMap& edgeMap;
-  mutable std::set<int32_t> uFeatures;
-};
-
 // -----------------------------------------------------------------------------
 void GetGridCoordinates(const IGridGeometry* grid, size_t x, size_t y, size_t z, QuickSurfaceMesh::VertexStore& verts, IGeometry::MeshIndexType nodeIndex)
 {
@@ -310,1189 +112,969 @@ void FlipProblemVoxelCase3(Int32AbstractDataStore& featureIds, QuickSurfaceMesh:
     featureIds[v3] = featureIds[v1];
   }
 }
-} // namespace
-
-// -----------------------------------------------------------------------------
-QuickSurfaceMesh::QuickSurfaceMesh(DataStructure& dataStructure, QuickSurfaceMeshInputValues* inputValues, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
-: m_DataStructure(dataStructure)
-, m_InputValues(inputValues)
-, m_ShouldCancel(shouldCancel)
-, m_MessageHandler(mesgHandler)
-{
-  k_Generator.seed(k_Seed);
-}
-
-// -----------------------------------------------------------------------------
-QuickSurfaceMesh::~QuickSurfaceMesh() noexcept = default;
 
 // -----------------------------------------------------------------------------
-Result<> QuickSurfaceMesh::operator()()
-{
-  // Get the ImageGeometry
-  auto& grid = m_DataStructure.getDataRefAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
-
-  // Get the Created Triangle Geometry
-  auto& triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->TriangleGeometryPath);
+using MeshIndexType = QuickSurfaceMesh::MeshIndexType;
 
-  SizeVec3 udims = grid.getDimensions();
+constexpr MeshIndexType k_InactiveNode = std::numeric_limits<MeshIndexType>::max();
 
-  size_t xP = udims[0];
-  size_t yP = udims[1];
-  size_t zP = udims[2];
+// Triangle corner orders used to split a voxel face into two triangles
+constexpr std::array<usize, 6> k_FaceWinding = {0, 1, 2, 1, 3, 2};
+constexpr std::array<usize, 6> k_FlippedFaceWinding = {0, 2, 1, 1, 2, 3};
 
-  std::vector<std::set<int32_t>> ownerLists;
+// Bits used to flag the triple line edges that leave a node in the -Y, -X and -Z directions
+constexpr uint8 k_TripleLineEdgeY = 1;
+constexpr uint8 k_TripleLineEdgeX = 2;
+constexpr uint8 k_TripleLineEdgeZ = 4;
 
-  size_t possibleNumNodes = (xP + 1) * (yP + 1) * (zP + 1);
-  std::vector<MeshIndexType> nodeIds(possibleNumNodes, std::numeric_limits<size_t>::max());
+// -----------------------------------------------------------------------------
+/**
+ * @brief A quad face between a voxel and a differing neighbor or the outside of the grid.
+ * The nodes are stored in the order that the original serial scan visited them so that the
+ * node numbering and triangle order of the mesh do not depend on the slab decomposition.
+ */
+struct VoxelFace
+{
+  std::array<MeshIndexType, 4> nodes = {};
+  bool flipWinding = false;
+  int32 firstLabel = -1;
+  int32 secondLabel = -1;
+  MeshIndexType firstCell = 0;
+  MeshIndexType secondCell = 0;
+};
 
-  MeshIndexType nodeCount = 0;
-  MeshIndexType triangleCount = 0;
+// -----------------------------------------------------------------------------
+void SetBoundaryFace(VoxelFace& face, int32 featureId, MeshIndexType point, bool flipWinding)
+{
+  face.flipWinding = flipWinding;
+  face.firstLabel = -1;
+  face.secondLabel = featureId;
+  face.firstCell = point;
+  face.secondCell = point;
+}
 
-  if(m_InputValues->FixProblemVoxels)
+// -----------------------------------------------------------------------------
+void SetInteriorFace(VoxelFace& face, int32 featureId, int32 neighborFeatureId, MeshIndexType point, MeshIndexType neighbor, bool flipWinding)
+{
+  face.firstCell = neighbor;
+  face.secondCell = point;
+  if(featureId < neighborFeatureId)
   {
-    correctProblemVoxels();
+    face.flipWinding = !flipWinding;
+    face.firstLabel = featureId;
+    face.secondLabel = neighborFeatureId;
   }
-
-  determineActiveNodes(nodeIds, nodeCount, triangleCount);
-
-  // now create node and triangle arrays knowing the number that will be needed
-  std::vector<usize> tupleShape = {triangleCount};
-  triangleGeom.resizeFaceList(triangleCount);
-  triangleGeom.resizeVertexList(nodeCount);
-  triangleGeom.getFaceAttributeMatrix()->resizeTuples(tupleShape);
-  triangleGeom.getVertexAttributeMatrix()->resizeTuples({nodeCount});
-
-  // Resize the Face Arrays that are being copied over from the ImageGeom Cell Data
-  for(const auto& dataPath : m_InputValues->CreatedDataArrayPaths)
+  else
   {
-    Result<> result = nx::core::ResizeAndReplaceDataArray(m_DataStructure, dataPath, tupleShape, nx::core::IDataAction::Mode::Execute);
+    face.flipWinding = flipWinding;
+    face.firstLabel = neighborFeatureId;
+    face.secondLabel = featureId;
   }
+}
 
-  createNodesAndTriangles(nodeIds, nodeCount, triangleCount);
+// -----------------------------------------------------------------------------
+/**
+ * @brief Walks the voxels of a single Z slab and reports every face that the mesh needs.
+ * Slab k only ever touches nodes on node planes k and k + 1, which is what allows the
+ * slabs to be meshed independently.
+ */
+class VoxelFaceWalker
+{
+public:
+  VoxelFaceWalker(const Int32AbstractDataStore& featureIds, const SizeVec3& dims)
+  : m_FeatureIds(featureIds)
+  , m_XP(dims[0])
+  , m_YP(dims[1])
+  , m_ZP(dims[2])
+  {
+  }
 
-#ifdef QSM_CREATE_TRIPLE_LINES
-  if(m_InputValues->pGenerateTripleLines)
+  MeshIndexType numberOfSlabs() const
   {
-    IGeometry::SharedTriList* triangle = triangleGeom.getFaces();
-    IGeometry::SharedVertexList* vertices = triangleGeom.getVertices();
+    return m_ZP;
+  }
 
-    EdgeGeom* edgeGeom = EdgeGeom::Create(m_DataStructure, "[EdgeType Geometry]", parentGroupId);
-    edgeGeom->setVertices(*vertices);
+  MeshIndexType nodesPerPlane() const
+  {
+    return (m_XP + 1) * (m_YP + 1);
+  }
 
-    Int32Array& nodeTypes = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->pFaceLabelsDataPath);
+  MeshIndexType nodePlane(MeshIndexType nodeIndex) const
+  {
+    return nodeIndex / nodesPerPlane();
+  }
 
-    MeshIndexType edgeCount = 0;
-    for(MeshIndexType i = 0; i < triangleCount; i++)
+  template <class FaceVisitor>
+  void visitSlab(MeshIndexType k, FaceVisitor& visitor) const
+  {
+    for(MeshIndexType j = 0; j < m_YP; j++)
     {
-      MeshIndexType n1 = (*triangle)[3 * i + 0];
-      MeshIndexType n2 = (*triangle)[3 * i + 1];
-      MeshIndexType n3 = (*triangle)[3 * i + 2];
-      if(nodeTypes[n1] >= 3 && nodeTypes[n2] >= 3)
+      for(MeshIndexType i = 0; i < m_XP; i++)
       {
-        edgeCount++;
+        visitVoxel(i, j, k, visitor);
       }
-      if(nodeTypes[n1] >= 3 && nodeTypes[n3] >= 3)
+    }
+  }
+
+private:
+  MeshIndexType nodeIndex(MeshIndexType i, MeshIndexType j, MeshIndexType k) const
+  {
+    return (k * (m_XP + 1) * (m_YP + 1)) + (j * (m_XP + 1)) + i;
+  }
+
+  template <class FaceVisitor>
+  void visitVoxel(MeshIndexType i, MeshIndexType j, MeshIndexType k, FaceVisitor& visitor) const
+  {
+    const MeshIndexType point = (k * m_XP * m_YP) + (j * m_XP) + i;
+    const MeshIndexType neigh1 = point + 1;
+    const MeshIndexType neigh2 = point + m_XP;
+    const MeshIndexType neigh3 = point + (m_XP * m_YP);
+    const int32 featureId = m_FeatureIds[point];
+
+    VoxelFace face;
+    if(i == 0)
+    {
+      face.nodes = {nodeIndex(i, j, k), nodeIndex(i, j + 1, k), nodeIndex(i, j, k + 1), nodeIndex(i, j + 1, k + 1)};
+      SetBoundaryFace(face, featureId, point, true);
+      visitor(face);
+    }
+    if(j == 0)
+    {
+      face.nodes = {nodeIndex(i, j, k), nodeIndex(i + 1, j, k), nodeIndex(i, j, k + 1), nodeIndex(i + 1, j, k + 1)};
+      SetBoundaryFace(face, featureId, point, false);
+      visitor(face);
+    }
+    if(k == 0)
+    {
+      face.nodes = {nodeIndex(i, j, k), nodeIndex(i + 1, j, k), nodeIndex(i, j + 1, k), nodeIndex(i + 1, j + 1, k)};
+      SetBoundaryFace(face, featureId, point, true);
+      visitor(face);
+    }
+    if(i == (m_XP - 1) || featureId != m_FeatureIds[neigh1])
+    {
+      face.nodes = {nodeIndex(i + 1, j, k), nodeIndex(i + 1, j + 1, k), nodeIndex(i + 1, j, k + 1), nodeIndex(i + 1, j + 1, k + 1)};
+      if(i == (m_XP - 1))
       {
-        edgeCount++;
+        SetBoundaryFace(face, featureId, point, false);
       }
-      if(nodeTypes[n2] >= 3 && nodeTypes[n3] >= 3)
+      else
       {
-        edgeCount++;
+        SetInteriorFace(face, featureId, m_FeatureIds[neigh1], point, neigh1, false);
       }
+      visitor(face);
     }
-
-    std::string edgeGeometryName = "[EdgeType Geometry]";
-    DataPath edgeGeometryDataPath = m_InputValues->pParentDataGroupPath.createChildPath(edgeGeometryName);
-    std::string sharedEdgeListName = "SharedEdgeList";
-    size_t numEdges = edgeCount;
-    size_t numEdgeComps = 2;
-    IGeometry::SharedEdgeList* edges =
-        IGeometry::SharedEdgeList::CreateWithStore<DataStore<MeshIndexType>>(m_DataStructure, sharedEdgeListName, {numEdges}, {numEdgeComps}, m_DataStructure.getId(edgeGeometryDataPath));
-
-    edgeCount = 0;
-    for(MeshIndexType i = 0; i < triangleCount; i++)
+    if(j == (m_YP - 1) || featureId != m_FeatureIds[neigh2])
     {
-      MeshIndexType n1 = (*triangle)[3 * i + 0];
-      MeshIndexType n2 = (*triangle)[3 * i + 1];
-      MeshIndexType n3 = (*triangle)[3 * i + 2];
-      if(nodeTypes[n1] >= 3 && nodeTypes[n2] >= 3)
+      face.nodes = {nodeIndex(i + 1, j + 1, k), nodeIndex(i, j + 1, k), nodeIndex(i + 1, j + 1, k + 1), nodeIndex(i, j + 1, k + 1)};
+      if(j == (m_YP - 1))
       {
-        (*edges)[2 * edgeCount] = n1;
-        (*edges)[2 * edgeCount + 1] = n2;
-        edgeCount++;
+        SetBoundaryFace(face, featureId, point, false);
       }
-      if(nodeTypes[n1] >= 3 && nodeTypes[n3] >= 3)
+      else
       {
-        (*edges)[2 * edgeCount] = n1;
-        (*edges)[2 * edgeCount + 1] = n3;
-        edgeCount++;
+        SetInteriorFace(face, featureId, m_FeatureIds[neigh2], point, neigh2, true);
       }
-      if(nodeTypes[n2] >= 3 && nodeTypes[n3] >= 3)
+      visitor(face);
+    }
+    if(k == (m_ZP - 1) || featureId != m_FeatureIds[neigh3])
+    {
+      face.nodes = {nodeIndex(i + 1, j, k + 1), nodeIndex(i, j, k + 1), nodeIndex(i + 1, j + 1, k + 1), nodeIndex(i, j + 1, k + 1)};
+      if(k == (m_ZP - 1))
       {
-        (*edges)[2 * edgeCount] = n2;
-        (*edges)[2 * edgeCount + 1] = n3;
-        edgeCount++;
+        SetBoundaryFace(face, featureId, point, true);
+      }
+      else
+      {
+        SetInteriorFace(face, featureId, m_FeatureIds[neigh3], point, neigh3, false);
       }
+      visitor(face);
     }
-
-    // Now that we all of that out of the way, generate the triple lines
-    generateTripleLines();
   }
-#endif
 
-  return {};
-}
+  const Int32AbstractDataStore& m_FeatureIds;
+  MeshIndexType m_XP = 0;
+  MeshIndexType m_YP = 0;
+  MeshIndexType m_ZP = 0;
+};
 
 // -----------------------------------------------------------------------------
-void QuickSurfaceMesh::correctProblemVoxels()
+/**
+ * @brief Pass 1: flags every node a slab touches and counts the triangles the slab emits.
+ * Slab k writes the lower plane flags of node plane k and the upper plane flags of node
+ * plane k + 1, so no two slabs ever write the same entry.
+ */
+class MarkActiveNodesImpl
 {
-  m_MessageHandler(IFilter::Message::Type::Info, "Correcting Problem Voxels");
-
-  auto* grid = m_DataStructure.getDataAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
-  auto& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
-
-  SizeVec3 udims = grid->getDimensions();
+public:
+  MarkActiveNodesImpl(const VoxelFaceWalker& walker, std::vector<uint8>& lowerPlaneFlags, std::vector<uint8>& upperPlaneFlags, std::vector<MeshIndexType>& slabTriangleCounts)
+  : m_Walker(walker)
+  , m_LowerPlaneFlags(lowerPlaneFlags)
+  , m_UpperPlaneFlags(upperPlaneFlags)
+  , m_SlabTriangleCounts(slabTriangleCounts)
+  {
+  }
 
-  MeshIndexType xP = udims[0];
-  MeshIndexType yP = udims[1];
-  MeshIndexType zP = udims[2];
+  void operator()(const Range& range) const
+  {
+    for(usize k = range.min(); k < range.max(); k++)
+    {
+      SlabVisitor visitor = {m_Walker, k, m_LowerPlaneFlags, m_UpperPlaneFlags};
+      m_Walker.visitSlab(k, visitor);
+      m_SlabTriangleCounts[k] = visitor.triangleCount;
+    }
+  }
 
-  MeshIndexType v1 = 0, v2 = 0, v3 = 0, v4 = 0;
-  MeshIndexType v5 = 0, v6 = 0, v7 = 0, v8 = 0;
+private:
+  struct SlabVisitor
+  {
+    const VoxelFaceWalker& walker;
+    MeshIndexType slab = 0;
+    std::vector<uint8>& lowerPlaneFlags;
+    std::vector<uint8>& upperPlaneFlags;
+    MeshIndexType triangleCount = 0;
 
-  int32_t f1 = 0, f2 = 0, f3 = 0, f4 = 0;
-  int32_t f5 = 0, f6 = 0, f7 = 0, f8 = 0;
+    void operator()(const VoxelFace& face)
+    {
+      for(const MeshIndexType node : face.nodes)
+      {
+        if(walker.nodePlane(node) == slab)
+        {
+          lowerPlaneFlags[node] = 1;
+        }
+        else
+        {
+          upperPlaneFlags[node] = 1;
+        }
+      }
+      triangleCount += 2;
+    }
+  };
 
-  MeshIndexType row1 = 0, row2 = 0;
-  MeshIndexType plane1 = 0, plane2 = 0;
+  const VoxelFaceWalker& m_Walker;
+  std::vector<uint8>& m_LowerPlaneFlags;
+  std::vector<uint8>& m_UpperPlaneFlags;
+  std::vector<MeshIndexType>& m_SlabTriangleCounts;
+};
 
-  MeshIndexType count = 1;
-  MeshIndexType iter = 0;
-  while(count > 0 && iter < 20)
+// -----------------------------------------------------------------------------
+/**
+ * @brief Pass 2: counts the nodes owned by each slab. A node on plane p belongs to slab p - 1
+ * when that slab touches it, otherwise to slab p. This is the slab that reaches the node first
+ * in the serial scan order.
+ */
+class CountOwnedNodesImpl
+{
+public:
+  CountOwnedNodesImpl(const VoxelFaceWalker& walker, const std::vector<uint8>& lowerPlaneFlags, const std::vector<uint8>& upperPlaneFlags, std::vector<MeshIndexType>& slabNodeCounts)
+  : m_Walker(walker)
+  , m_LowerPlaneFlags(lowerPlaneFlags)
+  , m_UpperPlaneFlags(upperPlaneFlags)
+  , m_SlabNodeCounts(slabNodeCounts)
   {
-    iter++;
-    count = 0;
+  }
 
-    for(MeshIndexType k = 1; k < zP; k++)
+  void operator()(const Range& range) const
+  {
+    const MeshIndexType nodesPerPlane = m_Walker.nodesPerPlane();
+    for(usize k = range.min(); k < range.max(); k++)
     {
-      plane1 = (k - 1) * xP * yP;
-      plane2 = k * xP * yP;
-      for(MeshIndexType j = 1; j < yP; j++)
+      MeshIndexType count = 0;
+      const MeshIndexType lowerStart = k * nodesPerPlane;
+      const MeshIndexType upperStart = lowerStart + nodesPerPlane;
+      for(MeshIndexType n = 0; n < nodesPerPlane; n++)
       {
-        row1 = (j - 1) * xP;
-        row2 = j * xP;
-        for(MeshIndexType i = 1; i < xP; i++)
+        if(m_LowerPlaneFlags[lowerStart + n] != 0 && m_UpperPlaneFlags[lowerStart + n] == 0)
         {
-          v1 = plane1 + row1 + i - 1;
-          v2 = plane1 + row1 + i;
-          v3 = plane1 + row2 + i - 1;
-          v4 = plane1 + row2 + i;
-          v5 = plane2 + row1 + i - 1;
-          v6 = plane2 + row1 + i;
-          v7 = plane2 + row2 + i - 1;
-          v8 = plane2 + row2 + i;
-
-          f1 = featureIds[v1];
-          f2 = featureIds[v2];
-          f3 = featureIds[v3];
-          f4 = featureIds[v4];
-          f5 = featureIds[v5];
-          f6 = featureIds[v6];
-          f7 = featureIds[v7];
-          f8 = featureIds[v8];
-
-          if(f1 == f8 && f1 != f2 && f1 != f3 && f1 != f4 && f1 != f5 && f1 != f6 && f1 != f7)
-          {
-            ::FlipProblemVoxelCase1(featureIds, v1, v2, v3, v6, v7, v8);
-            count++;
-          }
-          if(f2 == f7 && f2 != f1 && f2 != f3 && f2 != f4 && f2 != f5 && f2 != f6 && f2 != f8)
-          {
-            ::FlipProblemVoxelCase1(featureIds, v2, v1, v4, v5, v8, v7);
-            count++;
-          }
-          if(f3 == f6 && f3 != f1 && f3 != f2 && f3 != f4 && f3 != f5 && f3 != f7 && f3 != f8)
-          {
-            ::FlipProblemVoxelCase1(featureIds, v3, v1, v4, v5, v8, v6);
-            count++;
-          }
-          if(f4 == f5 && f4 != f1 && f4 != f2 && f4 != f3 && f4 != f6 && f4 != f7 && f4 != f8)
-          {
-            ::FlipProblemVoxelCase1(featureIds, v4, v2, v3, v6, v7, v5);
-            count++;
-          }
-          if(f1 == f6 && f1 != f2 && f1 != f5)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v1, v2, v5, v6);
-            count++;
-          }
-          if(f2 == f5 && f2 != f1 && f2 != f6)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v2, v1, v6, v5);
-            count++;
-          }
-          if(f3 == f8 && f3 != f4 && f3 != f7)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v3, v4, v7, v8);
-            count++;
-          }
-          if(f4 == f7 && f4 != f3 && f4 != f8)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v4, v3, v8, v7);
-            count++;
-          }
-          if(f1 == f7 && f1 != f3 && f1 != f5)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v1, v3, v5, v7);
-            count++;
-          }
-          if(f3 == f5 && f3 != f1 && f3 != f7)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v3, v1, v7, v5);
-            count++;
-          }
-          if(f2 == f8 && f2 != f4 && f2 != f6)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v2, v4, v6, v8);
-            count++;
-          }
-          if(f4 == f6 && f4 != f2 && f4 != f8)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v4, v2, v8, v6);
-            count++;
-          }
-          if(f1 == f4 && f1 != f2 && f1 != f3)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v1, v2, v3, v4);
-            count++;
-          }
-          if(f2 == f3 && f2 != f1 && f2 != f4)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v2, v1, v4, v3);
-            count++;
-          }
-          if(f5 == f8 && f5 != f6 && f5 != f7)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v5, v6, v7, v8);
-            count++;
-          }
-          if(f6 == f7 && f6 != f5 && f6 != f8)
-          {
-            ::FlipProblemVoxelCase2(featureIds, v6, v5, v8, v7);
-            count++;
-          }
-          if(f2 == f3 && f2 == f4 && f2 == f5 && f2 == f6 && f2 == f7 && f2 != f1 && f2 != f8)
-          {
-            ::FlipProblemVoxelCase3(featureIds, v2, v1, v8);
-            count++;
-          }
-          if(f1 == f3 && f1 == f4 && f1 == f5 && f1 == f7 && f2 == f8 && f1 != f2 && f1 != f7)
-          {
-            ::FlipProblemVoxelCase3(featureIds, v1, v2, v7);
-            count++;
-          }
-          if(f1 == f2 && f1 == f4 && f1 == f5 && f1 == f7 && f1 == f8 && f1 != f3 && f1 != f6)
-          {
-            ::FlipProblemVoxelCase3(featureIds, v1, v3, v6);
-            count++;
-          }
-          if(f1 == f2 && f1 == f3 && f1 == f6 && f1 == f7 && f1 == f8 && f1 != f4 && f1 != f5)
-          {
-            ::FlipProblemVoxelCase3(featureIds, v1, v4, v5);
-            count++;
-          }
+          count++;
+        }
+        if(m_UpperPlaneFlags[upperStart + n] != 0)
+        {
+          count++;
         }
       }
+      m_SlabNodeCounts[k] = count;
     }
-
-    std::string ss = fmt::format("Correcting Problem Voxels: Iteration - '{}'; Problem Voxels - '{}'", iter, count);
-    m_MessageHandler(IFilter::Message::Type::Info, ss);
   }
-}
+
+private:
+  const VoxelFaceWalker& m_Walker;
+  const std::vector<uint8>& m_LowerPlaneFlags;
+  const std::vector<uint8>& m_UpperPlaneFlags;
+  std::vector<MeshIndexType>& m_SlabNodeCounts;
+};
 
 // -----------------------------------------------------------------------------
-void QuickSurfaceMesh::determineActiveNodes(std::vector<MeshIndexType>& nodeIds, MeshIndexType& nodeCount, MeshIndexType& triangleCount)
+/**
+ * @brief Pass 3: numbers the nodes owned by each slab, in first visit order, starting at the
+ * slab's offset from the exclusive scan of the owned node counts.
+ */
+class AssignNodeIdsImpl
 {
-  m_MessageHandler(IFilter::Message::Type::Info, "Determining active Nodes");
+public:
+  AssignNodeIdsImpl(const VoxelFaceWalker& walker, const std::vector<uint8>& upperPlaneFlags, const std::vector<MeshIndexType>& slabNodeOffsets, std::vector<MeshIndexType>& nodeIds)
+  : m_Walker(walker)
+  , m_UpperPlaneFlags(upperPlaneFlags)
+  , m_SlabNodeOffsets(slabNodeOffsets)
+  , m_NodeIds(nodeIds)
+  {
+  }
 
-  auto* grid = m_DataStructure.getDataAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
-  Int32AbstractDataStore& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
+  void operator()(const Range& range) const
+  {
+    for(usize k = range.min(); k < range.max(); k++)
+    {
+      SlabVisitor visitor = {m_Walker, k, m_UpperPlaneFlags, m_NodeIds, m_SlabNodeOffsets[k]};
+      m_Walker.visitSlab(k, visitor);
+    }
+  }
 
-  SizeVec3 udims = grid->getDimensions();
+private:
+  struct SlabVisitor
+  {
+    const VoxelFaceWalker& walker;
+    MeshIndexType slab = 0;
+    const std::vector<uint8>& upperPlaneFlags;
+    std::vector<MeshIndexType>& nodeIds;
+    MeshIndexType nextNodeId = 0;
 
-  MeshIndexType xP = udims[0];
-  MeshIndexType yP = udims[1];
-  MeshIndexType zP = udims[2];
+    void operator()(const VoxelFace& face)
+    {
+      for(const MeshIndexType node : face.nodes)
+      {
+        // Lower plane nodes that the slab below touched are numbered by that slab
+        if(walker.nodePlane(node) == slab && upperPlaneFlags[node] != 0)
+        {
+          continue;
+        }
+        if(nodeIds[node] == k_InactiveNode)
+        {
+          nodeIds[node] = nextNodeId++;
+        }
+      }
+    }
+  };
 
-  std::vector<std::set<int32_t>> ownerLists;
+  const VoxelFaceWalker& m_Walker;
+  const std::vector<uint8>& m_UpperPlaneFlags;
+  const std::vector<MeshIndexType>& m_SlabNodeOffsets;
+  std::vector<MeshIndexType>& m_NodeIds;
+};
 
-  MeshIndexType point = 0, neigh1 = 0, neigh2 = 0, neigh3 = 0;
+// -----------------------------------------------------------------------------
+/**
+ * @brief Writes the triangles, face labels and transferred cell data of each slab directly
+ * into the final arrays starting at the slab's triangle offset.
+ */
+class CreateTrianglesImpl
+{
+public:
+  CreateTrianglesImpl(const VoxelFaceWalker& walker, const std::vector<MeshIndexType>& nodeIds, const std::vector<MeshIndexType>& slabTriangleOffsets, QuickSurfaceMesh::TriStore& triangles,
+                      Int32AbstractDataStore& faceLabels, const std::vector<std::shared_ptr<AbstractTupleTransfer>>& tupleTransferFunctions)
+  : m_Walker(walker)
+  , m_NodeIds(nodeIds)
+  , m_SlabTriangleOffsets(slabTriangleOffsets)
+  , m_Triangles(triangles)
+  , m_FaceLabels(faceLabels)
+  , m_TupleTransferFunctions(tupleTransferFunctions)
+  {
+  }
 
-  MeshIndexType nodeId1 = 0, nodeId2 = 0, nodeId3 = 0, nodeId4 = 0;
+  void operator()(const Range& range) const
+  {
+    for(usize k = range.min(); k < range.max(); k++)
+    {
+      SlabVisitor visitor = {m_NodeIds, m_Triangles, m_FaceLabels, m_TupleTransferFunctions, m_SlabTriangleOffsets[k]};
+      m_Walker.visitSlab(k, visitor);
+    }
+  }
 
-  // first determining which nodes are actually boundary nodes and
-  // count number of nodes and triangles that will be created
-  for(MeshIndexType k = 0; k < zP; k++)
+private:
+  struct SlabVisitor
   {
-    for(MeshIndexType j = 0; j < yP; j++)
+    const std::vector<MeshIndexType>& nodeIds;
+    QuickSurfaceMesh::TriStore& triangles;
+    Int32AbstractDataStore& faceLabels;
+    const std::vector<std::shared_ptr<AbstractTupleTransfer>>& tupleTransferFunctions;
+    MeshIndexType triangleIndex = 0;
+
+    void operator()(const VoxelFace& face)
     {
-      for(MeshIndexType i = 0; i < xP; i++)
+      const std::array<usize, 6>& winding = face.flipWinding ? k_FlippedFaceWinding : k_FaceWinding;
+      for(usize t = 0; t < 2; t++)
       {
-        point = (k * xP * yP) + (j * xP) + i;
-        neigh1 = point + 1;
-        neigh2 = point + xP;
-        neigh3 = point + (xP * yP);
+        triangles[triangleIndex * 3 + 0] = nodeIds[face.nodes[winding[t * 3 + 0]]];
+        triangles[triangleIndex * 3 + 1] = nodeIds[face.nodes[winding[t * 3 + 1]]];
+        triangles[triangleIndex * 3 + 2] = nodeIds[face.nodes[winding[t * 3 + 2]]];
+        faceLabels[triangleIndex * 2] = face.firstLabel;
+        faceLabels[triangleIndex * 2 + 1] = face.secondLabel;
 
-        if(i == 0)
+        for(const auto& tupleTransferFunction : tupleTransferFunctions)
         {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
+          tupleTransferFunction->transfer(triangleIndex, face.firstCell, face.secondCell, faceLabels);
         }
-        if(j == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        if(k == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        if(i == (xP - 1))
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        else if(featureIds[point] != featureIds[neigh1])
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        if(j == (yP - 1))
+
+        triangleIndex++;
+      }
+    }
+  };
+
+  const VoxelFaceWalker& m_Walker;
+  const std::vector<MeshIndexType>& m_NodeIds;
+  const std::vector<MeshIndexType>& m_SlabTriangleOffsets;
+  QuickSurfaceMesh::TriStore& m_Triangles;
+  Int32AbstractDataStore& m_FaceLabels;
+  const std::vector<std::shared_ptr<AbstractTupleTransfer>>& m_TupleTransferFunctions;
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Writes the coordinates and node type of every active node. The node type is the
+ * number of unique features among the (up to) 8 voxels around the node, capped at 4, plus
+ * 10 if the node lies on the outside of the volume. Since every pair of differing voxels
+ * around an active node is separated by a meshed face this is the same as collecting the
+ * owners of each node while the triangles are being created.
+ */
+class CreateNodesImpl
+{
+public:
+  CreateNodesImpl(const IGridGeometry* grid, const Int32AbstractDataStore& featureIds, const std::vector<MeshIndexType>& nodeIds, QuickSurfaceMesh::VertexStore& vertices,
+                  Int8AbstractDataStore& nodeTypes)
+  : m_Grid(grid)
+  , m_FeatureIds(featureIds)
+  , m_NodeIds(nodeIds)
+  , m_Vertices(vertices)
+  , m_NodeTypes(nodeTypes)
+  {
+    SizeVec3 udims = grid->getDimensions();
+    m_XP = udims[0];
+    m_YP = udims[1];
+    m_ZP = udims[2];
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize z = range.min(); z < range.max(); z++)
+    {
+      for(MeshIndexType y = 0; y <= m_YP; y++)
+      {
+        for(MeshIndexType x = 0; x <= m_XP; x++)
         {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
+          const MeshIndexType nodeId = m_NodeIds[(z * (m_XP + 1) * (m_YP + 1)) + (y * (m_XP + 1)) + x];
+          if(nodeId == k_InactiveNode)
           {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
+            continue;
           }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
+          ::GetGridCoordinates(m_Grid, x, y, z, m_Vertices, nodeId * 3);
+          m_NodeTypes[nodeId] = nodeType(x, y, z);
         }
-        else if(featureIds[point] != featureIds[neigh2])
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        if(k == (zP - 1))
+      }
+    }
+  }
+
+private:
+  int8 nodeType(MeshIndexType x, MeshIndexType y, MeshIndexType z) const
+  {
+    std::array<int32, 8> owners = {};
+    usize numOwners = 0;
+    bool onSurface = false;
+    for(MeshIndexType cz = z; cz <= z + 1; cz++)
+    {
+      for(MeshIndexType cy = y; cy <= y + 1; cy++)
+      {
+        for(MeshIndexType cx = x; cx <= x + 1; cx++)
         {
-          nodeId1 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
+          // The voxel at (cx - 1, cy - 1, cz - 1) touches this node
+          int32 owner = -1;
+          if(cx != 0 && cx <= m_XP && cy != 0 && cy <= m_YP && cz != 0 && cz <= m_ZP)
           {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
+            owner = m_FeatureIds[((cz - 1) * m_XP * m_YP) + ((cy - 1) * m_XP) + (cx - 1)];
           }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
+          if(owner == -1)
           {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
+            onSurface = true;
           }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
+          if(std::find(owners.begin(), owners.begin() + numOwners, owner) == owners.begin() + numOwners)
           {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
+            owners[numOwners++] = owner;
           }
-          triangleCount++;
-          triangleCount++;
         }
-        else if(k < zP - 1 && featureIds[point] != featureIds[neigh3])
+      }
+    }
+
+    auto type = static_cast<int8>(std::min<usize>(numOwners, 4));
+    if(onSurface)
+    {
+      type += 10;
+    }
+    return type;
+  }
+
+  const IGridGeometry* m_Grid = nullptr;
+  const Int32AbstractDataStore& m_FeatureIds;
+  const std::vector<MeshIndexType>& m_NodeIds;
+  QuickSurfaceMesh::VertexStore& m_Vertices;
+  Int8AbstractDataStore& m_NodeTypes;
+  MeshIndexType m_XP = 0;
+  MeshIndexType m_YP = 0;
+  MeshIndexType m_ZP = 0;
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Flags the triple line edges found at each voxel. Voxel (i, j, k) only ever writes the
+ * flags of node (i + 1, j + 1, k + 1), so the voxels can be processed in parallel.
+ */
+class GenerateTripleLinesImpl
+{
+public:
+  GenerateTripleLinesImpl(const ImageGeom* imageGeom, const Int32AbstractDataStore& featureIdsStore, std::vector<uint8>& edgeFlagsRef)
+  : featureIds(featureIdsStore)
+  , edgeFlags(edgeFlagsRef)
+  {
+    SizeVec3 udims = imageGeom->getDimensions();
+
+    xP = udims[0];
+    yP = udims[1];
+    zP = udims[2];
+  }
+
+  void compute(usize zStart, usize zEnd, usize yStart, usize yEnd, usize xStart, usize xEnd) const
+  {
+    for(size_t k = zStart; k < zEnd; k++)
+    {
+      for(size_t j = yStart; j < yEnd; j++)
+      {
+        for(size_t i = xStart; i < xEnd; i++)
         {
-          nodeId1 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
+          const MeshIndexType point = (k * xP * yP) + (j * xP) + i;
+          uint8 flags = 0;
+          // Case 1
+          if(countUniqueFeatures(point, point + 1, point + (xP * yP) + 1, point + (xP * yP)) > 2)
           {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
+            flags |= k_TripleLineEdgeY;
           }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
+          // Case 2
+          if(countUniqueFeatures(point, point + xP, point + (xP * yP) + xP, point + (xP * yP)) > 2)
           {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
+            flags |= k_TripleLineEdgeX;
           }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
+          // Case 3
+          if(countUniqueFeatures(point, point + 1, point + xP + 1, point + xP) > 2)
           {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
+            flags |= k_TripleLineEdgeZ;
           }
-          triangleCount++;
-          triangleCount++;
+          edgeFlags[((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1)] = flags;
         }
       }
     }
   }
-}
-
-// -----------------------------------------------------------------------------
-void QuickSurfaceMesh::createNodesAndTriangles(std::vector<MeshIndexType>& m_NodeIds, MeshIndexType nodeCount, MeshIndexType triangleCount)
-{
-  m_MessageHandler(IFilter::Message::Type::Info, "Creating mesh");
 
-  auto& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
+  void operator()(const Range3D& range) const
+  {
+    compute(range[4], range[5], range[2], range[3], range[0], range[1]);
+  }
 
-  size_t numFeatures = 0;
-  size_t numTuples = featureIds.getNumberOfTuples();
-  for(size_t i = 0; i < numTuples; i++)
-  // for(const auto& featureId : featureIds)
+private:
+  usize countUniqueFeatures(MeshIndexType point, MeshIndexType neigh1, MeshIndexType neigh2, MeshIndexType neigh3) const
   {
-    const size_t featureId = featureIds[i];
-    if(featureId > numFeatures)
-    {
-      numFeatures = static_cast<size_t>(featureId);
-    }
+    std::array<int32, 4> uFeatures = {featureIds[point], featureIds[neigh1], featureIds[neigh2], featureIds[neigh3]};
+    std::sort(uFeatures.begin(), uFeatures.end());
+    return static_cast<usize>(std::unique(uFeatures.begin(), uFeatures.end()) - uFeatures.begin());
   }
 
-  auto* grid = m_DataStructure.getDataAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
+  MeshIndexType xP = 0;
+  MeshIndexType yP = 0;
+  MeshIndexType zP = 0;
+  const Int32AbstractDataStore& featureIds;
+  std::vector<uint8>& edgeFlags;
+};
+} // namespace
 
-  SizeVec3 udims = grid->getDimensions();
+// -----------------------------------------------------------------------------
+QuickSurfaceMesh::QuickSurfaceMesh(DataStructure& dataStructure, QuickSurfaceMeshInputValues* inputValues, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
+: m_DataStructure(dataStructure)
+, m_InputValues(inputValues)
+, m_ShouldCancel(shouldCancel)
+, m_MessageHandler(mesgHandler)
+{
+  k_Generator.seed(k_Seed);
+}
 
-  MeshIndexType xP = udims[0];
-  MeshIndexType yP = udims[1];
-  MeshIndexType zP = udims[2];
+// -----------------------------------------------------------------------------
+QuickSurfaceMesh::~QuickSurfaceMesh() noexcept = default;
 
-  std::vector<std::set<int32_t>> ownerLists;
+// -----------------------------------------------------------------------------
+Result<> QuickSurfaceMesh::operator()()
+{
+  // Get the ImageGeometry
+  auto& grid = m_DataStructure.getDataRefAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
 
-  MeshIndexType point = 0;
-  MeshIndexType neigh1 = 0;
-  MeshIndexType neigh2 = 0;
-  MeshIndexType neigh3 = 0;
+  // Get the Created Triangle Geometry
+  auto& triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->TriangleGeometryPath);
 
-  MeshIndexType nodeId1 = 0;
-  MeshIndexType nodeId2 = 0;
-  MeshIndexType nodeId3 = 0;
-  MeshIndexType nodeId4 = 0;
+  SizeVec3 udims = grid.getDimensions();
 
-  auto* triangleGeom = m_DataStructure.getDataAs<TriangleGeom>(m_InputValues->TriangleGeometryPath);
+  size_t xP = udims[0];
+  size_t yP = udims[1];
+  size_t zP = udims[2];
 
-  std::vector<size_t> tDims = {nodeCount};
-  triangleGeom->resizeVertexList(nodeCount);
-  triangleGeom->resizeFaceList(triangleCount);
-  triangleGeom->getFaceAttributeMatrix()->resizeTuples({triangleCount});
-  triangleGeom->getVertexAttributeMatrix()->resizeTuples(tDims);
+  size_t possibleNumNodes = (xP + 1) * (yP + 1) * (zP + 1);
+  std::vector<MeshIndexType> nodeIds(possibleNumNodes, k_InactiveNode);
+  std::vector<MeshIndexType> slabTriangleOffsets;
 
-  auto& faceLabelsStore = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FaceLabelsDataPath)->getDataStoreRef();
+  MeshIndexType nodeCount = 0;
+  MeshIndexType triangleCount = 0;
 
-  // Resize the NodeTypes array
-  auto& nodeTypes = m_DataStructure.getDataAs<Int8Array>(m_InputValues->NodeTypesDataPath)->getDataStoreRef();
-  nodeTypes.resizeTuples({nodeCount});
+  if(m_InputValues->FixProblemVoxels)
+  {
+    correctProblemVoxels();
+  }
 
-  QuickSurfaceMesh::VertexStore& vertex = triangleGeom->getVertices()->getDataStoreRef();
-  QuickSurfaceMesh::TriStore& triangle = triangleGeom->getFaces()->getDataStoreRef();
+  determineActiveNodes(nodeIds, slabTriangleOffsets, nodeCount, triangleCount);
 
-  ownerLists.resize(nodeCount);
+  // now create node and triangle arrays knowing the number that will be needed
+  std::vector<usize> tupleShape = {triangleCount};
+  triangleGeom.resizeFaceList(triangleCount);
+  triangleGeom.resizeVertexList(nodeCount);
+  triangleGeom.getFaceAttributeMatrix()->resizeTuples(tupleShape);
+  triangleGeom.getVertexAttributeMatrix()->resizeTuples({nodeCount});
 
-  // Create a vector of TupleTransferFunctions for each of the Triangle Face to VertexType Data Arrays
-  std::vector<std::shared_ptr<AbstractTupleTransfer>> tupleTransferFunctions;
-  for(size_t i = 0; i < m_InputValues->SelectedDataArrayPaths.size(); i++)
+  // Resize the Face Arrays that are being copied over from the ImageGeom Cell Data
+  for(const auto& dataPath : m_InputValues->CreatedDataArrayPaths)
   {
-    // Associate these arrays with the Triangle Face Data.
-    ::AddTupleTransferInstance(m_DataStructure, m_InputValues->SelectedDataArrayPaths[i], m_InputValues->CreatedDataArrayPaths[i], tupleTransferFunctions);
+    Result<> result = nx::core::ResizeAndReplaceDataArray(m_DataStructure, dataPath, tupleShape, nx::core::IDataAction::Mode::Execute);
   }
 
-  // Cycle through again assigning coordinates to each node and assigning node numbers and feature labels to each triangle
-  MeshIndexType triangleIndex = 0;
-  for(MeshIndexType k = 0; k < zP; k++)
+  createNodesAndTriangles(nodeIds, slabTriangleOffsets, nodeCount, triangleCount);
+
+#ifdef QSM_CREATE_TRIPLE_LINES
+  if(m_InputValues->pGenerateTripleLines)
   {
-    for(MeshIndexType j = 0; j < yP; j++)
+    IGeometry::SharedTriList* triangle = triangleGeom.getFaces();
+    IGeometry::SharedVertexList* vertices = triangleGeom.getVertices();
+
+    EdgeGeom* edgeGeom = EdgeGeom::Create(m_DataStructure, "[EdgeType Geometry]", parentGroupId);
+    edgeGeom->setVertices(*vertices);
+
+    Int32Array& nodeTypes = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->pFaceLabelsDataPath);
+
+    MeshIndexType edgeCount = 0;
+    for(MeshIndexType i = 0; i < triangleCount; i++)
     {
-      for(MeshIndexType i = 0; i < xP; i++)
+      MeshIndexType n1 = (*triangle)[3 * i + 0];
+      MeshIndexType n2 = (*triangle)[3 * i + 1];
+      MeshIndexType n3 = (*triangle)[3 * i + 2];
+      if(nodeTypes[n1] >= 3 && nodeTypes[n2] >= 3)
+      {
+        edgeCount++;
+      }
+      if(nodeTypes[n1] >= 3 && nodeTypes[n3] >= 3)
       {
+        edgeCount++;
+      }
+      if(nodeTypes[n2] >= 3 && nodeTypes[n3] >= 3)
+      {
+        edgeCount++;
+      }
+    }
 
-        point = (k * xP * yP) + (j * xP) + i;
-        neigh1 = point + 1; // <== What happens if we are at the end of a row?
-        neigh2 = point + xP;
-        neigh3 = point + (xP * yP);
+    std::string edgeGeometryName = "[EdgeType Geometry]";
+    DataPath edgeGeometryDataPath = m_InputValues->pParentDataGroupPath.createChildPath(edgeGeometryName);
+    std::string sharedEdgeListName = "SharedEdgeList";
+    size_t numEdges = edgeCount;
+    size_t numEdgeComps = 2;
+    IGeometry::SharedEdgeList* edges =
+        IGeometry::SharedEdgeList::CreateWithStore<DataStore<MeshIndexType>>(m_DataStructure, sharedEdgeListName, {numEdges}, {numEdgeComps}, m_DataStructure.getId(edgeGeometryDataPath));
 
-        if(i == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k, vertex, (m_NodeIds[nodeId1] * 3));
+    edgeCount = 0;
+    for(MeshIndexType i = 0; i < triangleCount; i++)
+    {
+      MeshIndexType n1 = (*triangle)[3 * i + 0];
+      MeshIndexType n2 = (*triangle)[3 * i + 1];
+      MeshIndexType n3 = (*triangle)[3 * i + 2];
+      if(nodeTypes[n1] >= 3 && nodeTypes[n2] >= 3)
+      {
+        (*edges)[2 * edgeCount] = n1;
+        (*edges)[2 * edgeCount + 1] = n2;
+        edgeCount++;
+      }
+      if(nodeTypes[n1] >= 3 && nodeTypes[n3] >= 3)
+      {
+        (*edges)[2 * edgeCount] = n1;
+        (*edges)[2 * edgeCount + 1] = n3;
+        edgeCount++;
+      }
+      if(nodeTypes[n2] >= 3 && nodeTypes[n3] >= 3)
+      {
+        (*edges)[2 * edgeCount] = n2;
+        (*edges)[2 * edgeCount + 1] = n3;
+        edgeCount++;
+      }
+    }
+
+    // Now that we all of that out of the way, generate the triple lines
+    generateTripleLines();
+  }
+#endif
+
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMesh::correctProblemVoxels()
+{
+  m_MessageHandler(IFilter::Message::Type::Info, "Correcting Problem Voxels");
+
+  auto* grid = m_DataStructure.getDataAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
+  auto& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
+
+  SizeVec3 udims = grid->getDimensions();
+
+  MeshIndexType xP = udims[0];
+  MeshIndexType yP = udims[1];
+  MeshIndexType zP = udims[2];
 
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
+  MeshIndexType v1 = 0, v2 = 0, v3 = 0, v4 = 0;
+  MeshIndexType v5 = 0, v6 = 0, v7 = 0, v8 = 0;
+
+  int32_t f1 = 0, f2 = 0, f3 = 0, f4 = 0;
+  int32_t f5 = 0, f6 = 0, f7 = 0, f8 = 0;
+
+  MeshIndexType row1 = 0, row2 = 0;
+  MeshIndexType plane1 = 0, plane2 = 0;
 
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
+  MeshIndexType count = 1;
+  MeshIndexType iter = 0;
+  while(count > 0 && iter < 20)
+  {
+    iter++;
+    count = 0;
 
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
+    for(MeshIndexType k = 1; k < zP; k++)
+    {
+      plane1 = (k - 1) * xP * yP;
+      plane2 = k * xP * yP;
+      for(MeshIndexType j = 1; j < yP; j++)
+      {
+        row1 = (j - 1) * xP;
+        row2 = j * xP;
+        for(MeshIndexType i = 1; i < xP; i++)
+        {
+          v1 = plane1 + row1 + i - 1;
+          v2 = plane1 + row1 + i;
+          v3 = plane1 + row2 + i - 1;
+          v4 = plane1 + row2 + i;
+          v5 = plane2 + row1 + i - 1;
+          v6 = plane2 + row1 + i;
+          v7 = plane2 + row2 + i - 1;
+          v8 = plane2 + row2 + i;
 
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
+          f1 = featureIds[v1];
+          f2 = featureIds[v2];
+          f3 = featureIds[v3];
+          f4 = featureIds[v4];
+          f5 = featureIds[v5];
+          f6 = featureIds[v6];
+          f7 = featureIds[v7];
+          f8 = featureIds[v8];
 
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f1 == f8 && f1 != f2 && f1 != f3 && f1 != f4 && f1 != f5 && f1 != f6 && f1 != f7)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase1(featureIds, v1, v2, v3, v6, v7, v8);
+            count++;
           }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f2 == f7 && f2 != f1 && f2 != f3 && f2 != f4 && f2 != f5 && f2 != f6 && f2 != f8)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase1(featureIds, v2, v1, v4, v5, v8, v7);
+            count++;
           }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        if(j == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f3 == f6 && f3 != f1 && f3 != f2 && f3 != f4 && f3 != f5 && f3 != f7 && f3 != f8)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase1(featureIds, v3, v1, v4, v5, v8, v6);
+            count++;
           }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f4 == f5 && f4 != f1 && f4 != f2 && f4 != f3 && f4 != f6 && f4 != f7 && f4 != f8)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase1(featureIds, v4, v2, v3, v6, v7, v5);
+            count++;
           }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        if(k == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f1 == f6 && f1 != f2 && f1 != f5)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase2(featureIds, v1, v2, v5, v6);
+            count++;
           }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f2 == f5 && f2 != f1 && f2 != f6)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase2(featureIds, v2, v1, v6, v5);
+            count++;
           }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        if(i == (xP - 1)) // Takes care of the end of a Row...
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f3 == f8 && f3 != f4 && f3 != f7)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase2(featureIds, v3, v4, v7, v8);
+            count++;
           }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f4 == f7 && f4 != f3 && f4 != f8)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase2(featureIds, v4, v3, v8, v7);
+            count++;
           }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        else if(featureIds[point] != featureIds[neigh1])
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh1];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          if(featureIds[point] < featureIds[neigh1])
+          if(f1 == f7 && f1 != f3 && f1 != f5)
           {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh1];
+            ::FlipProblemVoxelCase2(featureIds, v1, v3, v5, v7);
+            count++;
           }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f3 == f5 && f3 != f1 && f3 != f7)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh1, point, faceLabelsStore);
+            ::FlipProblemVoxelCase2(featureIds, v3, v1, v7, v5);
+            count++;
           }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh1];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh1])
+          if(f2 == f8 && f2 != f4 && f2 != f6)
           {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh1];
+            ::FlipProblemVoxelCase2(featureIds, v2, v4, v6, v8);
+            count++;
           }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f4 == f6 && f4 != f2 && f4 != f8)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh1, point, faceLabelsStore);
+            ::FlipProblemVoxelCase2(featureIds, v4, v2, v8, v6);
+            count++;
           }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[neigh1]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[neigh1]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[neigh1]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[neigh1]);
-        }
-        if(j == (yP - 1)) // Takes care of the end of a column
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f1 == f4 && f1 != f2 && f1 != f3)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase2(featureIds, v1, v2, v3, v4);
+            count++;
           }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f2 == f3 && f2 != f1 && f2 != f4)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase2(featureIds, v2, v1, v4, v3);
+            count++;
           }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        else if(featureIds[point] != featureIds[neigh2])
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh2];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh2])
+          if(f5 == f8 && f5 != f6 && f5 != f7)
           {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh2];
+            ::FlipProblemVoxelCase2(featureIds, v5, v6, v7, v8);
+            count++;
           }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f6 == f7 && f6 != f5 && f6 != f8)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh2, point, faceLabelsStore);
+            ::FlipProblemVoxelCase2(featureIds, v6, v5, v8, v7);
+            count++;
           }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh2];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh2])
+          if(f2 == f3 && f2 == f4 && f2 == f5 && f2 == f6 && f2 == f7 && f2 != f1 && f2 != f8)
           {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh2];
+            ::FlipProblemVoxelCase3(featureIds, v2, v1, v8);
+            count++;
           }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f1 == f3 && f1 == f4 && f1 == f5 && f1 == f7 && f2 == f8 && f1 != f2 && f1 != f7)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh2, point, faceLabelsStore);
+            ::FlipProblemVoxelCase3(featureIds, v1, v2, v7);
+            count++;
           }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[neigh2]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[neigh2]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[neigh2]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[neigh2]);
-        }
-        if(k == (zP - 1)) // Takes care of the end of a Pillar
-        {
-          nodeId1 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k + 1, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f1 == f2 && f1 == f4 && f1 == f5 && f1 == f7 && f1 == f8 && f1 != f3 && f1 != f6)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase3(featureIds, v1, v3, v6);
+            count++;
           }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
+          if(f1 == f2 && f1 == f3 && f1 == f6 && f1 == f7 && f1 == f8 && f1 != f4 && f1 != f5)
           {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
+            ::FlipProblemVoxelCase3(featureIds, v1, v4, v5);
+            count++;
           }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
         }
-        else if(featureIds[point] != featureIds[neigh3])
-        {
-          nodeId1 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId1] * 3));
+      }
+    }
 
-          nodeId2 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k + 1, vertex, (m_NodeIds[nodeId2] * 3));
+    std::string ss = fmt::format("Correcting Problem Voxels: Iteration - '{}'; Problem Voxels - '{}'", iter, count);
+    m_MessageHandler(IFilter::Message::Type::Info, ss);
+  }
+}
 
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
+// -----------------------------------------------------------------------------
+void QuickSurfaceMesh::determineActiveNodes(std::vector<MeshIndexType>& nodeIds, std::vector<MeshIndexType>& slabTriangleOffsets, MeshIndexType& nodeCount, MeshIndexType& triangleCount)
+{
+  m_MessageHandler(IFilter::Message::Type::Info, "Determining active Nodes");
 
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
+  auto* grid = m_DataStructure.getDataAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
+  auto& featureIdsArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
+  Int32AbstractDataStore& featureIds = featureIdsArray.getDataStoreRef();
+
+  // Each Z slab of voxels is meshed independently. Slab k only touches node planes k and k + 1,
+  // so a node is shared by at most two slabs and is owned by the first of them in scan order.
+  const VoxelFaceWalker walker(featureIds, grid->getDimensions());
+  const MeshIndexType numSlabs = walker.numberOfSlabs();
+
+  std::vector<uint8> lowerPlaneFlags(nodeIds.size(), 0);
+  std::vector<uint8> upperPlaneFlags(nodeIds.size(), 0);
+  std::vector<MeshIndexType> slabTriangleCounts(numSlabs, 0);
+  std::vector<MeshIndexType> slabNodeCounts(numSlabs, 0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numSlabs);
+  dataAlg.requireArraysInMemory({&featureIdsArray});
+  dataAlg.execute(MarkActiveNodesImpl(walker, lowerPlaneFlags, upperPlaneFlags, slabTriangleCounts));
+  dataAlg.execute(CountOwnedNodesImpl(walker, lowerPlaneFlags, upperPlaneFlags, slabNodeCounts));
+
+  // Exclusive scans give each slab the first global node and triangle id that it writes
+  std::vector<MeshIndexType> slabNodeOffsets(numSlabs, 0);
+  slabTriangleOffsets.assign(numSlabs, 0);
+  nodeCount = 0;
+  triangleCount = 0;
+  for(MeshIndexType k = 0; k < numSlabs; k++)
+  {
+    slabNodeOffsets[k] = nodeCount;
+    slabTriangleOffsets[k] = triangleCount;
+    nodeCount += slabNodeCounts[k];
+    triangleCount += slabTriangleCounts[k];
+  }
 
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh3];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh3])
-          {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh3];
-          }
+  dataAlg.execute(AssignNodeIdsImpl(walker, upperPlaneFlags, slabNodeOffsets, nodeIds));
+}
 
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh3, point, faceLabelsStore);
-          }
+// -----------------------------------------------------------------------------
+void QuickSurfaceMesh::createNodesAndTriangles(const std::vector<MeshIndexType>& nodeIds, const std::vector<MeshIndexType>& slabTriangleOffsets, MeshIndexType nodeCount,
+                                               MeshIndexType triangleCount)
+{
+  m_MessageHandler(IFilter::Message::Type::Info, "Creating mesh");
 
-          triangleIndex++;
+  auto* grid = m_DataStructure.getDataAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
+  auto& featureIdsArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
+  Int32AbstractDataStore& featureIds = featureIdsArray.getDataStoreRef();
 
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh3];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh3])
-          {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh3];
-          }
+  auto* triangleGeom = m_DataStructure.getDataAs<TriangleGeom>(m_InputValues->TriangleGeometryPath);
 
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh3, point, faceLabelsStore);
-          }
+  auto& faceLabelsArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FaceLabelsDataPath);
+  auto& faceLabelsStore = faceLabelsArray.getDataStoreRef();
 
-          triangleIndex++;
+  // Resize the NodeTypes array
+  auto& nodeTypesArray = m_DataStructure.getDataRefAs<Int8Array>(m_InputValues->NodeTypesDataPath);
+  auto& nodeTypes = nodeTypesArray.getDataStoreRef();
+  nodeTypes.resizeTuples({nodeCount});
 
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[neigh3]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[neigh3]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[neigh3]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[neigh3]);
-        }
-      }
-    }
+  QuickSurfaceMesh::VertexStore& vertex = triangleGeom->getVertices()->getDataStoreRef();
+  QuickSurfaceMesh::TriStore& triangle = triangleGeom->getFaces()->getDataStoreRef();
+
+  // Create a vector of TupleTransferFunctions for each of the Triangle Face to VertexType Data Arrays
+  std::vector<std::shared_ptr<AbstractTupleTransfer>> tupleTransferFunctions;
+  IParallelAlgorithm::AlgorithmArrays algArrays = {&featureIdsArray, &faceLabelsArray, &nodeTypesArray, triangleGeom->getVertices(), triangleGeom->getFaces()};
+  for(size_t i = 0; i < m_InputValues->SelectedDataArrayPaths.size(); i++)
+  {
+    // Associate these arrays with the Triangle Face Data.
+    ::AddTupleTransferInstance(m_DataStructure, m_InputValues->SelectedDataArrayPaths[i], m_InputValues->CreatedDataArrayPaths[i], tupleTransferFunctions);
+    algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->SelectedDataArrayPaths[i]));
+    algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->CreatedDataArrayPaths[i]));
   }
 
-  Int8AbstractDataStore& m_NodeTypes = m_DataStructure.getDataAs<Int8Array>(m_InputValues->NodeTypesDataPath)->getDataStoreRef();
+  const VoxelFaceWalker walker(featureIds, grid->getDimensions());
 
-  for(size_t i = 0; i < nodeCount; i++)
-  {
-    auto& ownerList = ownerLists[i];
+  // Every slab writes its triangles into its own block of the face arrays
+  ParallelDataAlgorithm triangleAlg;
+  triangleAlg.setRange(0, walker.numberOfSlabs());
+  triangleAlg.requireArraysInMemory(algArrays);
+  triangleAlg.execute(CreateTrianglesImpl(walker, nodeIds, slabTriangleOffsets, triangle, faceLabelsStore, tupleTransferFunctions));
 
-    m_NodeTypes[i] = static_cast<int8_t>(ownerList.size());
-    if(m_NodeTypes[i] > 4)
-    {
-      m_NodeTypes[i] = 4;
-    }
-    if(ownerList.find(-1) != ownerList.end())
-    {
-      m_NodeTypes[i] += 10;
-    }
-  }
+  // Every active node is visited exactly once when walking the node planes
+  ParallelDataAlgorithm nodeAlg;
+  nodeAlg.setRange(0, walker.numberOfSlabs() + 1);
+  nodeAlg.requireArraysInMemory(algArrays);
+  nodeAlg.execute(CreateNodesImpl(grid, featureIds, nodeIds, vertex, nodeTypes));
 }
 
 // -----------------------------------------------------------------------------
@@ -1510,24 +1092,8 @@ void QuickSurfaceMesh::generateTripleLines()
    */
   m_MessageHandler(IFilter::Message::Type::Info, "Generating Triple Lines");
 
-  //  DataContainer* m = getDataContainerArray()->getDataContainer(m_FeatureIdsArrayPath.getDataContainerName());
-  //  DataContainer* sm = getDataContainerArray()->getDataContainer(getSurfaceDataContainerName());
-  //
-  //  AttributeMatrix* featAttrMat = sm->getAttributeMatrix(m_FeatureAttributeMatrixName);
   Int32AbstractDataStore& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
 
-  int32_t numFeatures = 0;
-  size_t numTuples = featureIds.getNumberOfTuples();
-  for(size_t i = 0; i < numTuples; i++)
-  {
-    if(featureIds[i] > numFeatures)
-    {
-      numFeatures = featureIds[i];
-    }
-  }
-
-  std::vector<size_t> featDims = {static_cast<size_t>(numFeatures) + 1};
-
   auto* imageGeom = m_DataStructure.getDataAs<ImageGeom>(m_InputValues->GridGeomDataPath);
 
   SizeVec3 udims = imageGeom->getDimensions();
@@ -1535,20 +1101,14 @@ void QuickSurfaceMesh::generateTripleLines()
   MeshIndexType xP = udims[0];
   MeshIndexType yP = udims[1];
   MeshIndexType zP = udims[2];
-  MeshIndexType point = 0, neigh1 = 0, neigh2 = 0, neigh3 = 0;
-
-  std::set<int32_t> uFeatures;
 
   FloatVec3 origin = imageGeom->getOrigin();
   FloatVec3 res = imageGeom->getSpacing();
 
-  VertexMap vertexMap;
-  EdgeMap edgeMap;
-  MeshIndexType vertCounter = 0;
-  MeshIndexType edgeCounter = 0;
-
-  // Cycle through again assigning coordinates to each node and assigning node numbers and feature labels to each triangle
-  // int64_t triangleIndex = 0;
+  // The triple line edges are flagged on the grid node they start from, which replaces the
+  // hashed vertex and edge maps with dense, node indexed arrays.
+  const MeshIndexType numNodes = (xP + 1) * (yP + 1) * (zP + 1);
+  std::vector<uint8> edgeFlags(numNodes, 0);
 
   ParallelData3DAlgorithm algorithm;
   algorithm.setRange(Range3D(xP - 1, yP - 1, zP - 1));
@@ -1557,130 +1117,34 @@ void QuickSurfaceMesh::generateTripleLines()
     const auto chunkShape = featureIds.getChunkShape().value();
     algorithm.setChunkSize(Range3D(chunkShape[0], chunkShape[1], chunkShape[2]));
   }
-  algorithm.setParallelizationEnabled(false);
-  algorithm.execute(GenerateTripleLinesImpl(imageGeom, featureIds, vertexMap, edgeMap));
-
-#if QSM_CREATE_TRIPLE_LINES
-  for(size_t k = 0; k < zP - 1; k++)
+  algorithm.requireStoresInMemory({&featureIds});
+  algorithm.execute(GenerateTripleLinesImpl(imageGeom, featureIds, edgeFlags));
+
+  // Number the vertices and edges in the same order as they are found in the voxel scan
+  std::vector<MeshIndexType> vertexIds(numNodes, k_InactiveNode);
+  std::vector<MeshIndexType> vertexNodes;
+  std::vector<MeshIndexType> edgeList;
+  const std::array<uint8, 3> edgeBits = {k_TripleLineEdgeY, k_TripleLineEdgeX, k_TripleLineEdgeZ};
+  const std::array<MeshIndexType, 3> edgeNodeOffsets = {xP + 1, 1, (xP + 1) * (yP + 1)};
+  for(MeshIndexType node = 0; node < numNodes; node++)
   {
-    for(size_t j = 0; j < yP - 1; j++)
+    for(usize e = 0; e < edgeBits.size(); e++)
     {
-      for(size_t i = 0; i < xP - 1; i++)
+      if((edgeFlags[node] & edgeBits[e]) == 0)
       {
-        point = (k * xP * yP) + (j * xP) + i;
-        // Case 1
-        neigh1 = point + 1;
-        neigh2 = point + (xP * yP) + 1;
-        neigh3 = point + (xP * yP);
-
-        VertexType p0 = {{origin[0] + static_cast<float>(i) * res[0] + res[0], origin[1] + static_cast<float>(j) * res[1] + res[1], origin[2] + static_cast<float>(k) * res[2] + res[2]}};
-
-        VertexType p1 = {{origin[0] + static_cast<float>(i) * res[0] + res[0], origin[1] + static_cast<float>(j) * res[1], origin[2] + static_cast<float>(k) * res[2] + res[2]}};
-
-        VertexType p2 = {{origin[0] + static_cast<float>(i) * res[0], origin[1] + static_cast<float>(j) * res[1] + res[1], origin[2] + static_cast<float>(k) * res[2] + res[2]}};
-
-        VertexType p3 = {{origin[0] + static_cast<float>(i) * res[0] + res[0], origin[1] + static_cast<float>(j) * res[1] + res[1], origin[2] + static_cast<float>(k) * res[2]}};
-
-        uFeatures.clear();
-        uFeatures.insert(featureIds[point]);
-        uFeatures.insert(featureIds[neigh1]);
-        uFeatures.insert(featureIds[neigh2]);
-        uFeatures.insert(featureIds[neigh3]);
-
-        if(uFeatures.size() > 2)
-        {
-          auto iter = vertexMap.find(p0);
-          if(iter == vertexMap.end())
-          {
-            vertexMap[p0] = vertCounter++;
-          }
-          iter = vertexMap.find(p1);
-          if(iter == vertexMap.end())
-          {
-            vertexMap[p1] = vertCounter++;
-          }
-          MeshIndexType i0 = vertexMap[p0];
-          MeshIndexType i1 = vertexMap[p1];
-
-          EdgeType tmpEdge = {{i0, i1}};
-          auto eiter = edgeMap.find(tmpEdge);
-          if(eiter == edgeMap.end())
-          {
-            edgeMap[tmpEdge] = edgeCounter++;
-          }
-        }
-
-        // Case 2
-        neigh1 = point + xP;
-        neigh2 = point + (xP * yP) + xP;
-        neigh3 = point + (xP * yP);
-
-        uFeatures.clear();
-        uFeatures.insert(featureIds[point]);
-        uFeatures.insert(featureIds[neigh1]);
-        uFeatures.insert(featureIds[neigh2]);
-        uFeatures.insert(featureIds[neigh3]);
-        if(uFeatures.size() > 2)
-        {
-          auto iter = vertexMap.find(p0);
-          if(iter == vertexMap.end())
-          {
-            vertexMap[p0] = vertCounter++;
-          }
-          iter = vertexMap.find(p2);
-          if(iter == vertexMap.end())
-          {
-            vertexMap[p2] = vertCounter++;
-          }
-
-          MeshIndexType i0 = vertexMap[p0];
-          MeshIndexType i2 = vertexMap[p2];
-
-          EdgeType tmpEdge = {{i0, i2}};
-          auto eiter = edgeMap.find(tmpEdge);
-          if(eiter == edgeMap.end())
-          {
-            edgeMap[tmpEdge] = edgeCounter++;
-          }
-        }
-
-        // Case 3
-        neigh1 = point + 1;
-        neigh2 = point + xP + 1;
-        neigh3 = point + +xP;
-
-        uFeatures.clear();
-        uFeatures.insert(featureIds[point]);
-        uFeatures.insert(featureIds[neigh1]);
-        uFeatures.insert(featureIds[neigh2]);
-        uFeatures.insert(featureIds[neigh3]);
-        if(uFeatures.size() > 2)
+        continue;
+      }
+      for(const MeshIndexType edgeNode : {node, node - edgeNodeOffsets[e]})
+      {
+        if(vertexIds[edgeNode] == k_InactiveNode)
         {
-          auto iter = vertexMap.find(p0);
-          if(iter == vertexMap.end())
-          {
-            vertexMap[p0] = vertCounter++;
-          }
-          iter = vertexMap.find(p3);
-          if(iter == vertexMap.end())
-          {
-            vertexMap[p3] = vertCounter++;
-          }
-
-          MeshIndexType i0 = vertexMap[p0];
-          MeshIndexType i3 = vertexMap[p3];
-
-          EdgeType tmpEdge = {{i0, i3}};
-          auto eiter = edgeMap.find(tmpEdge);
-          if(eiter == edgeMap.end())
-          {
-            edgeMap[tmpEdge] = edgeCounter++;
-          }
+          vertexIds[edgeNode] = vertexNodes.size();
+          vertexNodes.push_back(edgeNode);
         }
+        edgeList.push_back(vertexIds[edgeNode]);
       }
     }
   }
-#endif
 
   std::string edgeGeometryName = "[Edge Geometry]";
 
@@ -1689,38 +1153,33 @@ void QuickSurfaceMesh::generateTripleLines()
   DataPath sharedVertListDataPath = edgeGeometryDataPath.createChildPath(sharedVertListName);
 
   EdgeGeom* tripleLineEdge = EdgeGeom::Create(m_DataStructure, edgeGeometryName);
-  size_t numVerts = vertexMap.size();
+  size_t numVerts = vertexNodes.size();
   size_t numComps = 3;
   IGeometry::SharedVertexList* vertices = Float32Array::CreateWithStore<DataStore<float>>(m_DataStructure, sharedVertListName, {numVerts}, {numComps}, m_DataStructure.getId(edgeGeometryDataPath));
   auto& verticesRef = vertices->getDataStoreRef();
 
-  for(const auto& vert : vertexMap)
+  for(MeshIndexType idx = 0; idx < numVerts; idx++)
   {
-    float v0 = vert.first[0];
-    float v1 = vert.first[1];
-    float v2 = vert.first[2];
-    MeshIndexType idx = vert.second;
-    const MeshIndexType offset = idx * numComps;
-    verticesRef.setValue(offset + 0, v0);
-    verticesRef.setValue(+1, v1);
-    verticesRef.setValue(idx * numComps + 2, v2);
+    const MeshIndexType node = vertexNodes[idx];
+    const MeshIndexType i = node % (xP + 1);
+    const MeshIndexType j = (node / (xP + 1)) % (yP + 1);
+    const MeshIndexType k = node / ((xP + 1) * (yP + 1));
+    verticesRef.setValue(idx * numComps + 0, origin[0] + static_cast<float>(i) * res[0]);
+    verticesRef.setValue(idx * numComps + 1, origin[1] + static_cast<float>(j) * res[1]);
+    verticesRef.setValue(idx * numComps + 2, origin[2] + static_cast<float>(k) * res[2]);
   }
   tripleLineEdge->setVertices(*vertices);
 
   std::string sharedEdgeListName = "SharedEdgeList";
-  size_t numEdges = edgeMap.size();
   size_t numEdgeComps = 2;
+  size_t numEdges = edgeList.size() / numEdgeComps;
   IGeometry::SharedEdgeList* edges =
       IGeometry::SharedEdgeList::CreateWithStore<DataStore<MeshIndexType>>(m_DataStructure, sharedEdgeListName, {numEdges}, {numEdgeComps}, m_DataStructure.getId(edgeGeometryDataPath));
   auto& edgesRef = edges->getDataStoreRef();
 
-  for(const auto& edge : edgeMap)
+  for(size_t idx = 0; idx < edgeList.size(); idx++)
   {
-    MeshIndexType i0 = edge.first[0];
-    MeshIndexType i1 = edge.first[1];
-    MeshIndexType idx = edge.second;
-    edgesRef.setValue(idx * numComps + 0, i0);
-    edgesRef.setValue(idx * numComps + 1, i1);
+    edgesRef.setValue(idx, edgeList[idx]);
   }
   tripleLineEdge->setEdgeList(*edges);
 }
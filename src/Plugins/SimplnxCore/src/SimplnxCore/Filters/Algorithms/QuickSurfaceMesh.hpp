@@ -53,20 +53,23 @@ public:
   void correctProblemVoxels();
 
   /**
-   * @brief
-   * @param m_NodeIds
+   * @brief Numbers the active nodes of the grid one Z slab at a time. The node ids and
+   * triangle counts match a serial scan of the voxels.
+   * @param nodeIds Mesh node id of each grid node, or max() if the node is not used
+   * @param slabTriangleOffsets First triangle index written by each Z slab
    * @param nodeCount
    * @param triangleCount
    */
-  void determineActiveNodes(std::vector<MeshIndexType>& m_NodeIds, MeshIndexType& nodeCount, MeshIndexType& triangleCount);
+  void determineActiveNodes(std::vector<MeshIndexType>& nodeIds, std::vector<MeshIndexType>& slabTriangleOffsets, MeshIndexType& nodeCount, MeshIndexType& triangleCount);
 
   /**
-   * @brief
-   * @param m_NodeIds
+   * @brief Writes the vertices, triangles, face labels and node types of the mesh one Z slab at a time.
+   * @param nodeIds
+   * @param slabTriangleOffsets
    * @param nodeCount
    * @param triangleCount
    */
-  void createNodesAndTriangles(std::vector<MeshIndexType>& m_NodeIds, MeshIndexType nodeCount, MeshIndexType triangleCount);
+  void createNodesAndTriangles(const std::vector<MeshIndexType>& nodeIds, const std::vector<MeshIndexType>& slabTriangleOffsets, MeshIndexType nodeCount, MeshIndexType triangleCount);
 
   /**
    * @brief generateTripleLines
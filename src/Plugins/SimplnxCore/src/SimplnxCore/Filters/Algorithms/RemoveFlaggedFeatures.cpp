@@ -8,121 +8,16 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/FeatureCompactionUtilities.hpp"
 #include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 using namespace nx::core;
 
 namespace
 {
-bool IdentifyNeighbors(ImageGeom& imageGeom, Int32AbstractDataStore& featureIds, std::vector<int32>& storageArray, const std::atomic_bool& shouldCancel, RemoveFlaggedFeatures* filter)
-{
-  SizeVec3 uDims = imageGeom.getDimensions();
-
-  int64 dims[3] = {static_cast<int64>(uDims[0]), static_cast<int64>(uDims[1]), static_cast<int64>(uDims[2])};
-
-  const int64 neighborPoints[6] = {(-dims[0] * dims[1]), (-dims[0]), -1, 1, dims[0], (dims[0] * dims[1])};
-
-  bool shouldLoop = false;
-
-  auto progressIncrement = dims[2] / 100;
-  usize progressCounter = 0;
-  int32 featureName;
-  int64 kStride, jStride;
-  for(int64 k = 0; k < dims[2]; k++)
-  {
-    if(shouldCancel)
-    {
-      return false;
-    }
-
-    if(progressCounter > progressIncrement)
-    {
-      filter->sendThreadSafeProgressMessage(progressCounter);
-      progressCounter = 0;
-    }
-    progressCounter++;
-
-    kStride = dims[0] * dims[1] * k;
-    for(int64 j = 0; j < dims[1]; j++)
-    {
-      jStride = dims[0] * j;
-      for(int64 i = 0; i < dims[0]; i++)
-      {
-        int64 count = kStride + jStride + i;
-        featureName = featureIds[count];
-        if(featureName > 0)
-        {
-          continue;
-        }
-        shouldLoop = true;
-        int32 current;
-        int32 most = 0;
-        std::vector<int32> numHits(6, 0);
-        std::vector<int32> discoveredFeatures = {};
-        discoveredFeatures.reserve(6);
-        for(int8 l = 0; l < 6; l++)
-        {
-          if(l == 5 && k == (dims[2] - 1))
-          {
-            continue;
-          }
-          if(l == 1 && j == 0)
-          {
-            continue;
-          }
-          if(l == 4 && j == (dims[1] - 1))
-          {
-            continue;
-          }
-          if(l == 2 && i == 0)
-          {
-            continue;
-          }
-          if(l == 3 && i == (dims[0] - 1))
-          {
-            continue;
-          }
-          if(l == 0 && k == 0)
-          {
-            continue;
-          }
-
-          int64 neighborPoint = count + neighborPoints[l];
-          int32 feature = featureIds[neighborPoint];
-          if(feature >= 0)
-          {
-            bool found = false;
-            for(usize featIndex = 0; featIndex < discoveredFeatures.size(); featIndex++)
-            {
-              if(discoveredFeatures[featIndex] == feature)
-              {
-                found = true;
-                numHits[featIndex]++;
-                current = numHits[featIndex];
-                if(current > most)
-                {
-                  most = current;
-                  storageArray[count] = static_cast<int32>(neighborPoint);
-                }
-                break;
-              }
-            }
-            if(!found)
-            {
-              discoveredFeatures.push_back(feature);
-            }
-          }
-        }
-      }
-    }
-  }
-  return shouldLoop;
-}
-
-std::vector<bool> FlagFeatures(Int32AbstractDataStore& featureIds, std::unique_ptr<MaskCompare>& flaggedFeatures, const bool fillRemovedFeatures)
+std::vector<bool> FlagFeatures(Int32AbstractDataStore& featureIds, std::unique_ptr<MaskCompare>& flaggedFeatures, const bool fillRemovedFeatures, const std::atomic_bool& shouldCancel)
 {
   bool good = false;
-  usize totalPoints = featureIds.getNumberOfTuples();
   usize totalFeatures = flaggedFeatures->getNumberOfTuples();
   std::vector<bool> activeObjects(totalFeatures, true);
   for(usize i = 1; i < totalFeatures; i++)
@@ -140,52 +35,10 @@ std::vector<bool> FlagFeatures(Int32AbstractDataStore& featureIds, std::unique_p
   {
     return {};
   }
-  for(usize i = 0; i < totalPoints; i++)
-  {
-    if(activeObjects[featureIds[i]])
-    {
-      continue;
-    }
-
-    if(fillRemovedFeatures)
-    {
-      featureIds[i] = -1;
-    }
-    else
-    {
-      featureIds[i] = 0;
-    }
-  }
+  FeatureCompaction::ReplaceInactiveFeatureIds(featureIds, activeObjects, fillRemovedFeatures ? -1 : 0, shouldCancel);
   return activeObjects;
 }
 
-void FindVoxelArrays(const Int32AbstractDataStore& featureIds, const std::vector<int32>& neighbors, std::vector<std::shared_ptr<IDataArray>>& voxelArrays, const std::atomic_bool& shouldCancel)
-{
-  const usize totalPoints = featureIds.getNumberOfTuples();
-
-  int32 featureName, neighbor;
-  for(usize j = 0; j < totalPoints; j++)
-  {
-    if(shouldCancel)
-    {
-      return;
-    }
-
-    featureName = featureIds[j];
-    neighbor = neighbors[j];
-    if(neighbor >= 0)
-    {
-      if(featureName < 0 && featureIds[neighbor] >= 0)
-      {
-        for(const auto& voxelArray : voxelArrays)
-        {
-          voxelArray->copyTuple(neighbor, j);
-        }
-      }
-    }
-  }
-}
-
 class RunCropImageGeometryImpl
 {
 public:
@@ -386,8 +239,7 @@ Result<> RemoveFlaggedFeatures::operator()()
   {
     m_MessageHandler(IFilter::ProgressMessage{IFilter::Message::Type::Info, fmt::format("Beginning Feature Removal")});
 
-    std::vector<int32> neighbors((featureIds.getNumberOfTuples() * featureIds.getNumberOfComponents()), -1);
-    std::vector<bool> activeObjects = FlagFeatures(featureIds, flaggedFeatures, m_InputValues->FillRemovedFeatures);
+    std::vector<bool> activeObjects = FlagFeatures(featureIds, flaggedFeatures, m_InputValues->FillRemovedFeatures, getCancel());
     if(activeObjects.empty())
     {
       return MakeErrorResult(-45433, "All Features were flagged and would all be removed. The filter has quit.");
@@ -400,24 +252,17 @@ Result<> RemoveFlaggedFeatures::operator()()
 
     if(m_InputValues->FillRemovedFeatures)
     {
-      bool shouldLoop;
-      usize count = 0;
-      do
+      m_MessageHandler(IFilter::ProgressMessage{IFilter::Message::Type::Info, fmt::format("Filling bad voxels...")});
+      std::vector<IDataArray*> voxelArrays;
+      for(const auto& voxelArray : GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths))
       {
-        count++;
-        m_MessageHandler(IFilter::ProgressMessage{IFilter::Message::Type::Info, fmt::format("Entering iteration number {}...", count)});
-        std::fill(neighbors.begin(), neighbors.end(), -1);
-        shouldLoop = IdentifyNeighbors(imageGeom, featureIds, neighbors, getCancel(), this);
-
-        if(getCancel())
-        {
-          return {};
-        }
-
-        m_MessageHandler(IFilter::ProgressMessage{IFilter::Message::Type::Info, fmt::format("Filling bad voxels...")});
-        std::vector<std::shared_ptr<IDataArray>> voxelArrays = GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths);
-        FindVoxelArrays(featureIds, neighbors, voxelArrays, getCancel());
-      } while(shouldLoop);
+        voxelArrays.push_back(voxelArray.get());
+      }
+      Result<> fillResult = FeatureCompaction::AssignBadCellsToNeighbors(imageGeom.getDimensions(), featureIds, voxelArrays, m_MessageHandler, getCancel());
+      if(fillResult.invalid())
+      {
+        return fillResult;
+      }
     }
 
     if(getCancel())
@@ -5,68 +5,281 @@
 #include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
-#include "simplnx/Utilities/ParallelData3DAlgorithm.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 #include "simplnx/Utilities/SamplingUtils.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 using namespace nx::core;
 
 namespace
 {
+// Keeps floating point noise from growing a majority vote box by one source cell
+constexpr float64 k_BoxTolerance = 1.0E-4;
+
+/**
+ * @brief The source cells sampled along one axis for every destination cell along that axis.
+ * Resampling an image geometry is separable, so one of these per axis describes the whole
+ * mapping instead of a source index stored for every destination voxel.
+ */
+struct AxisSampling
+{
+  std::vector<usize> Nearest;  // Source cell holding the minimum corner of the destination cell
+  std::vector<usize> Lower;    // Trilinear: source cells on either side of the destination cell center...
+  std::vector<usize> Upper;
+  std::vector<float64> Weight; // ...and the weight of the upper one
+  std::vector<usize> BoxBegin; // Majority vote: source cells overlapped by the destination cell
+  std::vector<usize> BoxEnd;
+};
+
 // -----------------------------------------------------------------------------
-class ResampleImageGeomImpl
+AxisSampling CreateAxisSampling(usize destDim, float32 destSpacing, usize srcDim, float32 srcSpacing)
+{
+  AxisSampling sampling;
+  sampling.Nearest.resize(destDim);
+  sampling.Lower.resize(destDim);
+  sampling.Upper.resize(destDim);
+  sampling.Weight.resize(destDim);
+  sampling.BoxBegin.resize(destDim);
+  sampling.BoxEnd.resize(destDim);
+
+  const usize lastIndex = srcDim - 1;
+  const float64 scale = static_cast<float64>(destSpacing) / static_cast<float64>(srcSpacing);
+  for(usize index = 0; index < destDim; index++)
+  {
+    // Same single precision math the per voxel index list used so nearest neighbor results do not change
+    const float32 position = static_cast<float32>(index) * destSpacing;
+    sampling.Nearest[index] = std::min(static_cast<usize>(position / srcSpacing), lastIndex);
+
+    const float64 center = (static_cast<float64>(index) + 0.5) * scale - 0.5;
+    const float64 lower = std::clamp(std::floor(center), 0.0, static_cast<float64>(lastIndex));
+    sampling.Lower[index] = static_cast<usize>(lower);
+    sampling.Upper[index] = std::min(sampling.Lower[index] + 1, lastIndex);
+    sampling.Weight[index] = std::clamp(center - lower, 0.0, 1.0);
+
+    const auto boxBegin = static_cast<usize>(std::floor(static_cast<float64>(index) * scale + k_BoxTolerance));
+    const auto boxEnd = static_cast<usize>(std::ceil(static_cast<float64>(index + 1) * scale - k_BoxTolerance));
+    sampling.BoxBegin[index] = std::min(boxBegin, lastIndex);
+    sampling.BoxEnd[index] = std::clamp(boxEnd, sampling.BoxBegin[index] + 1, srcDim);
+  }
+  return sampling;
+}
+
+using ImageSampling = std::array<AxisSampling, 3>;
+
+/**
+ * @brief Resamples one cell array into the destination geometry. The destination x-rows are
+ * split between threads and each row is filled by gathering through the per axis sampling.
+ * Trilinear interpolation only applies to floating point arrays and majority vote only to
+ * single component integer and boolean arrays, every other array is sampled by nearest neighbor.
+ * @tparam T
+ */
+template <typename T>
+class ResampleDataArray
 {
 public:
-  ResampleImageGeomImpl(std::vector<int64>& newIndices, std::vector<float> spacing, FloatVec3 sourceSpacing, SizeVec3 sourceDims, SizeVec3 destDims, const std::atomic_bool& shouldCancel)
-  : m_NewIndices(newIndices)
-  , m_Spacing(std::move(spacing))
-  , m_OrigSpacing(std::move(sourceSpacing))
-  , m_OrigDims(std::move(sourceDims))
-  , m_CopyDims(std::move(destDims))
+  ResampleDataArray(const IDataArray& oldCellArray, IDataArray& newCellArray, const SizeVec3& srcDims, const SizeVec3& destDims, const ImageSampling& sampling,
+                    ChoicesParameter::ValueType interpolationMode, const std::atomic_bool& shouldCancel)
+  : m_OldCellStore(oldCellArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
+  , m_NewCellStore(newCellArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
+  , m_OldData(GetInMemoryDataPointer(m_OldCellStore))
+  , m_NewData(GetInMemoryDataPointer(m_NewCellStore))
+  , m_NumComps(m_OldCellStore.getNumberOfComponents())
+  , m_SrcDims(srcDims)
+  , m_DestDims(destDims)
+  , m_Sampling(sampling)
+  , m_InterpolationMode(interpolationMode)
   , m_ShouldCancel(shouldCancel)
   {
   }
 
-  // -----------------------------------------------------------------------------
-  void compute(size_t xStart, size_t xEnd, size_t yStart, size_t yEnd, size_t zStart, size_t zEnd) const
+  ~ResampleDataArray() = default;
+
+  ResampleDataArray(const ResampleDataArray&) = default;
+  ResampleDataArray(ResampleDataArray&&) noexcept = default;
+  ResampleDataArray& operator=(const ResampleDataArray&) = delete;
+  ResampleDataArray& operator=(ResampleDataArray&&) noexcept = delete;
+
+  void operator()() const
   {
-    for(size_t i = zStart; i < zEnd; i++)
-    {
-      for(size_t j = yStart; j < yEnd; j++)
+    convert();
+  }
+
+protected:
+  void convert() const
+  {
+    const bool useTrilinear = m_InterpolationMode == ResampleImageGeom::k_TrilinearIndex && std::is_floating_point_v<T>;
+    const bool useMajorityVote = m_InterpolationMode == ResampleImageGeom::k_MajorityVoteIndex && std::is_integral_v<T> && m_NumComps == 1;
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, m_DestDims[1] * m_DestDims[2]);
+    dataAlg.requireStoresInMemory({&m_OldCellStore, &m_NewCellStore});
+    dataAlg.execute([&](const Range& range) {
+      std::vector<std::pair<T, usize>> votes;
+      for(usize destRow = range.min(); destRow < range.max(); destRow++)
       {
         if(m_ShouldCancel)
         {
           return;
         }
+        const usize yIndex = destRow % m_DestDims[1];
+        const usize zIndex = destRow / m_DestDims[1];
+        if(useTrilinear)
+        {
+          trilinearRow(destRow, yIndex, zIndex);
+        }
+        else if(useMajorityVote)
+        {
+          majorityVoteRow(destRow, yIndex, zIndex, votes);
+        }
+        else
+        {
+          // Neighboring destination rows that sample the same source row are identical, copy the previous one whole
+          const bool repeatsPreviousRow = destRow > range.min() && yIndex > 0 && m_Sampling[1].Nearest[yIndex] == m_Sampling[1].Nearest[yIndex - 1];
+          nearestRow(destRow, yIndex, zIndex, repeatsPreviousRow);
+        }
+      }
+    });
+  }
+
+  T oldValue(usize index) const
+  {
+    return m_OldData != nullptr ? m_OldData[index] : m_OldCellStore.getValue(index);
+  }
 
-        for(size_t k = xStart; k < xEnd; k++)
+  void setNewValue(usize index, T value) const
+  {
+    if(m_NewData != nullptr)
+    {
+      m_NewData[index] = value;
+    }
+    else
+    {
+      m_NewCellStore.setValue(index, value);
+    }
+  }
+
+  void nearestRow(usize destRow, usize yIndex, usize zIndex, bool repeatsPreviousRow) const
+  {
+    const usize destRowOffset = destRow * m_DestDims[0] * m_NumComps;
+    if(repeatsPreviousRow && m_NewData != nullptr)
+    {
+      const usize rowSize = m_DestDims[0] * m_NumComps;
+      std::copy_n(m_NewData + destRowOffset - rowSize, rowSize, m_NewData + destRowOffset);
+      return;
+    }
+
+    const std::vector<usize>& xMap = m_Sampling[0].Nearest;
+    const usize srcRowOffset = ((m_Sampling[2].Nearest[zIndex] * m_SrcDims[1]) + m_Sampling[1].Nearest[yIndex]) * m_SrcDims[0] * m_NumComps;
+    if(m_NumComps == 1)
+    {
+      for(usize xIndex = 0; xIndex < m_DestDims[0]; xIndex++)
+      {
+        setNewValue(destRowOffset + xIndex, oldValue(srcRowOffset + xMap[xIndex]));
+      }
+      return;
+    }
+    for(usize xIndex = 0; xIndex < m_DestDims[0]; xIndex++)
+    {
+      const usize srcOffset = srcRowOffset + xMap[xIndex] * m_NumComps;
+      const usize destOffset = destRowOffset + xIndex * m_NumComps;
+      if(m_OldData != nullptr && m_NewData != nullptr)
+      {
+        std::copy_n(m_OldData + srcOffset, m_NumComps, m_NewData + destOffset);
+        continue;
+      }
+      for(usize compIndex = 0; compIndex < m_NumComps; compIndex++)
+      {
+        setNewValue(destOffset + compIndex, oldValue(srcOffset + compIndex));
+      }
+    }
+  }
+
+  void trilinearRow(usize destRow, usize yIndex, usize zIndex) const
+  {
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      const AxisSampling& xSampling = m_Sampling[0];
+      const std::array<usize, 2> rows = {m_Sampling[1].Lower[yIndex], m_Sampling[1].Upper[yIndex]};
+      const std::array<usize, 2> planes = {m_Sampling[2].Lower[zIndex], m_Sampling[2].Upper[zIndex]};
+      const std::array<float64, 2> yWeights = {1.0 - m_Sampling[1].Weight[yIndex], m_Sampling[1].Weight[yIndex]};
+      const std::array<float64, 2> zWeights = {1.0 - m_Sampling[2].Weight[zIndex], m_Sampling[2].Weight[zIndex]};
+
+      const usize destRowOffset = destRow * m_DestDims[0] * m_NumComps;
+      for(usize xIndex = 0; xIndex < m_DestDims[0]; xIndex++)
+      {
+        const std::array<usize, 2> cols = {xSampling.Lower[xIndex], xSampling.Upper[xIndex]};
+        const std::array<float64, 2> xWeights = {1.0 - xSampling.Weight[xIndex], xSampling.Weight[xIndex]};
+        for(usize compIndex = 0; compIndex < m_NumComps; compIndex++)
         {
-          float32 x = (static_cast<float32>(k) * m_Spacing[0]);
-          float32 y = (static_cast<float32>(j) * m_Spacing[1]);
-          float32 z = (static_cast<float32>(i) * m_Spacing[2]);
-          auto col = static_cast<int64>(x / m_OrigSpacing[0]);
-          auto row = static_cast<int64>(y / m_OrigSpacing[1]);
-          auto plane = static_cast<int64>(z / m_OrigSpacing[2]);
-          int64 indexOld = static_cast<int64>(plane * m_OrigDims[1] * m_OrigDims[0]) + static_cast<int64>(row * m_OrigDims[0]) + col;
-          auto index = static_cast<size_t>((i * m_CopyDims[0] * m_CopyDims[1]) + (j * m_CopyDims[0]) + k);
-          m_NewIndices[index] = indexOld;
+          float64 value = 0.0;
+          for(usize z = 0; z < 2; z++)
+          {
+            for(usize y = 0; y < 2; y++)
+            {
+              const usize srcRowOffset = ((planes[z] * m_SrcDims[1]) + rows[y]) * m_SrcDims[0];
+              const float64 rowWeight = zWeights[z] * yWeights[y];
+              for(usize x = 0; x < 2; x++)
+              {
+                value += rowWeight * xWeights[x] * static_cast<float64>(oldValue((srcRowOffset + cols[x]) * m_NumComps + compIndex));
+              }
+            }
+          }
+          setNewValue(destRowOffset + xIndex * m_NumComps + compIndex, static_cast<T>(value));
         }
       }
     }
   }
 
-  void operator()(const Range3D& r) const
+  void majorityVoteRow(usize destRow, usize yIndex, usize zIndex, std::vector<std::pair<T, usize>>& votes) const
   {
-    compute(r[0], r[1], r[2], r[3], r[4], r[5]);
+    const AxisSampling& xSampling = m_Sampling[0];
+    const usize destRowOffset = destRow * m_DestDims[0];
+    for(usize xIndex = 0; xIndex < m_DestDims[0]; xIndex++)
+    {
+      votes.clear();
+      for(usize z = m_Sampling[2].BoxBegin[zIndex]; z < m_Sampling[2].BoxEnd[zIndex]; z++)
+      {
+        for(usize y = m_Sampling[1].BoxBegin[yIndex]; y < m_Sampling[1].BoxEnd[yIndex]; y++)
+        {
+          const usize srcRowOffset = ((z * m_SrcDims[1]) + y) * m_SrcDims[0];
+          for(usize x = xSampling.BoxBegin[xIndex]; x < xSampling.BoxEnd[xIndex]; x++)
+          {
+            const T value = oldValue(srcRowOffset + x);
+            auto iter = std::find_if(votes.begin(), votes.end(), [value](const auto& vote) { return vote.first == value; });
+            if(iter == votes.end())
+            {
+              votes.emplace_back(value, 1);
+            }
+            else
+            {
+              iter->second++;
+            }
+          }
+        }
+      }
+      // Ties go to the value found first
+      auto winner = std::max_element(votes.begin(), votes.end(), [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+      setNewValue(destRowOffset + xIndex, winner->first);
+    }
   }
 
 private:
-  std::vector<int64>& m_NewIndices;
-  std::vector<float> m_Spacing;
-  FloatVec3 m_OrigSpacing;
-  SizeVec3 m_OrigDims;
-  SizeVec3 m_CopyDims;
+  const AbstractDataStore<T>& m_OldCellStore;
+  AbstractDataStore<T>& m_NewCellStore;
+  const T* m_OldData = nullptr;
+  T* m_NewData = nullptr;
+  usize m_NumComps = 1;
+  SizeVec3 m_SrcDims;
+  SizeVec3 m_DestDims;
+  const ImageSampling& m_Sampling;
+  ChoicesParameter::ValueType m_InterpolationMode;
   const std::atomic_bool& m_ShouldCancel;
 };
 } // namespace
@@ -92,7 +305,7 @@ const std::atomic_bool& ResampleImageGeom::getCancel()
 // -----------------------------------------------------------------------------
 Result<> ResampleImageGeom::operator()()
 {
-  m_MessageHandler(IFilter::Message::Type::Info, "Computing new indices...");
+  m_MessageHandler(IFilter::Message::Type::Info, "Computing resampling maps...");
 
   const auto& selectedImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->SelectedImageGeometryPath);
   SizeVec3 sourceDims = selectedImageGeom.getDimensions();
@@ -101,10 +314,11 @@ Result<> ResampleImageGeom::operator()()
   auto& destImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->CreatedImageGeometryPath);
   SizeVec3 destDims = destImageGeom.getDimensions();
 
-  std::vector<int64> newIndices(destDims[2] * destDims[1] * destDims[0]);
-  ParallelData3DAlgorithm dataAlg;
-  dataAlg.setRange(destDims[0], destDims[1], destDims[2]);
-  dataAlg.execute(ResampleImageGeomImpl(newIndices, m_InputValues->Spacing, origSpacing, sourceDims, destDims, m_ShouldCancel));
+  ImageSampling sampling;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    sampling[axis] = CreateAxisSampling(destDims[axis], m_InputValues->Spacing[axis], sourceDims[axis], origSpacing[axis]);
+  }
 
   auto cellDataGroupPath = m_InputValues->CellDataGroupPath;
   auto& cellDataGroup = m_DataStructure.getDataRefAs<AttributeMatrix>(cellDataGroupPath);
@@ -116,8 +330,9 @@ Result<> ResampleImageGeom::operator()()
     selectedCellArrays.push_back(m_InputValues->CellDataGroupPath.createChildPath(child.second->getName()));
   }
 
-  // The actual cropping of the dataStructure arrays is done in parallel where parallel here
-  // refers to the cropping of each DataArray being done on a separate thread.
+  // The actual resampling of the dataStructure arrays is done in parallel where parallel here
+  // refers to each DataArray being done on a separate thread, each of which further splits
+  // its destination x-rows between threads.
   ParallelTaskAlgorithm taskRunner;
   const auto& srcCellDataAM = selectedImageGeom.getCellDataRef();
   auto& destCellDataAM = destImageGeom.getCellDataRef();
@@ -136,7 +351,8 @@ Result<> ResampleImageGeom::operator()()
     auto& newDataArray = dynamic_cast<IDataArray&>(destCellDataAM.at(srcName));
     m_MessageHandler(fmt::format("Resample Volume || Copying Data Array {}", srcName));
 
-    ExecuteParallelFunction<CopyTupleUsingIndexList>(oldDataArray.getDataType(), taskRunner, oldDataArray, newDataArray, newIndices);
+    ExecuteParallelFunction<ResampleDataArray>(oldDataArray.getDataType(), taskRunner, oldDataArray, newDataArray, sourceDims, destDims, sampling, m_InputValues->InterpolationMode,
+                                               m_ShouldCancel);
   }
 
   taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
@@ -22,6 +22,7 @@ struct SIMPLNXCORE_EXPORT ResampleImageGeomInputValues
   bool RenumberFeatures;
   DataPath FeatureIdsArrayPath;
   DataPath CellFeatureAttributeMatrix;
+  ChoicesParameter::ValueType InterpolationMode;
 };
 
 /**
@@ -30,6 +31,10 @@ struct SIMPLNXCORE_EXPORT ResampleImageGeomInputValues
 class SIMPLNXCORE_EXPORT ResampleImageGeom
 {
 public:
+  static inline constexpr ChoicesParameter::ValueType k_NearestNeighborIndex = 0;
+  static inline constexpr ChoicesParameter::ValueType k_TrilinearIndex = 1;
+  static inline constexpr ChoicesParameter::ValueType k_MajorityVoteIndex = 2;
+
   ResampleImageGeom(DataStructure& dataStructure, const IFilter::MessageHandler& msgHandler, const std::atomic_bool& shouldCancel, ResampleImageGeomInputValues* inputValues);
   ~ResampleImageGeom() noexcept;
 
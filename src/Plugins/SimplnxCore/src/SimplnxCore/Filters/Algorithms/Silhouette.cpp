@@ -4,13 +4,174 @@
 #include "simplnx/Utilities/ClusteringUtilities.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
+#include <numeric>
 #include <unordered_set>
 
 using namespace nx::core;
 
 namespace
 {
+constexpr usize k_PointBlockSize = 64;
+constexpr usize k_ReferenceTileSize = 1024;
+
+/**
+ * @brief Turns the summed distances of one tuple to every cluster into its silhouette value.
+ */
+void StoreSilhouette(float64* clusterDist, int32 cluster, const std::vector<float64>& referenceCounts, Float64AbstractDataStore& outputData, usize tupleIndex)
+{
+  const usize totalClusters = referenceCounts.size();
+  for(usize j = 1; j < totalClusters; j++)
+  {
+    clusterDist[j] /= referenceCounts[j];
+  }
+
+  const float64 inClusterDist = clusterDist[cluster];
+  float64 outClusterMinDist = 0.0;
+  float64 minDist = std::numeric_limits<float64>::max();
+  for(usize j = 1; j < totalClusters; j++)
+  {
+    if(cluster != j)
+    {
+      float64 dist = clusterDist[j];
+      if(dist < minDist)
+      {
+        minDist = dist;
+        outClusterMinDist = dist;
+      }
+    }
+  }
+  outputData[tupleIndex] = (outClusterMinDist - inClusterDist) / (std::max(outClusterMinDist, inClusterDist));
+}
+
+/**
+ * @brief Computes the silhouette of a range of tuple blocks. The distances are streamed tile by tile from the packed
+ * reference tuples into per cluster sums of the block's tuples, so the memory use does not depend on the number of
+ * tuples and the references stay in cache while a whole block is compared against them.
+ */
+class ComputeSilhouetteBlocksImpl
+{
+public:
+  ComputeSilhouetteBlocksImpl(const std::vector<float64>& tupleValues, const std::vector<usize>& tuples, const std::vector<int32>& tupleIds, const std::vector<float64>& referenceValues,
+                              const std::vector<int32>& referenceIds, const std::vector<float64>& referenceCounts, usize numComps, ClusterUtilities::DistanceMetric distMetric,
+                              Float64AbstractDataStore& outputData, const std::atomic_bool& shouldCancel)
+  : m_TupleValues(tupleValues)
+  , m_Tuples(tuples)
+  , m_TupleIds(tupleIds)
+  , m_ReferenceValues(referenceValues)
+  , m_ReferenceIds(referenceIds)
+  , m_ReferenceCounts(referenceCounts)
+  , m_NumComps(numComps)
+  , m_DistMetric(distMetric)
+  , m_OutputData(outputData)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize totalClusters = m_ReferenceCounts.size();
+    const usize numReferences = m_ReferenceIds.size();
+    std::vector<float64> clusterDist(k_PointBlockSize * totalClusters);
+
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const usize blockStart = block * k_PointBlockSize;
+      const usize blockEnd = std::min(blockStart + k_PointBlockSize, m_Tuples.size());
+      std::fill(clusterDist.begin(), clusterDist.end(), 0.0);
+
+      for(usize tileStart = 0; tileStart < numReferences; tileStart += k_ReferenceTileSize)
+      {
+        const usize tileEnd = std::min(tileStart + k_ReferenceTileSize, numReferences);
+        for(usize i = blockStart; i < blockEnd; i++)
+        {
+          float64* tupleDist = clusterDist.data() + (i - blockStart) * totalClusters;
+          for(usize r = tileStart; r < tileEnd; r++)
+          {
+            tupleDist[m_ReferenceIds[r]] += ClusterUtilities::GetDistance(m_TupleValues, m_NumComps * i, m_ReferenceValues, m_NumComps * r, m_NumComps, m_DistMetric);
+          }
+        }
+      }
+
+      for(usize i = blockStart; i < blockEnd; i++)
+      {
+        StoreSilhouette(clusterDist.data() + (i - blockStart) * totalClusters, m_TupleIds[i], m_ReferenceCounts, m_OutputData, m_Tuples[i]);
+      }
+    }
+  }
+
+private:
+  const std::vector<float64>& m_TupleValues;
+  const std::vector<usize>& m_Tuples;
+  const std::vector<int32>& m_TupleIds;
+  const std::vector<float64>& m_ReferenceValues;
+  const std::vector<int32>& m_ReferenceIds;
+  const std::vector<float64>& m_ReferenceCounts;
+  usize m_NumComps;
+  ClusterUtilities::DistanceMetric m_DistMetric;
+  Float64AbstractDataStore& m_OutputData;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Squared Euclidean fast path: the summed squared distance from x to the members y of a cluster c with mean m_c is
+ * n_c * |x - m_c|^2 + sum(|y - m_c|^2), so each tuple only needs the per cluster means and scatters instead of every member.
+ * Both terms are taken about the cluster mean, which keeps them accurate for data far away from the origin.
+ */
+class ComputeSquaredEuclideanSilhouetteImpl
+{
+public:
+  ComputeSquaredEuclideanSilhouetteImpl(const std::vector<float64>& tupleValues, const std::vector<usize>& tuples, const std::vector<int32>& tupleIds, const std::vector<float64>& clusterMeans,
+                                        const std::vector<float64>& clusterScatters, const std::vector<float64>& referenceCounts, usize numComps, Float64AbstractDataStore& outputData)
+  : m_TupleValues(tupleValues)
+  , m_Tuples(tuples)
+  , m_TupleIds(tupleIds)
+  , m_ClusterMeans(clusterMeans)
+  , m_ClusterScatters(clusterScatters)
+  , m_ReferenceCounts(referenceCounts)
+  , m_NumComps(numComps)
+  , m_OutputData(outputData)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize totalClusters = m_ReferenceCounts.size();
+    std::vector<float64> clusterDist(totalClusters);
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      const float64* x = m_TupleValues.data() + m_NumComps * i;
+      for(usize cluster = 0; cluster < totalClusters; cluster++)
+      {
+        const float64* mean = m_ClusterMeans.data() + m_NumComps * cluster;
+        float64 squaredDist = 0.0;
+        for(usize comp = 0; comp < m_NumComps; comp++)
+        {
+          const float64 diff = x[comp] - mean[comp];
+          squaredDist += diff * diff;
+        }
+        clusterDist[cluster] = m_ReferenceCounts[cluster] * squaredDist + m_ClusterScatters[cluster];
+      }
+      StoreSilhouette(clusterDist.data(), m_TupleIds[i], m_ReferenceCounts, m_OutputData, m_Tuples[i]);
+    }
+  }
+
+private:
+  const std::vector<float64>& m_TupleValues;
+  const std::vector<usize>& m_Tuples;
+  const std::vector<int32>& m_TupleIds;
+  const std::vector<float64>& m_ClusterMeans;
+  const std::vector<float64>& m_ClusterScatters;
+  const std::vector<float64>& m_ReferenceCounts;
+  usize m_NumComps;
+  Float64AbstractDataStore& m_OutputData;
+};
+
 template <typename T>
 class SilhouetteTemplate
 {
@@ -26,14 +187,17 @@ public:
     return Pointer(static_cast<Self*>(nullptr));
   }
 
-  SilhouetteTemplate(const IDataArray& inputIDataArray, Float64AbstractDataStore& outputDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
-                     const Int32AbstractDataStore& featureIds, ClusterUtilities::DistanceMetric distMetric)
-  : m_InputData(inputIDataArray.template getIDataStoreRefAs<AbstractDataStoreT>())
+  SilhouetteTemplate(Silhouette* filter, const IDataArray& inputIDataArray, Float64AbstractDataStore& outputDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
+                     const Int32AbstractDataStore& featureIds, const SilhouetteInputValues* inputValues)
+  : m_Filter(filter)
+  , m_InputData(inputIDataArray.template getIDataStoreRefAs<AbstractDataStoreT>())
   , m_OutputData(outputDataArray)
+  , m_FeatureIds(featureIds)
   , m_Mask(maskDataArray)
   , m_NumClusters(numClusters)
-  , m_FeatureIds(featureIds)
-  , m_DistMetric(distMetric)
+  , m_DistMetric(inputValues->DistanceMetric)
+  , m_UseSampling(inputValues->UseSampling)
+  , m_SampleSize(inputValues->SampleSize)
   {
   }
   ~SilhouetteTemplate() = default;
@@ -50,84 +214,139 @@ public:
     usize numTuples = m_InputData.getNumberOfTuples();
     usize numCompDims = m_InputData.getNumberOfComponents();
     usize totalClusters = m_NumClusters + 1;
-    std::vector<float64> inClusterDist(numTuples, 0.0);
-    std::vector<float64> outClusterMinDist(numTuples, 0.0);
-    std::vector<float64> numTuplesPerFeature(totalClusters, 0.0);
-    std::vector<std::vector<float64>> clusterDist(numTuples, std::vector<float64>(totalClusters, 0.0));
 
+    // Gather the usable tuples (ascending) and group them by cluster
+    std::vector<usize> tuples;
+    std::vector<int32> tupleIds;
+    std::vector<std::vector<usize>> clusterMembers(totalClusters);
     for(usize i = 0; i < numTuples; i++)
     {
       if(m_Mask->isTrue(i))
       {
-        numTuplesPerFeature[m_FeatureIds[i]]++;
+        tuples.push_back(i);
+        tupleIds.push_back(m_FeatureIds[i]);
+        clusterMembers[m_FeatureIds[i]].push_back(tuples.size() - 1);
       }
     }
-
-    for(usize i = 0; i < numTuples; i++)
+    std::vector<float64> tupleValues(tuples.size() * numCompDims);
+    for(usize i = 0; i < tuples.size(); i++)
     {
-      if(m_Mask->isTrue(i))
+      for(usize comp = 0; comp < numCompDims; comp++)
       {
-        for(usize j = 0; j < numTuples; j++)
-        {
-          if(m_Mask->isTrue(j))
-          {
-            clusterDist[i][m_FeatureIds[j]] += ClusterUtilities::GetDistance(m_InputData, (numCompDims * i), m_InputData, (numCompDims * j), numCompDims, m_DistMetric);
-          }
-        }
+        tupleValues[numCompDims * i + comp] = static_cast<float64>(m_InputData[numCompDims * tuples[i] + comp]);
       }
     }
 
-    for(usize i = 0; i < numTuples; i++)
+    // The tuples every tuple is compared against: all of them, or an equal share of every cluster
+    std::vector<usize> references;
+    std::vector<float64> referenceCounts(totalClusters, 0.0);
+    if(m_UseSampling)
     {
-      if(m_Mask->isTrue(i))
+      for(usize cluster = 0; cluster < totalClusters; cluster++)
       {
-        for(usize j = 1; j < totalClusters; j++)
+        for(usize position : ClusterUtilities::StratifiedSamplePositions(clusterMembers[cluster].size(), m_SampleSize))
         {
-          clusterDist[i][j] /= numTuplesPerFeature[j];
+          references.push_back(clusterMembers[cluster][position]);
         }
       }
+      std::sort(references.begin(), references.end());
     }
+    else
+    {
+      references.resize(tuples.size());
+      std::iota(references.begin(), references.end(), 0);
+    }
+    clusterMembers.clear();
 
-    for(usize i = 0; i < numTuples; i++)
+    std::vector<float64> referenceValues(references.size() * numCompDims);
+    std::vector<int32> referenceIds(references.size());
+    for(usize r = 0; r < references.size(); r++)
     {
-      if(m_Mask->isTrue(i))
-      {
-        int32 cluster = m_FeatureIds[i];
-        inClusterDist[i] = clusterDist[i][cluster];
+      referenceIds[r] = tupleIds[references[r]];
+      referenceCounts[referenceIds[r]]++;
+      std::copy_n(tupleValues.begin() + numCompDims * references[r], numCompDims, referenceValues.begin() + numCompDims * r);
+    }
+
+    if(m_Filter->getCancel())
+    {
+      return;
+    }
+    m_Filter->updateProgress(fmt::format("Computing Silhouette || {} tuples against {} reference tuples", tuples.size(), references.size()));
 
-        float64 minDist = std::numeric_limits<float64>::max();
-        for(usize j = 1; j < totalClusters; j++)
+    if(m_DistMetric == ClusterUtilities::SquaredEuclidean)
+    {
+      // Corrected two pass mean and scatter of every cluster: the residuals of the first pass mean refine it
+      std::vector<float64> clusterMeans(totalClusters * numCompDims, 0.0);
+      for(usize r = 0; r < references.size(); r++)
+      {
+        for(usize comp = 0; comp < numCompDims; comp++)
         {
-          if(cluster != j)
-          {
-            float64 dist = clusterDist[i][j];
-            if(dist < minDist)
-            {
-              minDist = dist;
-              outClusterMinDist[i] = dist;
-            }
-          }
+          clusterMeans[numCompDims * referenceIds[r] + comp] += referenceValues[numCompDims * r + comp];
+        }
+      }
+      for(usize cluster = 0; cluster < totalClusters; cluster++)
+      {
+        if(referenceCounts[cluster] <= 0.0)
+        {
+          continue;
+        }
+        for(usize comp = 0; comp < numCompDims; comp++)
+        {
+          clusterMeans[numCompDims * cluster + comp] /= referenceCounts[cluster];
         }
       }
-    }
 
-    for(usize i = 0; i < numTuples; i++)
-    {
-      if(m_Mask->isTrue(i))
+      std::vector<float64> residualSums(totalClusters * numCompDims, 0.0);
+      std::vector<float64> clusterScatters(totalClusters, 0.0);
+      for(usize r = 0; r < references.size(); r++)
       {
-        m_OutputData[i] = (outClusterMinDist[i] - inClusterDist[i]) / (std::max(outClusterMinDist[i], inClusterDist[i]));
+        for(usize comp = 0; comp < numCompDims; comp++)
+        {
+          const float64 residual = referenceValues[numCompDims * r + comp] - clusterMeans[numCompDims * referenceIds[r] + comp];
+          residualSums[numCompDims * referenceIds[r] + comp] += residual;
+          clusterScatters[referenceIds[r]] += residual * residual;
+        }
       }
+      for(usize cluster = 0; cluster < totalClusters; cluster++)
+      {
+        if(referenceCounts[cluster] <= 0.0)
+        {
+          continue;
+        }
+        for(usize comp = 0; comp < numCompDims; comp++)
+        {
+          const float64 correction = residualSums[numCompDims * cluster + comp] / referenceCounts[cluster];
+          clusterMeans[numCompDims * cluster + comp] += correction;
+          clusterScatters[cluster] -= correction * residualSums[numCompDims * cluster + comp];
+        }
+        clusterScatters[cluster] = std::max(clusterScatters[cluster], 0.0);
+      }
+
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, tuples.size());
+      dataAlg.requireStoresInMemory({&m_OutputData});
+      dataAlg.execute(ComputeSquaredEuclideanSilhouetteImpl(tupleValues, tuples, tupleIds, clusterMeans, clusterScatters, referenceCounts, numCompDims, m_OutputData));
+      return;
     }
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, (tuples.size() + k_PointBlockSize - 1) / k_PointBlockSize);
+    dataAlg.requireStoresInMemory({&m_OutputData});
+    dataAlg.execute(
+        ComputeSilhouetteBlocksImpl(tupleValues, tuples, tupleIds, referenceValues, referenceIds, referenceCounts, numCompDims, m_DistMetric, m_OutputData, m_Filter->getCancel()));
   }
 
 private:
   using AbstractDataStoreT = AbstractDataStore<T>;
+  Silhouette* m_Filter;
   const AbstractDataStoreT& m_InputData;
   Float64AbstractDataStore& m_OutputData;
   const Int32AbstractDataStore& m_FeatureIds;
   const std::unique_ptr<MaskCompare>& m_Mask;
   usize m_NumClusters;
   ClusterUtilities::DistanceMetric m_DistMetric;
+  bool m_UseSampling;
+  usize m_SampleSize;
 };
 } // namespace
 
@@ -179,8 +398,8 @@ Result<> Silhouette::operator()()
     std::string message = fmt::format("Mask Array DataPath does not exist or is not of the correct type (Bool | UInt8) {}", m_InputValues->MaskArrayPath.toString());
     return MakeErrorResult(-54080, message);
   }
-  RunTemplateClass<SilhouetteTemplate, types::NoBooleanType>(clusteringArray.getDataType(), clusteringArray,
+  RunTemplateClass<SilhouetteTemplate, types::NoBooleanType>(clusteringArray.getDataType(), this, clusteringArray,
                                                              m_DataStructure.getDataAs<Float64Array>(m_InputValues->SilhouetteArrayPath)->getDataStoreRef(), maskCompare, uniqueIds.size(), featureIds,
-                                                             m_InputValues->DistanceMetric);
+                                                             m_InputValues);
   return {};
 }
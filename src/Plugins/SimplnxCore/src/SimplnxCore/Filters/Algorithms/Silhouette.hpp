@@ -19,6 +19,8 @@ struct SIMPLNXCORE_EXPORT SilhouetteInputValues
   DataPath MaskArrayPath;
   DataPath FeatureIdsArrayPath;
   DataPath SilhouetteArrayPath;
+  bool UseSampling;
+  uint64 SampleSize;
 };
 
 /**
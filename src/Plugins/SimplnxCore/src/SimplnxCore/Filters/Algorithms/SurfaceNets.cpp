@@ -6,6 +6,7 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "SimplnxCore/SurfaceNets/MMCellFlag.h"
 #include "SimplnxCore/SurfaceNets/MMCellMap.h"
@@ -71,6 +72,200 @@ void getQuadTriangleIDs(std::array<VertexData, 4>& vData, bool isQuadFrontFacing
   triangleVtxIDs[4] = vData[2].VertexId;
   triangleVtxIDs[5] = vData[3].VertexId;
 }
+
+// Every vertex generates the quads around these 3 edges of its cell. The other 9 cell
+// edges are handled by the neighboring cells that share them.
+const std::array<MMCellFlag::Edge, 3> k_QuadEdges = {MMCellFlag::Edge::BackBottomEdge, MMCellFlag::Edge::LeftBottomEdge, MMCellFlag::Edge::LeftBackEdge};
+
+// All 12 edges of a cell. A vertex is a corner of the quad of every crossed edge of its cell.
+const std::array<MMCellFlag::Edge, 12> k_CellEdges = {MMCellFlag::Edge::LeftBottomEdge, MMCellFlag::Edge::RightBottomEdge, MMCellFlag::Edge::BackBottomEdge, MMCellFlag::Edge::FrontBottomEdge,
+                                                      MMCellFlag::Edge::LeftTopEdge,    MMCellFlag::Edge::RightTopEdge,    MMCellFlag::Edge::BackTopEdge,    MMCellFlag::Edge::FrontTopEdge,
+                                                      MMCellFlag::Edge::LeftBackEdge,   MMCellFlag::Edge::RightBackEdge,   MMCellFlag::Edge::LeftFrontEdge,  MMCellFlag::Edge::RightFrontEdge};
+
+/**
+ * @brief Writes the position and node type of a block of vertices. The node type is the
+ * number of junctions of the vertex's cell. Vertices on quads that touch the padding around
+ * the volume get 10 added for the first such quad and 1 for each additional one.
+ */
+class SetVerticesImpl
+{
+public:
+  SetVerticesImpl(MMCellMap* cellMap, const FloatVec3& origin, const FloatVec3& voxelSize, AbstractDataStore<float32>& vertices, Int8AbstractDataStore& nodeTypes)
+  : m_CellMap(cellMap)
+  , m_Origin(origin)
+  , m_VoxelSize(voxelSize)
+  , m_Vertices(vertices)
+  , m_NodeTypes(nodeTypes)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    Point3Df position = {0.0f, 0.0f, 0.0f};
+    std::array<int, 3> vertCellIndex = {0, 0, 0};
+    std::array<int32, 4> vertexIndices = {0, 0, 0, 0};
+    std::array<int32, 2> quadLabels = {0, 0};
+    for(usize vertIndex = range.min(); vertIndex < range.max(); vertIndex++)
+    {
+      m_CellMap->getVertexPosition(static_cast<int>(vertIndex), position.data());
+      // Relocate the vertex correctly based on the origin of the ImageGeometry
+      position = position + m_Origin - Point3Df(0.5f * m_VoxelSize[0], 0.5f * m_VoxelSize[1], 0.5f * m_VoxelSize[1]);
+      m_Vertices[vertIndex * 3 + 0] = position[0];
+      m_Vertices[vertIndex * 3 + 1] = position[1];
+      m_Vertices[vertIndex * 3 + 2] = position[2];
+
+      m_CellMap->getVertexCellIndex(static_cast<int>(vertIndex), vertCellIndex.data());
+      MMCellMap::Cell* currentCellPtr = m_CellMap->getCell(vertCellIndex.data());
+      auto nodeType = static_cast<int8>(currentCellPtr->flag.numJunctions());
+
+      int8 numPaddingQuads = 0;
+      for(const auto edge : k_CellEdges)
+      {
+        if(m_CellMap->getEdgeQuad(static_cast<int>(vertIndex), edge, vertexIndices.data(), quadLabels.data()) &&
+           (quadLabels[0] == MMSurfaceNet::Padding || quadLabels[1] == MMSurfaceNet::Padding))
+        {
+          numPaddingQuads++;
+        }
+      }
+      if(numPaddingQuads > 0)
+      {
+        nodeType += 10 + (numPaddingQuads - 1);
+      }
+      m_NodeTypes[vertIndex] = nodeType;
+    }
+  }
+
+private:
+  MMCellMap* m_CellMap = nullptr;
+  const FloatVec3& m_Origin;
+  const FloatVec3& m_VoxelSize;
+  AbstractDataStore<float32>& m_Vertices;
+  Int8AbstractDataStore& m_NodeTypes;
+};
+
+/**
+ * @brief Counts the triangles generated by each vertex of a block.
+ */
+class CountTrianglesImpl
+{
+public:
+  CountTrianglesImpl(MMCellMap* cellMap, std::vector<usize>& faceOffsets)
+  : m_CellMap(cellMap)
+  , m_FaceOffsets(faceOffsets)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::array<int, 3> vertCellIndex = {0, 0, 0};
+    for(usize vertIndex = range.min(); vertIndex < range.max(); vertIndex++)
+    {
+      m_CellMap->getVertexCellIndex(static_cast<int>(vertIndex), vertCellIndex.data());
+      MMCellMap::Cell* currentCellPtr = m_CellMap->getCell(vertCellIndex.data());
+      usize numTriangles = 0;
+      for(const auto edge : k_QuadEdges)
+      {
+        if(currentCellPtr->flag.isEdgeCrossing(edge))
+        {
+          numTriangles += 2;
+        }
+      }
+      m_FaceOffsets[vertIndex] = numTriangles;
+    }
+  }
+
+private:
+  MMCellMap* m_CellMap = nullptr;
+  std::vector<usize>& m_FaceOffsets;
+};
+
+/**
+ * @brief Writes the triangles, face labels and transferred cell data of a block of vertices
+ * starting at each vertex's offset into the face list.
+ */
+class CreateTrianglesImpl
+{
+public:
+  CreateTrianglesImpl(MMCellMap* cellMap, const std::vector<usize>& faceOffsets, AbstractDataStore<IGeometry::MeshIndexType>& triangles, Int32AbstractDataStore& faceLabels,
+                      const std::vector<std::shared_ptr<AbstractTupleTransfer>>& tupleTransferFunctions)
+  : m_CellMap(cellMap)
+  , m_FaceOffsets(faceOffsets)
+  , m_Triangles(triangles)
+  , m_FaceLabels(faceLabels)
+  , m_TupleTransferFunctions(tupleTransferFunctions)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::array<int32, 4> vertexIndices = {0, 0, 0, 0};
+    std::array<int32, 2> quadLabels = {0, 0};
+    for(usize vertIndex = range.min(); vertIndex < range.max(); vertIndex++)
+    {
+      usize faceIndex = m_FaceOffsets[vertIndex];
+      for(const auto edge : k_QuadEdges)
+      {
+        if(m_CellMap->getEdgeQuad(static_cast<int>(vertIndex), edge, vertexIndices.data(), quadLabels.data()))
+        {
+          faceIndex = createQuad(faceIndex, vertexIndices, quadLabels);
+        }
+      }
+    }
+  }
+
+private:
+  usize createQuad(usize faceIndex, const std::array<int32, 4>& vertexIndices, std::array<int32, 2>& quadLabels) const
+  {
+    std::array<VertexData, 4> vData{};
+    vData[0] = {vertexIndices[0], 00.0f, 0.0f, 0.0f};
+    vData[1] = {vertexIndices[1], 00.0f, 0.0f, 0.0f};
+    vData[2] = {vertexIndices[2], 00.0f, 0.0f, 0.0f};
+    vData[3] = {vertexIndices[3], 00.0f, 0.0f, 0.0f};
+
+    const bool isQuadFrontFacing = (quadLabels[0] < quadLabels[1]);
+    if(quadLabels[0] == MMSurfaceNet::Padding)
+    {
+      quadLabels[0] = 0;
+    }
+    if(quadLabels[1] == MMSurfaceNet::Padding)
+    {
+      quadLabels[1] = 0;
+    }
+
+    std::array<int, 6> triangleVtxIDs = {0, 0, 0, 0, 0, 0};
+    getQuadTriangleIDs(vData, isQuadFrontFacing, triangleVtxIDs);
+
+    for(usize t = 0; t < 2; t++)
+    {
+      m_Triangles[faceIndex * 3 + 0] = static_cast<usize>(triangleVtxIDs[t * 3 + 0]);
+      m_Triangles[faceIndex * 3 + 1] = static_cast<usize>(triangleVtxIDs[t * 3 + 1]);
+      m_Triangles[faceIndex * 3 + 2] = static_cast<usize>(triangleVtxIDs[t * 3 + 2]);
+      if(quadLabels[0] < quadLabels[1])
+      {
+        m_FaceLabels[faceIndex * 2] = quadLabels[0];
+        m_FaceLabels[faceIndex * 2 + 1] = quadLabels[1];
+      }
+      else
+      {
+        m_FaceLabels[faceIndex * 2] = quadLabels[1];
+        m_FaceLabels[faceIndex * 2 + 1] = quadLabels[0];
+      }
+      // Copy any Cell Data to the Triangle Mesh
+      for(const auto& tupleTransferFunction : m_TupleTransferFunctions)
+      {
+        tupleTransferFunction->transfer(faceIndex, quadLabels[0], quadLabels[1], m_FaceLabels);
+      }
+      faceIndex++;
+    }
+    return faceIndex;
+  }
+
+  MMCellMap* m_CellMap = nullptr;
+  const std::vector<usize>& m_FaceOffsets;
+  AbstractDataStore<IGeometry::MeshIndexType>& m_Triangles;
+  Int32AbstractDataStore& m_FaceLabels;
+  const std::vector<std::shared_ptr<AbstractTupleTransfer>>& m_TupleTransferFunctions;
+};
 } // namespace
 // -----------------------------------------------------------------------------
 SurfaceNets::SurfaceNets(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, SurfaceNetsInputValues* inputValues)
@@ -123,6 +318,7 @@ Result<> SurfaceNets::operator()()
     relaxAttrs.maxDistFromCellCenter = m_InputValues->MaxDistanceFromVoxel;
     relaxAttrs.numRelaxIterations = m_InputValues->SmoothingIterations;
     relaxAttrs.relaxFactor = m_InputValues->RelaxationFactor;
+    relaxAttrs.jacobiRelaxation = m_InputValues->UseJacobiRelaxation;
 
     surfaceNet.relax(relaxAttrs);
   }
@@ -137,288 +333,59 @@ Result<> SurfaceNets::operator()()
   triangleGeom.getVertexAttributeMatrix()->resizeTuples({static_cast<usize>(nodeCount)});
 
   // Remove and then insert a properly sized int8 for the NodeTypes
-  auto& nodeTypes = m_DataStructure.getDataAs<Int8Array>(m_InputValues->NodeTypesDataPath)->getDataStoreRef();
+  auto& nodeTypesArray = m_DataStructure.getDataRefAs<Int8Array>(m_InputValues->NodeTypesDataPath);
+  auto& nodeTypes = nodeTypesArray.getDataStoreRef();
   nodeTypes.resizeTuples({static_cast<usize>(nodeCount)});
 
-  Point3Df position = {0.0f, 0.0f, 0.0f};
+  ParallelDataAlgorithm vertexAlg;
+  vertexAlg.setRange(0, static_cast<usize>(nodeCount));
+  vertexAlg.requireArraysInMemory({triangleGeom.getVertices(), &nodeTypesArray});
+  vertexAlg.execute(SetVerticesImpl(cellMapPtr, origin, voxelSize, triangleGeom.getVertices()->getDataStoreRef(), nodeTypes));
 
-  std::array<int, 3> vertCellIndex = {0, 0, 0};
-  for(int32 vertIndex = 0; vertIndex < nodeCount; vertIndex++)
+  if(m_ShouldCancel)
   {
-    cellMapPtr->getVertexPosition(vertIndex, position.data());
-    // Relocate the vertex correctly based on the origin of the ImageGeometry
-    position = position + origin - Point3Df(0.5f * voxelSize[0], 0.5f * voxelSize[1], 0.5f * voxelSize[1]);
-
-    triangleGeom.setVertexCoordinate(static_cast<usize>(vertIndex), position);
-    cellMapPtr->getVertexCellIndex(vertIndex, vertCellIndex.data());
-    MMCellMap::Cell* currentCellPtr = cellMapPtr->getCell(vertCellIndex.data());
-    nodeTypes[static_cast<usize>(vertIndex)] = static_cast<int8>(currentCellPtr->flag.numJunctions());
+    return {};
   }
+
+  // First Pass through to just count the number of triangles. An exclusive scan of the
+  // counts gives every vertex the index of its first triangle.
+  std::vector<usize> faceOffsets(static_cast<usize>(nodeCount), 0);
+  ParallelDataAlgorithm countAlg;
+  countAlg.setRange(0, static_cast<usize>(nodeCount));
+  countAlg.execute(CountTrianglesImpl(cellMapPtr, faceOffsets));
+
   usize triangleCount = 0;
-  // First Pass through to just count the number of triangles:
-  for(int idxVtx = 0; idxVtx < nodeCount; idxVtx++)
+  for(auto& faceOffset : faceOffsets)
   {
-    std::array<int32, 4> vertexIndices = {0, 0, 0, 0};
-    std::array<LabelType, 2> quadLabels = {0, 0};
-    if(cellMapPtr->getEdgeQuad(idxVtx, MMCellFlag::Edge::BackBottomEdge, vertexIndices.data(), quadLabels.data()))
-    {
-      if(quadLabels[0] == MMSurfaceNet::Padding || quadLabels[1] == MMSurfaceNet::Padding)
-      {
-        for(auto& vertIndex : vertexIndices)
-        {
-          if(nodeTypes[static_cast<usize>(vertIndex)] < 10)
-          {
-            nodeTypes[static_cast<usize>(vertIndex)] += 10;
-          }
-          else
-          {
-            nodeTypes[static_cast<usize>(vertIndex)] += 1;
-          }
-        }
-      }
-      triangleCount += 2;
-    }
-    if(cellMapPtr->getEdgeQuad(idxVtx, MMCellFlag::Edge::LeftBottomEdge, vertexIndices.data(), quadLabels.data()))
-    {
-      if(quadLabels[0] == MMSurfaceNet::Padding || quadLabels[1] == MMSurfaceNet::Padding)
-      {
-        for(auto& vertIndex : vertexIndices)
-        {
-          if(nodeTypes[static_cast<usize>(vertIndex)] < 10)
-          {
-            nodeTypes[static_cast<usize>(vertIndex)] += 10;
-          }
-          else
-          {
-            nodeTypes[static_cast<usize>(vertIndex)] += 1;
-          }
-        }
-      }
-      triangleCount += 2;
-    }
-    if(cellMapPtr->getEdgeQuad(idxVtx, MMCellFlag::Edge::LeftBackEdge, vertexIndices.data(), quadLabels.data()))
-    {
-      if(quadLabels[0] == MMSurfaceNet::Padding || quadLabels[1] == MMSurfaceNet::Padding)
-      {
-        for(auto& vertIndex : vertexIndices)
-        {
-          if(nodeTypes[static_cast<usize>(vertIndex)] < 10)
-          {
-            nodeTypes[static_cast<usize>(vertIndex)] += 10;
-          }
-          else
-          {
-            nodeTypes[static_cast<usize>(vertIndex)] += 1;
-          }
-        }
-      }
-      triangleCount += 2;
-    }
+    const usize numTriangles = faceOffset;
+    faceOffset = triangleCount;
+    triangleCount += numTriangles;
   }
+
   triangleGeom.resizeFaceList(triangleCount);
   triangleGeom.getFaceAttributeMatrix()->resizeTuples({triangleCount});
 
   // Resize the face labels Int32Array
-  auto& faceLabels = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FaceLabelsDataPath)->getDataStoreRef();
+  auto& faceLabelsArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FaceLabelsDataPath);
+  auto& faceLabels = faceLabelsArray.getDataStoreRef();
   faceLabels.resizeTuples({triangleCount});
 
   // Create a vector of TupleTransferFunctions for each of the Triangle Face to VertexType Data Arrays
   std::vector<std::shared_ptr<AbstractTupleTransfer>> tupleTransferFunctions;
+  IParallelAlgorithm::AlgorithmArrays algArrays = {triangleGeom.getFaces(), &faceLabelsArray};
   for(size_t i = 0; i < m_InputValues->SelectedDataArrayPaths.size(); i++)
   {
     // Associate these arrays with the Triangle Face Data.
     ::AddTupleTransferInstance(m_DataStructure, m_InputValues->SelectedDataArrayPaths[i], m_InputValues->CreatedDataArrayPaths[i], tupleTransferFunctions);
+    algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->SelectedDataArrayPaths[i]));
+    algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->CreatedDataArrayPaths[i]));
   }
 
-  usize faceIndex = 0;
-  //   Create temporary storage for cell quads which are constructed around edges
-  //   crossed by the surface. Handle 3 edges per cell. The other 9 cell edges will
-  //   be handled when neighboring cells that share edges with this cell are visited.
-  std::array<usize, 3> t1 = {0, 0, 0};
-  std::array<usize, 3> t2 = {0, 0, 0};
-  std::array<int, 6> triangleVtxIDs = {0, 0, 0, 0, 0, 0};
-  std::array<int32, 4> vertexIndices = {0, 0, 0, 0};
-  std::array<LabelType, 2> quadLabels = {0, 0};
-  std::array<VertexData, 4> vData{};
-  for(int idxVtx = 0; idxVtx < nodeCount; idxVtx++)
-  {
-
-    // Back-bottom edge
-    if(cellMapPtr->getEdgeQuad(idxVtx, MMCellFlag::Edge::BackBottomEdge, vertexIndices.data(), quadLabels.data()))
-    {
-      vData[0] = {vertexIndices[0], 00.0f, 0.0f, 0.0f};
-      vData[1] = {vertexIndices[1], 00.0f, 0.0f, 0.0f};
-      vData[2] = {vertexIndices[2], 00.0f, 0.0f, 0.0f};
-      vData[3] = {vertexIndices[3], 00.0f, 0.0f, 0.0f};
-
-      const bool isQuadFrontFacing = (quadLabels[0] < quadLabels[1]);
-      if(quadLabels[0] == MMSurfaceNet::Padding)
-      {
-        quadLabels[0] = 0;
-      }
-      if(quadLabels[1] == MMSurfaceNet::Padding)
-      {
-        quadLabels[1] = 0;
-      }
-
-      getQuadTriangleIDs(vData, isQuadFrontFacing, triangleVtxIDs);
-      t1 = {static_cast<usize>(triangleVtxIDs[0]), static_cast<usize>(triangleVtxIDs[1]), static_cast<usize>(triangleVtxIDs[2])};
-      t2 = {static_cast<usize>(triangleVtxIDs[3]), static_cast<usize>(triangleVtxIDs[4]), static_cast<usize>(triangleVtxIDs[5])};
-
-      triangleGeom.setFacePointIds(faceIndex, t1);
-      if(quadLabels[0] < quadLabels[1])
-      {
-        faceLabels[faceIndex * 2] = quadLabels[0];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[1];
-      }
-      else
-      {
-        faceLabels[faceIndex * 2] = quadLabels[1];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[0];
-      }
-      // Copy any Cell Data to the Triangle Mesh
-      for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-      {
-        tupleTransferFunctions[dataVectorIndex]->transfer(faceIndex, quadLabels[0], quadLabels[1], faceLabels);
-      }
-
-      faceIndex++;
-
-      triangleGeom.setFacePointIds(faceIndex, t2);
-      if(quadLabels[0] < quadLabels[1])
-      {
-        faceLabels[faceIndex * 2] = quadLabels[0];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[1];
-      }
-      else
-      {
-        faceLabels[faceIndex * 2] = quadLabels[1];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[0];
-      }
-      // Copy any Cell Data to the Triangle Mesh
-      for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-      {
-        tupleTransferFunctions[dataVectorIndex]->transfer(faceIndex, quadLabels[0], quadLabels[1], faceLabels);
-      }
-      faceIndex++;
-    }
-
-    // Left-bottom edge
-    if(cellMapPtr->getEdgeQuad(idxVtx, MMCellFlag::Edge::LeftBottomEdge, vertexIndices.data(), quadLabels.data()))
-    {
-      vData[0] = {vertexIndices[0], 00.0f, 0.0f, 0.0f};
-      vData[1] = {vertexIndices[1], 00.0f, 0.0f, 0.0f};
-      vData[2] = {vertexIndices[2], 00.0f, 0.0f, 0.0f};
-      vData[3] = {vertexIndices[3], 00.0f, 0.0f, 0.0f};
-
-      const bool isQuadFrontFacing = (quadLabels[0] < quadLabels[1]); ///
-      if(quadLabels[0] == MMSurfaceNet::Padding)
-      {
-        quadLabels[0] = 0;
-      }
-      if(quadLabels[1] == MMSurfaceNet::Padding)
-      {
-        quadLabels[1] = 0;
-      }
-      getQuadTriangleIDs(vData, isQuadFrontFacing, triangleVtxIDs);
-      t1 = {static_cast<usize>(triangleVtxIDs[0]), static_cast<usize>(triangleVtxIDs[1]), static_cast<usize>(triangleVtxIDs[2])};
-      t2 = {static_cast<usize>(triangleVtxIDs[3]), static_cast<usize>(triangleVtxIDs[4]), static_cast<usize>(triangleVtxIDs[5])};
-
-      triangleGeom.setFacePointIds(faceIndex, t1);
-      if(quadLabels[0] < quadLabels[1])
-      {
-        faceLabels[faceIndex * 2] = quadLabels[0];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[1];
-      }
-      else
-      {
-        faceLabels[faceIndex * 2] = quadLabels[1];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[0];
-      }
-      // Copy any Cell Data to the Triangle Mesh
-      for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-      {
-        tupleTransferFunctions[dataVectorIndex]->transfer(faceIndex, quadLabels[0], quadLabels[1], faceLabels);
-      }
-      faceIndex++;
-
-      triangleGeom.setFacePointIds(faceIndex, t2);
-      if(quadLabels[0] < quadLabels[1])
-      {
-        faceLabels[faceIndex * 2] = quadLabels[0];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[1];
-      }
-      else
-      {
-        faceLabels[faceIndex * 2] = quadLabels[1];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[0];
-      }
-      // Copy any Cell Data to the Triangle Mesh
-      for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-      {
-        tupleTransferFunctions[dataVectorIndex]->transfer(faceIndex, quadLabels[0], quadLabels[1], faceLabels);
-      }
-      faceIndex++;
-    }
-
-    // Left-back edge
-    if(cellMapPtr->getEdgeQuad(idxVtx, MMCellFlag::Edge::LeftBackEdge, vertexIndices.data(), quadLabels.data()))
-    {
-      vData[0] = {vertexIndices[0], 00.0f, 0.0f, 0.0f};
-      vData[1] = {vertexIndices[1], 00.0f, 0.0f, 0.0f};
-      vData[2] = {vertexIndices[2], 00.0f, 0.0f, 0.0f};
-      vData[3] = {vertexIndices[3], 00.0f, 0.0f, 0.0f};
-
-      const bool isQuadFrontFacing = (quadLabels[0] < quadLabels[1]);
-      if(quadLabels[0] == MMSurfaceNet::Padding)
-      {
-        quadLabels[0] = 0;
-      }
-      if(quadLabels[1] == MMSurfaceNet::Padding)
-      {
-        quadLabels[1] = 0;
-      }
-      getQuadTriangleIDs(vData, isQuadFrontFacing, triangleVtxIDs);
-      t1 = {static_cast<usize>(triangleVtxIDs[0]), static_cast<usize>(triangleVtxIDs[1]), static_cast<usize>(triangleVtxIDs[2])};
-      t2 = {static_cast<usize>(triangleVtxIDs[3]), static_cast<usize>(triangleVtxIDs[4]), static_cast<usize>(triangleVtxIDs[5])};
-
-      triangleGeom.setFacePointIds(faceIndex, t1);
-      if(quadLabels[0] < quadLabels[1])
-      {
-        faceLabels[faceIndex * 2] = quadLabels[0];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[1];
-      }
-      else
-      {
-        faceLabels[faceIndex * 2] = quadLabels[1];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[0];
-      }
-      // Copy any Cell Data to the Triangle Mesh
-      for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-      {
-        tupleTransferFunctions[dataVectorIndex]->transfer(faceIndex, quadLabels[0], quadLabels[1], faceLabels);
-      }
-      faceIndex++;
-
-      triangleGeom.setFacePointIds(faceIndex, t2);
-      if(quadLabels[0] < quadLabels[1])
-      {
-        faceLabels[faceIndex * 2] = quadLabels[0];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[1];
-      }
-      else
-      {
-        faceLabels[faceIndex * 2] = quadLabels[1];
-        faceLabels[faceIndex * 2 + 1] = quadLabels[0];
-      }
-      // Copy any Cell Data to the Triangle Mesh
-      for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-      {
-        tupleTransferFunctions[dataVectorIndex]->transfer(faceIndex, quadLabels[0], quadLabels[1], faceLabels);
-      }
-      faceIndex++;
-    }
-  }
+  // Create the cell quads which are constructed around edges crossed by the surface
+  ParallelDataAlgorithm triangleAlg;
+  triangleAlg.setRange(0, static_cast<usize>(nodeCount));
+  triangleAlg.requireArraysInMemory(algArrays);
+  triangleAlg.execute(CreateTrianglesImpl(cellMapPtr, faceOffsets, triangleGeom.getFaces()->getDataStoreRef(), faceLabels, tupleTransferFunctions));
 
   return {};
 }
@@ -20,6 +20,7 @@ struct SIMPLNXCORE_EXPORT SurfaceNetsInputValues
   int32 SmoothingIterations;
   float32 MaxDistanceFromVoxel;
   float32 RelaxationFactor;
+  bool UseJacobiRelaxation;
 
   DataPath GridGeomDataPath;
   DataPath FeatureIdsArrayPath;
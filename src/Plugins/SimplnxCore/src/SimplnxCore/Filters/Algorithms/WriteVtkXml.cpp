@@ -0,0 +1,642 @@
+#include "WriteVtkXml.hpp"
+
+#include "simplnx/Common/Bit.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/Geometry/INodeGeometry0D.hpp"
+#include "simplnx/DataStructure/Geometry/INodeGeometry1D.hpp"
+#include "simplnx/DataStructure/Geometry/INodeGeometry2D.hpp"
+#include "simplnx/DataStructure/Geometry/INodeGeometry3D.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/DataStructure/Geometry/RectGridGeom.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include "SimplnxCore/utils/VtkUtilities.hpp"
+
+#include <zlib.h>
+
+#include <fstream>
+#include <functional>
+
+using namespace nx::core;
+
+namespace
+{
+// Uncompressed size of a single zlib block. VTK's own writer uses 32 KiB, but larger blocks give the
+// compressor more context and keep the per-block header overhead negligible for very large arrays.
+constexpr usize k_CompressionBlockBytes = 1048576;
+
+// VTK cell type identifiers (vtkCellType.h)
+constexpr uint8 k_VtkVertex = 1;
+constexpr uint8 k_VtkLine = 3;
+constexpr uint8 k_VtkTriangle = 5;
+constexpr uint8 k_VtkQuad = 9;
+constexpr uint8 k_VtkTetra = 10;
+constexpr uint8 k_VtkHexahedron = 12;
+
+// -----------------------------------------------------------------------------
+std::string EscapeXml(const std::string& value)
+{
+  std::string escaped;
+  escaped.reserve(value.size());
+  for(char character : value)
+  {
+    switch(character)
+    {
+    case '&':
+      escaped.append("&amp;");
+      break;
+    case '<':
+      escaped.append("&lt;");
+      break;
+    case '>':
+      escaped.append("&gt;");
+      break;
+    case '"':
+      escaped.append("&quot;");
+      break;
+    default:
+      escaped.push_back(character);
+    }
+  }
+  return escaped;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+std::string VtkXmlTypeName()
+{
+  if constexpr(std::is_same_v<T, int8>)
+  {
+    return "Int8";
+  }
+  else if constexpr(std::is_same_v<T, uint8> || std::is_same_v<T, bool>)
+  {
+    return "UInt8";
+  }
+  else if constexpr(std::is_same_v<T, int16>)
+  {
+    return "Int16";
+  }
+  else if constexpr(std::is_same_v<T, uint16>)
+  {
+    return "UInt16";
+  }
+  else if constexpr(std::is_same_v<T, int32>)
+  {
+    return "Int32";
+  }
+  else if constexpr(std::is_same_v<T, uint32>)
+  {
+    return "UInt32";
+  }
+  else if constexpr(std::is_same_v<T, int64>)
+  {
+    return "Int64";
+  }
+  else if constexpr(std::is_same_v<T, uint64>)
+  {
+    return "UInt64";
+  }
+  else if constexpr(std::is_same_v<T, float32>)
+  {
+    return "Float32";
+  }
+  else if constexpr(std::is_same_v<T, float64>)
+  {
+    return "Float64";
+  }
+  else
+  {
+    static_assert(dependent_false<T>, "VtkXmlTypeName: Unsupported type");
+  }
+}
+
+/**
+ * @brief One <DataArray> of the output file. Implementations copy a range of their values, already in
+ * the file's byte layout, into a destination buffer. fill() must be safe to call concurrently for
+ * disjoint ranges when isInMemory() returns true.
+ */
+class IVtkXmlArray
+{
+public:
+  IVtkXmlArray(std::string name, std::string vtkType, usize numComponents, usize numValues, usize valueSize)
+  : m_Name(std::move(name))
+  , m_VtkType(std::move(vtkType))
+  , m_NumComponents(numComponents)
+  , m_NumValues(numValues)
+  , m_ValueSize(valueSize)
+  {
+  }
+  virtual ~IVtkXmlArray() = default;
+
+  IVtkXmlArray(const IVtkXmlArray&) = delete;
+  IVtkXmlArray(IVtkXmlArray&&) noexcept = delete;
+  IVtkXmlArray& operator=(const IVtkXmlArray&) = delete;
+  IVtkXmlArray& operator=(IVtkXmlArray&&) noexcept = delete;
+
+  virtual void fill(char* dest, usize start, usize count) const = 0;
+  virtual bool isInMemory() const = 0;
+
+  const std::string& name() const
+  {
+    return m_Name;
+  }
+  const std::string& vtkType() const
+  {
+    return m_VtkType;
+  }
+  usize numComponents() const
+  {
+    return m_NumComponents;
+  }
+  usize numValues() const
+  {
+    return m_NumValues;
+  }
+  usize valueSize() const
+  {
+    return m_ValueSize;
+  }
+  uint64 numBytes() const
+  {
+    return static_cast<uint64>(m_NumValues) * m_ValueSize;
+  }
+
+private:
+  std::string m_Name;
+  std::string m_VtkType;
+  usize m_NumComponents = 1;
+  usize m_NumValues = 0;
+  usize m_ValueSize = 1;
+};
+
+/**
+ * @brief Exposes a data store as a VTK data array. Values are written in native byte order which is
+ * declared in the file header.
+ */
+template <typename T>
+class DataStoreXmlArray : public IVtkXmlArray
+{
+public:
+  DataStoreXmlArray(const AbstractDataStore<T>& dataStore, const std::string& name, const std::string& vtkType)
+  : IVtkXmlArray(name, vtkType, dataStore.getNumberOfComponents(), dataStore.getSize(), sizeof(T))
+  , m_DataStore(dataStore)
+  {
+  }
+  ~DataStoreXmlArray() override = default;
+
+  void fill(char* dest, usize start, usize count) const override
+  {
+    CopyBinaryValuesImpl<T>(m_DataStore, reinterpret_cast<T*>(dest), start, false)(Range(0, count));
+  }
+
+  bool isInMemory() const override
+  {
+    return m_DataStore.getDataFormat().empty();
+  }
+
+private:
+  const AbstractDataStore<T>& m_DataStore;
+};
+
+/**
+ * @brief A VTK data array whose values are computed from their index (cell offsets, cell types,
+ * implicit connectivity, etc.)
+ */
+template <typename T>
+class GeneratedXmlArray : public IVtkXmlArray
+{
+public:
+  using GeneratorType = std::function<T(usize)>;
+
+  GeneratedXmlArray(const std::string& name, usize numComponents, usize numValues, GeneratorType generator)
+  : IVtkXmlArray(name, VtkXmlTypeName<T>(), numComponents, numValues, sizeof(T))
+  , m_Generator(std::move(generator))
+  {
+  }
+  ~GeneratedXmlArray() override = default;
+
+  void fill(char* dest, usize start, usize count) const override
+  {
+    T* values = reinterpret_cast<T*>(dest);
+    for(usize i = 0; i < count; i++)
+    {
+      values[i] = m_Generator(start + i);
+    }
+  }
+
+  bool isInMemory() const override
+  {
+    return true;
+  }
+
+private:
+  GeneratorType m_Generator;
+};
+
+struct AddDataStoreXmlArray
+{
+  template <typename T>
+  void operator()(std::vector<std::unique_ptr<IVtkXmlArray>>& arrays, const IDataArray& dataArray)
+  {
+    const auto& dataStore = dataArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    arrays.push_back(std::make_unique<DataStoreXmlArray<T>>(dataStore, dataArray.getName(), VtkXmlTypeName<T>()));
+  }
+};
+
+// -----------------------------------------------------------------------------
+class FillValuesImpl
+{
+public:
+  FillValuesImpl(const IVtkXmlArray& array, char* dest, usize start)
+  : m_Array(array)
+  , m_Dest(dest)
+  , m_Start(start)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    m_Array.fill(m_Dest + range.min() * m_Array.valueSize(), m_Start + range.min(), range.size());
+  }
+
+private:
+  const IVtkXmlArray& m_Array;
+  char* m_Dest = nullptr;
+  usize m_Start = 0;
+};
+
+/**
+ * @brief The zlib compressed representation of one array: the VTK compression header followed by
+ * the independently compressed blocks.
+ */
+struct CompressedXmlArray
+{
+  std::vector<uint64> Header;
+  std::vector<std::vector<uint8>> Blocks;
+
+  uint64 numBytes() const
+  {
+    uint64 total = Header.size() * sizeof(uint64);
+    for(const auto& block : Blocks)
+    {
+      total += block.size();
+    }
+    return total;
+  }
+};
+
+// -----------------------------------------------------------------------------
+class CompressBlocksImpl
+{
+public:
+  CompressBlocksImpl(const IVtkXmlArray& array, CompressedXmlArray& compressed, usize valuesPerBlock, std::atomic_bool& failed)
+  : m_Array(array)
+  , m_Compressed(compressed)
+  , m_ValuesPerBlock(valuesPerBlock)
+  , m_Failed(failed)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<char> uncompressed(m_ValuesPerBlock * m_Array.valueSize());
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      const usize start = block * m_ValuesPerBlock;
+      const usize count = std::min(m_ValuesPerBlock, m_Array.numValues() - start);
+      const usize numBytes = count * m_Array.valueSize();
+      m_Array.fill(uncompressed.data(), start, count);
+
+      std::vector<uint8>& output = m_Compressed.Blocks[block];
+      uLongf compressedSize = compressBound(static_cast<uLong>(numBytes));
+      output.resize(compressedSize);
+      if(compress2(output.data(), &compressedSize, reinterpret_cast<const Bytef*>(uncompressed.data()), static_cast<uLong>(numBytes), Z_DEFAULT_COMPRESSION) != Z_OK)
+      {
+        m_Failed = true;
+        return;
+      }
+      output.resize(compressedSize);
+      m_Compressed.Header[3 + block] = compressedSize;
+    }
+  }
+
+private:
+  const IVtkXmlArray& m_Array;
+  CompressedXmlArray& m_Compressed;
+  usize m_ValuesPerBlock = 1;
+  std::atomic_bool& m_Failed;
+};
+
+// -----------------------------------------------------------------------------
+bool CompressArray(const IVtkXmlArray& array, CompressedXmlArray& compressed)
+{
+  const usize valuesPerBlock = std::max(k_CompressionBlockBytes / array.valueSize(), usize{1});
+  const usize blockBytes = valuesPerBlock * array.valueSize();
+  const usize numBlocks = (array.numValues() + valuesPerBlock - 1) / valuesPerBlock;
+  const usize lastBlockBytes = (array.numValues() % valuesPerBlock) * array.valueSize();
+
+  compressed.Header.assign(3 + numBlocks, 0);
+  compressed.Header[0] = numBlocks;
+  compressed.Header[1] = blockBytes;
+  compressed.Header[2] = lastBlockBytes;
+  compressed.Blocks.resize(numBlocks);
+
+  std::atomic_bool failed = false;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.setParallelizationEnabled(array.isInMemory());
+  dataAlg.execute(CompressBlocksImpl(array, compressed, valuesPerBlock, failed));
+  return !failed;
+}
+
+// -----------------------------------------------------------------------------
+void WriteDataArrayTag(std::ostream& outStrm, const IVtkXmlArray& array, uint64 offset, const std::string& indent)
+{
+  outStrm << fmt::format("{}<DataArray type=\"{}\" Name=\"{}\" NumberOfComponents=\"{}\" format=\"appended\" offset=\"{}\"/>\n", indent, array.vtkType(), EscapeXml(array.name()),
+                         array.numComponents(), offset);
+}
+
+/**
+ * @brief Collects the arrays of the file by section (PointData, CellData, Points/Coordinates, Cells)
+ * in the order they are declared, which is also the order of the appended data.
+ */
+struct VtkXmlLayout
+{
+  std::vector<std::unique_ptr<IVtkXmlArray>> PointData;
+  std::vector<std::unique_ptr<IVtkXmlArray>> CellData;
+  std::vector<std::unique_ptr<IVtkXmlArray>> Geometry;
+  std::vector<std::unique_ptr<IVtkXmlArray>> Cells;
+
+  std::vector<const IVtkXmlArray*> allArrays() const
+  {
+    std::vector<const IVtkXmlArray*> arrays;
+    for(const auto* section : {&PointData, &CellData, &Geometry, &Cells})
+    {
+      for(const auto& array : *section)
+      {
+        arrays.push_back(array.get());
+      }
+    }
+    return arrays;
+  }
+};
+
+// -----------------------------------------------------------------------------
+void AddSelectedArrays(const DataStructure& dataStructure, const std::vector<DataPath>& arrayPaths, std::vector<std::unique_ptr<IVtkXmlArray>>& arrays)
+{
+  for(const auto& arrayPath : arrayPaths)
+  {
+    const auto& dataArray = dataStructure.getDataRefAs<IDataArray>(arrayPath);
+    ExecuteDataFunction(AddDataStoreXmlArray{}, dataArray.getDataType(), arrays, dataArray);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void AddUnstructuredCells(const IGeometry& geometry, VtkXmlLayout& layout)
+{
+  const IGeometry::Type geomType = geometry.getGeomType();
+  const IGeometry::MeshIndexArrayType* connectivity = nullptr;
+  usize vertsPerCell = 1;
+  uint8 vtkCellType = k_VtkVertex;
+
+  switch(geomType)
+  {
+  case IGeometry::Type::Vertex:
+    break;
+  case IGeometry::Type::Edge:
+    connectivity = dynamic_cast<const INodeGeometry1D&>(geometry).getEdges();
+    vertsPerCell = 2;
+    vtkCellType = k_VtkLine;
+    break;
+  case IGeometry::Type::Triangle:
+  case IGeometry::Type::Quad: {
+    const auto& geom2D = dynamic_cast<const INodeGeometry2D&>(geometry);
+    connectivity = geom2D.getFaces();
+    vertsPerCell = geom2D.getNumberOfVerticesPerFace();
+    vtkCellType = geomType == IGeometry::Type::Triangle ? k_VtkTriangle : k_VtkQuad;
+    break;
+  }
+  case IGeometry::Type::Tetrahedral:
+  case IGeometry::Type::Hexahedral: {
+    const auto& geom3D = dynamic_cast<const INodeGeometry3D&>(geometry);
+    connectivity = geom3D.getPolyhedra();
+    vertsPerCell = geom3D.getNumberOfVerticesPerCell();
+    vtkCellType = geomType == IGeometry::Type::Tetrahedral ? k_VtkTetra : k_VtkHexahedron;
+    break;
+  }
+  default:
+    break;
+  }
+
+  const usize numCells = geometry.getNumberOfCells();
+  if(connectivity != nullptr)
+  {
+    // Vertex indices are far below 2^63 so the unsigned indices can be declared as Int64 as-is
+    layout.Cells.push_back(std::make_unique<DataStoreXmlArray<uint64>>(connectivity->getDataStoreRef(), "connectivity", "Int64"));
+  }
+  else
+  {
+    layout.Cells.push_back(std::make_unique<GeneratedXmlArray<int64>>("connectivity", 1, numCells, [](usize index) { return static_cast<int64>(index); }));
+  }
+  layout.Cells.push_back(std::make_unique<GeneratedXmlArray<int64>>("offsets", 1, numCells, [vertsPerCell](usize index) { return static_cast<int64>((index + 1) * vertsPerCell); }));
+  layout.Cells.push_back(std::make_unique<GeneratedXmlArray<uint8>>("types", 1, numCells, [vtkCellType](usize) { return vtkCellType; }));
+}
+
+// -----------------------------------------------------------------------------
+std::string ExtentString(const SizeVec3& dims)
+{
+  return fmt::format("0 {} 0 {} 0 {}", dims[0], dims[1], dims[2]);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+WriteVtkXml::WriteVtkXml(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, WriteVtkXmlInputValues* inputValues)
+: m_DataStructure(dataStructure)
+, m_InputValues(inputValues)
+, m_ShouldCancel(shouldCancel)
+, m_MessageHandler(mesgHandler)
+{
+}
+
+// -----------------------------------------------------------------------------
+WriteVtkXml::~WriteVtkXml() noexcept = default;
+
+// -----------------------------------------------------------------------------
+const std::atomic_bool& WriteVtkXml::getCancel()
+{
+  return m_ShouldCancel;
+}
+
+// -----------------------------------------------------------------------------
+std::string WriteVtkXml::FileExtensionForGeometry(IGeometry::Type geomType)
+{
+  switch(geomType)
+  {
+  case IGeometry::Type::Image:
+    return ".vti";
+  case IGeometry::Type::RectGrid:
+    return ".vtr";
+  default:
+    return ".vtu";
+  }
+}
+
+// -----------------------------------------------------------------------------
+Result<> WriteVtkXml::operator()()
+{
+  const auto& geometry = m_DataStructure.getDataRefAs<IGeometry>(m_InputValues->InputGeometryPath);
+  const IGeometry::Type geomType = geometry.getGeomType();
+
+  VtkXmlLayout layout;
+  AddSelectedArrays(m_DataStructure, m_InputValues->CellDataArrayPaths, layout.CellData);
+  AddSelectedArrays(m_DataStructure, m_InputValues->PointDataArrayPaths, layout.PointData);
+
+  std::string datasetType;
+  std::string datasetAttributes;
+  std::string pieceAttributes;
+  if(geomType == IGeometry::Type::Image)
+  {
+    const auto& imageGeom = dynamic_cast<const ImageGeom&>(geometry);
+    const FloatVec3 origin = imageGeom.getOrigin();
+    const FloatVec3 spacing = imageGeom.getSpacing();
+    datasetType = "ImageData";
+    datasetAttributes = fmt::format(" WholeExtent=\"{}\" Origin=\"{} {} {}\" Spacing=\"{} {} {}\"", ExtentString(imageGeom.getDimensions()), origin[0], origin[1], origin[2], spacing[0], spacing[1],
+                                    spacing[2]);
+    pieceAttributes = fmt::format(" Extent=\"{}\"", ExtentString(imageGeom.getDimensions()));
+  }
+  else if(geomType == IGeometry::Type::RectGrid)
+  {
+    const auto& rectGridGeom = dynamic_cast<const RectGridGeom&>(geometry);
+    datasetType = "RectilinearGrid";
+    datasetAttributes = fmt::format(" WholeExtent=\"{}\"", ExtentString(rectGridGeom.getDimensions()));
+    pieceAttributes = fmt::format(" Extent=\"{}\"", ExtentString(rectGridGeom.getDimensions()));
+    layout.Geometry.push_back(std::make_unique<DataStoreXmlArray<float32>>(rectGridGeom.getXBoundsRef().getDataStoreRef(), "x_coordinates", "Float32"));
+    layout.Geometry.push_back(std::make_unique<DataStoreXmlArray<float32>>(rectGridGeom.getYBoundsRef().getDataStoreRef(), "y_coordinates", "Float32"));
+    layout.Geometry.push_back(std::make_unique<DataStoreXmlArray<float32>>(rectGridGeom.getZBoundsRef().getDataStoreRef(), "z_coordinates", "Float32"));
+  }
+  else
+  {
+    const auto& nodeGeom = dynamic_cast<const INodeGeometry0D&>(geometry);
+    datasetType = "UnstructuredGrid";
+    pieceAttributes = fmt::format(" NumberOfPoints=\"{}\" NumberOfCells=\"{}\"", nodeGeom.getNumberOfVertices(), nodeGeom.getNumberOfCells());
+    layout.Geometry.push_back(std::make_unique<DataStoreXmlArray<float32>>(nodeGeom.getVerticesRef().getDataStoreRef(), "Points", "Float32"));
+    AddUnstructuredCells(geometry, layout);
+  }
+
+  const std::vector<const IVtkXmlArray*> allArrays = layout.allArrays();
+  const bool compress = m_InputValues->CompressData;
+
+  // When compressing, the block sizes are only known after encoding so every array is compressed
+  // up front. Raw arrays are streamed straight from their data stores while writing.
+  std::vector<CompressedXmlArray> compressedArrays(compress ? allArrays.size() : 0);
+  std::vector<uint64> offsets(allArrays.size(), 0);
+  uint64 currentOffset = 0;
+  for(usize index = 0; index < allArrays.size(); index++)
+  {
+    offsets[index] = currentOffset;
+    if(compress)
+    {
+      m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Compressing '{}'", allArrays[index]->name()));
+      if(!CompressArray(*allArrays[index], compressedArrays[index]))
+      {
+        return MakeErrorResult(-2100, fmt::format("zlib failed to compress array '{}'", allArrays[index]->name()));
+      }
+      currentOffset += compressedArrays[index].numBytes();
+    }
+    else
+    {
+      currentOffset += sizeof(uint64) + allArrays[index]->numBytes();
+    }
+    if(m_ShouldCancel)
+    {
+      return {};
+    }
+  }
+
+  std::ofstream outStrm(m_InputValues->OutputFile, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if(!outStrm.is_open())
+  {
+    return MakeErrorResult(-2101, fmt::format("Output file could not be opened for writing: '{}'", m_InputValues->OutputFile.string()));
+  }
+
+  const std::string byteOrder = endian::native == endian::little ? "LittleEndian" : "BigEndian";
+  outStrm << "<?xml version=\"1.0\"?>\n";
+  outStrm << fmt::format("<VTKFile type=\"{}\" version=\"1.0\" byte_order=\"{}\" header_type=\"UInt64\"{}>\n", datasetType, byteOrder, compress ? " compressor=\"vtkZLibDataCompressor\"" : "");
+  outStrm << fmt::format("  <{}{}>\n", datasetType, datasetAttributes);
+  outStrm << fmt::format("    <Piece{}>\n", pieceAttributes);
+
+  usize arrayIndex = 0;
+  auto writeSection = [&](const std::string& sectionName, const std::vector<std::unique_ptr<IVtkXmlArray>>& arrays) {
+    outStrm << fmt::format("      <{}>\n", sectionName);
+    for(const auto& array : arrays)
+    {
+      WriteDataArrayTag(outStrm, *array, offsets[arrayIndex], "        ");
+      arrayIndex++;
+    }
+    outStrm << fmt::format("      </{}>\n", sectionName);
+  };
+  writeSection("PointData", layout.PointData);
+  writeSection("CellData", layout.CellData);
+  if(geomType == IGeometry::Type::RectGrid)
+  {
+    writeSection("Coordinates", layout.Geometry);
+  }
+  else if(geomType != IGeometry::Type::Image)
+  {
+    writeSection("Points", layout.Geometry);
+    writeSection("Cells", layout.Cells);
+  }
+
+  outStrm << "    </Piece>\n";
+  outStrm << fmt::format("  </{}>\n", datasetType);
+  outStrm << "  <AppendedData encoding=\"raw\">\n";
+  outStrm << "   _";
+
+  std::vector<char> chunk;
+  for(usize index = 0; index < allArrays.size(); index++)
+  {
+    const IVtkXmlArray& array = *allArrays[index];
+    m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Writing '{}'", array.name()));
+    if(compress)
+    {
+      const CompressedXmlArray& compressed = compressedArrays[index];
+      outStrm.write(reinterpret_cast<const char*>(compressed.Header.data()), static_cast<std::streamsize>(compressed.Header.size() * sizeof(uint64)));
+      for(const auto& block : compressed.Blocks)
+      {
+        outStrm.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(block.size()));
+      }
+    }
+    else
+    {
+      const uint64 numBytes = array.numBytes();
+      outStrm.write(reinterpret_cast<const char*>(&numBytes), sizeof(uint64));
+
+      const usize chunkValues = std::max(k_BinaryChunkBytes / array.valueSize(), usize{1});
+      chunk.resize(std::min(chunkValues, array.numValues()) * array.valueSize());
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setParallelizationEnabled(array.isInMemory());
+      for(usize start = 0; start < array.numValues(); start += chunkValues)
+      {
+        const usize count = std::min(chunkValues, array.numValues() - start);
+        dataAlg.setRange(0, count);
+        dataAlg.execute(FillValuesImpl(array, chunk.data(), start));
+        outStrm.write(chunk.data(), static_cast<std::streamsize>(count * array.valueSize()));
+        if(m_ShouldCancel)
+        {
+          return {};
+        }
+      }
+    }
+    if(outStrm.bad())
+    {
+      return MakeErrorResult(-2102, fmt::format("Error writing array '{}' to '{}'", array.name(), m_InputValues->OutputFile.string()));
+    }
+  }
+
+  outStrm << "\n  </AppendedData>\n";
+  outStrm << "</VTKFile>\n";
+
+  return {};
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "SimplnxCore/SimplnxCore_export.hpp"
+
+#include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/Geometry/IGeometry.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Parameters/FileSystemPathParameter.hpp"
+#include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
+
+namespace nx::core
+{
+
+struct SIMPLNXCORE_EXPORT WriteVtkXmlInputValues
+{
+  FileSystemPathParameter::ValueType OutputFile;
+  bool CompressData;
+  DataPath InputGeometryPath;
+  MultiArraySelectionParameter::ValueType CellDataArrayPaths;
+  MultiArraySelectionParameter::ValueType PointDataArrayPaths;
+};
+
+/**
+ * @class WriteVtkXml
+ * @brief Writes a geometry and its selected arrays as a VTK XML file (.vti, .vtr or .vtu). All
+ * heavy data goes into a single raw appended data section, optionally zlib compressed.
+ */
+class SIMPLNXCORE_EXPORT WriteVtkXml
+{
+public:
+  WriteVtkXml(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, WriteVtkXmlInputValues* inputValues);
+  ~WriteVtkXml() noexcept;
+
+  WriteVtkXml(const WriteVtkXml&) = delete;
+  WriteVtkXml(WriteVtkXml&&) noexcept = delete;
+  WriteVtkXml& operator=(const WriteVtkXml&) = delete;
+  WriteVtkXml& operator=(WriteVtkXml&&) noexcept = delete;
+
+  Result<> operator()();
+
+  const std::atomic_bool& getCancel();
+
+  /**
+   * @brief Returns the file extension that VTK expects for the given geometry type
+   * @param geomType The type of the geometry that will be written
+   * @return ".vti", ".vtr" or ".vtu"
+   */
+  static std::string FileExtensionForGeometry(IGeometry::Type geomType);
+
+private:
+  DataStructure& m_DataStructure;
+  const WriteVtkXmlInputValues* m_InputValues = nullptr;
+  const std::atomic_bool& m_ShouldCancel;
+  const IFilter::MessageHandler& m_MessageHandler;
+};
+
+} // namespace nx::core
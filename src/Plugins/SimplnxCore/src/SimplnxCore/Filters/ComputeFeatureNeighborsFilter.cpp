@@ -14,12 +14,141 @@
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
 
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 namespace nx::core
 {
+namespace
+{
+/**
+ * @brief Upper bound on the number of row slabs the image is split into.
+ */
+constexpr usize k_MaxSlabCount = 256;
+
+/**
+ * @brief Smallest number of voxels worth giving its own slab.
+ */
+constexpr usize k_MinVoxelsPerSlab = 16384;
+
+/**
+ * @brief Number of features whose lists are assembled together by one task.
+ */
+constexpr usize k_FeaturesPerBlock = 4096;
+
+/**
+ * @brief Number of faces shared by the feature and neighbor packed in key (feature in the high 32 bits).
+ */
+struct FaceCount
+{
+  uint64 key = 0;
+  uint64 count = 0;
+};
+
+inline uint64 MakeFaceKey(int32 feature, int32 neighbor)
+{
+  return (static_cast<uint64>(static_cast<uint32>(feature)) << 32) | static_cast<uint64>(static_cast<uint32>(neighbor));
+}
+
+inline int32 FaceKeyFeature(uint64 key)
+{
+  return static_cast<int32>(key >> 32);
+}
+
+inline int32 FaceKeyNeighbor(uint64 key)
+{
+  return static_cast<int32>(key & 0xFFFFFFFFULL);
+}
+
+struct FaceCountKeyLess
+{
+  bool operator()(const FaceCount& faceCount, uint64 key) const
+  {
+    return faceCount.key < key;
+  }
+};
+
+/**
+ * @brief Scans the rows [rowBegin, rowEnd) of the image (a row being one x line of a given y and z).
+ * Every face between two different positive features is recorded once per side, from the
+ * cell on its low side, and the recorded faces are reduced to counts sorted by key. The
+ * boundary cell value of every cell in the rows is written and the features touching the
+ * outside of the image are appended to surfaceFeatureIds.
+ */
+void FindSlabFaces(const Int32AbstractDataStore& featureIds, const std::array<int64, 3>& dims, usize rowBegin, usize rowEnd, AbstractDataStore<int8>* boundaryCells, bool findSurfaceFeatures,
+                   std::vector<FaceCount>& faceCounts, std::vector<int32>& surfaceFeatureIds)
+{
+  const int64 sliceSize = dims[0] * dims[1];
+  const std::array<int64, 6> neighPoints = {-sliceSize, -dims[0], -1, 1, dims[0], sliceSize};
+
+  std::vector<uint64> faceKeys;
+  for(usize rowIndex = rowBegin; rowIndex < rowEnd; rowIndex++)
+  {
+    const auto row = static_cast<int64>(rowIndex) % dims[1];
+    const auto plane = static_cast<int64>(rowIndex) / dims[1];
+    for(int64 column = 0; column < dims[0]; column++)
+    {
+      const int64 j = static_cast<int64>(rowIndex) * dims[0] + column;
+      uint8 onsurf = 0;
+      const int32 feature = featureIds.getValue(j);
+      if(feature > 0)
+      {
+        if(findSurfaceFeatures)
+        {
+          bool onImageSurface = column == 0 || column == dims[0] - 1 || row == 0 || row == dims[1] - 1;
+          if(dims[2] != 1)
+          {
+            onImageSurface = onImageSurface || plane == 0 || plane == dims[2] - 1;
+          }
+          if(onImageSurface && (surfaceFeatureIds.empty() || surfaceFeatureIds.back() != feature))
+          {
+            surfaceFeatureIds.push_back(feature);
+          }
+        }
+
+        const std::array<bool, 6> inside = {plane > 0, row > 0, column > 0, column < dims[0] - 1, row < dims[1] - 1, plane < dims[2] - 1};
+        for(usize k = 0; k < neighPoints.size(); k++)
+        {
+          if(!inside[k])
+          {
+            continue;
+          }
+          const int32 neighborFeature = featureIds.getValue(j + neighPoints[k]);
+          if(neighborFeature != feature && neighborFeature > 0)
+          {
+            onsurf++;
+            // +x, +y and +z faces record both sides so that every face is visited once
+            if(k >= 3)
+            {
+              faceKeys.push_back(MakeFaceKey(feature, neighborFeature));
+              faceKeys.push_back(MakeFaceKey(neighborFeature, feature));
+            }
+          }
+        }
+      }
+      if(boundaryCells != nullptr)
+      {
+        boundaryCells->setValue(j, static_cast<int8>(onsurf));
+      }
+    }
+  }
+
+  std::sort(faceKeys.begin(), faceKeys.end());
+  faceCounts.clear();
+  for(uint64 faceKey : faceKeys)
+  {
+    if(faceCounts.empty() || faceCounts.back().key != faceKey)
+    {
+      faceCounts.push_back({faceKey, 0});
+    }
+    faceCounts.back().count++;
+  }
+}
+} // namespace
+
 //------------------------------------------------------------------------------
 std::string ComputeFeatureNeighborsFilter::name() const
 {
@@ -218,7 +347,6 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
 
   auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
   SizeVec3 uDims = imageGeom.getDimensions();
-  const auto imageGeomNumX = imageGeom.getNumXCells();
   const auto imageGeomNumY = imageGeom.getNumYCells();
   const auto imageGeomNumZ = imageGeom.getNumZCells();
 
@@ -228,195 +356,117 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
       static_cast<int64>(uDims[2]),
   };
 
-  std::array<int64, 6> neighPoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
-
-  int64 column = 0;
-  int64 row = 0;
-  int64 plane = 0;
-  int32 feature = 0;
-  int32 nnum = 0;
-  uint8 onsurf = 0;
-  bool good = false;
-  int64 neighbor = 0;
+  const usize numRows = imageGeomNumY * imageGeomNumZ;
+  const usize slabCount = std::max<usize>(std::min({k_MaxSlabCount, totalPoints / k_MinVoxelsPerSlab, numRows}), 1);
+  const usize rowsPerSlab = (numRows + slabCount - 1) / slabCount;
 
-  std::vector<std::vector<int32>> neighborlist(totalFeatures);
-  std::vector<std::vector<float>> neighborsurfacearealist(totalFeatures);
-
-  int32 nListSize = 100;
-
-  float progInt = 0.0F;
-  auto start = std::chrono::steady_clock::now();
-  // Initialize the neighbor lists
-  for(usize i = 1; i < totalFeatures; i++)
+  IParallelAlgorithm::AlgorithmStores requiredStores = {&featureIds};
+  if(boundaryCells != nullptr)
   {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      progInt = static_cast<float>(i) / static_cast<float>(totalFeatures) * 100.0f;
-      std::string message = fmt::format("Initializing Neighbor Lists || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32_t>(progInt)});
-      start = std::chrono::steady_clock::now();
-    }
-
-    if(shouldCancel)
-    {
-      return {};
-    }
-
-    numNeighbors[i] = 0;
-    neighborlist[i].resize(nListSize);
-    neighborsurfacearealist[i].assign(nListSize, -1.0f);
-    if(storeSurfaceFeatures && surfaceFeatures != nullptr)
-    {
-      surfaceFeatures->setValue(i, false);
-    }
+    requiredStores.push_back(boundaryCells);
   }
 
-  progInt = 0.0F;
-  start = std::chrono::steady_clock::now();
-  // Loop over all points to generate the neighbor lists
-  for(usize j = 0; j < totalPoints; j++)
-  {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      progInt = static_cast<float>(j) / static_cast<float>(totalPoints) * 100.0f;
-      std::string message = fmt::format("Determining Neighbor Lists || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32_t>(progInt)});
-      start = std::chrono::steady_clock::now();
-    }
-
-    if(shouldCancel)
-    {
-      return {};
-    }
+  messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Determining Neighbor Lists"});
 
-    onsurf = 0;
-    feature = featureIds[j];
-    if(feature > 0 && feature < neighborlist.size())
+  // Phase 1: every slab of rows collects its feature faces and reduces them to sorted face counts
+  std::vector<std::vector<FaceCount>> slabFaceCounts(slabCount);
+  std::vector<std::vector<int32>> slabSurfaceFeatures(slabCount);
+  ParallelDataAlgorithm slabAlg;
+  slabAlg.setRange(0, slabCount);
+  slabAlg.requireStoresInMemory(requiredStores);
+  slabAlg.execute([&](const Range& range) {
+    for(usize slab = range.min(); slab < range.max(); slab++)
     {
-      column = static_cast<int64>(j % imageGeomNumX);
-      row = static_cast<int64>((j / imageGeomNumX) % imageGeomNumY);
-      plane = static_cast<int64>(j / (imageGeomNumX * imageGeomNumY));
-      if(storeSurfaceFeatures && surfaceFeatures != nullptr)
+      if(shouldCancel)
       {
-        if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY)-1) || plane == 0 ||
-            plane == static_cast<int64>((imageGeomNumZ - 1))) &&
-           imageGeomNumZ != 1)
-        {
-          surfaceFeatures->setValue(feature, true);
-        }
-        if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY - 1))) && imageGeomNumZ == 1)
-        {
-          surfaceFeatures->setValue(feature, true);
-        }
-      }
-      for(size_t k = 0; k < 6; k++)
-      {
-        good = true;
-        neighbor = static_cast<int64>(j + neighPoints[k]);
-        if(k == 0 && plane == 0)
-        {
-          good = false;
-        }
-        if(k == 5 && plane == (imageGeomNumZ - 1))
-        {
-          good = false;
-        }
-        if(k == 1 && row == 0)
-        {
-          good = false;
-        }
-        if(k == 4 && row == (imageGeomNumY - 1))
-        {
-          good = false;
-        }
-        if(k == 2 && column == 0)
-        {
-          good = false;
-        }
-        if(k == 3 && column == (imageGeomNumX - 1))
-        {
-          good = false;
-        }
-        if(good && featureIds[neighbor] != feature && featureIds[neighbor] > 0)
-        {
-          onsurf++;
-          nnum = numNeighbors[feature];
-          neighborlist[feature].push_back(featureIds[neighbor]);
-          nnum++;
-          numNeighbors[feature] = nnum;
-        }
+        return;
       }
+      const usize rowBegin = std::min(slab * rowsPerSlab, numRows);
+      const usize rowEnd = std::min(rowBegin + rowsPerSlab, numRows);
+      FindSlabFaces(featureIds, dims, rowBegin, rowEnd, storeBoundaryCells ? boundaryCells : nullptr, storeSurfaceFeatures, slabFaceCounts[slab], slabSurfaceFeatures[slab]);
     }
-    if(storeBoundaryCells && boundaryCells != nullptr)
-    {
-      boundaryCells->setValue(j, static_cast<int32>(onsurf));
-    }
+  });
+  if(shouldCancel)
+  {
+    return {};
   }
 
-  FloatVec3 spacing = imageGeom.getSpacing();
-
-  progInt = 0;
-  start = std::chrono::steady_clock::now();
-  // We do this to create new set of NeighborList objects
-  for(usize i = 1; i < totalFeatures; i++)
+  if(storeSurfaceFeatures && surfaceFeatures != nullptr)
   {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    for(usize i = 1; i < totalFeatures; i++)
     {
-      progInt = static_cast<float>(i) / static_cast<float>(totalFeatures) * 100.0f;
-      std::string message = fmt::format("Calculating Surface Areas || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32>(progInt)});
-      start = std::chrono::steady_clock::now();
+      surfaceFeatures->setValue(i, false);
     }
-    if(shouldCancel)
+    for(const auto& surfaceFeatureIds : slabSurfaceFeatures)
     {
-      return {};
+      for(int32 surfaceFeatureId : surfaceFeatureIds)
+      {
+        surfaceFeatures->setValue(surfaceFeatureId, true);
+      }
     }
+  }
 
-    std::map<int32, int32> neighToCount;
-    auto numneighs = static_cast<int32>(neighborlist[i].size());
-
-    // this increments the voxel counts for each feature
-    for(int32 j = 0; j < numneighs; j++)
-    {
-      neighToCount[neighborlist[i][j]]++;
-    }
+  messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Calculating Surface Areas"});
 
-    auto neighborIter = neighToCount.find(0);
-    neighToCount.erase(neighborIter);
-    neighborIter = neighToCount.find(-1);
-    if(neighborIter != neighToCount.end())
+  // Phase 2: each block of features merges its part of every slab and writes its lists
+  FloatVec3 spacing = imageGeom.getSpacing();
+  const usize featureBlockCount = (totalFeatures + k_FeaturesPerBlock - 1) / k_FeaturesPerBlock;
+
+  // The lists are created empty and setList() grows them on demand, which is not safe from
+  // several threads. Size them up front so the blocks below only replace existing entries.
+  neighborList.resizeTotalElements(totalFeatures);
+  sharedSurfaceAreaList.resizeTotalElements(totalFeatures);
+
+  ParallelDataAlgorithm featureAlg;
+  featureAlg.setRange(0, featureBlockCount);
+  featureAlg.requireStoresInMemory({&numNeighbors});
+  featureAlg.execute([&](const Range& range) {
+    std::vector<FaceCount> blockFaceCounts;
+    for(usize block = range.min(); block < range.max(); block++)
     {
-      neighToCount.erase(neighborIter);
-    }
-    // Resize the features neighbor list to zero
-    neighborlist[i].resize(0);
-    neighborsurfacearealist[i].resize(0);
+      if(shouldCancel)
+      {
+        return;
+      }
+      const auto featureBegin = static_cast<int32>(std::max<usize>(block * k_FeaturesPerBlock, 1));
+      const auto featureEnd = static_cast<int32>(std::min((block + 1) * k_FeaturesPerBlock, totalFeatures));
+      if(featureBegin >= featureEnd)
+      {
+        continue;
+      }
 
-    for(const auto [neigh, number] : neighToCount)
-    {
-      float area = static_cast<float>(number) * spacing[0] * spacing[1];
+      blockFaceCounts.clear();
+      for(const auto& faceCounts : slabFaceCounts)
+      {
+        auto first = std::lower_bound(faceCounts.begin(), faceCounts.end(), MakeFaceKey(featureBegin, 0), FaceCountKeyLess{});
+        auto last = std::lower_bound(first, faceCounts.end(), MakeFaceKey(featureEnd, 0), FaceCountKeyLess{});
+        blockFaceCounts.insert(blockFaceCounts.end(), first, last);
+      }
+      std::sort(blockFaceCounts.begin(), blockFaceCounts.end(), [](const FaceCount& lhs, const FaceCount& rhs) { return lhs.key < rhs.key; });
 
-      // Push the neighbor feature identifier back onto the list, so we stay synced up
-      neighborlist[i].push_back(neigh);
-      neighborsurfacearealist[i].push_back(area);
+      auto faceIter = blockFaceCounts.begin();
+      for(int32 feature = featureBegin; feature < featureEnd; feature++)
+      {
+        NeighborList<int32>::SharedVectorType sharedNeiLst(new std::vector<int32>);
+        NeighborList<float32>::SharedVectorType sharedSAL(new std::vector<float32>);
+        while(faceIter != blockFaceCounts.end() && FaceKeyFeature(faceIter->key) == feature)
+        {
+          const int32 neigh = FaceKeyNeighbor(faceIter->key);
+          uint64 number = 0;
+          while(faceIter != blockFaceCounts.end() && FaceKeyFeature(faceIter->key) == feature && FaceKeyNeighbor(faceIter->key) == neigh)
+          {
+            number += faceIter->count;
+            ++faceIter;
+          }
+          sharedNeiLst->push_back(neigh);
+          sharedSAL->push_back(static_cast<float>(number) * spacing[0] * spacing[1]);
+        }
+        numNeighbors[feature] = static_cast<int32>(sharedNeiLst->size());
+        neighborList.setList(feature, sharedNeiLst);
+        sharedSurfaceAreaList.setList(feature, sharedSAL);
+      }
     }
-    numNeighbors[i] = static_cast<int32>(neighborlist[i].size());
-
-    // Set the vector for each list into the NeighborList Object
-    NeighborList<int32>::SharedVectorType sharedNeiLst(new std::vector<int32>);
-    sharedNeiLst->assign(neighborlist[i].begin(), neighborlist[i].end());
-    neighborList.setList(static_cast<int32>(i), sharedNeiLst);
-
-    NeighborList<float32>::SharedVectorType sharedSAL(new std::vector<float32>);
-    sharedSAL->assign(neighborsurfacearealist[i].begin(), neighborsurfacearealist[i].end());
-    sharedSurfaceAreaList.setList(static_cast<int32>(i), sharedSAL);
-  }
+  });
 
   return {};
 }
@@ -11,6 +11,7 @@
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
 
+#include "simplnx/Utilities/FeatureReductionUtilities.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include <cmath>
@@ -146,7 +147,8 @@ Result<> ComputeFeatureSizesFilter::executeImpl(DataStructure& dataStructure, co
 {
   auto saveElementSizes = args.value<bool>(k_SaveElementSizes_Key);
 
-  const auto& featureIds = dataStructure.getDataRefAs<Int32Array>(args.value<DataPath>(k_CellFeatureIdsArrayPath_Key)).getDataStoreRef();
+  const auto& featureIdsArray = dataStructure.getDataRefAs<Int32Array>(args.value<DataPath>(k_CellFeatureIdsArrayPath_Key));
+  const auto& featureIds = featureIdsArray.getDataStoreRef();
 
   usize totalPoints = featureIds.getNumberOfTuples();
 
@@ -167,13 +169,22 @@ Result<> ComputeFeatureSizesFilter::executeImpl(DataStructure& dataStructure, co
     usize maxValue = featureIds[featureIdsMaxIdx];
     usize numFeatures = maxValue + 1;
 
-    std::vector<uint64> featureCounts(numFeatures, 0);
-
-    for(size_t j = 0; j < totalPoints; j++)
+    std::vector<uint64> featureCounts = FeatureReduction::ReduceByFeature(
+        totalPoints, numFeatures, uint64{0},
+        [&featureIds, numFeatures](uint64* counts, usize voxelBegin, usize voxelEnd) {
+          for(usize j = voxelBegin; j < voxelEnd; j++)
+          {
+            const int32 gnum = featureIds[j];
+            if(gnum >= 0 && static_cast<usize>(gnum) < numFeatures)
+            {
+              counts[gnum]++;
+            }
+          }
+        },
+        [](uint64& target, const uint64& source) { target += source; }, shouldCancel, {&featureIdsArray});
+    if(shouldCancel)
     {
-      int32_t gnum = featureIds[j];
-      auto temp = featureCounts[gnum] + 1;
-      featureCounts[gnum] = temp;
+      return {};
     }
 
     FloatVec3 spacing = imageGeom->getSpacing();
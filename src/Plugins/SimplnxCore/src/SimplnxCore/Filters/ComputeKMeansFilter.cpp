@@ -78,6 +78,16 @@ Parameters ComputeKMeansFilter::parameters() const
   params.insert(
       std::make_unique<ChoicesParameter>(k_DistanceMetric_Key, "Distance Metric", "Distance Metric type to be used for calculations", to_underlying(ClusterUtilities::DistanceMetric::Euclidean),
                                          ChoicesParameter::Choices{"Euclidean", "Squared Euclidean", "Manhattan", "Cosine", "Pearson", "Squared Pearson"})); // sequence dependent DO NOT REORDER
+  params.insert(std::make_unique<ChoicesParameter>(k_InitializationType_Key, "Initialization Method",
+                                                   "How the initial cluster means are chosen. K-Means++ spreads them out, which usually needs far fewer iterations",
+                                                   k_RandomInitialization, ChoicesParameter::Choices{"Random", "K-Means++"})); // sequence dependent DO NOT REORDER
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseMiniBatch_Key, "Use Mini-Batch",
+                                                                 "Update the means from random batches of tuples instead of the whole array. Much faster for very large arrays, but approximate",
+                                                                 false));
+  params.insert(std::make_unique<UInt64Parameter>(k_BatchSize_Key, "Batch Size", "Number of randomly sampled tuples used for each mini-batch update", 4096));
+  params.insert(std::make_unique<UInt64Parameter>(
+      k_MaxIterations_Key, "Number of Mini-Batch Iterations",
+      "Number of mini-batch updates to run before the final assignment. This does not bound the full (non mini-batch) iteration, which always runs until no tuple changes its cluster", 100));
 
   params.insertSeparator(Parameters::Separator{"Optional Data Mask"});
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseMask_Key, "Use Mask Array", "Specifies whether or not to use a mask array", false));
@@ -97,6 +107,8 @@ Parameters ComputeKMeansFilter::parameters() const
   // Associate the Linkable Parameter(s) to the children parameters that they control
   params.linkParameters(k_UseMask_Key, k_MaskArrayPath_Key, true);
   params.linkParameters(k_UseSeed_Key, k_SeedValue_Key, true);
+  params.linkParameters(k_UseMiniBatch_Key, k_BatchSize_Key, true);
+  params.linkParameters(k_UseMiniBatch_Key, k_MaxIterations_Key, true);
 
   return params;
 }
@@ -104,7 +116,12 @@ Parameters ComputeKMeansFilter::parameters() const
 //------------------------------------------------------------------------------
 IFilter::VersionType ComputeKMeansFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added 'initialization_index', 'use_mini_batch', 'batch_size' and 'max_iterations'
+  // 'initialization_index' defaults to Random so that version 1 pipelines produce the same clusters
 }
 
 //------------------------------------------------------------------------------
@@ -125,6 +142,9 @@ IFilter::PreflightResult ComputeKMeansFilter::preflightImpl(const DataStructure&
   auto pFeatureAMPathValue = filterArgs.value<DataPath>(k_FeatureAMPath_Key);
   auto pMeansArrayNameValue = filterArgs.value<std::string>(k_MeansArrayName_Key);
   auto pSeedArrayNameValue = filterArgs.value<std::string>(k_SeedArrayName_Key);
+  auto pUseMiniBatchValue = filterArgs.value<bool>(k_UseMiniBatch_Key);
+  auto pBatchSizeValue = filterArgs.value<uint64>(k_BatchSize_Key);
+  auto pMaxIterationsValue = filterArgs.value<uint64>(k_MaxIterations_Key);
 
   PreflightResult preflightResult;
   nx::core::Result<OutputActions> resultOutputActions;
@@ -136,6 +156,11 @@ IFilter::PreflightResult ComputeKMeansFilter::preflightImpl(const DataStructure&
     return MakePreflightErrorResult(-7585, "Array to Cluster MUST be a valid DataPath.");
   }
 
+  if(pUseMiniBatchValue && (pBatchSizeValue == 0 || pMaxIterationsValue == 0))
+  {
+    return MakePreflightErrorResult(-7586, "The Batch Size and the Number of Mini-Batch Iterations must both be greater than 0.");
+  }
+
   {
     auto createAction = std::make_unique<CreateArrayAction>(DataType::int32, clusterArray->getTupleShape(), std::vector<usize>{1}, pSelectedArrayPathValue.replaceName(pFeatureIdsArrayNameValue));
     resultOutputActions.value().appendAction(std::move(createAction));
@@ -198,6 +223,10 @@ Result<> ComputeKMeansFilter::executeImpl(DataStructure& dataStructure, const Ar
   inputValues.MaskArrayPath = maskPath;
   inputValues.MeansArrayPath = filterArgs.value<DataPath>(k_FeatureAMPath_Key).createChildPath(filterArgs.value<std::string>(k_MeansArrayName_Key));
   inputValues.Seed = seed;
+  inputValues.UseKMeansPlusPlus = filterArgs.value<ChoicesParameter::ValueType>(k_InitializationType_Key) == k_KMeansPlusPlusInitialization;
+  inputValues.UseMiniBatch = filterArgs.value<bool>(k_UseMiniBatch_Key);
+  inputValues.BatchSize = filterArgs.value<uint64>(k_BatchSize_Key);
+  inputValues.MaxIterations = filterArgs.value<uint64>(k_MaxIterations_Key);
 
   inputValues.ClusteringArrayPath = filterArgs.value<DataPath>(k_SelectedArrayPath_Key);
   auto fIdsPath = inputValues.ClusteringArrayPath.replaceName(filterArgs.value<std::string>(k_FeatureIdsArrayName_Key));
@@ -227,6 +256,8 @@ constexpr StringLiteral k_MeansArrayNameKey = "MeansArrayName";
 Result<Arguments> ComputeKMeansFilter::FromSIMPLJson(const nlohmann::json& json)
 {
   Arguments args = ComputeKMeansFilter().getDefaultArguments();
+  // SIMPL seeded the means randomly
+  args.insertOrAssign(k_InitializationType_Key, std::make_any<ChoicesParameter::ValueType>(k_RandomInitialization));
 
   std::vector<Result<>> results;
 
@@ -35,6 +35,12 @@ public:
   static inline constexpr StringLiteral k_UseSeed_Key = "use_seed";
   static inline constexpr StringLiteral k_SeedValue_Key = "seed_value";
   static inline constexpr StringLiteral k_SeedArrayName_Key = "seed_array_name";
+  static inline constexpr StringLiteral k_InitializationType_Key = "initialization_index";
+  static inline constexpr StringLiteral k_UseMiniBatch_Key = "use_mini_batch";
+  static inline constexpr StringLiteral k_BatchSize_Key = "batch_size";
+  static inline constexpr StringLiteral k_MaxIterations_Key = "max_iterations";
+  static inline constexpr uint64 k_RandomInitialization = 0;
+  static inline constexpr uint64 k_KMeansPlusPlusInitialization = 1;
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
@@ -80,6 +80,9 @@ Parameters ComputeKMedoidsFilter::parameters() const
   params.insert(
       std::make_unique<ChoicesParameter>(k_DistanceMetric_Key, "Distance Metric", "Distance Metric type to be used for calculations", to_underlying(ClusterUtilities::DistanceMetric::Euclidean),
                                          ChoicesParameter::Choices{"Euclidean", "Squared Euclidean", "Manhattan", "Cosine", "Pearson", "Squared Pearson"})); // sequence dependent DO NOT REORDER
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseSampling_Key, "Use Stratified Sampling",
+                                                                 "Choose each medoid from an evenly spaced subset of its cluster (CLARA) instead of from all members", false));
+  params.insert(std::make_unique<UInt64Parameter>(k_SampleSize_Key, "Maximum Samples Per Cluster", "The largest number of members of each cluster that are evaluated as medoids", 1000));
 
   params.insertSeparator(Parameters::Separator{"Input Data Objects"});
   params.insert(std::make_unique<ArraySelectionParameter>(k_SelectedArrayPath_Key, "Attribute Array to Cluster", "The array to find the medoids for", DataPath{}, nx::core::GetAllNumericTypes()));
@@ -93,6 +96,7 @@ Parameters ComputeKMedoidsFilter::parameters() const
   // Associate the Linkable Parameter(s) to the children parameters that they control
   params.linkParameters(k_UseMask_Key, k_MaskArrayPath_Key, true);
   params.linkParameters(k_UseSeed_Key, k_SeedValue_Key, true);
+  params.linkParameters(k_UseSampling_Key, k_SampleSize_Key, true);
 
   return params;
 }
@@ -100,7 +104,11 @@ Parameters ComputeKMedoidsFilter::parameters() const
 //------------------------------------------------------------------------------
 IFilter::VersionType ComputeKMedoidsFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added 'use_sampling' and 'sample_size'
 }
 
 //------------------------------------------------------------------------------
@@ -121,6 +129,8 @@ IFilter::PreflightResult ComputeKMedoidsFilter::preflightImpl(const DataStructur
   auto pFeatureAMPathValue = filterArgs.value<DataPath>(k_FeatureAMPath_Key);
   auto pMedoidsArrayNameValue = filterArgs.value<std::string>(k_MedoidsArrayName_Key);
   auto pSeedArrayNameValue = filterArgs.value<std::string>(k_SeedArrayName_Key);
+  auto pUseSamplingValue = filterArgs.value<bool>(k_UseSampling_Key);
+  auto pSampleSizeValue = filterArgs.value<uint64>(k_SampleSize_Key);
 
   PreflightResult preflightResult;
   nx::core::Result<OutputActions> resultOutputActions;
@@ -132,6 +142,11 @@ IFilter::PreflightResult ComputeKMedoidsFilter::preflightImpl(const DataStructur
     return MakePreflightErrorResult(-7584, "Array to Cluster MUST be a valid DataPath.");
   }
 
+  if(pUseSamplingValue && pSampleSizeValue == 0)
+  {
+    return MakePreflightErrorResult(-7583, "The Maximum Samples Per Cluster must be greater than 0.");
+  }
+
   {
     auto createAction = std::make_unique<CreateArrayAction>(DataType::int32, clusterArray->getTupleShape(), std::vector<usize>{1}, pSelectedArrayPathValue.replaceName(pFeatureIdsArrayNameValue));
     resultOutputActions.value().appendAction(std::move(createAction));
@@ -194,6 +209,8 @@ Result<> ComputeKMedoidsFilter::executeImpl(DataStructure& dataStructure, const
   inputValues.MaskArrayPath = maskPath;
   inputValues.MedoidsArrayPath = filterArgs.value<DataPath>(k_FeatureAMPath_Key).createChildPath(filterArgs.value<std::string>(k_MedoidsArrayName_Key));
   inputValues.Seed = seed;
+  inputValues.UseSampling = filterArgs.value<bool>(k_UseSampling_Key);
+  inputValues.SampleSize = filterArgs.value<uint64>(k_SampleSize_Key);
 
   inputValues.ClusteringArrayPath = filterArgs.value<DataPath>(k_SelectedArrayPath_Key);
   auto fIdsPath = inputValues.ClusteringArrayPath.replaceName(filterArgs.value<std::string>(k_FeatureIdsArrayName_Key));
@@ -35,6 +35,8 @@ public:
   static inline constexpr StringLiteral k_UseSeed_Key = "use_seed";
   static inline constexpr StringLiteral k_SeedValue_Key = "seed_value";
   static inline constexpr StringLiteral k_SeedArrayName_Key = "seed_array_name";
+  static inline constexpr StringLiteral k_UseSampling_Key = "use_sampling";
+  static inline constexpr StringLiteral k_SampleSize_Key = "sample_size";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
@@ -27,6 +27,9 @@
 #include "simplnx/Utilities/SamplingUtils.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
+#include <algorithm>
+#include <mutex>
+
 using namespace nx::core;
 
 namespace
@@ -71,12 +74,14 @@ template <typename T>
 class CropImageGeomDataArray
 {
 public:
-  CropImageGeomDataArray(const IDataArray& oldCellArray, IDataArray& newCellArray, const ImageGeom& srcImageGeom, std::array<uint64, 6> bounds, const std::atomic_bool& shouldCancel)
+  CropImageGeomDataArray(const IDataArray& oldCellArray, IDataArray& newCellArray, const ImageGeom& srcImageGeom, std::array<uint64, 6> bounds, const std::atomic_bool& shouldCancel,
+                         Result<>& result)
   : m_OldCellStore(oldCellArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
   , m_NewCellStore(newCellArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
   , m_SrcImageGeom(srcImageGeom)
   , m_Bounds(bounds)
   , m_ShouldCancel(shouldCancel)
+  , m_Result(result)
   {
   }
 
@@ -95,32 +100,61 @@ public:
 protected:
   void convert() const
   {
-    size_t numComps = m_OldCellStore.getNumberOfComponents();
+    const usize numComps = m_OldCellStore.getNumberOfComponents();
+    const SizeVec3 srcDims = m_SrcImageGeom.getDimensions();
+    const usize rowLength = m_Bounds[1] - m_Bounds[0];
+    const usize numRows = m_Bounds[3] - m_Bounds[2];
+    const usize numPlanes = m_Bounds[5] - m_Bounds[4];
+
+    // Every destination tuple is overwritten below, the fill only matters if the destination is larger than the crop
+    if(m_NewCellStore.getNumberOfTuples() != rowLength * numRows * numPlanes)
+    {
+      m_NewCellStore.fill(static_cast<T>(-1));
+    }
 
-    m_NewCellStore.fill(static_cast<T>(-1));
+    // Each x-row of the cropped region is contiguous in both arrays so it is moved as a single span.
+    // The rows are split between threads, in-memory stores are copied directly between their buffers.
+    const T* srcData = GetInMemoryDataPointer(m_OldCellStore);
+    T* destData = GetInMemoryDataPointer(m_NewCellStore);
 
-    auto srcDims = m_SrcImageGeom.getDimensions();
+    // Out-of-core stores go through copyFrom(), the first failed row is kept and the remaining rows are skipped
+    std::mutex resultMutex;
+    std::atomic_bool copyFailed = false;
 
-    uint64 destTupleIndex = 0;
-    for(uint64 zIndex = m_Bounds[4]; zIndex < m_Bounds[5]; zIndex++)
-    {
-      if(m_ShouldCancel)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numRows * numPlanes);
+    dataAlg.requireStoresInMemory({&m_OldCellStore, &m_NewCellStore});
+    dataAlg.execute([&](const Range& range) {
+      for(usize destRow = range.min(); destRow < range.max(); destRow++)
       {
-        return;
-      }
-      for(uint64 yIndex = m_Bounds[2]; yIndex < m_Bounds[3]; yIndex++)
-      {
-        for(uint64 xIndex = m_Bounds[0]; xIndex < m_Bounds[1]; xIndex++)
+        if(m_ShouldCancel || copyFailed)
+        {
+          return;
+        }
+        const usize zIndex = m_Bounds[4] + destRow / numRows;
+        const usize yIndex = m_Bounds[2] + destRow % numRows;
+        const usize srcIndex = (srcDims[0] * srcDims[1] * zIndex) + (srcDims[0] * yIndex) + m_Bounds[0];
+        const usize destIndex = destRow * rowLength;
+        if(srcData != nullptr && destData != nullptr)
+        {
+          std::copy_n(srcData + srcIndex * numComps, rowLength * numComps, destData + destIndex * numComps);
+        }
+        else
         {
-          uint64 srcIndex = (srcDims[0] * srcDims[1] * zIndex) + (srcDims[0] * yIndex) + xIndex;
-          for(size_t compIndex = 0; compIndex < numComps; compIndex++)
+          Result<> copyResult = m_NewCellStore.copyFrom(destIndex, m_OldCellStore, srcIndex, rowLength);
+          if(copyResult.invalid())
           {
-            m_NewCellStore.setValue(destTupleIndex * numComps + compIndex, m_OldCellStore.getValue(srcIndex * numComps + compIndex));
+            const std::lock_guard<std::mutex> guard(resultMutex);
+            if(!copyFailed)
+            {
+              m_Result = std::move(copyResult);
+              copyFailed = true;
+            }
+            return;
           }
-          destTupleIndex++;
         }
       }
-    }
+    });
   }
 
 private:
@@ -129,6 +163,7 @@ private:
   const ImageGeom& m_SrcImageGeom;
   std::array<uint64, 6> m_Bounds;
   const std::atomic_bool& m_ShouldCancel;
+  Result<>& m_Result;
 };
 } // namespace
 
@@ -635,10 +670,14 @@ Result<> CropImageGeometryFilter::executeImpl(DataStructure& dataStructure, cons
   std::array<uint64, 6> bounds = {xMin, xMax + 1, yMin, yMax + 1, zMin, zMax + 1};
 
   // The actual cropping of the dataStructure arrays is done in parallel where parallel here
-  // refers to the cropping of each DataArray being done on a separate thread.
+  // refers to the cropping of each DataArray being done on a separate thread, each of which
+  // further splits its x-row copies between threads.
+  // Each DataArray reports into its own slot so the tasks never share a Result.
   ParallelTaskAlgorithm taskRunner;
   const auto& srcCellDataAM = srcImageGeom.getCellDataRef();
   auto& destCellDataAM = destImageGeom.getCellDataRef();
+  std::vector<Result<>> copyResults(srcCellDataAM.getSize());
+  usize arrayIndex = 0;
   for(const auto& [dataId, oldDataObject] : srcCellDataAM)
   {
     if(shouldCancel)
@@ -652,10 +691,17 @@ Result<> CropImageGeometryFilter::executeImpl(DataStructure& dataStructure, cons
     auto& newDataArray = dynamic_cast<IDataArray&>(destCellDataAM.at(srcName));
 
     messageHandler(fmt::format("Cropping Volume || Copying Data Array {}", srcName));
-    ExecuteParallelFunction<CropImageGeomDataArray>(oldDataArray.getDataType(), taskRunner, oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel);
+    ExecuteParallelFunction<CropImageGeomDataArray>(oldDataArray.getDataType(), taskRunner, oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel, copyResults[arrayIndex]);
+    arrayIndex++;
   }
   taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
 
+  Result<> copyResult = MergeResults(std::move(copyResults));
+  if(copyResult.invalid())
+  {
+    return copyResult;
+  }
+
   if(shouldCancel)
   {
     return {};
@@ -10,6 +10,7 @@
 #include "simplnx/Parameters/DataGroupCreationParameter.hpp"
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
+#include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
 #include "simplnx/Parameters/NumberParameter.hpp"
 
 using namespace nx::core;
@@ -64,6 +65,10 @@ Parameters FlyingEdges3DFilter::parameters() const
                                                              GeometrySelectionParameter::AllowedTypes{IGeometry::Type::Image}));
   params.insert(std::make_unique<ArraySelectionParameter>(k_SelectedDataArrayPath_Key, "Data Array to Contour", "This is the data that will be checked for the contouring iso value", DataPath{},
                                                           GetAllDataTypes()));
+  params.insert(std::make_unique<MultiArraySelectionParameter>(
+      k_InterpolatedArrayPaths_Key, "Attribute Arrays to Interpolate",
+      "The cell arrays of the image that are interpolated onto the vertices of the created Triangle Geometry. Integer arrays take the value of the nearest cell.",
+      MultiArraySelectionParameter::ValueType{}, MultiArraySelectionParameter::AllowedTypes{IArray::ArrayType::DataArray}, nx::core::GetAllNumericTypes()));
 
   params.insertSeparator(Parameters::Separator{"Output Data Object(s)"});
   params.insert(std::make_unique<DataGroupCreationParameter>(k_CreatedTriangleGeometryPath_Key, "Name of Output Triangle Geometry", "This is where the contouring line will be stored",
@@ -75,7 +80,11 @@ Parameters FlyingEdges3DFilter::parameters() const
 //------------------------------------------------------------------------------
 IFilter::VersionType FlyingEdges3DFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added 'interpolated_array_paths'
 }
 
 //------------------------------------------------------------------------------
@@ -90,21 +99,43 @@ IFilter::PreflightResult FlyingEdges3DFilter::preflightImpl(const DataStructure&
 {
   auto pImageGeomPath = filterArgs.value<DataPath>(k_SelectedImageGeometryPath_Key);
   auto pTriangleGeomName = filterArgs.value<DataPath>(k_CreatedTriangleGeometryPath_Key);
+  auto pContouringArrayPath = filterArgs.value<DataPath>(k_SelectedDataArrayPath_Key);
+  auto pInterpolatedArrayPaths = filterArgs.value<MultiArraySelectionParameter::ValueType>(k_InterpolatedArrayPaths_Key);
 
   nx::core::Result<OutputActions> resultOutputActions;
   std::vector<PreflightValue> preflightUpdatedValues;
 
+  if(!pInterpolatedArrayPaths.empty())
+  {
+    std::vector<DataPath> cellArrayPaths = pInterpolatedArrayPaths;
+    cellArrayPaths.push_back(pContouringArrayPath);
+    if(auto tupleValidityCheck = dataStructure.validateNumberOfTuples(cellArrayPaths); !tupleValidityCheck)
+    {
+      return MakePreflightErrorResult(-2360, fmt::format("The arrays to interpolate must have the same number of tuples as the array to contour: {}", tupleValidityCheck.error()));
+    }
+  }
+
   // Create the Triangle Geometry action and store it
   auto createTriangleGeometryAction =
       std::make_unique<CreateTriangleGeometryAction>(pTriangleGeomName, static_cast<usize>(1), static_cast<usize>(1), INodeGeometry0D::k_VertexDataName, INodeGeometry2D::k_FaceDataName,
                                                      CreateTriangleGeometryAction::k_DefaultVerticesName, CreateTriangleGeometryAction::k_DefaultFacesName);
-  auto vertexNormalsPath = createTriangleGeometryAction->getVertexDataPath().createChildPath(k_VertexNormals);
+  auto vertexDataPath = createTriangleGeometryAction->getVertexDataPath();
+  auto vertexNormalsPath = vertexDataPath.createChildPath(k_VertexNormals);
   resultOutputActions.value().appendAction(std::move(createTriangleGeometryAction));
 
   // Create the face Normals DataArray action and store it
   auto createArrayAction = std::make_unique<CreateArrayAction>(nx::core::DataType::float32, std::vector<usize>{static_cast<usize>(1)}, std::vector<usize>{static_cast<usize>(3)}, vertexNormalsPath);
   resultOutputActions.value().appendAction(std::move(createArrayAction));
 
+  // Create the interpolated vertex arrays
+  for(const auto& interpolatedArrayPath : pInterpolatedArrayPaths)
+  {
+    const auto& iDataArray = dataStructure.getDataRefAs<IDataArray>(interpolatedArrayPath);
+    auto createInterpolatedArrayAction = std::make_unique<CreateArrayAction>(iDataArray.getDataType(), std::vector<usize>{static_cast<usize>(1)}, iDataArray.getComponentShape(),
+                                                                             vertexDataPath.createChildPath(interpolatedArrayPath.getTargetName()));
+    resultOutputActions.value().appendAction(std::move(createInterpolatedArrayAction));
+  }
+
   return {std::move(resultOutputActions), std::move(preflightUpdatedValues)};
 }
 
@@ -119,6 +150,11 @@ Result<> FlyingEdges3DFilter::executeImpl(DataStructure& dataStructure, const Ar
   inputValues.triangleGeomPath = filterArgs.value<DataPath>(k_CreatedTriangleGeometryPath_Key);
   inputValues.isoVal = filterArgs.value<float64>(k_IsoVal_Key);
   inputValues.normalsArrayPath = inputValues.triangleGeomPath.createChildPath(INodeGeometry0D::k_VertexDataName).createChildPath(k_VertexNormals);
+  inputValues.interpolatedArrayPaths = filterArgs.value<MultiArraySelectionParameter::ValueType>(k_InterpolatedArrayPaths_Key);
+  for(const auto& interpolatedArrayPath : inputValues.interpolatedArrayPaths)
+  {
+    inputValues.createdArrayPaths.push_back(inputValues.normalsArrayPath.replaceName(interpolatedArrayPath.getTargetName()));
+  }
 
   return FlyingEdges3D(dataStructure, messageHandler, shouldCancel, &inputValues)();
 }
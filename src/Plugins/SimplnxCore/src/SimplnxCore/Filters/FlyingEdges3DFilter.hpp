@@ -28,6 +28,7 @@ public:
   static inline constexpr StringLiteral k_SelectedDataArrayPath_Key = "input_data_array_path";
   static inline constexpr StringLiteral k_CreatedTriangleGeometryPath_Key = "output_triangle_geometry_path";
   static inline constexpr StringLiteral k_IsoVal_Key = "contour_value";
+  static inline constexpr StringLiteral k_InterpolatedArrayPaths_Key = "interpolated_array_paths";
 
   /**
    * @brief Returns the name of the filter.
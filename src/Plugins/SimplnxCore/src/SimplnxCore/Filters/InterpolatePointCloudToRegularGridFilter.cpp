@@ -5,6 +5,7 @@
 #include "simplnx/DataStructure/Geometry/VertexGeom.hpp"
 #include "simplnx/DataStructure/NeighborList.hpp"
 #include "simplnx/Filter/Actions/CopyArrayInstanceAction.hpp"
+#include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Filter/Actions/CreateAttributeMatrixAction.hpp"
 #include "simplnx/Filter/Actions/CreateNeighborListAction.hpp"
 #include "simplnx/Parameters/ArraySelectionParameter.hpp"
@@ -18,10 +19,12 @@
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include <cmath>
+#include <limits>
 
 namespace nx::core
 {
@@ -142,6 +145,193 @@ void mapKernelDistances(NeighborList<float32>* kernelDistances, std::vector<floa
     }
   }
 }
+
+/**
+ * @brief Holds the indices of the (unmasked) points grouped by the voxel that they fall in. The
+ * points of voxel i are pointIds[offsets[i]] .. pointIds[offsets[i + 1] - 1] in ascending order.
+ */
+struct VoxelPointBins
+{
+  std::vector<usize> offsets;
+  std::vector<usize> pointIds;
+};
+
+/**
+ * @brief Gathers the kernel contributions of all points that reach each voxel in the range into
+ * a weighted mean plus the min/max of the contributing values. Each voxel is written by exactly one
+ * task and its contributions are always summed in the same order, so the result does not depend
+ * on the number of threads.
+ */
+template <typename T>
+class ReducePointCloudByKernelImpl
+{
+public:
+  ReducePointCloudByKernelImpl(const AbstractDataStore<T>& inputStore, const VoxelPointBins& bins, const std::vector<float32>& kernelVals, const int64 kernelNumVoxels[3], const SizeVec3& dims,
+                               AbstractDataStore<float64>& meanStore, AbstractDataStore<float64>& minStore, AbstractDataStore<float64>& maxStore, const std::atomic_bool& shouldCancel)
+  : m_InputStore(inputStore)
+  , m_Bins(bins)
+  , m_KernelVals(kernelVals)
+  , m_KernelNumVoxels{kernelNumVoxels[0], kernelNumVoxels[1], kernelNumVoxels[2]}
+  , m_Dims{static_cast<int64>(dims[0]), static_cast<int64>(dims[1]), static_cast<int64>(dims[2])}
+  , m_MeanStore(meanStore)
+  , m_MinStore(minStore)
+  , m_MaxStore(maxStore)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize voxelIdx = range.min(); voxelIdx < range.max(); voxelIdx++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const int64 x = static_cast<int64>(voxelIdx) % m_Dims[0];
+      const int64 y = (static_cast<int64>(voxelIdx) / m_Dims[0]) % m_Dims[1];
+      const int64 z = static_cast<int64>(voxelIdx) / (m_Dims[0] * m_Dims[1]);
+
+      float64 weightSum = 0.0;
+      float64 weightedSum = 0.0;
+      float64 minValue = std::numeric_limits<float64>::max();
+      float64 maxValue = std::numeric_limits<float64>::lowest();
+
+      // A point in voxel (x - dx, y - dy, z - dz) reaches this voxel through kernel offset (dx, dy, dz)
+      usize counter = 0;
+      for(int64 dz = -m_KernelNumVoxels[2]; dz <= m_KernelNumVoxels[2]; dz++)
+      {
+        const int64 srcZ = z - dz;
+        for(int64 dy = -m_KernelNumVoxels[1]; dy <= m_KernelNumVoxels[1]; dy++)
+        {
+          const int64 srcY = y - dy;
+          for(int64 dx = -m_KernelNumVoxels[0]; dx <= m_KernelNumVoxels[0]; dx++, counter++)
+          {
+            const int64 srcX = x - dx;
+            const float64 kernelVal = m_KernelVals[counter];
+            if(kernelVal == 0.0 || srcX < 0 || srcX >= m_Dims[0] || srcY < 0 || srcY >= m_Dims[1] || srcZ < 0 || srcZ >= m_Dims[2])
+            {
+              continue;
+            }
+            const usize srcVoxel = (srcZ * m_Dims[1] * m_Dims[0]) + (srcY * m_Dims[0]) + srcX;
+            for(usize binIdx = m_Bins.offsets[srcVoxel]; binIdx < m_Bins.offsets[srcVoxel + 1]; binIdx++)
+            {
+              const auto value = static_cast<float64>(m_InputStore[m_Bins.pointIds[binIdx]]);
+              weightSum += kernelVal;
+              weightedSum += kernelVal * value;
+              minValue = std::min(minValue, value);
+              maxValue = std::max(maxValue, value);
+            }
+          }
+        }
+      }
+
+      if(weightSum > 0.0)
+      {
+        m_MeanStore[voxelIdx] = weightedSum / weightSum;
+        m_MinStore[voxelIdx] = minValue;
+        m_MaxStore[voxelIdx] = maxValue;
+      }
+      else
+      {
+        m_MeanStore[voxelIdx] = std::numeric_limits<float64>::quiet_NaN();
+        m_MinStore[voxelIdx] = std::numeric_limits<float64>::quiet_NaN();
+        m_MaxStore[voxelIdx] = std::numeric_limits<float64>::quiet_NaN();
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<T>& m_InputStore;
+  const VoxelPointBins& m_Bins;
+  const std::vector<float32>& m_KernelVals;
+  const int64 m_KernelNumVoxels[3];
+  const int64 m_Dims[3];
+  AbstractDataStore<float64>& m_MeanStore;
+  AbstractDataStore<float64>& m_MinStore;
+  AbstractDataStore<float64>& m_MaxStore;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+struct ReducePointCloudByKernelFunctor
+{
+  template <typename T>
+  void operator()(const IDataArray* source, const VoxelPointBins& bins, const std::vector<float32>& kernelVals, const int64 kernelNumVoxels[3], const SizeVec3& dims, Float64Array& meanArray,
+                  Float64Array& minArray, Float64Array& maxArray, const std::atomic_bool& shouldCancel)
+  {
+    const auto& inputStore = source->template getIDataStoreRefAs<AbstractDataStore<T>>();
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, meanArray.getNumberOfTuples());
+    dataAlg.requireArraysInMemory({source, &meanArray, &minArray, &maxArray});
+    dataAlg.execute(
+        ReducePointCloudByKernelImpl<T>(inputStore, bins, kernelVals, kernelNumVoxels, dims, meanArray.getDataStoreRef(), minArray.getDataStoreRef(), maxArray.getDataStoreRef(), shouldCancel));
+  }
+};
+
+/**
+ * @brief Sums the kernel weights of all points that reach each voxel in the range. This only
+ * depends on the point bins and the kernel, so it is filled regardless of which arrays are selected.
+ */
+class ComputeKernelWeightsImpl
+{
+public:
+  ComputeKernelWeightsImpl(const VoxelPointBins& bins, const std::vector<float32>& kernelVals, const int64 kernelNumVoxels[3], const SizeVec3& dims, AbstractDataStore<float64>& weightsStore,
+                           const std::atomic_bool& shouldCancel)
+  : m_Bins(bins)
+  , m_KernelVals(kernelVals)
+  , m_KernelNumVoxels{kernelNumVoxels[0], kernelNumVoxels[1], kernelNumVoxels[2]}
+  , m_Dims{static_cast<int64>(dims[0]), static_cast<int64>(dims[1]), static_cast<int64>(dims[2])}
+  , m_WeightsStore(weightsStore)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize voxelIdx = range.min(); voxelIdx < range.max(); voxelIdx++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const int64 x = static_cast<int64>(voxelIdx) % m_Dims[0];
+      const int64 y = (static_cast<int64>(voxelIdx) / m_Dims[0]) % m_Dims[1];
+      const int64 z = static_cast<int64>(voxelIdx) / (m_Dims[0] * m_Dims[1]);
+
+      float64 weightSum = 0.0;
+      usize counter = 0;
+      for(int64 dz = -m_KernelNumVoxels[2]; dz <= m_KernelNumVoxels[2]; dz++)
+      {
+        const int64 srcZ = z - dz;
+        for(int64 dy = -m_KernelNumVoxels[1]; dy <= m_KernelNumVoxels[1]; dy++)
+        {
+          const int64 srcY = y - dy;
+          for(int64 dx = -m_KernelNumVoxels[0]; dx <= m_KernelNumVoxels[0]; dx++, counter++)
+          {
+            const int64 srcX = x - dx;
+            const float64 kernelVal = m_KernelVals[counter];
+            if(kernelVal == 0.0 || srcX < 0 || srcX >= m_Dims[0] || srcY < 0 || srcY >= m_Dims[1] || srcZ < 0 || srcZ >= m_Dims[2])
+            {
+              continue;
+            }
+            const usize srcVoxel = (srcZ * m_Dims[1] * m_Dims[0]) + (srcY * m_Dims[0]) + srcX;
+            weightSum += kernelVal * static_cast<float64>(m_Bins.offsets[srcVoxel + 1] - m_Bins.offsets[srcVoxel]);
+          }
+        }
+      }
+      m_WeightsStore[voxelIdx] = weightSum;
+    }
+  }
+
+private:
+  const VoxelPointBins& m_Bins;
+  const std::vector<float32>& m_KernelVals;
+  const int64 m_KernelNumVoxels[3];
+  const int64 m_Dims[3];
+  AbstractDataStore<float64>& m_WeightsStore;
+  const std::atomic_bool& m_ShouldCancel;
+};
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -181,6 +371,10 @@ Parameters InterpolatePointCloudToRegularGridFilter::parameters() const
 
   params.insertSeparator(Parameters::Separator{"Input Parameter(s)"});
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseMask_Key, "Use Mask Array", "Specifies whether or not to use a mask array", false));
+  params.insert(std::make_unique<BoolParameter>(k_StoreNeighborLists_Key, "Store Per-Voxel Neighbor Lists",
+                                                "Specifies whether to store every weighted kernel contribution of each voxel in a NeighborList instead of reducing them into dense "
+                                                "mean/min/max arrays. This can require a large amount of memory",
+                                                false));
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_StoreKernelDistances_Key, "Store Kernel Distances", "Specifies whether or not to store kernel distances", false));
   params.insertLinkableParameter(
       std::make_unique<ChoicesParameter>(k_InterpolationTechnique_Key, "Interpolation Technique", "Selected Interpolation Technique", 0, std::vector<std::string>{"Uniform", "Gaussian"}));
@@ -207,6 +401,8 @@ Parameters InterpolatePointCloudToRegularGridFilter::parameters() const
 
   params.insertSeparator(Parameters::Separator{"Output Data Object(s)"});
   params.insert(std::make_unique<DataObjectNameParameter>(k_InterpolatedGroupName_Key, "Interpolated Group", "DataPath to created DataGroup for interpolated data", "InterpolatedData"));
+  params.insert(std::make_unique<DataObjectNameParameter>(k_KernelWeightsArrayName_Key, "Kernel Weights Array",
+                                                          "Name of the created array holding the sum of the kernel weights that reached each voxel", "KernelWeights"));
   params.insert(std::make_unique<DataObjectNameParameter>(k_KernelDistancesArrayName_Key, "Kernel Distances Group", "DataPath to created DataGroup for kernel distances data", "KernelDistances"));
 
   params.linkParameters(k_UseMask_Key, k_InputMaskPath_Key, std::make_any<bool>(true));
@@ -219,7 +415,22 @@ Parameters InterpolatePointCloudToRegularGridFilter::parameters() const
 //------------------------------------------------------------------------------
 IFilter::VersionType InterpolatePointCloudToRegularGridFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added 'store_neighbor_lists' and 'kernel_weights_array_name'; the interpolated data is now reduced into dense
+  // per-voxel arrays unless 'store_neighbor_lists' is set. Version 1 pipelines are read with 'store_neighbor_lists' set to
+  // true so that they keep their NeighborList outputs.
+}
+
+//------------------------------------------------------------------------------
+void InterpolatePointCloudToRegularGridFilter::updateArgumentsFromVersion(Arguments& args, VersionType version) const
+{
+  if(version < 2)
+  {
+    args.insertOrAssign(k_StoreNeighborLists_Key, std::make_any<bool>(true));
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -234,6 +445,7 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
 {
   auto useMask = args.value<bool>(k_UseMask_Key);
   auto storeKernelDistances = args.value<bool>(k_StoreKernelDistances_Key);
+  auto storeNeighborLists = args.value<bool>(k_StoreNeighborLists_Key);
   auto interpolationTechnique = args.value<uint64>(k_InterpolationTechnique_Key);
   auto vertexGeomPath = args.value<DataPath>(k_SelectedVertexGeometryPath_Key);
   auto imageGeomPath = args.value<DataPath>(k_SelectedImageGeometryPath_Key);
@@ -280,7 +492,7 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
 
   std::vector<DataPath> dataArrays = {vertexGeomPath.createChildPath(vertexGeom->getVertices()->getName()), voxelIndicesPath};
 
-  // Create the neighbor list arrays for storing the interpolated array data
+  // Create either the neighbor list arrays or the reduced arrays for storing the interpolated array data
   for(const auto& interpolatePath : interpolatedDataPaths)
   {
     dataArrays.push_back(interpolatePath);
@@ -292,15 +504,31 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
       return MakePreflightErrorResult(-11002, fmt::format("Attribute Arrays selected for copying must be scalar arrays"));
     }
     auto dataType = targetArray->getDataType();
-    if(dataType != DataType::boolean)
+    if(dataType == DataType::boolean)
+    {
+      continue;
+    }
+    if(storeNeighborLists)
     {
-      auto neighborPath = interpolatedGroupPath.createChildPath(targetArray->getName());
-      auto neighborAction = std::make_unique<CreateNeighborListAction>(dataType, numTuples, neighborPath);
+      auto neighborAction = std::make_unique<CreateNeighborListAction>(dataType, numTuples, targetPath);
       actions.appendAction(std::move(neighborAction));
+      continue;
     }
+    for(const auto& suffix : {k_MeanSuffix, k_MinSuffix, k_MaxSuffix})
+    {
+      auto reducedPath = interpolatedGroupPath.createChildPath(fmt::format("{}{}", targetArray->getName(), suffix));
+      actions.appendAction(std::make_unique<CreateArrayAction>(DataType::float64, tupleDims, std::vector<usize>{1}, reducedPath));
+    }
+  }
+
+  // Create the array holding the summed kernel weights that reach each voxel
+  if(!storeNeighborLists)
+  {
+    auto weightsPath = interpolatedGroupPath.createChildPath(args.value<std::string>(k_KernelWeightsArrayName_Key));
+    actions.appendAction(std::make_unique<CreateArrayAction>(DataType::float64, tupleDims, std::vector<usize>{1}, weightsPath));
   }
 
-  // Create the neighbor list arrays for storing the copied array data
+  // Create either the neighbor list arrays or the reduced arrays for storing the copied array data
   for(const auto& copyPath : copyDataPaths)
   {
     dataArrays.push_back(copyPath);
@@ -312,11 +540,20 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
       return MakePreflightErrorResult(-11002, fmt::format("Attribute Arrays selected for copying must be scalar arrays"));
     }
     auto dataType = targetArray->getDataType();
-    if(dataType != DataType::boolean)
+    if(dataType == DataType::boolean)
     {
-      auto neighborPath = interpolatedGroupPath.createChildPath(targetArray->getName());
-      auto neighborAction = std::make_unique<CreateNeighborListAction>(dataType, numTuples, neighborPath);
+      continue;
+    }
+    if(storeNeighborLists)
+    {
+      auto neighborAction = std::make_unique<CreateNeighborListAction>(dataType, numTuples, targetPath);
       actions.appendAction(std::move(neighborAction));
+      continue;
+    }
+    for(const auto& suffix : {k_MeanSuffix, k_MinSuffix, k_MaxSuffix})
+    {
+      auto reducedPath = interpolatedGroupPath.createChildPath(fmt::format("{}{}", targetArray->getName(), suffix));
+      actions.appendAction(std::make_unique<CreateArrayAction>(DataType::float64, tupleDims, std::vector<usize>{1}, reducedPath));
     }
   }
 
@@ -348,6 +585,7 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
 {
   auto useMask = args.value<bool>(k_UseMask_Key);
   auto storeKernelDistances = args.value<bool>(k_StoreKernelDistances_Key);
+  auto storeNeighborLists = args.value<bool>(k_StoreNeighborLists_Key);
   auto interpolationTechnique = args.value<uint64>(k_InterpolationTechnique_Key);
   auto vertexGeomPath = args.value<DataPath>(k_SelectedVertexGeometryPath_Key);
   auto imageGeomPath = args.value<DataPath>(k_SelectedImageGeometryPath_Key);
@@ -367,6 +605,7 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
   int64 kernelNumVoxels[3] = {0, 0, 0};
 
   auto numVerts = vertices->getNumberOfVertices();
+  const usize numVoxels = image->getNumberOfCells();
   usize index = 0;
   usize x = 0;
   usize y = 0;
@@ -382,17 +621,40 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
 
   auto& voxelIndices = dataStructure.getDataRefAs<UInt64Array>(voxelIndicesPath);
 
-  // Make sure the NeighborList's outermost vector is resized to the number of tuples and initialized to non-null values (empty vectors)
-  for(const auto& interpolatedDataPath : interpolatedDataPaths)
+  // Bucket the usable points by voxel (counting sort) so that the reduction can gather per voxel
+  VoxelPointBins bins;
+  bins.offsets.assign(numVoxels + 1, 0);
+  for(usize i = 0; i < numVerts; i++)
   {
-    InitializeNeighborList(dataStructure, interpolatedGroupPath.createChildPath(interpolatedDataPath.getTargetName()));
+    if(useMask && !mask->getValue(i))
+    {
+      continue;
+    }
+    index = voxelIndices[i];
+    if(index >= numVoxels)
+    {
+      return MakeErrorResult(-11004,
+                             fmt::format("Index present in the selected Voxel Indices array that falls outside the selected Image Geometry for interpolation.\n Index = {}\n Max Image Index = {}\n",
+                                         index, numVoxels - 1));
+    }
+    bins.offsets[index + 1]++;
   }
-  for(const auto& copyDataPath : copyDataPaths)
+  for(usize i = 0; i < numVoxels; i++)
   {
-    InitializeNeighborList(dataStructure, interpolatedGroupPath.createChildPath(copyDataPath.getTargetName()));
+    bins.offsets[i + 1] += bins.offsets[i];
+  }
+  bins.pointIds.resize(bins.offsets[numVoxels]);
+  {
+    std::vector<usize> insertPos(bins.offsets.begin(), bins.offsets.end() - 1);
+    for(usize i = 0; i < numVerts; i++)
+    {
+      if(useMask && !mask->getValue(i))
+      {
+        continue;
+      }
+      bins.pointIds[insertPos[voxelIndices[i]]++] = i;
+    }
   }
-
-  usize maxImageIndex = ((dims[2] - 1) * dims[0] * dims[1]) + ((dims[1] - 1) * dims[0]) + (dims[0] - 1);
 
   kernelNumVoxels[0] = static_cast<int64>(std::ceil((kernelSize[0] / res[0]) * 0.5f));
   kernelNumVoxels[1] = static_cast<int64>(std::ceil((kernelSize[1] / res[1]) * 0.5f));
@@ -433,6 +695,63 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
     determineKernelDistances(kernelValDistances, kernelNumVoxels, res);
   }
 
+  if(!storeNeighborLists)
+  {
+    // Sum the kernel weights that reach each voxel and reduce each selected array into the dense per-voxel mean/min/max arrays
+    {
+      auto& weightsArray = dataStructure.getDataRefAs<Float64Array>(interpolatedGroupPath.createChildPath(args.value<std::string>(k_KernelWeightsArrayName_Key)));
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, weightsArray.getNumberOfTuples());
+      dataAlg.requireArraysInMemory({&weightsArray});
+      dataAlg.execute(ComputeKernelWeightsImpl(bins, kernel, kernelNumVoxels, dims, weightsArray.getDataStoreRef(), shouldCancel));
+    }
+
+    for(const auto& interpolatedDataPathItem : interpolatedDataPaths)
+    {
+      auto* sourceArray = dataStructure.getDataAs<IDataArray>(interpolatedDataPathItem);
+      if(sourceArray->getDataType() == DataType::boolean)
+      {
+        continue;
+      }
+      messageHandler(fmt::format("Interpolating '{}' onto the grid", sourceArray->getName()));
+      auto& meanArray = dataStructure.getDataRefAs<Float64Array>(interpolatedGroupPath.createChildPath(fmt::format("{}{}", sourceArray->getName(), k_MeanSuffix)));
+      auto& minArray = dataStructure.getDataRefAs<Float64Array>(interpolatedGroupPath.createChildPath(fmt::format("{}{}", sourceArray->getName(), k_MinSuffix)));
+      auto& maxArray = dataStructure.getDataRefAs<Float64Array>(interpolatedGroupPath.createChildPath(fmt::format("{}{}", sourceArray->getName(), k_MaxSuffix)));
+      ExecuteDataFunction(ReducePointCloudByKernelFunctor{}, sourceArray->getDataType(), sourceArray, bins, kernel, kernelNumVoxels, dims, meanArray, minArray, maxArray, shouldCancel);
+    }
+    for(const auto& copyDataPath : copyDataPaths)
+    {
+      auto* sourceArray = dataStructure.getDataAs<IDataArray>(copyDataPath);
+      if(sourceArray->getDataType() == DataType::boolean)
+      {
+        continue;
+      }
+      messageHandler(fmt::format("Copying '{}' onto the grid", sourceArray->getName()));
+      auto& meanArray = dataStructure.getDataRefAs<Float64Array>(interpolatedGroupPath.createChildPath(fmt::format("{}{}", sourceArray->getName(), k_MeanSuffix)));
+      auto& minArray = dataStructure.getDataRefAs<Float64Array>(interpolatedGroupPath.createChildPath(fmt::format("{}{}", sourceArray->getName(), k_MinSuffix)));
+      auto& maxArray = dataStructure.getDataRefAs<Float64Array>(interpolatedGroupPath.createChildPath(fmt::format("{}{}", sourceArray->getName(), k_MaxSuffix)));
+      ExecuteDataFunction(ReducePointCloudByKernelFunctor{}, sourceArray->getDataType(), sourceArray, bins, uniformKernel, kernelNumVoxels, dims, meanArray, minArray, maxArray, shouldCancel);
+    }
+  }
+
+  if(shouldCancel || (!storeNeighborLists && !storeKernelDistances))
+  {
+    return {};
+  }
+
+  // Make sure the NeighborList's outermost vector is resized to the number of tuples and initialized to non-null values (empty vectors)
+  if(storeNeighborLists)
+  {
+    for(const auto& interpolatedDataPath : interpolatedDataPaths)
+    {
+      InitializeNeighborList(dataStructure, interpolatedGroupPath.createChildPath(interpolatedDataPath.getTargetName()));
+    }
+    for(const auto& copyDataPath : copyDataPaths)
+    {
+      InitializeNeighborList(dataStructure, interpolatedGroupPath.createChildPath(copyDataPath.getTargetName()));
+    }
+  }
+
   usize progIncrement = numVerts / 100;
   usize prog = 1;
   usize progressInt = 0;
@@ -447,46 +766,43 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
       }
     }
     index = voxelIndices[i];
-    if(index > maxImageIndex)
-    {
-      return MakeErrorResult(-11004,
-                             fmt::format("Index present in the selected Voxel Indices array that falls outside the selected Image Geometry for interpolation.\n Index = %1\n Max Image Index = %2\n",
-                                         index, maxImageIndex));
-    }
     x = index % dims[0];
     y = (index / dims[0]) % dims[1];
     z = index / (dims[0] * dims[1]);
 
-    for(const auto& interpolatedDataPathItem : interpolatedDataPaths)
+    if(storeNeighborLists)
     {
-      const auto dynamicArrayPath = interpolatedGroupPath.createChildPath(interpolatedDataPathItem.getTargetName());
-      auto* dynamicArrayToInterpolate = dataStructure.getDataAs<INeighborList>(dynamicArrayPath);
-      auto* sourceArray = dataStructure.getDataAs<IDataArray>(interpolatedDataPathItem);
-
-      const auto& type = sourceArray->getDataType();
-      if(type == DataType::boolean) // Can't be executed will throw error
+      for(const auto& interpolatedDataPathItem : interpolatedDataPaths)
       {
-        continue;
-      }
+        const auto dynamicArrayPath = interpolatedGroupPath.createChildPath(interpolatedDataPathItem.getTargetName());
+        auto* dynamicArrayToInterpolate = dataStructure.getDataAs<INeighborList>(dynamicArrayPath);
+        auto* sourceArray = dataStructure.getDataAs<IDataArray>(interpolatedDataPathItem);
 
-      // NO BOOL
-      ExecuteNeighborFunction(MapPointCloudDataByKernelFunctor{}, type, sourceArray, dynamicArrayToInterpolate, kernel, kernelNumVoxels, dims.data(), x, y, z, i);
-    }
+        const auto& type = sourceArray->getDataType();
+        if(type == DataType::boolean) // Can't be executed will throw error
+        {
+          continue;
+        }
 
-    for(const auto& copyDataPath : copyDataPaths)
-    {
-      auto dynamicArrayPath = interpolatedGroupPath.createChildPath(copyDataPath.getTargetName());
-      auto* dynamicArrayToCopy = dataStructure.getDataAs<INeighborList>(dynamicArrayPath);
-      auto* sourceArray = dataStructure.getDataAs<IDataArray>(copyDataPath);
+        // NO BOOL
+        ExecuteNeighborFunction(MapPointCloudDataByKernelFunctor{}, type, sourceArray, dynamicArrayToInterpolate, kernel, kernelNumVoxels, dims.data(), x, y, z, i);
+      }
 
-      const auto& type = sourceArray->getDataType();
-      if(type == DataType::boolean) // Can't be executed will throw error
+      for(const auto& copyDataPath : copyDataPaths)
       {
-        continue;
-      }
+        auto dynamicArrayPath = interpolatedGroupPath.createChildPath(copyDataPath.getTargetName());
+        auto* dynamicArrayToCopy = dataStructure.getDataAs<INeighborList>(dynamicArrayPath);
+        auto* sourceArray = dataStructure.getDataAs<IDataArray>(copyDataPath);
+
+        const auto& type = sourceArray->getDataType();
+        if(type == DataType::boolean) // Can't be executed will throw error
+        {
+          continue;
+        }
 
-      // NO BOOL
-      ExecuteNeighborFunction(MapPointCloudDataByKernelFunctor{}, type, sourceArray, dynamicArrayToCopy, uniformKernel, kernelNumVoxels, dims.data(), x, y, z, i);
+        // NO BOOL
+        ExecuteNeighborFunction(MapPointCloudDataByKernelFunctor{}, type, sourceArray, dynamicArrayToCopy, uniformKernel, kernelNumVoxels, dims.data(), x, y, z, i);
+      }
     }
 
     if(storeKernelDistances)
@@ -533,6 +849,8 @@ constexpr StringLiteral k_CopySuffixKey = "CopySuffix";
 Result<Arguments> InterpolatePointCloudToRegularGridFilter::FromSIMPLJson(const nlohmann::json& json)
 {
   Arguments args = InterpolatePointCloudToRegularGridFilter().getDefaultArguments();
+  // SIMPL always produced the per-voxel NeighborLists
+  args.insertOrAssign(k_StoreNeighborLists_Key, std::make_any<bool>(true));
 
   std::vector<Result<>> results;
 
@@ -38,9 +38,16 @@ public:
   static inline constexpr StringLiteral k_CopyArrays_Key = "copy_arrays";
   static inline constexpr StringLiteral k_InterpolatedGroupName_Key = "interpolated_group_name";
   static inline constexpr StringLiteral k_KernelDistancesArrayName_Key = "kernel_distances_array_name";
+  static inline constexpr StringLiteral k_StoreNeighborLists_Key = "store_neighbor_lists";
+  static inline constexpr StringLiteral k_KernelWeightsArrayName_Key = "kernel_weights_array_name";
   static inline constexpr uint64 k_Uniform = 0;
   static inline constexpr uint64 k_Gaussian = 1;
 
+  // Suffixes appended to the source array name for the dense per-voxel reductions
+  static inline constexpr StringLiteral k_MeanSuffix = "_Mean";
+  static inline constexpr StringLiteral k_MinSuffix = "_Min";
+  static inline constexpr StringLiteral k_MaxSuffix = "_Max";
+
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
    * @param json
@@ -120,6 +127,13 @@ protected:
    */
   Result<> executeImpl(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
                        const std::atomic_bool& shouldCancel) const override;
+
+  /**
+   * @brief Version 1 pipelines always produced the per-voxel NeighborLists, so they keep doing so.
+   * @param args
+   * @param version
+   */
+  void updateArgumentsFromVersion(Arguments& args, VersionType version) const override;
 };
 } // namespace nx::core
 
@@ -2,6 +2,7 @@
 
 #include "simplnx/Common/TypeTraits.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Parameters/ArrayThresholdsParameter.hpp"
 #include "simplnx/Parameters/BoolParameter.hpp"
@@ -11,6 +12,7 @@
 #include "simplnx/Parameters/NumericTypeParameter.hpp"
 #include "simplnx/Utilities/ArrayThreshold.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include <algorithm>
@@ -19,276 +21,310 @@ namespace nx::core
 {
 namespace
 {
-template <typename U>
-class ThresholdFilterHelper
-{
-public:
-  ThresholdFilterHelper(nx::core::ArrayThreshold::ComparisonType compType, nx::core::ArrayThreshold::ComparisonValue compValue, std::vector<U>& output)
-  : m_ComparisonOperator(compType)
-  , m_ComparisonValue(compValue)
-  , m_Output(output)
-  {
-  }
+// Number of tuples evaluated together. Every comparison is applied to a whole block
+// before the next one so the inner loops are simple enough to be vectorized.
+constexpr usize k_BlockSize = 4096;
 
-  ~ThresholdFilterHelper() = default;
-
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataLessThan(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
+template <typename T, typename InputAccessor>
+void CompareBlock(ArrayThreshold::ComparisonType comparisonType, T value, usize count, uint8* result, InputAccessor input)
+{
+  switch(comparisonType)
   {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
+  case ArrayThreshold::ComparisonType::LessThan:
+    for(usize i = 0; i < count; i++)
     {
-      m_Output[i] = (m_Input[i] < value) ? trueValue : falseValue;
+      result[i] = static_cast<uint8>(input(i) < value);
     }
-  }
-
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataGreaterThan(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
-  {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
+    break;
+  case ArrayThreshold::ComparisonType::GreaterThan:
+    for(usize i = 0; i < count; i++)
     {
-      m_Output[i] = (m_Input[i] > value) ? trueValue : falseValue;
+      result[i] = static_cast<uint8>(input(i) > value);
     }
-  }
-
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataEqualTo(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
-  {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
+    break;
+  case ArrayThreshold::ComparisonType::Operator_Equal:
+    for(usize i = 0; i < count; i++)
+    {
+      result[i] = static_cast<uint8>(input(i) == value);
+    }
+    break;
+  case ArrayThreshold::ComparisonType::Operator_NotEqual:
+    for(usize i = 0; i < count; i++)
     {
-      m_Output[i] = (m_Input[i] == value) ? trueValue : falseValue;
+      result[i] = static_cast<uint8>(input(i) != value);
     }
+    break;
   }
+}
+
+/**
+ * @brief A single comparison of an input array against a value. The input type is resolved
+ * once when the threshold program is compiled, so evaluating a block costs one virtual call.
+ */
+class IThresholdComparison
+{
+public:
+  IThresholdComparison() = default;
+  virtual ~IThresholdComparison() = default;
+
+  IThresholdComparison(const IThresholdComparison&) = delete;
+  IThresholdComparison(IThresholdComparison&&) noexcept = delete;
+  IThresholdComparison& operator=(const IThresholdComparison&) = delete;
+  IThresholdComparison& operator=(IThresholdComparison&&) noexcept = delete;
 
   /**
-   * @brief
+   * @brief Writes 1 or 0 into result for each of the count tuples starting at start.
    */
-  template <typename T>
-  void filterDataNotEqualTo(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
+  virtual void evaluate(usize start, usize count, uint8* result) const = 0;
+};
+
+template <typename T>
+class ThresholdComparison : public IThresholdComparison
+{
+public:
+  ThresholdComparison(const AbstractDataStore<T>& inputStore, ArrayThreshold::ComparisonType comparisonType, ArrayThreshold::ComparisonValue comparisonValue)
+  : m_InputStore(inputStore)
+  , m_ComparisonType(comparisonType)
+  , m_ComparisonValue(static_cast<T>(comparisonValue))
   {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      m_Output[i] = (m_Input[i] != value) ? trueValue : falseValue;
-    }
+    // In memory stores are read straight from their buffer
+    const auto* dataStorePtr = dynamic_cast<const DataStore<T>*>(&inputStore);
+    m_InputData = dataStorePtr != nullptr ? dataStorePtr->data() : nullptr;
   }
 
-  template <typename Type>
-  void filterData(const AbstractDataStore<Type>& input, Type trueValue, Type falseValue)
+  ~ThresholdComparison() override = default;
+
+  void evaluate(usize start, usize count, uint8* result) const override
   {
-    if(m_ComparisonOperator == ArrayThreshold::ComparisonType::LessThan)
-    {
-      filterDataLessThan<Type>(input, trueValue, falseValue);
-    }
-    else if(m_ComparisonOperator == ArrayThreshold::ComparisonType::GreaterThan)
-    {
-      filterDataGreaterThan<Type>(input, trueValue, falseValue);
-    }
-    else if(m_ComparisonOperator == ArrayThreshold::ComparisonType::Operator_Equal)
-    {
-      filterDataEqualTo<Type>(input, trueValue, falseValue);
-    }
-    else if(m_ComparisonOperator == ArrayThreshold::ComparisonType::Operator_NotEqual)
+    if(m_InputData != nullptr)
     {
-      filterDataNotEqualTo<Type>(input, trueValue, falseValue);
+      const T* inputData = m_InputData + start;
+      CompareBlock<T>(m_ComparisonType, m_ComparisonValue, count, result, [inputData](usize i) { return inputData[i]; });
     }
     else
     {
-      std::string errorMessage = fmt::format("MultiThresholdObjects Comparison Operator not understood: '{}'", static_cast<int>(m_ComparisonOperator));
-      throw std::runtime_error(errorMessage);
+      CompareBlock<T>(m_ComparisonType, m_ComparisonValue, count, result, [this, start](usize i) { return m_InputStore.getValue(start + i); });
     }
   }
 
 private:
-  nx::core::ArrayThreshold::ComparisonType m_ComparisonOperator;
-  nx::core::ArrayThreshold::ComparisonValue m_ComparisonValue;
-  std::vector<U>& m_Output;
-
-public:
-  ThresholdFilterHelper(const ThresholdFilterHelper&) = delete;            // Copy Constructor Not Implemented
-  ThresholdFilterHelper(ThresholdFilterHelper&&) = delete;                 // Move Constructor Not Implemented
-  ThresholdFilterHelper& operator=(const ThresholdFilterHelper&) = delete; // Copy Assignment Not Implemented
-  ThresholdFilterHelper& operator=(ThresholdFilterHelper&&) = delete;      // Move Assignment Not Implemented
+  const AbstractDataStore<T>& m_InputStore;
+  const T* m_InputData = nullptr;
+  ArrayThreshold::ComparisonType m_ComparisonType;
+  T m_ComparisonValue;
 };
 
-struct ExecuteThresholdHelper
+struct CreateThresholdComparisonFunctor
 {
-  template <typename Type, typename MaskType>
-  void operator()(ThresholdFilterHelper<MaskType>& helper, const IDataArray* iDataArray, Type trueValue, Type falseValue)
+  template <typename T>
+  std::unique_ptr<IThresholdComparison> operator()(const IDataArray& inputArray, const ArrayThreshold& threshold)
   {
-    const auto& dataStore = iDataArray->template getIDataStoreRefAs<AbstractDataStore<Type>>();
-    helper.template filterData<Type>(dataStore, trueValue, falseValue);
+    return std::make_unique<ThresholdComparison<T>>(inputArray.template getIDataStoreRefAs<AbstractDataStore<T>>(), threshold.getComparisonType(), threshold.getComparisonValue());
   }
 };
 
 /**
- * @brief InsertThreshold
- * @param numItems
- * @param currentArrayPtr
- * @param unionOperator
- * @param newArrayPtr
- * @param inverse
+ * @brief The ArrayThresholdSet tree flattened into a list of instructions. Sets become a
+ * BeginSet/EndSet pair around the instructions of their children. Every comparison or set
+ * result is combined into the result of its parent set with its own union operator, except for
+ * the first entry of a set which initializes it. Inverted entries are negated before combining.
  */
-template <typename T>
-void InsertThreshold(usize numItems, AbstractDataStore<T>& currentStore, nx::core::IArrayThreshold::UnionOperator unionOperator, std::vector<T>& newArrayPtr, bool inverse, T trueValue, T falseValue)
+class ThresholdProgram
 {
-  for(usize i = 0; i < numItems; i++)
+public:
+  enum class OpCode : uint8
   {
-    // invert the current comparison if necessary
-    if(inverse)
-    {
-      newArrayPtr[i] = (newArrayPtr[i] == trueValue) ? falseValue : trueValue;
-    }
+    Compare,
+    BeginSet,
+    EndSet
+  };
 
-    if(nx::core::IArrayThreshold::UnionOperator::Or == unionOperator)
-    {
-      currentStore[i] = (currentStore[i] == trueValue || newArrayPtr[i] == trueValue) ? trueValue : falseValue;
-    }
-    else if(currentStore[i] == falseValue || newArrayPtr[i] == falseValue)
-    {
-      currentStore[i] = falseValue;
-    }
+  struct Instruction
+  {
+    OpCode opCode = OpCode::Compare;
+    std::unique_ptr<IThresholdComparison> comparison;
+    IArrayThreshold::UnionOperator unionOperator = IArrayThreshold::UnionOperator::And;
+    bool isFirst = false;
+    bool isInverted = false;
+  };
+
+  ThresholdProgram(const ArrayThresholdSet& thresholdSet, const DataStructure& dataStructure)
+  : m_IsInverted(thresholdSet.isInverted())
+  {
+    compileSet(thresholdSet, dataStructure, 0);
   }
-}
 
-template <typename T>
-void ThresholdValue(std::shared_ptr<ArrayThreshold>& comparisonValue, const DataStructure& dataStructure, AbstractDataStore<T>& outputResultStore, int32_t& err, bool replaceInput, bool inverse,
-                    T trueValue, T falseValue)
-{
-  if(nullptr == comparisonValue)
+  /**
+   * @brief Number of block sized buffers evaluate() needs, one per nesting level.
+   */
+  usize numBuffers() const
   {
-    err = -1;
-    return;
+    return m_MaxDepth + 1;
   }
 
-  // Get the total number of tuples, create and initialize an array with FALSE to use for these results
-  size_t totalTuples = outputResultStore.getNumberOfTuples();
-  std::vector<T> tempResultVector(totalTuples, falseValue);
-
-  nx::core::ArrayThreshold::ComparisonType compOperator = comparisonValue->getComparisonType();
-  nx::core::ArrayThreshold::ComparisonValue compValue = comparisonValue->getComparisonValue();
-  nx::core::IArrayThreshold::UnionOperator unionOperator = comparisonValue->getUnionOperator();
-
-  DataPath inputDataArrayPath = comparisonValue->getArrayPath();
-
-  ThresholdFilterHelper<T> helper(compOperator, compValue, tempResultVector);
-
-  const auto* iDataArray = dataStructure.getDataAs<IDataArray>(inputDataArrayPath);
-
-  ExecuteDataFunction(ExecuteThresholdHelper{}, iDataArray->getDataType(), helper, iDataArray, trueValue, falseValue);
-
-  if(replaceInput)
+  /**
+   * @brief Evaluates count tuples starting at start. The result ends up in the first buffer.
+   * @param buffers numBuffers() * k_BlockSize values
+   * @param scratch k_BlockSize values
+   */
+  void evaluate(usize start, usize count, uint8* buffers, uint8* scratch) const
   {
-    if(inverse)
+    usize depth = 0;
+    std::fill_n(buffers, count, static_cast<uint8>(0));
+    for(const auto& instruction : m_Instructions)
     {
-      std::reverse(tempResultVector.begin(), tempResultVector.end());
+      switch(instruction.opCode)
+      {
+      case OpCode::Compare:
+        instruction.comparison->evaluate(start, count, scratch);
+        Combine(instruction, scratch, buffers + depth * k_BlockSize, count);
+        break;
+      case OpCode::BeginSet:
+        depth++;
+        std::fill_n(buffers + depth * k_BlockSize, count, static_cast<uint8>(0));
+        break;
+      case OpCode::EndSet:
+        depth--;
+        Combine(instruction, buffers + (depth + 1) * k_BlockSize, buffers + depth * k_BlockSize, count);
+        break;
+      }
     }
-    // copy the temp uint8 vector to the final uint8 result array
-    for(size_t i = 0; i < totalTuples; i++)
+    if(m_IsInverted)
     {
-      outputResultStore[i] = tempResultVector[i];
+      for(usize i = 0; i < count; i++)
+      {
+        buffers[i] ^= 1;
+      }
     }
   }
-  else
+
+private:
+  static void Combine(const Instruction& instruction, const uint8* value, uint8* result, usize count)
   {
-    // insert into current threshold
-    InsertThreshold<T>(totalTuples, outputResultStore, unionOperator, tempResultVector, inverse, trueValue, falseValue);
+    const uint8 invertMask = instruction.isInverted ? 1 : 0;
+    if(instruction.isFirst)
+    {
+      for(usize i = 0; i < count; i++)
+      {
+        result[i] = value[i] ^ invertMask;
+      }
+    }
+    else if(instruction.unionOperator == IArrayThreshold::UnionOperator::Or)
+    {
+      for(usize i = 0; i < count; i++)
+      {
+        result[i] |= value[i] ^ invertMask;
+      }
+    }
+    else
+    {
+      for(usize i = 0; i < count; i++)
+      {
+        result[i] &= value[i] ^ invertMask;
+      }
+    }
   }
-}
 
-struct ThresholdValueFunctor
-{
-  template <typename T>
-  void operator()(std::shared_ptr<ArrayThreshold>& comparisonValue, const DataStructure& dataStructure, IDataArray* outputResultArray, int32_t& err, bool replaceInput, bool inverse, T trueValue,
-                  T falseValue)
+  void compileSet(const ArrayThresholdSet& thresholdSet, const DataStructure& dataStructure, usize depth)
   {
-    // Traditionally we would do a check to ensure we get a valid pointer, I'm forgoing that check because it
-    // was essentially done in the preflight part.
-    ThresholdValue(comparisonValue, dataStructure, outputResultArray->template getIDataStoreRefAs<AbstractDataStore<T>>(), err, replaceInput, inverse, trueValue, falseValue);
+    m_MaxDepth = std::max(m_MaxDepth, depth);
+    bool isFirst = true;
+    for(const std::shared_ptr<IArrayThreshold>& threshold : thresholdSet.getArrayThresholds())
+    {
+      Instruction instruction;
+      instruction.unionOperator = threshold->getUnionOperator();
+      instruction.isFirst = isFirst;
+      instruction.isInverted = threshold->isInverted();
+      if(const auto* comparisonSet = dynamic_cast<const ArrayThresholdSet*>(threshold.get()); comparisonSet != nullptr)
+      {
+        Instruction beginSet;
+        beginSet.opCode = OpCode::BeginSet;
+        m_Instructions.push_back(std::move(beginSet));
+        compileSet(*comparisonSet, dataStructure, depth + 1);
+        instruction.opCode = OpCode::EndSet;
+      }
+      else if(const auto* comparisonValue = dynamic_cast<const ArrayThreshold*>(threshold.get()); comparisonValue != nullptr)
+      {
+        // Traditionally we would do a check to ensure we get a valid pointer, I'm forgoing that check because it
+        // was essentially done in the preflight part.
+        const auto& inputArray = dataStructure.getDataRefAs<IDataArray>(comparisonValue->getArrayPath());
+        instruction.opCode = OpCode::Compare;
+        instruction.comparison = ExecuteDataFunction(CreateThresholdComparisonFunctor{}, inputArray.getDataType(), inputArray, *comparisonValue);
+      }
+      else
+      {
+        continue;
+      }
+      m_Instructions.push_back(std::move(instruction));
+      isFirst = false;
+    }
   }
+
+  std::vector<Instruction> m_Instructions;
+  usize m_MaxDepth = 0;
+  bool m_IsInverted = false;
 };
 
+/**
+ * @brief Evaluates the threshold program over a range of tuples one block at a time and
+ * writes the TRUE/FALSE values of each block into the mask.
+ */
 template <typename T>
-void ThresholdSet(std::shared_ptr<ArrayThresholdSet>& inputComparisonSet, const DataStructure& dataStructure, AbstractDataStore<T>& outputResultStore, int32_t& err, bool replaceInput, bool inverse,
-                  T trueValue, T falseValue)
+class EvaluateThresholdProgramImpl
 {
-  if(nullptr == inputComparisonSet)
+public:
+  EvaluateThresholdProgramImpl(const ThresholdProgram& program, AbstractDataStore<T>& maskStore, T trueValue, T falseValue)
+  : m_Program(program)
+  , m_MaskStore(maskStore)
+  , m_TrueValue(trueValue)
+  , m_FalseValue(falseValue)
   {
-    return;
   }
 
-  // Get the total number of tuples, create and initialize an array with FALSE to use for these results
-  size_t totalTuples = outputResultStore.getNumberOfTuples();
-  std::vector<T> tempResultVector(totalTuples, falseValue);
-
-  T firstValueFound = 0;
-
-  ArrayThresholdSet::CollectionType thresholds = inputComparisonSet->getArrayThresholds();
-  for(const std::shared_ptr<IArrayThreshold>& threshold : thresholds)
+  void operator()(const Range& range) const
   {
-    if(std::dynamic_pointer_cast<ArrayThresholdSet>(threshold))
+    std::vector<uint8> buffers(m_Program.numBuffers() * k_BlockSize, 0);
+    std::vector<uint8> scratch(k_BlockSize, 0);
+    auto* maskDataStorePtr = dynamic_cast<DataStore<T>*>(&m_MaskStore);
+    for(usize start = range.min(); start < range.max(); start += k_BlockSize)
     {
-      std::shared_ptr<ArrayThresholdSet> comparisonSet = std::dynamic_pointer_cast<ArrayThresholdSet>(threshold);
-      ThresholdSet<T>(comparisonSet, dataStructure, outputResultStore, err, !firstValueFound, false, trueValue, falseValue);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ArrayThreshold>(threshold))
-    {
-      std::shared_ptr<ArrayThreshold> comparisonValue = std::dynamic_pointer_cast<ArrayThreshold>(threshold);
-
-      ThresholdValue<T>(comparisonValue, dataStructure, outputResultStore, err, !firstValueFound, false, trueValue, falseValue);
-      firstValueFound = true;
+      const usize count = std::min(k_BlockSize, range.max() - start);
+      m_Program.evaluate(start, count, buffers.data(), scratch.data());
+      if(maskDataStorePtr != nullptr)
+      {
+        T* maskData = maskDataStorePtr->data() + start;
+        for(usize i = 0; i < count; i++)
+        {
+          maskData[i] = buffers[i] != 0 ? m_TrueValue : m_FalseValue;
+        }
+      }
+      else
+      {
+        for(usize i = 0; i < count; i++)
+        {
+          m_MaskStore.setValue(start + i, buffers[i] != 0 ? m_TrueValue : m_FalseValue);
+        }
+      }
     }
   }
 
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      std::reverse(tempResultVector.begin(), tempResultVector.end());
-    }
-    // copy the temp uint8 vector to the final uint8 result array
-    for(size_t i = 0; i < totalTuples; i++)
-    {
-      outputResultStore[i] = tempResultVector[i];
-    }
-  }
-  else
-  {
-    // insert into current threshold
-    InsertThreshold<T>(totalTuples, outputResultStore, inputComparisonSet->getUnionOperator(), tempResultVector, inverse, trueValue, falseValue);
-  }
-}
+private:
+  const ThresholdProgram& m_Program;
+  AbstractDataStore<T>& m_MaskStore;
+  T m_TrueValue;
+  T m_FalseValue;
+};
 
-struct ThresholdSetFunctor
+struct EvaluateThresholdProgramFunctor
 {
   template <typename T>
-  void operator()(std::shared_ptr<ArrayThresholdSet>& inputComparisonSet, const DataStructure& dataStructure, IDataArray* outputResultArray, int32_t& err, bool replaceInput, bool inverse, T trueValue,
-                  T falseValue)
+  void operator()(const ThresholdProgram& program, IDataArray& maskArray, const IParallelAlgorithm::AlgorithmArrays& algorithmArrays, float64 trueValue, float64 falseValue)
   {
-    if(outputResultArray == nullptr)
-    {
-      return;
-    }
-
-    // Traditionally we would do a check to ensure we get a valid pointer, I'm forgoing that check because it
-    // was essentially done in the preflight part.
-    ThresholdSet<T>(inputComparisonSet, dataStructure, outputResultArray->template getIDataStoreRefAs<AbstractDataStore<T>>(), err, replaceInput, inverse, trueValue, falseValue);
+    auto& maskStore = maskArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, maskStore.getNumberOfTuples());
+    dataAlg.requireArraysInMemory(algorithmArrays);
+    dataAlg.execute(EvaluateThresholdProgramImpl<T>(program, maskStore, static_cast<T>(trueValue), static_cast<T>(falseValue)));
   }
 };
 
@@ -498,28 +534,20 @@ Result<> MultiThresholdObjectsFilter::executeImpl(DataStructure& dataStructure,
   float64 trueValue = useCustomTrueValue ? customTrueValue : 1.0;
   float64 falseValue = useCustomFalseValue ? customFalseValue : 0.0;
 
-  bool firstValueFound = false;
   DataPath maskArrayPath = (*thresholdsObject.getRequiredPaths().begin()).replaceName(maskArrayName);
-  int32_t err = 0;
-  ArrayThresholdSet::CollectionType thresholdSet = thresholdsObject.getArrayThresholds();
-  for(const std::shared_ptr<IArrayThreshold>& threshold : thresholdSet)
+  auto& maskArray = dataStructure.getDataRefAs<IDataArray>(maskArrayPath);
+
+  // Compile the threshold tree once and evaluate it in a single pass over the mask
+  const ThresholdProgram program(thresholdsObject, dataStructure);
+
+  IParallelAlgorithm::AlgorithmArrays algorithmArrays = {&maskArray};
+  for(const auto& thresholdPath : thresholdsObject.getRequiredPaths())
   {
-    if(std::dynamic_pointer_cast<ArrayThresholdSet>(threshold))
-    {
-      std::shared_ptr<ArrayThresholdSet> comparisonSet = std::dynamic_pointer_cast<ArrayThresholdSet>(threshold);
-      ExecuteDataFunction(ThresholdSetFunctor{}, maskArrayType, comparisonSet, dataStructure, dataStructure.getDataAs<IDataArray>(maskArrayPath), err, !firstValueFound, thresholdsObject.isInverted(),
-                          trueValue, falseValue);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ArrayThreshold>(threshold))
-    {
-      std::shared_ptr<ArrayThreshold> comparisonValue = std::dynamic_pointer_cast<ArrayThreshold>(threshold);
-      ExecuteDataFunction(ThresholdValueFunctor{}, maskArrayType, comparisonValue, dataStructure, dataStructure.getDataAs<IDataArray>(maskArrayPath), err, !firstValueFound,
-                          thresholdsObject.isInverted(), trueValue, falseValue);
-      firstValueFound = true;
-    }
+    algorithmArrays.push_back(dataStructure.getDataAs<IDataArray>(thresholdPath));
   }
 
+  ExecuteDataFunction(EvaluateThresholdProgramFunctor{}, maskArrayType, program, maskArray, algorithmArrays, trueValue, falseValue);
+
   return {};
 }
 
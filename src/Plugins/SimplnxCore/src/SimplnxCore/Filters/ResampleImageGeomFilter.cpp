@@ -37,6 +37,8 @@ const ChoicesParameter::ValueType k_SpacingModeIndex = 0;
 const ChoicesParameter::ValueType k_ScalingModeIndex = 1;
 const ChoicesParameter::ValueType k_ExactDimensionsModeIndex = 2;
 
+const ChoicesParameter::Choices k_InterpolationChoices = {"Nearest Neighbor (0)", "Trilinear (1)", "Majority Vote (2)"};
+
 } // namespace
 
 namespace nx::core
@@ -95,6 +97,12 @@ Parameters ResampleImageGeomFilter::parameters() const
   params.insert(std::make_unique<VectorUInt64Parameter>(k_ExactDimensions_Key, "Exact Dimensions (pixels)", "The exact dimension size values (dx, dy, dz) to resample the geometry, in pixels.",
                                                         std::vector<uint64>{100, 100, 100}, std::vector<std::string>{"X", "Y", "Z"}));
 
+  params.insert(std::make_unique<ChoicesParameter>(k_InterpolationMode_Key, "Interpolation Mode",
+                                                   "How the resampled values are computed. [0] Nearest Neighbor copies the source cell, [1] Trilinear blends the 8 closest "
+                                                   "source cells of floating point arrays, [2] Majority Vote takes the most common value of the source cells covered by "
+                                                   "single component integer and boolean arrays. Arrays an interpolation does not apply to use Nearest Neighbor.",
+                                                   ResampleImageGeom::k_NearestNeighborIndex, ::k_InterpolationChoices));
+
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_RemoveOriginalGeometry_Key, "Perform In Place", "Removes the original Image Geometry after filter is completed", true));
 
   params.insertSeparator(Parameters::Separator{"Input Image Geometry"});
@@ -125,7 +133,12 @@ Parameters ResampleImageGeomFilter::parameters() const
 //------------------------------------------------------------------------------
 IFilter::VersionType ResampleImageGeomFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added 'interpolation_mode_index'. It defaults to Nearest Neighbor, which is the only mode version 1 had, so version 1
+  // pipelines resample exactly as before.
 }
 
 //------------------------------------------------------------------------------
@@ -386,6 +399,7 @@ Result<> ResampleImageGeomFilter::executeImpl(DataStructure& dataStructure, cons
 
   inputValues.RemoveOriginalImageGeom = filterArgs.value<bool>(k_RemoveOriginalGeometry_Key);
   inputValues.CreatedImageGeometryPath = filterArgs.value<DataPath>(k_CreatedImageGeometry_Key);
+  inputValues.InterpolationMode = filterArgs.value<ChoicesParameter::ValueType>(k_InterpolationMode_Key);
 
   if(inputValues.RemoveOriginalImageGeom)
   {
@@ -34,6 +34,7 @@ public:
   static inline constexpr StringLiteral k_FeatureAttributeMatrix_Key = "cell_feature_attribute_matrix_path";
   static inline constexpr StringLiteral k_CreatedImageGeometry_Key = "new_data_container_path";
   static inline constexpr StringLiteral k_SelectedImageGeometryPath_Key = "input_image_geometry_path";
+  static inline constexpr StringLiteral k_InterpolationMode_Key = "interpolation_mode_index";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
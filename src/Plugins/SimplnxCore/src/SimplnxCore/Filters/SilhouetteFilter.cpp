@@ -12,6 +12,7 @@
 #include "simplnx/Parameters/ArraySelectionParameter.hpp"
 #include "simplnx/Parameters/BoolParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
+#include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/Utilities/ClusteringUtilities.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
@@ -63,6 +64,9 @@ Parameters SilhouetteFilter::parameters() const
   params.insert(
       std::make_unique<ChoicesParameter>(k_DistanceMetric_Key, "Distance Metric", "Distance Metric type to be used for calculations", to_underlying(ClusterUtilities::DistanceMetric::Euclidean),
                                          ChoicesParameter::Choices{"Euclidean", "Squared Euclidean", "Manhattan", "Cosine", "Pearson", "Squared Pearson"})); // sequence dependent DO NOT REORDER
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(
+      k_UseSampling_Key, "Use Stratified Sampling", "Compare every point against an evenly spaced subset of each cluster instead of all points. The result is an approximation", false));
+  params.insert(std::make_unique<UInt64Parameter>(k_SampleSize_Key, "Maximum Samples Per Cluster", "The largest number of points of each cluster that are used as references", 1000));
 
   // Create the parameter descriptors that are needed for this filter
   params.insertSeparator(Parameters::Separator{"Optional Data Mask"});
@@ -80,6 +84,7 @@ Parameters SilhouetteFilter::parameters() const
 
   // Associate the Linkable Parameter(s) to the children parameters that they control
   params.linkParameters(k_UseMask_Key, k_MaskArrayPath_Key, true);
+  params.linkParameters(k_UseSampling_Key, k_SampleSize_Key, true);
 
   return params;
 }
@@ -87,7 +92,11 @@ Parameters SilhouetteFilter::parameters() const
 //------------------------------------------------------------------------------
 IFilter::VersionType SilhouetteFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added 'use_sampling' and 'sample_size'
 }
 
 //------------------------------------------------------------------------------
@@ -105,9 +114,16 @@ IFilter::PreflightResult SilhouetteFilter::preflightImpl(const DataStructure& da
   auto pMaskArrayPathValue = filterArgs.value<DataPath>(k_MaskArrayPath_Key);
   auto pFeatureIdsArrayPathValue = filterArgs.value<DataPath>(k_FeatureIdsArrayPath_Key);
   auto pSilhouetteArrayPathValue = filterArgs.value<DataPath>(k_SilhouetteArrayPath_Key);
+  auto pUseSamplingValue = filterArgs.value<bool>(k_UseSampling_Key);
+  auto pSampleSizeValue = filterArgs.value<uint64>(k_SampleSize_Key);
 
   nx::core::Result<OutputActions> resultOutputActions;
 
+  if(pUseSamplingValue && pSampleSizeValue == 0)
+  {
+    return MakePreflightErrorResult(-8977, "The Maximum Samples Per Cluster must be greater than 0.");
+  }
+
   auto clusterArray = dataStructure.getDataAs<IDataArray>(pSelectedArrayPathValue);
   auto clusterIds = dataStructure.getDataAs<IDataArray>(pFeatureIdsArrayPathValue);
   if(clusterArray->getNumberOfTuples() != clusterIds->getNumberOfTuples())
@@ -154,6 +170,8 @@ Result<> SilhouetteFilter::executeImpl(DataStructure& dataStructure, const Argum
   inputValues.MaskArrayPath = maskPath;
   inputValues.FeatureIdsArrayPath = filterArgs.value<DataPath>(k_FeatureIdsArrayPath_Key);
   inputValues.SilhouetteArrayPath = filterArgs.value<DataPath>(k_SilhouetteArrayPath_Key);
+  inputValues.UseSampling = filterArgs.value<bool>(k_UseSampling_Key);
+  inputValues.SampleSize = filterArgs.value<uint64>(k_SampleSize_Key);
 
   return Silhouette(dataStructure, messageHandler, shouldCancel, &inputValues)();
 }
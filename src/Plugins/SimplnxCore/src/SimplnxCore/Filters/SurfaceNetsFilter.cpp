@@ -63,6 +63,9 @@ Parameters SurfaceNetsFilter::parameters() const
   params.insert(
       std::make_unique<Float32Parameter>(k_MaxDistanceFromVoxelCenter_Key, "Max Distance from Voxel Center", "The maximum allowable distance that a node can move from the voxel center", 1.0F));
   params.insert(std::make_unique<Float32Parameter>(k_RelaxationFactor_Key, "Relaxation Factor", "The factor used to determine how far a node can move in each smoothing iteration", 0.5F));
+  params.insert(std::make_unique<BoolParameter>(k_UseJacobiRelaxation_Key, "Use Parallel (Jacobi) Relaxation",
+                                                "Relax every node from the positions of the previous iteration so the iterations can run in parallel. Results differ slightly from the default relaxation.",
+                                                false));
 
   params.insertSeparator(Parameters::Separator{"Input Cell Data"});
   params.insert(std::make_unique<GeometrySelectionParameter>(k_GridGeometryDataPath_Key, "Input Image Geometry", "DataPath to input Image Geometry", DataPath{},
@@ -95,6 +98,7 @@ Parameters SurfaceNetsFilter::parameters() const
   params.linkParameters(k_ApplySmoothing_Key, k_SmoothingIterations_Key, true);
   params.linkParameters(k_ApplySmoothing_Key, k_MaxDistanceFromVoxelCenter_Key, true);
   params.linkParameters(k_ApplySmoothing_Key, k_RelaxationFactor_Key, true);
+  params.linkParameters(k_ApplySmoothing_Key, k_UseJacobiRelaxation_Key, true);
 
   return params;
 }
@@ -102,7 +106,11 @@ Parameters SurfaceNetsFilter::parameters() const
 //------------------------------------------------------------------------------
 IFilter::VersionType SurfaceNetsFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added 'use_jacobi_relaxation'
 }
 
 //------------------------------------------------------------------------------
@@ -192,6 +200,7 @@ Result<> SurfaceNetsFilter::executeImpl(DataStructure& dataStructure, const Argu
   inputValues.SmoothingIterations = filterArgs.value<int32>(k_SmoothingIterations_Key);
   inputValues.MaxDistanceFromVoxel = filterArgs.value<float32>(k_MaxDistanceFromVoxelCenter_Key);
   inputValues.RelaxationFactor = filterArgs.value<float32>(k_RelaxationFactor_Key);
+  inputValues.UseJacobiRelaxation = filterArgs.value<bool>(k_UseJacobiRelaxation_Key);
 
   inputValues.GridGeomDataPath = filterArgs.value<DataPath>(k_GridGeometryDataPath_Key);
   inputValues.FeatureIdsArrayPath = filterArgs.value<DataPath>(k_CellFeatureIdsArrayPath_Key);
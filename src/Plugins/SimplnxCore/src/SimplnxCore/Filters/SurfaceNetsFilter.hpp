@@ -41,6 +41,7 @@ public:
   static inline constexpr StringLiteral k_SmoothingIterations_Key = "smoothing_iterations";
   static inline constexpr StringLiteral k_MaxDistanceFromVoxelCenter_Key = "max_distance_from_voxel";
   static inline constexpr StringLiteral k_RelaxationFactor_Key = "relaxation_factor";
+  static inline constexpr StringLiteral k_UseJacobiRelaxation_Key = "use_jacobi_relaxation";
 
   /**
    * @brief Returns the name of the filter.
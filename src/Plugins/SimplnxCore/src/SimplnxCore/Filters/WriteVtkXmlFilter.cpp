@@ -0,0 +1,172 @@
+#include "WriteVtkXmlFilter.hpp"
+
+#include "SimplnxCore/Filters/Algorithms/WriteVtkXml.hpp"
+
+#include "simplnx/Common/AtomicFile.hpp"
+#include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/Geometry/INodeGeometry0D.hpp"
+#include "simplnx/Parameters/BoolParameter.hpp"
+#include "simplnx/Parameters/FileSystemPathParameter.hpp"
+#include "simplnx/Parameters/GeometrySelectionParameter.hpp"
+#include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
+
+#include <filesystem>
+namespace fs = std::filesystem;
+
+using namespace nx::core;
+
+namespace nx::core
+{
+//------------------------------------------------------------------------------
+std::string WriteVtkXmlFilter::name() const
+{
+  return FilterTraits<WriteVtkXmlFilter>::name.str();
+}
+
+//------------------------------------------------------------------------------
+std::string WriteVtkXmlFilter::className() const
+{
+  return FilterTraits<WriteVtkXmlFilter>::className;
+}
+
+//------------------------------------------------------------------------------
+Uuid WriteVtkXmlFilter::uuid() const
+{
+  return FilterTraits<WriteVtkXmlFilter>::uuid;
+}
+
+//------------------------------------------------------------------------------
+std::string WriteVtkXmlFilter::humanName() const
+{
+  return "Write Vtk XML File (.vti, .vtr, .vtu)";
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string> WriteVtkXmlFilter::defaultTags() const
+{
+  return {className(), "IO", "Output", "Write", "Export", "Vtk", "ParaView", "Image Data", "Rectilinear Grid", "Unstructured Grid"};
+}
+
+//------------------------------------------------------------------------------
+Parameters WriteVtkXmlFilter::parameters() const
+{
+  Parameters params;
+
+  // Create the parameter descriptors that are needed for this filter
+  params.insertSeparator(Parameters::Separator{"Input Parameter(s)"});
+  params.insert(std::make_unique<FileSystemPathParameter>(k_OutputFile_Key, "Output File",
+                                                          "The output VTK XML file. Image geometries are written as .vti, rectilinear grids as .vtr and all other geometries as .vtu",
+                                                          fs::path("data.vti"), FileSystemPathParameter::ExtensionsType{".vti", ".vtr", ".vtu"}, FileSystemPathParameter::PathType::OutputFile));
+  params.insert(std::make_unique<BoolParameter>(k_CompressData_Key, "Compress Data", "Whether to zlib compress the appended data blocks", false));
+
+  params.insertSeparator(Parameters::Separator{"Input Geometry"});
+  params.insert(std::make_unique<GeometrySelectionParameter>(k_InputGeometryPath_Key, "Input Geometry", "The geometry to write to the VTK file", DataPath{},
+                                                             GeometrySelectionParameter::AllowedTypes{IGeometry::Type::Image, IGeometry::Type::RectGrid, IGeometry::Type::Vertex, IGeometry::Type::Edge,
+                                                                                                      IGeometry::Type::Triangle, IGeometry::Type::Quad, IGeometry::Type::Tetrahedral,
+                                                                                                      IGeometry::Type::Hexahedral}));
+
+  params.insertSeparator(Parameters::Separator{"Input Data"});
+  params.insert(std::make_unique<MultiArraySelectionParameter>(k_CellDataArrayPaths_Key, "Cell Data Arrays to Write",
+                                                               "The arrays written as VTK cell data. They must have one tuple per cell (voxel, edge, face or polyhedron) of the geometry",
+                                                               MultiArraySelectionParameter::ValueType{}, MultiArraySelectionParameter::AllowedTypes{IArray::ArrayType::DataArray}, GetAllDataTypes()));
+  params.insert(std::make_unique<MultiArraySelectionParameter>(k_PointDataArrayPaths_Key, "Vertex Data Arrays to Write",
+                                                               "The arrays written as VTK point data. Only node based geometries have vertex data; they must have one tuple per vertex",
+                                                               MultiArraySelectionParameter::ValueType{}, MultiArraySelectionParameter::AllowedTypes{IArray::ArrayType::DataArray}, GetAllDataTypes()));
+
+  return params;
+}
+
+//------------------------------------------------------------------------------
+IFilter::VersionType WriteVtkXmlFilter::parametersVersion() const
+{
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+IFilter::UniquePointer WriteVtkXmlFilter::clone() const
+{
+  return std::make_unique<WriteVtkXmlFilter>();
+}
+
+//------------------------------------------------------------------------------
+IFilter::PreflightResult WriteVtkXmlFilter::preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler,
+                                                          const std::atomic_bool& shouldCancel) const
+{
+  auto pOutputFileValue = filterArgs.value<FileSystemPathParameter::ValueType>(k_OutputFile_Key);
+  auto pInputGeometryPathValue = filterArgs.value<DataPath>(k_InputGeometryPath_Key);
+  auto pCellDataArrayPathsValue = filterArgs.value<MultiArraySelectionParameter::ValueType>(k_CellDataArrayPaths_Key);
+  auto pPointDataArrayPathsValue = filterArgs.value<MultiArraySelectionParameter::ValueType>(k_PointDataArrayPaths_Key);
+
+  const auto& geometry = dataStructure.getDataRefAs<IGeometry>(pInputGeometryPathValue);
+
+  const std::string expectedExtension = WriteVtkXml::FileExtensionForGeometry(geometry.getGeomType());
+  if(pOutputFileValue.extension().string() != expectedExtension)
+  {
+    return MakePreflightErrorResult(-2090, fmt::format("The selected geometry '{}' must be written to a '{}' file but the output file is '{}'", pInputGeometryPathValue.toString(), expectedExtension,
+                                                       pOutputFileValue.string()));
+  }
+
+  const usize numCells = geometry.getNumberOfCells();
+  for(const auto& arrayPath : pCellDataArrayPathsValue)
+  {
+    const auto& dataArray = dataStructure.getDataRefAs<IDataArray>(arrayPath);
+    if(dataArray.getNumberOfTuples() != numCells)
+    {
+      return MakePreflightErrorResult(-2091, fmt::format("The cell data array '{}' has {} tuples but the geometry '{}' has {} cells", arrayPath.toString(), dataArray.getNumberOfTuples(),
+                                                         pInputGeometryPathValue.toString(), numCells));
+    }
+  }
+
+  if(!pPointDataArrayPathsValue.empty())
+  {
+    const auto* nodeGeom = dynamic_cast<const INodeGeometry0D*>(&geometry);
+    if(nodeGeom == nullptr)
+    {
+      return MakePreflightErrorResult(-2092, fmt::format("Vertex data arrays were selected but the geometry '{}' does not have vertex data", pInputGeometryPathValue.toString()));
+    }
+    const usize numVertices = nodeGeom->getNumberOfVertices();
+    for(const auto& arrayPath : pPointDataArrayPathsValue)
+    {
+      const auto& dataArray = dataStructure.getDataRefAs<IDataArray>(arrayPath);
+      if(dataArray.getNumberOfTuples() != numVertices)
+      {
+        return MakePreflightErrorResult(-2093, fmt::format("The vertex data array '{}' has {} tuples but the geometry '{}' has {} vertices", arrayPath.toString(), dataArray.getNumberOfTuples(),
+                                                           pInputGeometryPathValue.toString(), numVertices));
+      }
+    }
+  }
+
+  return {};
+}
+
+//------------------------------------------------------------------------------
+Result<> WriteVtkXmlFilter::executeImpl(DataStructure& dataStructure, const Arguments& filterArgs, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                                        const std::atomic_bool& shouldCancel) const
+{
+  auto atomicFileResult = AtomicFile::Create(filterArgs.value<FileSystemPathParameter::ValueType>(k_OutputFile_Key));
+  if(atomicFileResult.invalid())
+  {
+    return ConvertResult(std::move(atomicFileResult));
+  }
+  AtomicFile atomicFile = std::move(atomicFileResult.value());
+
+  WriteVtkXmlInputValues inputValues;
+
+  inputValues.OutputFile = atomicFile.tempFilePath();
+  inputValues.CompressData = filterArgs.value<bool>(k_CompressData_Key);
+  inputValues.InputGeometryPath = filterArgs.value<DataPath>(k_InputGeometryPath_Key);
+  inputValues.CellDataArrayPaths = filterArgs.value<MultiArraySelectionParameter::ValueType>(k_CellDataArrayPaths_Key);
+  inputValues.PointDataArrayPaths = filterArgs.value<MultiArraySelectionParameter::ValueType>(k_PointDataArrayPaths_Key);
+
+  auto result = WriteVtkXml(dataStructure, messageHandler, shouldCancel, &inputValues)();
+  if(result.valid() && !shouldCancel)
+  {
+    Result<> commitResult = atomicFile.commit();
+    if(commitResult.invalid())
+    {
+      return commitResult;
+    }
+  }
+  return result;
+}
+} // namespace nx::core
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "SimplnxCore/SimplnxCore_export.hpp"
+
+#include "simplnx/Filter/FilterTraits.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+
+namespace nx::core
+{
+/**
+ * @class WriteVtkXmlFilter
+ * @brief This filter writes a geometry and its selected arrays to a VTK XML file: ImageData (.vti),
+ * RectilinearGrid (.vtr) or UnstructuredGrid (.vtu). The heavy data is stored in a raw appended
+ * section, optionally zlib compressed.
+ */
+class SIMPLNXCORE_EXPORT WriteVtkXmlFilter : public IFilter
+{
+public:
+  WriteVtkXmlFilter() = default;
+  ~WriteVtkXmlFilter() noexcept override = default;
+
+  WriteVtkXmlFilter(const WriteVtkXmlFilter&) = delete;
+  WriteVtkXmlFilter(WriteVtkXmlFilter&&) noexcept = delete;
+
+  WriteVtkXmlFilter& operator=(const WriteVtkXmlFilter&) = delete;
+  WriteVtkXmlFilter& operator=(WriteVtkXmlFilter&&) noexcept = delete;
+
+  // Parameter Keys
+  static inline constexpr StringLiteral k_OutputFile_Key = "output_file";
+  static inline constexpr StringLiteral k_CompressData_Key = "compress_data";
+  static inline constexpr StringLiteral k_InputGeometryPath_Key = "input_geometry_path";
+  static inline constexpr StringLiteral k_CellDataArrayPaths_Key = "input_cell_data_array_paths";
+  static inline constexpr StringLiteral k_PointDataArrayPaths_Key = "input_point_data_array_paths";
+
+  /**
+   * @brief Returns the name of the filter.
+   * @return
+   */
+  std::string name() const override;
+
+  /**
+   * @brief Returns the C++ classname of this filter.
+   * @return
+   */
+  std::string className() const override;
+
+  /**
+   * @brief Returns the uuid of the filter.
+   * @return
+   */
+  Uuid uuid() const override;
+
+  /**
+   * @brief Returns the human readable name of the filter.
+   * @return
+   */
+  std::string humanName() const override;
+
+  /**
+   * @brief Returns the default tags for this filter.
+   * @return
+   */
+  std::vector<std::string> defaultTags() const override;
+
+  /**
+   * @brief Returns the parameters of the filter (i.e. its inputs)
+   * @return
+   */
+  Parameters parameters() const override;
+
+  /**
+   * @brief Returns parameters version integer.
+   * Initial version should always be 1.
+   * Should be incremented everytime the parameters change.
+   * @return VersionType
+   */
+  VersionType parametersVersion() const override;
+
+  /**
+   * @brief Returns a copy of the filter.
+   * @return
+   */
+  UniquePointer clone() const override;
+
+protected:
+  /**
+   * @brief Takes in a DataStructure and checks that the filter can be run on it with the given arguments.
+   * Returns any warnings/errors. Also returns the changes that would be applied to the DataStructure.
+   * Some parts of the actions may not be completely filled out if all the required information is not available at preflight time.
+   * @param ds The input DataStructure instance
+   * @param filterArgs These are the input values for each parameter that is required for the filter
+   * @param messageHandler The MessageHandler object
+   * @return Returns a Result object with error or warning values if any of those occurred during execution of this function
+   */
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override;
+
+  /**
+   * @brief Applies the filter's algorithm to the DataStructure with the given arguments. Returns any warnings/errors.
+   * On failure, there is no guarantee that the DataStructure is in a correct state.
+   * @param ds The input DataStructure instance
+   * @param filterArgs These are the input values for each parameter that is required for the filter
+   * @param messageHandler The MessageHandler object
+   * @return Returns a Result object with error or warning values if any of those occurred during execution of this function
+   */
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& filterArgs, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override;
+};
+} // namespace nx::core
+
+SIMPLNX_DEF_FILTER_TRAITS(nx::core, WriteVtkXmlFilter, "f203e675-5180-4ca3-a2a4-f95a8f908ee2");
@@ -11,6 +11,118 @@
 #include "MMCellMap.h"
 #include "MMSurfaceNet.h"
 
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <utility>
+#include <vector>
+
+// Sets the cell flags of a block of cell slabs and counts the vertices in each slab
+class MMCellMap::SetCellFlagsImpl
+{
+public:
+  SetCellFlagsImpl(MMCellMap* cellMap, int* slabVertexCounts)
+  : m_cellMap(cellMap)
+  , m_slabVertexCounts(slabVertexCounts)
+  {
+  }
+
+  void operator()(const nx::core::Range& range) const
+  {
+    for(size_t k = range.min(); k < range.max(); k++)
+    {
+      int numVertices = 0;
+      for(int j = 0; j < m_cellMap->m_arraySize[1] - 1; j++)
+      {
+        for(int i = 0; i < m_cellMap->m_arraySize[0] - 1; i++)
+        {
+          Cell* pCell = m_cellMap->getCell(i, j, static_cast<int>(k));
+          int32_t cellLabels[8];
+          m_cellMap->getCellLabels(pCell, cellLabels);
+          pCell->flag.set(cellLabels);
+          if(pCell->flag.vertexType() != MMCellFlag::VertexType::NoVertex)
+          {
+            numVertices++;
+          }
+        }
+      }
+      m_slabVertexCounts[k] = numVertices;
+    }
+  }
+
+private:
+  MMCellMap* m_cellMap;
+  int* m_slabVertexCounts;
+};
+
+// Assigns vertex indices to the cells of a block of cell slabs, starting at each slab's offset
+class MMCellMap::SetVertexIndicesImpl
+{
+public:
+  SetVertexIndicesImpl(MMCellMap* cellMap, const int* slabVertexOffsets)
+  : m_cellMap(cellMap)
+  , m_slabVertexOffsets(slabVertexOffsets)
+  {
+  }
+
+  void operator()(const nx::core::Range& range) const
+  {
+    for(size_t k = range.min(); k < range.max(); k++)
+    {
+      int idxVtx = m_slabVertexOffsets[k];
+      for(int j = 0; j < m_cellMap->m_arraySize[1] - 1; j++)
+      {
+        for(int i = 0; i < m_cellMap->m_arraySize[0] - 1; i++)
+        {
+          Cell* pCell = m_cellMap->getCell(i, j, static_cast<int>(k));
+          if(pCell->flag.vertexType() != MMCellFlag::VertexType::NoVertex)
+          {
+            pCell->vertexIndex = idxVtx;
+            Vertex* pVtx = &m_cellMap->m_vertices[idxVtx++];
+            pVtx->cellIndex[0] = i;
+            pVtx->cellIndex[1] = j;
+            pVtx->cellIndex[2] = static_cast<int>(k);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  MMCellMap* m_cellMap;
+  const int* m_slabVertexOffsets;
+};
+
+// Relaxes a block of vertices from the previous iteration's offsets into the next offsets
+class MMCellMap::RelaxVerticesImpl
+{
+public:
+  RelaxVerticesImpl(MMCellMap* cellMap, const MMSurfaceNet::RelaxAttrs& relaxAttrs, const float* previousOffsets, float* nextOffsets)
+  : m_cellMap(cellMap)
+  , m_relaxAttrs(relaxAttrs)
+  , m_previousOffsets(previousOffsets)
+  , m_nextOffsets(nextOffsets)
+  {
+  }
+
+  void operator()(const nx::core::Range& range) const
+  {
+    for(size_t idxVtx = range.min(); idxVtx < range.max(); idxVtx++)
+    {
+      float* p = &m_nextOffsets[3 * idxVtx];
+      p[0] = m_previousOffsets[3 * idxVtx];
+      p[1] = m_previousOffsets[3 * idxVtx + 1];
+      p[2] = m_previousOffsets[3 * idxVtx + 2];
+      m_cellMap->relaxVertex(static_cast<int>(idxVtx), m_relaxAttrs, m_previousOffsets, p);
+    }
+  }
+
+private:
+  MMCellMap* m_cellMap;
+  const MMSurfaceNet::RelaxAttrs& m_relaxAttrs;
+  const float* m_previousOffsets;
+  float* m_nextOffsets;
+};
+
 // Basic cell map containing material labels
 MMCellMap::MMCellMap(int32_t* labels, int arraySize[3], float voxelSize[3])
 : m_cellArray(NULL)
@@ -72,77 +184,108 @@ MMCellMap::~MMCellMap()
 // Relax vertex positions using relaxation attributes or reset to cell centers
 void MMCellMap::relax(MMSurfaceNet::RelaxAttrs relaxAttrs)
 {
+  if(relaxAttrs.jacobiRelaxation)
+  {
+    relaxJacobi(relaxAttrs);
+    return;
+  }
+
+  // Vertices are relaxed in place so each vertex sees the already relaxed positions of
+  // the vertices visited before it in the same iteration
   for(int i = 0; i < relaxAttrs.numRelaxIterations; i++)
   {
     for(int idxVtx = 0; idxVtx < m_numVertices; idxVtx++)
     {
-      int cellIdx[3];
-      getVertexCellIndex(idxVtx, cellIdx);
-      Cell* pCell = getCell(cellIdx);
+      Cell* pCell = getCell(m_vertices[idxVtx].cellIndex);
+      relaxVertex(idxVtx, relaxAttrs, NULL, pCell->vertexOffset);
+    }
+  }
+}
+void MMCellMap::relaxJacobi(MMSurfaceNet::RelaxAttrs relaxAttrs)
+{
+  // Double buffered relaxation. Every vertex is relaxed from the positions of the previous
+  // iteration, so the vertices of an iteration are independent and are relaxed in parallel.
+  std::vector<float> previousOffsets(3 * static_cast<size_t>(m_numVertices));
+  for(int idxVtx = 0; idxVtx < m_numVertices; idxVtx++)
+  {
+    Cell* pCell = getCell(m_vertices[idxVtx].cellIndex);
+    previousOffsets[3 * idxVtx] = pCell->vertexOffset[0];
+    previousOffsets[3 * idxVtx + 1] = pCell->vertexOffset[1];
+    previousOffsets[3 * idxVtx + 2] = pCell->vertexOffset[2];
+  }
+  std::vector<float> nextOffsets(previousOffsets.size());
 
-      int numNeighbors = 0;
-      float avgP[3] = {0.0f, 0.0f, 0.0f};
-      if(pCell->flag.vertexType() == MMCellFlag::VertexType::SurfaceVertex)
-      {
-        for(MMCellFlag::Face face = MMCellFlag::Face::LeftFace; face <= MMCellFlag::Face::TopFace; ++face)
-        {
-          if(pCell->flag.faceCrossingType(face) != MMCellFlag::FaceCrossingType::NoFaceCrossing)
-          {
-            int nbrIdx[3];
-            Cell* nbrCell = getFaceNeighborCellAndIndex(cellIdx, face, nbrIdx);
-            avgP[0] += nbrCell->vertexOffset[0] + nbrIdx[0] - cellIdx[0];
-            avgP[1] += nbrCell->vertexOffset[1] + nbrIdx[1] - cellIdx[1];
-            avgP[2] += nbrCell->vertexOffset[2] + nbrIdx[2] - cellIdx[2];
-            numNeighbors++;
-          }
-        }
-      }
-      else
-      {
-        for(MMCellFlag::Face face = MMCellFlag::Face::LeftFace; face <= MMCellFlag::Face::TopFace; ++face)
-        {
-          if(pCell->flag.faceCrossingType(face) == MMCellFlag::FaceCrossingType::JunctionFaceCrossing)
-          {
-            int nbrIdx[3];
-            Cell* nbrCell = getFaceNeighborCellAndIndex(cellIdx, face, nbrIdx);
-            avgP[0] += nbrCell->vertexOffset[0] + nbrIdx[0] - cellIdx[0];
-            avgP[1] += nbrCell->vertexOffset[1] + nbrIdx[1] - cellIdx[1];
-            avgP[2] += nbrCell->vertexOffset[2] + nbrIdx[2] - cellIdx[2];
-            numNeighbors++;
-          }
-        }
-      }
+  nx::core::ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, static_cast<size_t>(m_numVertices));
+  for(int i = 0; i < relaxAttrs.numRelaxIterations; i++)
+  {
+    dataAlg.execute(RelaxVerticesImpl(this, relaxAttrs, previousOffsets.data(), nextOffsets.data()));
+    std::swap(previousOffsets, nextOffsets);
+  }
 
-      // Add a fraction of the averaged vertex position to the current position
-      float* p = pCell->vertexOffset;
-      if(numNeighbors > 0)
-      {
-        avgP[0] /= (float)numNeighbors;
-        avgP[1] /= (float)numNeighbors;
-        avgP[2] /= (float)numNeighbors;
-        float alpha = relaxAttrs.relaxFactor;
-        p[0] = (1.0 - alpha) * p[0] + alpha * avgP[0];
-        p[1] = (1.0 - alpha) * p[1] + alpha * avgP[1];
-        p[2] = (1.0 - alpha) * p[2] + alpha * avgP[2];
-
-        // Constrain vertex location to a max distance from the original voxel
-        float min = 0.5 - relaxAttrs.maxDistFromCellCenter;
-        float max = 0.5 + relaxAttrs.maxDistFromCellCenter;
-        if(p[0] < min)
-          p[0] = min;
-        if(p[0] > max)
-          p[0] = max;
-        if(p[1] < min)
-          p[1] = min;
-        if(p[1] > max)
-          p[1] = max;
-        if(p[2] < min)
-          p[2] = min;
-        if(p[2] > max)
-          p[2] = max;
-      }
+  for(int idxVtx = 0; idxVtx < m_numVertices; idxVtx++)
+  {
+    Cell* pCell = getCell(m_vertices[idxVtx].cellIndex);
+    pCell->vertexOffset[0] = previousOffsets[3 * idxVtx];
+    pCell->vertexOffset[1] = previousOffsets[3 * idxVtx + 1];
+    pCell->vertexOffset[2] = previousOffsets[3 * idxVtx + 2];
+  }
+}
+void MMCellMap::relaxVertex(int vertexIndex, const MMSurfaceNet::RelaxAttrs& relaxAttrs, const float* neighborOffsets, float vertexOffset[3])
+{
+  int cellIdx[3];
+  getVertexCellIndex(vertexIndex, cellIdx);
+  Cell* pCell = getCell(cellIdx);
+
+  // Surface vertices are pulled towards the vertices of all face neighbors across the
+  // surface. Edge and corner vertices only towards neighbors across junction faces.
+  bool isSurfaceVertex = (pCell->flag.vertexType() == MMCellFlag::VertexType::SurfaceVertex);
+  int numNeighbors = 0;
+  float avgP[3] = {0.0f, 0.0f, 0.0f};
+  for(MMCellFlag::Face face = MMCellFlag::Face::LeftFace; face <= MMCellFlag::Face::TopFace; ++face)
+  {
+    MMCellFlag::FaceCrossingType crossingType = pCell->flag.faceCrossingType(face);
+    bool isNeighbor = isSurfaceVertex ? (crossingType != MMCellFlag::FaceCrossingType::NoFaceCrossing) : (crossingType == MMCellFlag::FaceCrossingType::JunctionFaceCrossing);
+    if(isNeighbor)
+    {
+      int nbrIdx[3];
+      Cell* nbrCell = getFaceNeighborCellAndIndex(cellIdx, face, nbrIdx);
+      const float* nbrOffset = (neighborOffsets != NULL && nbrCell->vertexIndex >= 0) ? &neighborOffsets[3 * nbrCell->vertexIndex] : nbrCell->vertexOffset;
+      avgP[0] += nbrOffset[0] + nbrIdx[0] - cellIdx[0];
+      avgP[1] += nbrOffset[1] + nbrIdx[1] - cellIdx[1];
+      avgP[2] += nbrOffset[2] + nbrIdx[2] - cellIdx[2];
+      numNeighbors++;
     }
   }
+
+  // Add a fraction of the averaged vertex position to the current position
+  float* p = vertexOffset;
+  if(numNeighbors > 0)
+  {
+    avgP[0] /= (float)numNeighbors;
+    avgP[1] /= (float)numNeighbors;
+    avgP[2] /= (float)numNeighbors;
+    float alpha = relaxAttrs.relaxFactor;
+    p[0] = (1.0 - alpha) * p[0] + alpha * avgP[0];
+    p[1] = (1.0 - alpha) * p[1] + alpha * avgP[1];
+    p[2] = (1.0 - alpha) * p[2] + alpha * avgP[2];
+
+    // Constrain vertex location to a max distance from the original voxel
+    float min = 0.5 - relaxAttrs.maxDistFromCellCenter;
+    float max = 0.5 + relaxAttrs.maxDistFromCellCenter;
+    if(p[0] < min)
+      p[0] = min;
+    if(p[0] > max)
+      p[0] = max;
+    if(p[1] < min)
+      p[1] = min;
+    if(p[1] > max)
+      p[1] = max;
+    if(p[2] < min)
+      p[2] = min;
+    if(p[2] > max)
+      p[2] = max;
+  }
 }
 void MMCellMap::reset()
 {
@@ -262,25 +405,22 @@ void MMCellMap::initCell(Cell* cell, int32_t label)
 
 void MMCellMap::setCellVertices()
 {
-  // Set cell type and count cell vertices. There are no vertices in right, front,
-  // top faces.
+  // Set cell type and count cell vertices, one slab of cells at a time. There are no
+  // vertices in right, front, top faces.
+  int numSlabs = m_arraySize[2] - 1;
+  std::vector<int> slabVertexCounts(numSlabs, 0);
+  nx::core::ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, static_cast<size_t>(numSlabs));
+  dataAlg.execute(SetCellFlagsImpl(this, slabVertexCounts.data()));
+
+  // Number the vertices of each slab after those of all slabs below it. This gives the
+  // same vertex order as a single pass over the cells.
+  std::vector<int> slabVertexOffsets(numSlabs, 0);
   m_numVertices = 0;
-  for(int k = 0; k < m_arraySize[2] - 1; k++)
+  for(int k = 0; k < numSlabs; k++)
   {
-    for(int j = 0; j < m_arraySize[1] - 1; j++)
-    {
-      for(int i = 0; i < m_arraySize[0] - 1; i++)
-      {
-        Cell* pCell = getCell(i, j, k);
-        int32_t cellLabels[8];
-        getCellLabels(pCell, cellLabels);
-        pCell->flag.set(cellLabels);
-        if(pCell->flag.vertexType() != MMCellFlag::VertexType::NoVertex)
-        {
-          m_numVertices++;
-        }
-      }
-    }
+    slabVertexOffsets[k] = m_numVertices;
+    m_numVertices += slabVertexCounts[k];
   }
 
   // Create cell vertices. There are no vertices in right, front, top faces.
@@ -297,25 +437,7 @@ void MMCellMap::setCellVertices()
     m_vertices = NULL;
     return;
   }
-  int idxVtx = 0;
-  for(int k = 0; k < m_arraySize[2] - 1; k++)
-  {
-    for(int j = 0; j < m_arraySize[1] - 1; j++)
-    {
-      for(int i = 0; i < m_arraySize[0] - 1; i++)
-      {
-        Cell* pCell = getCell(i, j, k);
-        if(pCell->flag.vertexType() != MMCellFlag::VertexType::NoVertex)
-        {
-          pCell->vertexIndex = idxVtx;
-          Vertex* pVtx = &m_vertices[idxVtx++];
-          pVtx->cellIndex[0] = i;
-          pVtx->cellIndex[1] = j;
-          pVtx->cellIndex[2] = k;
-        }
-      }
-    }
-  }
+  dataAlg.execute(SetVertexIndicesImpl(this, slabVertexOffsets.data()));
 }
 
 // The caller is responsible for bounds checking to allow for optimal performance.
@@ -69,6 +69,18 @@ private:
   void initCell(Cell* cell, int32_t label);
   void setCellVertices();
 
+  // Parallel workers for building and relaxing the cell map. Each works on a block of
+  // cell slabs or vertices and is defined in MMCellMap.cpp.
+  class SetCellFlagsImpl;
+  class SetVertexIndicesImpl;
+  class RelaxVerticesImpl;
+
+  // Relax a single vertex. Neighbor offsets are read from neighborOffsets (indexed by
+  // vertex index) if given, otherwise from the cells themselves. The relaxed offset is
+  // written to vertexOffset, which must hold the vertex's current offset.
+  void relaxVertex(int vertexIndex, const MMSurfaceNet::RelaxAttrs& relaxAttrs, const float* neighborOffsets, float vertexOffset[3]);
+  void relaxJacobi(MMSurfaceNet::RelaxAttrs relaxAttrs);
+
   // Access cell map
 
   int cellArrayIndex(int i, int j, int k);
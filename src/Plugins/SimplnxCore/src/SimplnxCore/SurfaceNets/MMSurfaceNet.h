@@ -66,6 +66,7 @@ public:
     int numRelaxIterations;      // More iterations --> smoother and slower
     float relaxFactor;           // Range (0.0, 1.0); larger --> faster but less stable
     float maxDistFromCellCenter; // Maximun displacement of relaxed surface in voxel units
+    bool jacobiRelaxation;       // Relax all vertices from the previous iteration's positions (parallel)
   };
   void relax(const RelaxAttrs relaxAttrs);
   void reset();
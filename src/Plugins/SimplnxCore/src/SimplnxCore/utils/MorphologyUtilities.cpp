@@ -0,0 +1,363 @@
+#include "MorphologyUtilities.hpp"
+
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+
+#include <algorithm>
+
+using namespace nx::core;
+using namespace nx::core::MorphologyUtilities;
+
+namespace
+{
+// Upper bound on the number of slabs that are labeled independently. The slabs are merged serially
+// so this also bounds the serial part of the labeling.
+constexpr usize k_MaxSlabs = 256;
+
+inline int64 FindRoot(std::vector<int64>& parent, int64 voxel)
+{
+  while(parent[voxel] != voxel)
+  {
+    parent[voxel] = parent[parent[voxel]];
+    voxel = parent[voxel];
+  }
+  return voxel;
+}
+
+// The smaller voxel index always becomes the root so a component's root is its first voxel
+inline void Unite(std::vector<int64>& parent, int64 voxel1, int64 voxel2)
+{
+  const int64 root1 = FindRoot(parent, voxel1);
+  const int64 root2 = FindRoot(parent, voxel2);
+  if(root1 < root2)
+  {
+    parent[root2] = root1;
+  }
+  else if(root2 < root1)
+  {
+    parent[root1] = root2;
+  }
+}
+
+/**
+ * @brief Unites every masked voxel with its masked -Z, -Y and -X neighbors that lie in the same slab.
+ * A slab only ever writes the parents of its own voxels so the slabs can be labeled in parallel.
+ */
+class LabelSlabsImpl
+{
+public:
+  LabelSlabsImpl(const FaceNeighborhood& neighborhood, const std::vector<uint8>& mask, usize slabSize, std::vector<int64>& parent, const std::atomic_bool& shouldCancel)
+  : m_Neighborhood(neighborhood)
+  , m_Mask(mask)
+  , m_SlabSize(slabSize)
+  , m_Parent(parent)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numVoxels = m_Neighborhood.getNumberOfVoxels();
+    std::array<int64, k_NumFaceNeighbors> neighbors = {};
+    for(usize slab = range.min(); slab < range.max(); slab++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const auto slabStart = static_cast<int64>(slab * m_SlabSize);
+      const auto slabEnd = static_cast<int64>(std::min((slab + 1) * m_SlabSize, numVoxels));
+      for(int64 voxel = slabStart; voxel < slabEnd; voxel++)
+      {
+        if(m_Mask[voxel] == 0)
+        {
+          continue;
+        }
+        const usize numNeighbors = m_Neighborhood.getNeighbors(voxel, neighbors);
+        for(usize n = 0; n < numNeighbors; n++)
+        {
+          const int64 neighbor = neighbors[n];
+          if(neighbor > voxel)
+          {
+            break;
+          }
+          if(neighbor >= slabStart && m_Mask[neighbor] != 0)
+          {
+            Unite(m_Parent, voxel, neighbor);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const FaceNeighborhood& m_Neighborhood;
+  const std::vector<uint8>& m_Mask;
+  const usize m_SlabSize;
+  std::vector<int64>& m_Parent;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Finds the root of every masked voxel once all the unions are done. The parents are only read.
+ */
+class ResolveRootsImpl
+{
+public:
+  ResolveRootsImpl(const std::vector<int64>& parent, std::vector<int64>& roots)
+  : m_Parent(parent)
+  , m_Roots(roots)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize voxel = range.min(); voxel < range.max(); voxel++)
+    {
+      int64 root = m_Parent[voxel];
+      if(root >= 0)
+      {
+        while(m_Parent[root] != root)
+        {
+          root = m_Parent[root];
+        }
+      }
+      m_Roots[voxel] = root;
+    }
+  }
+
+private:
+  const std::vector<int64>& m_Parent;
+  std::vector<int64>& m_Roots;
+};
+
+class GatherTuplesImpl
+{
+public:
+  GatherTuplesImpl() = delete;
+  GatherTuplesImpl(const GatherTuplesImpl&) = default;
+
+  GatherTuplesImpl(const std::vector<std::pair<int64, int64>>& gatherList, std::shared_ptr<IDataArray> dataArrayPtr)
+  : m_GatherList(gatherList)
+  , m_DataArrayPtr(std::move(dataArrayPtr))
+  {
+  }
+  GatherTuplesImpl(GatherTuplesImpl&&) = default;                // Move Constructor Not Implemented
+  GatherTuplesImpl& operator=(const GatherTuplesImpl&) = delete; // Copy Assignment Not Implemented
+  GatherTuplesImpl& operator=(GatherTuplesImpl&&) = delete;      // Move Assignment Not Implemented
+
+  ~GatherTuplesImpl() = default;
+
+  void operator()() const
+  {
+    for(const auto& [target, source] : m_GatherList)
+    {
+      m_DataArrayPtr->copyTuple(source, target);
+    }
+  }
+
+private:
+  const std::vector<std::pair<int64, int64>>& m_GatherList;
+  std::shared_ptr<IDataArray> m_DataArrayPtr;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+FaceNeighborhood::FaceNeighborhood(const SizeVec3& dims, bool xDirOn, bool yDirOn, bool zDirOn)
+: m_Dims{static_cast<int64>(dims[0]), static_cast<int64>(dims[1]), static_cast<int64>(dims[2])}
+, m_AxisOn{xDirOn, yDirOn, zDirOn}
+{
+  m_Offsets = {-m_Dims[0] * m_Dims[1], -m_Dims[0], -1, 1, m_Dims[0], m_Dims[0] * m_Dims[1]};
+}
+
+// -----------------------------------------------------------------------------
+usize FaceNeighborhood::getNumberOfVoxels() const
+{
+  return static_cast<usize>(m_Dims[0] * m_Dims[1] * m_Dims[2]);
+}
+
+// -----------------------------------------------------------------------------
+const std::array<int64, 3>& FaceNeighborhood::getDimensions() const
+{
+  return m_Dims;
+}
+
+// -----------------------------------------------------------------------------
+bool FaceNeighborhood::isValid(usize j, int64 voxel) const
+{
+  const int64 column = voxel % m_Dims[0];
+  const int64 row = (voxel / m_Dims[0]) % m_Dims[1];
+  const int64 plane = voxel / (m_Dims[0] * m_Dims[1]);
+  switch(j)
+  {
+  case 0:
+    return m_AxisOn[2] && plane != 0;
+  case 1:
+    return m_AxisOn[1] && row != 0;
+  case 2:
+    return m_AxisOn[0] && column != 0;
+  case 3:
+    return m_AxisOn[0] && column != (m_Dims[0] - 1);
+  case 4:
+    return m_AxisOn[1] && row != (m_Dims[1] - 1);
+  case 5:
+    return m_AxisOn[2] && plane != (m_Dims[2] - 1);
+  default:
+    return false;
+  }
+}
+
+// -----------------------------------------------------------------------------
+usize FaceNeighborhood::getNeighbors(int64 voxel, std::array<int64, k_NumFaceNeighbors>& neighbors) const
+{
+  const int64 column = voxel % m_Dims[0];
+  const int64 row = (voxel / m_Dims[0]) % m_Dims[1];
+  const int64 plane = voxel / (m_Dims[0] * m_Dims[1]);
+  const std::array<bool, k_NumFaceNeighbors> valid = {
+      m_AxisOn[2] && plane != 0,
+      m_AxisOn[1] && row != 0,
+      m_AxisOn[0] && column != 0,
+      m_AxisOn[0] && column != (m_Dims[0] - 1),
+      m_AxisOn[1] && row != (m_Dims[1] - 1),
+      m_AxisOn[2] && plane != (m_Dims[2] - 1),
+  };
+  usize count = 0;
+  for(usize j = 0; j < k_NumFaceNeighbors; j++)
+  {
+    if(valid[j])
+    {
+      neighbors[count] = voxel + m_Offsets[j];
+      count++;
+    }
+  }
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+ActiveFrontier::ActiveFrontier(usize numVoxels)
+: m_Stamp(numVoxels, -1)
+{
+}
+
+// -----------------------------------------------------------------------------
+void ActiveFrontier::add(int64 voxel)
+{
+  if(m_Stamp[voxel] != m_Pass)
+  {
+    m_Stamp[voxel] = m_Pass;
+    m_Voxels.push_back(voxel);
+  }
+}
+
+// -----------------------------------------------------------------------------
+bool ActiveFrontier::empty() const
+{
+  return m_Voxels.empty();
+}
+
+// -----------------------------------------------------------------------------
+std::vector<int64> ActiveFrontier::takeNext()
+{
+  std::vector<int64> voxels;
+  voxels.swap(m_Voxels);
+  std::sort(voxels.begin(), voxels.end());
+  m_Pass++;
+  return voxels;
+}
+
+// -----------------------------------------------------------------------------
+ConnectedComponents MorphologyUtilities::LabelConnectedComponents(const FaceNeighborhood& neighborhood, const std::vector<uint8>& mask, const std::atomic_bool& shouldCancel)
+{
+  const usize numVoxels = neighborhood.getNumberOfVoxels();
+  ConnectedComponents components;
+
+  std::vector<int64> parent(numVoxels, -1);
+  for(usize voxel = 0; voxel < numVoxels; voxel++)
+  {
+    if(mask[voxel] != 0)
+    {
+      parent[voxel] = static_cast<int64>(voxel);
+    }
+  }
+
+  const usize slabSize = std::max<usize>(1, (numVoxels + k_MaxSlabs - 1) / k_MaxSlabs);
+  const usize numSlabs = (numVoxels + slabSize - 1) / slabSize;
+
+  ParallelDataAlgorithm slabAlg;
+  slabAlg.setRange(0, numSlabs);
+  slabAlg.execute(LabelSlabsImpl(neighborhood, mask, slabSize, parent, shouldCancel));
+  if(shouldCancel)
+  {
+    return components;
+  }
+
+  // Only the voxels within one plane of the start of a slab can have a neighbor in an earlier slab
+  const std::array<int64, 3>& dims = neighborhood.getDimensions();
+  const usize planeSize = static_cast<usize>(dims[0] * dims[1]);
+  std::array<int64, k_NumFaceNeighbors> neighbors = {};
+  for(usize slab = 1; slab < numSlabs; slab++)
+  {
+    const auto slabStart = static_cast<int64>(slab * slabSize);
+    const auto mergeEnd = static_cast<int64>(std::min({(slab + 1) * slabSize, slab * slabSize + planeSize, numVoxels}));
+    for(int64 voxel = slabStart; voxel < mergeEnd; voxel++)
+    {
+      if(mask[voxel] == 0)
+      {
+        continue;
+      }
+      const usize numNeighbors = neighborhood.getNeighbors(voxel, neighbors);
+      for(usize n = 0; n < numNeighbors; n++)
+      {
+        const int64 neighbor = neighbors[n];
+        if(neighbor >= slabStart)
+        {
+          break;
+        }
+        if(mask[neighbor] != 0)
+        {
+          Unite(parent, voxel, neighbor);
+        }
+      }
+    }
+  }
+
+  components.componentIds.resize(numVoxels);
+  ParallelDataAlgorithm rootAlg;
+  rootAlg.setRange(0, numVoxels);
+  rootAlg.execute(ResolveRootsImpl(parent, components.componentIds));
+
+  // Number the components in the order of their roots. The parent of a root is reused to hold its component index.
+  for(usize voxel = 0; voxel < numVoxels; voxel++)
+  {
+    const int64 root = components.componentIds[voxel];
+    if(root < 0)
+    {
+      continue;
+    }
+    if(root == static_cast<int64>(voxel))
+    {
+      parent[voxel] = static_cast<int64>(components.sizes.size());
+      components.sizes.push_back(0);
+    }
+    const int64 componentId = parent[root];
+    components.componentIds[voxel] = componentId;
+    components.sizes[componentId]++;
+  }
+
+  return components;
+}
+
+// -----------------------------------------------------------------------------
+void MorphologyUtilities::GatherTuples(const std::vector<std::shared_ptr<IDataArray>>& dataArrays, const std::vector<std::pair<int64, int64>>& gatherList)
+{
+  if(gatherList.empty())
+  {
+    return;
+  }
+  ParallelTaskAlgorithm taskRunner;
+  for(const auto& dataArrayPtr : dataArrays)
+  {
+    taskRunner.execute(GatherTuplesImpl(gatherList, dataArrayPtr));
+  }
+  taskRunner.wait();
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "SimplnxCore/SimplnxCore_export.hpp"
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace nx::core
+{
+namespace MorphologyUtilities
+{
+inline constexpr usize k_NumFaceNeighbors = 6;
+
+/**
+ * @brief The FaceNeighborhood class answers which of the 6 face neighbors of a voxel exist in an
+ * image geometry. The neighbors are always reported in the order -Z, -Y, -X, +X, +Y, +Z which is
+ * also increasing voxel index order. Each axis can be switched off so that the neighbors along
+ * that axis are never reported.
+ */
+class SIMPLNXCORE_EXPORT FaceNeighborhood
+{
+public:
+  FaceNeighborhood(const SizeVec3& dims, bool xDirOn = true, bool yDirOn = true, bool zDirOn = true);
+
+  /**
+   * @brief Returns the number of voxels in the geometry
+   */
+  usize getNumberOfVoxels() const;
+
+  /**
+   * @brief Returns the dimensions of the geometry
+   */
+  const std::array<int64, 3>& getDimensions() const;
+
+  /**
+   * @brief Returns true if the face neighbor 'j' (0 = -Z, 1 = -Y, 2 = -X, 3 = +X, 4 = +Y, 5 = +Z) of the voxel exists
+   * and its axis is switched on
+   */
+  bool isValid(usize j, int64 voxel) const;
+
+  /**
+   * @brief Writes the existing face neighbors of the voxel into 'neighbors' in increasing index order
+   * @return The number of neighbors written
+   */
+  usize getNeighbors(int64 voxel, std::array<int64, k_NumFaceNeighbors>& neighbors) const;
+
+private:
+  std::array<int64, 3> m_Dims = {0, 0, 0};
+  std::array<int64, k_NumFaceNeighbors> m_Offsets = {0, 0, 0, 0, 0, 0};
+  std::array<bool, 3> m_AxisOn = {true, true, true};
+};
+
+/**
+ * @brief The ActiveFrontier class collects the voxels that have to be looked at in the next pass
+ * of an iterative operation. A voxel is only added once per pass and the pass is handed out in
+ * increasing voxel order.
+ */
+class SIMPLNXCORE_EXPORT ActiveFrontier
+{
+public:
+  explicit ActiveFrontier(usize numVoxels);
+
+  /**
+   * @brief Adds the voxel to the next pass if it is not already part of it
+   */
+  void add(int64 voxel);
+
+  /**
+   * @brief Returns true if no voxel has been added since the last call to takeNext()
+   */
+  bool empty() const;
+
+  /**
+   * @brief Returns the sorted voxels of the next pass and starts collecting the pass after it
+   */
+  std::vector<int64> takeNext();
+
+private:
+  std::vector<int32> m_Stamp;
+  int32 m_Pass = 0;
+  std::vector<int64> m_Voxels;
+};
+
+/**
+ * @brief Holds the 6-connected components found by LabelConnectedComponents()
+ */
+struct SIMPLNXCORE_EXPORT ConnectedComponents
+{
+  std::vector<int64> componentIds; // -1 for voxels outside the mask, otherwise the index into 'sizes'
+  std::vector<usize> sizes;        // Number of voxels in each component. Components are numbered in the order of their first voxel
+};
+
+/**
+ * @brief Labels the face connected components of the voxels where 'mask' is non-zero. Contiguous slabs
+ * of voxels are labeled in parallel with a union-find each and the slabs are then merged across their
+ * shared faces.
+ * @param neighborhood
+ * @param mask One value per voxel
+ * @param shouldCancel
+ * @return
+ */
+SIMPLNXCORE_EXPORT ConnectedComponents LabelConnectedComponents(const FaceNeighborhood& neighborhood, const std::vector<uint8>& mask, const std::atomic_bool& shouldCancel);
+
+/**
+ * @brief Copies the tuple at 'second' into the tuple at 'first' for every pair in the gather list and
+ * for every data array. Each array is handled by its own task and walks the gather list once, so the
+ * sources must not also be targets of the same gather list.
+ * @param dataArrays
+ * @param gatherList Pairs of (target voxel, source voxel)
+ */
+SIMPLNXCORE_EXPORT void GatherTuples(const std::vector<std::shared_ptr<IDataArray>>& dataArrays, const std::vector<std::pair<int64, int64>>& gatherList);
+} // namespace MorphologyUtilities
+} // namespace nx::core
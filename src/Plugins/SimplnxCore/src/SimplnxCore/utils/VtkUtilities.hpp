@@ -1,11 +1,106 @@
 #pragma once
 
+#include "simplnx/Common/Bit.hpp"
 #include "simplnx/Utilities/OStreamUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/StringUtilities.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
 
 namespace nx::core
 {
 
 static constexpr usize k_BufferDumpVal = 1000000;
+static constexpr usize k_BinaryChunkBytes = 16777216;
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Copies a contiguous range of values out of a data store into a chunk buffer, optionally
+ * swapping every value to the opposite byte order. The source store is never modified.
+ */
+template <typename T>
+class CopyBinaryValuesImpl
+{
+public:
+  CopyBinaryValuesImpl(const AbstractDataStore<T>& dataStore, T* buffer, usize sourceOffset, bool swapBytes)
+  : m_DataStore(dataStore)
+  , m_ContiguousData(nullptr)
+  , m_Buffer(buffer)
+  , m_SourceOffset(sourceOffset)
+  , m_SwapBytes(swapBytes)
+  {
+    if(const auto* contiguousStore = dynamic_cast<const DataStore<T>*>(&dataStore); contiguousStore != nullptr)
+    {
+      m_ContiguousData = contiguousStore->data();
+    }
+  }
+
+  void operator()(const Range& range) const
+  {
+    T* dest = m_Buffer + range.min();
+    const usize count = range.size();
+    if(m_ContiguousData != nullptr)
+    {
+      std::memcpy(dest, m_ContiguousData + m_SourceOffset + range.min(), count * sizeof(T));
+    }
+    else
+    {
+      for(usize i = 0; i < count; i++)
+      {
+        dest[i] = m_DataStore[m_SourceOffset + range.min() + i];
+      }
+    }
+    if(m_SwapBytes)
+    {
+      for(usize i = 0; i < count; i++)
+      {
+        dest[i] = nx::core::byteswap(dest[i]);
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<T>& m_DataStore;
+  const T* m_ContiguousData = nullptr;
+  T* m_Buffer = nullptr;
+  usize m_SourceOffset = 0;
+  bool m_SwapBytes = false;
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Streams the values of a data store as binary in the requested byte order. Values are
+ * encoded chunk by chunk into a reusable buffer (in parallel for in-memory stores) and each chunk
+ * is handed to writeFunc as one large sequential write.
+ * @param dataStore The values to write
+ * @param bigEndian Whether the values should be written as big endian
+ * @param writeFunc Callable with the signature bool(const char* bytes, usize numBytes)
+ * @return false if writeFunc reported a failure
+ */
+template <typename T, typename WriteFunc>
+bool WriteBinaryValues(const AbstractDataStore<T>& dataStore, bool bigEndian, WriteFunc&& writeFunc)
+{
+  const usize totalElements = dataStore.getSize();
+  const usize chunkElements = std::max(k_BinaryChunkBytes / sizeof(T), usize{1});
+  const bool swapBytes = sizeof(T) > 1 && (bigEndian != (endian::native == endian::big));
+
+  auto buffer = std::make_unique<T[]>(std::min(chunkElements, totalElements));
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.requireStoresInMemory({&dataStore});
+  for(usize offset = 0; offset < totalElements; offset += chunkElements)
+  {
+    const usize count = std::min(chunkElements, totalElements - offset);
+    dataAlg.setRange(0, count);
+    dataAlg.execute(CopyBinaryValuesImpl<T>(dataStore, buffer.get(), offset, swapBytes));
+    if(!writeFunc(reinterpret_cast<const char*>(buffer.get()), count * sizeof(T)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -141,7 +236,7 @@ struct WriteVtkDataArrayFunctor
   void operator()(FILE* outputFile, bool binary, DataStructure& dataStructure, const DataPath& arrayPath, const IFilter::MessageHandler& messageHandler)
   {
     auto* dataArray = dataStructure.getDataAs<DataArray<T>>(arrayPath);
-    auto& dataStore = dataArray->template getIDataStoreRefAs<DataStore<T>>();
+    const auto& dataStore = dataArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
 
     messageHandler(IFilter::Message::Type::Info, fmt::format("Writing Cell Data {}", arrayPath.getTargetName()));
 
@@ -161,16 +256,9 @@ struct WriteVtkDataArrayFunctor
     fprintf(outputFile, "LOOKUP_TABLE default\n");
     if(binary)
     {
-      if constexpr(endian::little == endian::native)
-      {
-        dataArray->byteSwapElements();
-      }
-      fwrite(dataStore.data(), sizeof(T), totalElements, outputFile);
+      // VTK legacy binary data is always big endian
+      WriteBinaryValues(dataStore, true, [outputFile](const char* bytes, usize numBytes) { return fwrite(bytes, 1, numBytes, outputFile) == numBytes; });
       fprintf(outputFile, "\n");
-      if constexpr(endian::little == endian::native)
-      {
-        dataArray->byteSwapElements();
-      }
     }
     else
     {
@@ -276,21 +364,14 @@ struct WriteVtkDataFunctor
 
     if(binary)
     {
-      // Swap to big Endian... because
-      if constexpr(endian::little == endian::native)
-      {
-        dataArrayRef.byteSwapElements();
-      }
-
-      auto result = dataStoreRef.writeBinaryFile(outStrm);
-      if(result.first != 0)
-      {
-      }
-
-      // Swap back to little endian
-      if constexpr(endian::little == endian::native)
+      // VTK legacy binary data is always big endian
+      bool written = WriteBinaryValues(dataStoreRef, true, [&outStrm](const char* bytes, usize numBytes) {
+        outStrm.write(bytes, static_cast<std::streamsize>(numBytes));
+        return !outStrm.bad();
+      });
+      if(!written)
       {
-        dataArrayRef.byteSwapElements();
+        return MakeErrorResult(-2078, fmt::format("Error writing binary data for array '{}'", dataArrayRef.getName()));
       }
     }
     else
@@ -806,6 +806,23 @@ void SingleComponentArrayCalculatorTest2()
       REQUIRE(arrayPtr->at(i) == value);
     }
   }
+  SECTION("Constant Sub-Expressions Mixed With Arrays")
+  {
+    IFilter::ExecuteResult results =
+        createAndExecuteArrayCalculatorFilter("(InputArray1 * 2 + 3 * 4) / InputArray2 - sqrt(2 ^ 4) + -(1 - InputArray1)", k_AttributeArrayPath, CalculatorParameter::Radians, dataStructure, filter);
+
+    Float32Array* inputArray1 = dataStructure.getDataAs<Float32Array>(DataPath({k_AttributeMatrix, k_InputArray1}));
+    UInt32Array* inputArray2 = dataStructure.getDataAs<UInt32Array>(DataPath({k_AttributeMatrix, k_InputArray2}));
+    Float64Array* arrayPtr = dataStructure.getDataAs<Float64Array>(k_AttributeArrayPath);
+
+    SIMPLNX_RESULT_REQUIRE_VALID(results.result);
+    REQUIRE(arrayPtr->getNumberOfTuples() == inputArray2->getNumberOfTuples());
+    for(int i = 0; i < arrayPtr->getNumberOfTuples(); i++)
+    {
+      double value = (inputArray1->at(i) * 2.0 + 12.0) / inputArray2->at(i) - 4.0 - (1.0 - inputArray1->at(i));
+      REQUIRE(UnitTest::CloseEnough<double>(arrayPtr->at(i), value, 0.0001));
+    }
+  }
 }
 
 TEST_CASE("SimplnxCore::ArrayCalculatorFilter: Filter Execution")
@@ -1,12 +1,17 @@
 #include <catch2/catch.hpp>
 
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
+#include "simplnx/Utilities/ClusteringUtilities.hpp"
 
 #include "SimplnxCore/Filters/ComputeKMeansFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
 #include <filesystem>
+#include <random>
+#include <set>
 namespace fs = std::filesystem;
 
 using namespace nx::core;
@@ -121,3 +126,85 @@ TEST_CASE("SimplnxCore::ComputeKMeans: Valid Filter Execution", "[SimplnxCore][C
   WriteTestDataStructure(dataStructure, fs::path(fmt::format("{}/7_0_k_means_0_test.dream3d", unit_test::k_BinaryTestOutputDir)));
 #endif
 }
+
+TEST_CASE("SimplnxCore::ComputeKMeans: Separated Clusters", "[SimplnxCore][ComputeKMeans]")
+{
+  // Three well separated blobs of 200 tuples each; every run must put each blob into its own cluster
+  constexpr usize k_TuplesPerBlob = 200;
+  constexpr usize k_NumTuples = 3 * k_TuplesPerBlob;
+  const std::array<std::array<float32, 2>, 3> blobCenters = {{{0.0f, 0.0f}, {50.0f, 0.0f}, {0.0f, 50.0f}}};
+
+  DataStructure dataStructure;
+  auto* cellData = AttributeMatrix::Create(dataStructure, Constants::k_CellData, {k_NumTuples});
+  auto* values = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Values", {k_NumTuples}, {2}, cellData->getId());
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<float32> noise(-1.0f, 1.0f);
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    const auto& center = blobCenters[i / k_TuplesPerBlob];
+    (*values)[2 * i] = center[0] + noise(gen);
+    (*values)[2 * i + 1] = center[1] + noise(gen);
+  }
+
+  const DataPath cellDataPath({Constants::k_CellData});
+  const DataPath clusterDataPath({k_ClusterData});
+
+  ComputeKMeansFilter filter;
+  Arguments args;
+  args.insertOrAssign(ComputeKMeansFilter::k_UseSeed_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ComputeKMeansFilter::k_SeedValue_Key, std::make_any<uint64>(5489));
+  args.insertOrAssign(ComputeKMeansFilter::k_InitClusters_Key, std::make_any<uint64>(3));
+  args.insertOrAssign(ComputeKMeansFilter::k_UseMask_Key, std::make_any<bool>(false));
+  args.insertOrAssign(ComputeKMeansFilter::k_SelectedArrayPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath("Values")));
+  args.insertOrAssign(ComputeKMeansFilter::k_FeatureIdsArrayName_Key, std::make_any<std::string>(k_ClusterIdsName));
+  args.insertOrAssign(ComputeKMeansFilter::k_FeatureAMPath_Key, std::make_any<DataPath>(clusterDataPath));
+  args.insertOrAssign(ComputeKMeansFilter::k_MeansArrayName_Key, std::make_any<std::string>(k_MeansName));
+
+  SECTION("K-Means++ Euclidean")
+  {
+    args.insertOrAssign(ComputeKMeansFilter::k_InitializationType_Key, std::make_any<ChoicesParameter::ValueType>(ComputeKMeansFilter::k_KMeansPlusPlusInitialization));
+    args.insertOrAssign(ComputeKMeansFilter::k_DistanceMetric_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(ClusterUtilities::DistanceMetric::Euclidean)));
+  }
+  SECTION("K-Means++ Manhattan")
+  {
+    args.insertOrAssign(ComputeKMeansFilter::k_InitializationType_Key, std::make_any<ChoicesParameter::ValueType>(ComputeKMeansFilter::k_KMeansPlusPlusInitialization));
+    args.insertOrAssign(ComputeKMeansFilter::k_DistanceMetric_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(ClusterUtilities::DistanceMetric::Manhattan)));
+  }
+  SECTION("Mini-Batch Squared Euclidean")
+  {
+    args.insertOrAssign(ComputeKMeansFilter::k_InitializationType_Key, std::make_any<ChoicesParameter::ValueType>(ComputeKMeansFilter::k_KMeansPlusPlusInitialization));
+    args.insertOrAssign(ComputeKMeansFilter::k_DistanceMetric_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(ClusterUtilities::DistanceMetric::SquaredEuclidean)));
+    args.insertOrAssign(ComputeKMeansFilter::k_UseMiniBatch_Key, std::make_any<bool>(true));
+    args.insertOrAssign(ComputeKMeansFilter::k_BatchSize_Key, std::make_any<uint64>(64));
+    args.insertOrAssign(ComputeKMeansFilter::k_MaxIterations_Key, std::make_any<uint64>(20));
+  }
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  const auto& clusterIds = dataStructure.getDataRefAs<Int32Array>(cellDataPath.createChildPath(k_ClusterIdsName));
+  std::set<int32> blobIds;
+  for(usize blob = 0; blob < 3; blob++)
+  {
+    const int32 blobId = clusterIds[blob * k_TuplesPerBlob];
+    REQUIRE(blobId > 0);
+    blobIds.insert(blobId);
+    for(usize i = blob * k_TuplesPerBlob; i < (blob + 1) * k_TuplesPerBlob; i++)
+    {
+      REQUIRE(clusterIds[i] == blobId);
+    }
+  }
+  REQUIRE(blobIds.size() == 3);
+
+  // The stored means are the centers of the blobs
+  const auto& means = dataStructure.getDataRefAs<Float32Array>(clusterDataPath.createChildPath(k_MeansName));
+  for(usize blob = 0; blob < 3; blob++)
+  {
+    const usize cluster = clusterIds[blob * k_TuplesPerBlob];
+    REQUIRE(std::abs(means[2 * cluster] - blobCenters[blob][0]) < 0.5f);
+    REQUIRE(std::abs(means[2 * cluster + 1] - blobCenters[blob][1]) < 0.5f);
+  }
+}
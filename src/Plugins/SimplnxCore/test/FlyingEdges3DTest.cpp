@@ -1,15 +1,21 @@
 #include "SimplnxCore/Filters/FlyingEdges3DFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Parameters/ArrayCreationParameter.hpp"
 #include "simplnx/Parameters/DataGroupCreationParameter.hpp"
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
+#include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
 #include <catch2/catch.hpp>
 
+#include <cmath>
+
 using namespace nx::core;
 using namespace nx::core::UnitTest;
 
@@ -95,3 +101,80 @@ TEST_CASE("SimplnxCore::Image Contouring Valid Execution", "[SimplnxCore][Flying
   WriteTestDataStructure(dataStructure, fs::path(fmt::format("{}/image_contouring_test.dream3d", unit_test::k_BinaryTestOutputDir)));
 #endif
 }
+
+TEST_CASE("SimplnxCore::Image Contouring Interpolated Arrays", "[SimplnxCore][FlyingEdges3D]")
+{
+  // A sphere of radius 3 contoured on a distance field
+  constexpr usize k_Dim = 10;
+  constexpr float32 k_Radius = 3.0f;
+  const DataPath geometryPath({ContourTest::k_ImageGeometryName});
+  const DataPath cellDataPath = geometryPath.createChildPath(Constants::k_Cell_Data);
+
+  DataStructure dataStructure;
+  auto* imageGeom = ImageGeom::Create(dataStructure, ContourTest::k_ImageGeometryName);
+  imageGeom->setDimensions({k_Dim, k_Dim, k_Dim});
+  imageGeom->setSpacing({1.0f, 1.0f, 1.0f});
+  imageGeom->setOrigin({0.0f, 0.0f, 0.0f});
+  auto* cellData = AttributeMatrix::Create(dataStructure, Constants::k_Cell_Data, {k_Dim, k_Dim, k_Dim}, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+
+  auto* distances = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, ContourTest::k_DataName, {k_Dim, k_Dim, k_Dim}, {1}, cellData->getId());
+  auto* labels = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Labels", {k_Dim, k_Dim, k_Dim}, {1}, cellData->getId());
+  const float32 center = static_cast<float32>(k_Dim - 1) / 2.0f;
+  for(usize z = 0; z < k_Dim; z++)
+  {
+    for(usize y = 0; y < k_Dim; y++)
+    {
+      for(usize x = 0; x < k_Dim; x++)
+      {
+        const usize index = (z * k_Dim + y) * k_Dim + x;
+        const float32 dx = static_cast<float32>(x) - center;
+        const float32 dy = static_cast<float32>(y) - center;
+        const float32 dz = static_cast<float32>(z) - center;
+        (*distances)[index] = std::sqrt(dx * dx + dy * dy + dz * dz);
+        (*labels)[index] = (*distances)[index] < k_Radius ? 1 : 2;
+      }
+    }
+  }
+
+  FlyingEdges3DFilter filter;
+  Arguments args;
+  args.insertOrAssign(FlyingEdges3DFilter::k_IsoVal_Key, std::make_any<float64>(k_Radius));
+  args.insertOrAssign(FlyingEdges3DFilter::k_SelectedImageGeometryPath_Key, std::make_any<GeometrySelectionParameter::ValueType>(geometryPath));
+  args.insertOrAssign(FlyingEdges3DFilter::k_SelectedDataArrayPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath(ContourTest::k_DataName)));
+  args.insertOrAssign(FlyingEdges3DFilter::k_InterpolatedArrayPaths_Key,
+                      std::make_any<MultiArraySelectionParameter::ValueType>(
+                          MultiArraySelectionParameter::ValueType{cellDataPath.createChildPath(ContourTest::k_DataName), cellDataPath.createChildPath("Labels")}));
+  args.insertOrAssign(FlyingEdges3DFilter::k_CreatedTriangleGeometryPath_Key, std::make_any<DataGroupCreationParameter::ValueType>(ContourTest::k_NewContourPath));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  const auto& contour = dataStructure.getDataRefAs<TriangleGeom>(ContourTest::k_NewContourPath);
+  const usize numVertices = contour.getNumberOfVertices();
+  REQUIRE(numVertices > 0);
+  REQUIRE(contour.getNumberOfFaces() > 0);
+
+  const DataPath vertexDataPath = ContourTest::k_NewContourPath.createChildPath(INodeGeometry0D::k_VertexDataName);
+  const auto& interpolatedDistances = dataStructure.getDataRefAs<Float32Array>(vertexDataPath.createChildPath(ContourTest::k_DataName));
+  const auto& interpolatedLabels = dataStructure.getDataRefAs<Int32Array>(vertexDataPath.createChildPath("Labels"));
+  REQUIRE(interpolatedDistances.getNumberOfTuples() == numVertices);
+  REQUIRE(interpolatedLabels.getNumberOfTuples() == numVertices);
+
+  const auto& vertices = contour.getVerticesRef();
+  for(usize i = 0; i < numVertices; i++)
+  {
+    // Interpolating the contoured array itself gives back the contour value
+    REQUIRE(std::abs(interpolatedDistances[i] - k_Radius) < 1.0E-4f);
+    REQUIRE((interpolatedLabels[i] == 1 || interpolatedLabels[i] == 2));
+
+    // Every vertex lies close to the sphere
+    const float32 dx = vertices[i * 3] - center;
+    const float32 dy = vertices[i * 3 + 1] - center;
+    const float32 dz = vertices[i * 3 + 2] - center;
+    REQUIRE(std::abs(std::sqrt(dx * dx + dy * dy + dz * dz) - k_Radius) < 0.5f);
+  }
+}
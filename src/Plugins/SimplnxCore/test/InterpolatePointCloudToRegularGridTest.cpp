@@ -1,10 +1,14 @@
 #include "SimplnxCore/Filters/InterpolatePointCloudToRegularGridFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/DataStructure/Geometry/VertexGeom.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 
 namespace fs = std::filesystem;
@@ -43,6 +47,33 @@ const DataPath k_GaussianKernalDistancesExemplar = k_GaussianInterpolatedDataExe
 const DataPath k_GaussianFaceAreasComputed = k_GaussianInterpolatedDataComputed.createChildPath(k_FaceAreas);
 const DataPath k_GaussianVoxelIndicesComputed = k_GaussianInterpolatedDataComputed.createChildPath(k_VoxelIndices);
 const DataPath k_GaussianKernalDistancesComputed = k_GaussianInterpolatedDataComputed.createChildPath(k_KernalDistances);
+
+// Five voxels in a row; two points in voxel 0 and one point in voxel 4 so that voxel 2 is out of reach of every kernel
+DataStructure CreateSmallPointCloud()
+{
+  DataStructure dataStructure;
+  auto* image = ImageGeom::Create(dataStructure, k_ImageGeometry);
+  image->setDimensions({5, 1, 1});
+  image->setSpacing({1.0f, 1.0f, 1.0f});
+  image->setOrigin({0.0f, 0.0f, 0.0f});
+
+  const usize numPoints = 3;
+  auto* vertexGeom = VertexGeom::Create(dataStructure, k_PointCloudContainerName);
+  auto* vertexArray = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Vertices", {numPoints}, {3}, vertexGeom->getId());
+  vertexGeom->setVertices(*vertexArray);
+  auto* vertexData = AttributeMatrix::Create(dataStructure, k_VertexData, {numPoints}, vertexGeom->getId());
+  vertexGeom->setVertexAttributeMatrix(*vertexData);
+  auto* voxelIndices = UInt64Array::CreateWithStore<UInt64DataStore>(dataStructure, k_VoxelIndices, {numPoints}, {1}, vertexData->getId());
+  auto* values = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Values", {numPoints}, {1}, vertexData->getId());
+  const std::vector<uint64> pointVoxels = {0, 0, 4};
+  const std::vector<float32> pointValues = {2.0f, 4.0f, 10.0f};
+  for(usize i = 0; i < numPoints; i++)
+  {
+    (*voxelIndices)[i] = pointVoxels[i];
+    (*values)[i] = pointValues[i];
+  }
+  return dataStructure;
+}
 } // namespace
 
 TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Valid Filter Execution - Uniform Inpterpolation with Mask", "[SimplnxCore][InterpolatePointCloudToRegularGridFilter]")
@@ -59,6 +90,7 @@ TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Valid Filter E
 
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseMask_Key, std::make_any<bool>(true));
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreKernelDistances_Key, std::make_any<bool>(true));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreNeighborLists_Key, std::make_any<bool>(true));
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolationTechnique_Key, std::make_any<uint64>(InterpolatePointCloudToRegularGridFilter::k_Uniform));
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelSize_Key, std::make_any<std::vector<float32>>(std::vector<float32>{1, 1, 1}));
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedVertexGeometryPath_Key, std::make_any<DataPath>(k_VertexGeometryPath));
@@ -97,6 +129,7 @@ TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Valid Filter E
 
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseMask_Key, std::make_any<bool>(false));
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreKernelDistances_Key, std::make_any<bool>(true));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreNeighborLists_Key, std::make_any<bool>(true));
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolationTechnique_Key, std::make_any<uint64>(InterpolatePointCloudToRegularGridFilter::k_Gaussian));
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelSize_Key, std::make_any<std::vector<float32>>(std::vector<float32>{1, 1, 1}));
   args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_GaussianSigmas_Key, std::make_any<std::vector<float32>>(std::vector<float32>{1, 1, 1}));
@@ -170,3 +203,136 @@ TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Invalid Filter
   auto executeResult = filter.execute(dataStructure, args);
   SIMPLNX_RESULT_REQUIRE_INVALID(executeResult.result)
 }
+
+TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Dense Reduction", "[SimplnxCore][InterpolatePointCloudToRegularGridFilter]")
+{
+  DataStructure dataStructure = CreateSmallPointCloud();
+
+  InterpolatePointCloudToRegularGridFilter filter;
+  Arguments args;
+
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseMask_Key, std::make_any<bool>(false));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreKernelDistances_Key, std::make_any<bool>(false));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolationTechnique_Key, std::make_any<uint64>(InterpolatePointCloudToRegularGridFilter::k_Uniform));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelSize_Key, std::make_any<std::vector<float32>>(std::vector<float32>{1, 1, 1}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedVertexGeometryPath_Key, std::make_any<DataPath>(k_VertexGeometryPath));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreNeighborLists_Key, std::make_any<bool>(false));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_VoxelIndicesPath_Key, std::make_any<DataPath>(k_VoxelIndicesPath));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolatedGroupName_Key, std::make_any<std::string>(k_UniformInterpolatedData));
+
+  // With a uniform kernel, interpolating and copying an array produce the same reduced arrays and kernel weights
+  SECTION("Interpolated Array")
+  {
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolateArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{k_VertexDataPath.createChildPath("Values")}));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_CopyArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{}));
+  }
+  SECTION("Copied Array Only")
+  {
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolateArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{}));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_CopyArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{k_VertexDataPath.createChildPath("Values")}));
+  }
+
+  // Preflight the filter and check result
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  // Execute the filter and check the result
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  const DataPath groupPath = k_ImageGeomPath.createChildPath(k_UniformInterpolatedData);
+  REQUIRE(dataStructure.getData(groupPath.createChildPath("Values")) == nullptr);
+
+  const auto& means = dataStructure.getDataRefAs<Float64Array>(groupPath.createChildPath(fmt::format("Values{}", InterpolatePointCloudToRegularGridFilter::k_MeanSuffix)));
+  const auto& mins = dataStructure.getDataRefAs<Float64Array>(groupPath.createChildPath(fmt::format("Values{}", InterpolatePointCloudToRegularGridFilter::k_MinSuffix)));
+  const auto& maxs = dataStructure.getDataRefAs<Float64Array>(groupPath.createChildPath(fmt::format("Values{}", InterpolatePointCloudToRegularGridFilter::k_MaxSuffix)));
+  const auto& weights = dataStructure.getDataRefAs<Float64Array>(groupPath.createChildPath("KernelWeights"));
+
+  const std::vector<float64> expectedMeans = {3.0, 3.0, 0.0, 10.0, 10.0};
+  const std::vector<float64> expectedMins = {2.0, 2.0, 0.0, 10.0, 10.0};
+  const std::vector<float64> expectedMaxs = {4.0, 4.0, 0.0, 10.0, 10.0};
+  const std::vector<float64> expectedWeights = {2.0, 2.0, 0.0, 1.0, 1.0};
+  for(usize i = 0; i < 5; i++)
+  {
+    REQUIRE(weights[i] == Approx(expectedWeights[i]));
+    if(expectedWeights[i] == 0.0)
+    {
+      REQUIRE(std::isnan(means[i]));
+      REQUIRE(std::isnan(mins[i]));
+      REQUIRE(std::isnan(maxs[i]));
+      continue;
+    }
+    REQUIRE(means[i] == Approx(expectedMeans[i]));
+    REQUIRE(mins[i] == Approx(expectedMins[i]));
+    REQUIRE(maxs[i] == Approx(expectedMaxs[i]));
+  }
+}
+
+TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Per-Voxel Neighbor Lists", "[SimplnxCore][InterpolatePointCloudToRegularGridFilter]")
+{
+  DataStructure dataStructure = CreateSmallPointCloud();
+
+  InterpolatePointCloudToRegularGridFilter filter;
+  Arguments args;
+
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseMask_Key, std::make_any<bool>(false));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreKernelDistances_Key, std::make_any<bool>(false));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolationTechnique_Key, std::make_any<uint64>(InterpolatePointCloudToRegularGridFilter::k_Uniform));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelSize_Key, std::make_any<std::vector<float32>>(std::vector<float32>{1, 1, 1}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedVertexGeometryPath_Key, std::make_any<DataPath>(k_VertexGeometryPath));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreNeighborLists_Key, std::make_any<bool>(true));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_VoxelIndicesPath_Key, std::make_any<DataPath>(k_VoxelIndicesPath));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolateArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{k_VertexDataPath.createChildPath("Values")}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_CopyArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolatedGroupName_Key, std::make_any<std::string>(k_UniformInterpolatedData));
+
+  // Preflight the filter and check result
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  // Execute the filter and check the result
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  // Only the NeighborList is created; the dense arrays belong to the reduced output
+  const DataPath groupPath = k_ImageGeomPath.createChildPath(k_UniformInterpolatedData);
+  REQUIRE(dataStructure.getData(groupPath.createChildPath(fmt::format("Values{}", InterpolatePointCloudToRegularGridFilter::k_MeanSuffix))) == nullptr);
+  REQUIRE(dataStructure.getData(groupPath.createChildPath(fmt::format("Values{}", InterpolatePointCloudToRegularGridFilter::k_MinSuffix))) == nullptr);
+  REQUIRE(dataStructure.getData(groupPath.createChildPath(fmt::format("Values{}", InterpolatePointCloudToRegularGridFilter::k_MaxSuffix))) == nullptr);
+  REQUIRE(dataStructure.getData(groupPath.createChildPath("KernelWeights")) == nullptr);
+
+  const auto& neighborList = dataStructure.getDataRefAs<Float32NeighborList>(groupPath.createChildPath("Values"));
+  const std::vector<std::vector<float32>> expectedLists = {{2.0f, 4.0f}, {2.0f, 4.0f}, {}, {10.0f}, {10.0f}};
+  for(usize i = 0; i < expectedLists.size(); i++)
+  {
+    auto list = neighborList.getList(i);
+    REQUIRE(list != nullptr);
+    std::vector<float32> sortedList(list->begin(), list->end());
+    std::sort(sortedList.begin(), sortedList.end());
+    REQUIRE(sortedList == expectedLists[i]);
+  }
+}
+
+TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Parameters Version 1 Migration", "[SimplnxCore][InterpolatePointCloudToRegularGridFilter]")
+{
+  InterpolatePointCloudToRegularGridFilter filter;
+  REQUIRE_FALSE(filter.getDefaultArguments().value<bool>(InterpolatePointCloudToRegularGridFilter::k_StoreNeighborLists_Key));
+
+  nlohmann::json json = filter.toJson(filter.getDefaultArguments());
+  json.erase(InterpolatePointCloudToRegularGridFilter::k_StoreNeighborLists_Key);
+  json.erase(InterpolatePointCloudToRegularGridFilter::k_KernelWeightsArrayName_Key);
+
+  // Version 1 always produced the NeighborLists
+  json["parameters_version"] = 1;
+  auto version1Result = filter.fromJson(json);
+  SIMPLNX_RESULT_REQUIRE_VALID(version1Result)
+  REQUIRE(version1Result.value().value<bool>(InterpolatePointCloudToRegularGridFilter::k_StoreNeighborLists_Key));
+
+  // A current version pipeline that does not set the parameter gets the default
+  json["parameters_version"] = filter.parametersVersion();
+  auto version2Result = filter.fromJson(json);
+  SIMPLNX_RESULT_REQUIRE_VALID(version2Result)
+  REQUIRE_FALSE(version2Result.value().value<bool>(InterpolatePointCloudToRegularGridFilter::k_StoreNeighborLists_Key));
+}
@@ -676,3 +676,59 @@ TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution, DataType", "[Sim
     checkMaskValues<float64>(dataStructure, k_ThresholdArrayPath);
   }
 }
+
+TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution, Nested Sets", "[SimplnxCore][MultiThresholdObjects]")
+{
+  DataStructure dataStructure = CreateTestDataStructure();
+  MultiThresholdObjectsFilter filter;
+  Arguments args;
+
+  // { Int > 2 AND Int < 5 } OR Int == 10
+  auto greaterThreshold = std::make_shared<ArrayThreshold>();
+  greaterThreshold->setArrayPath(k_TestArrayIntPath);
+  greaterThreshold->setComparisonType(ArrayThreshold::ComparisonType::GreaterThan);
+  greaterThreshold->setComparisonValue(2);
+
+  auto lessThreshold = std::make_shared<ArrayThreshold>();
+  lessThreshold->setArrayPath(k_TestArrayIntPath);
+  lessThreshold->setComparisonType(ArrayThreshold::ComparisonType::LessThan);
+  lessThreshold->setComparisonValue(5);
+  lessThreshold->setUnionOperator(IArrayThreshold::UnionOperator::And);
+
+  auto nestedSet = std::make_shared<ArrayThresholdSet>();
+  nestedSet->setArrayThresholds({greaterThreshold, lessThreshold});
+
+  auto equalThreshold = std::make_shared<ArrayThreshold>();
+  equalThreshold->setArrayPath(k_TestArrayIntPath);
+  equalThreshold->setComparisonType(ArrayThreshold::ComparisonType::Operator_Equal);
+  equalThreshold->setComparisonValue(10);
+  equalThreshold->setUnionOperator(IArrayThreshold::UnionOperator::Or);
+
+  ArrayThresholdSet thresholdSet;
+  thresholdSet.setArrayThresholds({nestedSet, equalThreshold});
+
+  bool inverted = GENERATE(false, true);
+  thresholdSet.setInverted(inverted);
+
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_ArrayThresholdsObject_Key, std::make_any<ArrayThresholdSet>(thresholdSet));
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_CreatedDataName_Key, std::make_any<std::string>(k_ThresholdArrayName));
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_CreatedMaskType_Key, std::make_any<DataType>(DataType::boolean));
+
+  // Preflight the filter and check result
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  // Execute the filter and check the result
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  auto* thresholdArray = dataStructure.getDataAs<BoolArray>(k_ThresholdArrayPath);
+  REQUIRE(thresholdArray != nullptr);
+
+  // Only the elements 3, 4 and 10 pass the thresholds
+  for(usize i = 0; i < 20; i++)
+  {
+    bool expected = (i == 3 || i == 4 || i == 10);
+    REQUIRE((*thresholdArray)[i] == (expected != inverted));
+  }
+}
@@ -5,6 +5,7 @@
 #include "simplnx/Filter/Actions/DeleteDataAction.hpp"
 #include "simplnx/Filter/Arguments.hpp"
 #include "simplnx/Filter/FilterHandle.hpp"
+#include "simplnx/Parameters/ArrayCreationParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/Parameters/GeneratedFileListParameter.hpp"
 #include "simplnx/Pipeline/Pipeline.hpp"
@@ -15,6 +16,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <typeinfo>
@@ -110,6 +112,77 @@ protected:
     return {};
   }
 };
+
+class PreflightCountingFilter : public IFilter
+{
+public:
+  static inline constexpr StringLiteral k_OutputArrayPath_Key = "output_array_path";
+
+  static inline std::atomic<usize> s_PreflightCount = 0;
+
+  PreflightCountingFilter() = default;
+
+  ~PreflightCountingFilter() noexcept override = default;
+
+  PreflightCountingFilter(const PreflightCountingFilter&) = delete;
+  PreflightCountingFilter(PreflightCountingFilter&&) noexcept = delete;
+
+  PreflightCountingFilter& operator=(const PreflightCountingFilter&) = delete;
+  PreflightCountingFilter& operator=(PreflightCountingFilter&&) noexcept = delete;
+
+  std::string name() const override
+  {
+    return "PreflightCountingFilter";
+  }
+
+  std::string className() const override
+  {
+    return "PreflightCountingFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    static constexpr Uuid uuid = *Uuid::FromString("4c5b3e2a-8f0d-4a51-9e3c-1d7f6a2b9c40");
+    return uuid;
+  }
+
+  std::string humanName() const override
+  {
+    return "Preflight Counting Filter";
+  }
+
+  Parameters parameters() const override
+  {
+    Parameters params;
+    params.insert(std::make_unique<ArrayCreationParameter>(k_OutputArrayPath_Key, "Output Array", "", DataPath({"Array"})));
+    return params;
+  }
+
+  VersionType parametersVersion() const override
+  {
+    return 1;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<PreflightCountingFilter>();
+  }
+
+protected:
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    s_PreflightCount++;
+    OutputActions outputActions;
+    outputActions.appendAction(std::make_unique<CreateArrayAction>(DataType::int32, std::vector<usize>{10}, std::vector<usize>{1}, args.value<DataPath>(k_OutputArrayPath_Key)));
+    return {std::move(outputActions)};
+  }
+
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override
+  {
+    return {};
+  }
+};
 } // namespace
 
 TEST_CASE("PipelineTest:Execute Pipeline")
@@ -385,3 +458,39 @@ TEST_CASE("PipelineTest:PipelineDeferredActionTest")
   DataObject* executeObject = dataStructure.getData(k_DeferredActionPath);
   REQUIRE(executeObject == nullptr);
 }
+
+TEST_CASE("PipelineTest:Incremental Preflight")
+{
+  Pipeline pipeline;
+  for(const std::string name : {"Array0", "Array1", "Array2"})
+  {
+    Arguments args;
+    args.insert(PreflightCountingFilter::k_OutputArrayPath_Key, std::make_any<DataPath>(DataPath({name})));
+    REQUIRE(pipeline.push_back(std::make_unique<PreflightCountingFilter>(), args));
+  }
+
+  PreflightCountingFilter::s_PreflightCount = 0;
+  REQUIRE(pipeline.preflight());
+  REQUIRE(PreflightCountingFilter::s_PreflightCount == 3);
+
+  // Nothing changed, so every node reuses its stored result
+  REQUIRE(pipeline.preflight());
+  REQUIRE(PreflightCountingFilter::s_PreflightCount == 3);
+  REQUIRE(pipeline.at(2)->getPreflightStructure().getData(DataPath({"Array2"})) != nullptr);
+
+  // Changing the second node preflights it and the node downstream of it, but not the first one
+  {
+    auto* filterNode = dynamic_cast<PipelineFilter*>(pipeline.at(1));
+    REQUIRE(filterNode != nullptr);
+    Arguments args = filterNode->getArguments();
+    args.insertOrAssign(PreflightCountingFilter::k_OutputArrayPath_Key, std::make_any<DataPath>(DataPath({"Renamed"})));
+    filterNode->setArguments(args);
+  }
+  REQUIRE(pipeline.preflight());
+  REQUIRE(PreflightCountingFilter::s_PreflightCount == 5);
+
+  const DataStructure& preflightStructure = pipeline.at(2)->getPreflightStructure();
+  REQUIRE(preflightStructure.getData(DataPath({"Renamed"})) != nullptr);
+  REQUIRE(preflightStructure.getData(DataPath({"Array1"})) == nullptr);
+  REQUIRE(preflightStructure.getData(DataPath({"Array2"})) != nullptr);
+}
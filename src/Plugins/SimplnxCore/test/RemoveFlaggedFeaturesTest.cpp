@@ -153,6 +153,52 @@ TEST_CASE("SimplnxCore::RemoveFlaggedFeatures: Test Remove Algorithm", "[Simplnx
   ValidateResults(featureIdsResult, cellFeatureAMResult, testArrayResult);
 }
 
+TEST_CASE("SimplnxCore::RemoveFlaggedFeatures: Test Remove and Fill Algorithm", "[SimplnxCore][RemoveFlaggedFeatures]")
+{ // Instantiate the filter, a DataStructure object and an Arguments Object
+  RemoveFlaggedFeaturesFilter filter;
+  DataStructure dataStructure;
+  FillDataStructure(dataStructure);
+  Arguments args;
+
+  // Create default Parameters for the filter.
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_Functionality_Key, std::make_any<ChoicesParameter::ValueType>(0));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_FillRemovedFeatures_Key, std::make_any<bool>(true));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(k_FeatureIdsPath));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_FlaggedFeaturesArrayPath_Key, std::make_any<DataPath>(k_FlaggedFeaturesPath));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_IgnoredDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+
+  // Preflight the filter and check result
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  // Execute the filter and check the result
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  // Both cells of the removed feature 3 vote in the same pass against the unfilled ids. Cell 13
+  // touches two cells of feature 2. Cell 14 touches two cells with id 0, which count as a feature,
+  // and the unfilled cell 13, which does not.
+  // clang-format off
+  const std::vector<int32> expectedFeatureIds = {
+      0, 1, 1, 1,
+      1, 0, 2, 2,
+      2, 2, 0, 1,
+      2, 2, 0, 0};
+  // clang-format on
+  const auto& featureIdsResult = dataStructure.getDataRefAs<Int32Array>(k_FeatureIdsPath);
+  for(usize i = 0; i < expectedFeatureIds.size(); i++)
+  {
+    REQUIRE(featureIdsResult[i] == expectedFeatureIds[i]);
+  }
+
+  const auto& cellFeatureAMResult = dataStructure.getDataRefAs<AttributeMatrix>(DataPath({k_DataContainer, k_CellFeatureData}));
+  REQUIRE(cellFeatureAMResult.getNumTuples() == 3);
+  const auto& testArrayResult = dataStructure.getDataRefAs<Int32Array>(DataPath({k_DataContainer, k_CellFeatureData, k_Int32DataSet}));
+  REQUIRE(testArrayResult[1] == 4041);
+  REQUIRE(testArrayResult[2] == 10128);
+}
+
 TEST_CASE("SimplnxCore::RemoveFlaggedFeatures: Test Extract Algorithm", "[SimplnxCore][RemoveFlaggedFeatures]")
 { // Instantiate the filter, a DataStructure object and an Arguments Object
   RemoveFlaggedFeaturesFilter filter;
@@ -547,3 +547,78 @@ TEST_CASE("SimplnxCore::ResampleImageGeom: 2D Save Geometry", "[SimplnxCore][Res
     ExecuteDataFunction(CompareDataArrayFunctor{}, exemplarArray.getDataType(), exemplarArray, calculatedArray);
   }
 }
+
+TEST_CASE("SimplnxCore::ResampleImageGeom: Interpolation Modes", "[SimplnxCore][ResampleImageGeom]")
+{
+  // 4 x 2 x 1 image down-sampled to 2 x 1 x 1. Every destination cell covers a 2 x 2 block of source cells.
+  // clang-format off
+  const std::vector<int32> labels = {3, 1, 2, 2,
+                                     1, 1, 2, 2};
+  const std::vector<float32> values = {0.0F, 1.0F, 2.0F, 3.0F,
+                                       4.0F, 5.0F, 6.0F, 7.0F};
+  // clang-format on
+
+  DataStructure dataStructure;
+  auto* imageGeom = ImageGeom::Create(dataStructure, "Image");
+  imageGeom->setDimensions({4, 2, 1});
+  imageGeom->setSpacing({1.0F, 1.0F, 1.0F});
+  imageGeom->setOrigin({0.0F, 0.0F, 0.0F});
+  auto* cellData = AttributeMatrix::Create(dataStructure, ImageGeom::k_CellDataName, {1, 2, 4}, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+  auto& labelsStore = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Labels", {1, 2, 4}, {1}, cellData->getId())->getDataStoreRef();
+  auto& valuesStore = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Values", {1, 2, 4}, {1}, cellData->getId())->getDataStoreRef();
+  for(usize i = 0; i < labels.size(); i++)
+  {
+    labelsStore[i] = labels[i];
+    valuesStore[i] = values[i];
+  }
+
+  std::vector<int32> expectedLabels;
+  std::vector<float32> expectedValues;
+  ChoicesParameter::ValueType interpolationMode = 0;
+  SECTION("Nearest Neighbor")
+  {
+    interpolationMode = 0;
+    expectedLabels = {3, 2};
+    expectedValues = {0.0F, 2.0F};
+  }
+  SECTION("Trilinear")
+  {
+    interpolationMode = 1;
+    expectedLabels = {3, 2};
+    expectedValues = {2.5F, 4.5F};
+  }
+  SECTION("Majority Vote")
+  {
+    interpolationMode = 2;
+    expectedLabels = {1, 2};
+    expectedValues = {0.0F, 2.0F};
+  }
+
+  ResampleImageGeomFilter filter;
+  Arguments args;
+  const DataPath destGeomPath({"Resampled"});
+  args.insertOrAssign(ResampleImageGeomFilter::k_ResamplingMode_Key, std::make_any<ChoicesParameter::ValueType>(k_SpacingModeIndex));
+  args.insertOrAssign(ResampleImageGeomFilter::k_Spacing_Key, std::make_any<VectorFloat32Parameter::ValueType>(std::vector<float32>{2.0F, 2.0F, 1.0F}));
+  args.insertOrAssign(ResampleImageGeomFilter::k_InterpolationMode_Key, std::make_any<ChoicesParameter::ValueType>(interpolationMode));
+  args.insertOrAssign(ResampleImageGeomFilter::k_RenumberFeatures_Key, std::make_any<bool>(false));
+  args.insertOrAssign(ResampleImageGeomFilter::k_RemoveOriginalGeometry_Key, std::make_any<bool>(false));
+  args.insertOrAssign(ResampleImageGeomFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(DataPath({"Image"})));
+  args.insertOrAssign(ResampleImageGeomFilter::k_CreatedImageGeometry_Key, std::make_any<DataPath>(destGeomPath));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  const DataPath destCellDataPath = destGeomPath.createChildPath(ImageGeom::k_CellDataName);
+  const auto& resampledLabels = dataStructure.getDataRefAs<Int32Array>(destCellDataPath.createChildPath("Labels"));
+  const auto& resampledValues = dataStructure.getDataRefAs<Float32Array>(destCellDataPath.createChildPath("Values"));
+  REQUIRE(resampledLabels.getNumberOfTuples() == 2);
+  for(usize i = 0; i < 2; i++)
+  {
+    REQUIRE(resampledLabels[i] == expectedLabels[i]);
+    REQUIRE(resampledValues[i] == Approx(expectedValues[i]));
+  }
+}
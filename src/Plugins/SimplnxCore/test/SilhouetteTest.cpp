@@ -1,10 +1,16 @@
 #include <catch2/catch.hpp>
 
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
+#include "simplnx/Utilities/ClusteringUtilities.hpp"
 
 #include "SimplnxCore/Filters/SilhouetteFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
+#include <random>
+
 using namespace nx::core;
 
 namespace
@@ -80,3 +86,132 @@ TEST_CASE("SimplnxCore::SilhouetteFilter: Means Test", "[SimplnxCore][Silhouette
 
   UnitTest::CompareArrays<float64>(dataStructure, k_MeansSilhouettePath, k_MeansSilhouettePathNX);
 }
+
+TEST_CASE("SimplnxCore::SilhouetteFilter: Stratified Sampling", "[SimplnxCore][SilhouetteFilter]")
+{
+  // Two well separated blobs of 300 tuples each
+  constexpr usize k_TuplesPerBlob = 300;
+  constexpr usize k_NumTuples = 2 * k_TuplesPerBlob;
+
+  DataStructure dataStructure;
+  auto* cellData = AttributeMatrix::Create(dataStructure, Constants::k_CellData, {k_NumTuples});
+  auto* values = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Values", {k_NumTuples}, {2}, cellData->getId());
+  auto* clusterIds = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "ClusterIds", {k_NumTuples}, {1}, cellData->getId());
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<float32> noise(-1.0f, 1.0f);
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    const usize blob = i / k_TuplesPerBlob;
+    (*values)[2 * i] = static_cast<float32>(blob) * 100.0f + noise(gen);
+    (*values)[2 * i + 1] = noise(gen);
+    (*clusterIds)[i] = static_cast<int32>(blob) + 1;
+  }
+
+  const DataPath cellDataPath({Constants::k_CellData});
+  const DataPath exactPath = cellDataPath.createChildPath("ExactSilhouette");
+  const DataPath sampledPath = cellDataPath.createChildPath("SampledSilhouette");
+
+  auto runFilter = [&](const DataPath& outputPath, bool useSampling, uint64 sampleSize) {
+    SilhouetteFilter filter;
+    Arguments args;
+    args.insertOrAssign(SilhouetteFilter::k_DistanceMetric_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(ClusterUtilities::DistanceMetric::Euclidean)));
+    args.insertOrAssign(SilhouetteFilter::k_UseMask_Key, std::make_any<bool>(false));
+    args.insertOrAssign(SilhouetteFilter::k_SelectedArrayPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath("Values")));
+    args.insertOrAssign(SilhouetteFilter::k_FeatureIdsArrayPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath("ClusterIds")));
+    args.insertOrAssign(SilhouetteFilter::k_SilhouetteArrayPath_Key, std::make_any<DataPath>(outputPath));
+    args.insertOrAssign(SilhouetteFilter::k_UseSampling_Key, std::make_any<bool>(useSampling));
+    args.insertOrAssign(SilhouetteFilter::k_SampleSize_Key, std::make_any<uint64>(sampleSize));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  };
+
+  runFilter(exactPath, false, 1000);
+
+  SECTION("Sample Size Covers Every Cluster")
+  {
+    // No cluster is larger than the sample size, so the result must match the exact silhouette
+    runFilter(sampledPath, true, k_TuplesPerBlob);
+    UnitTest::CompareArrays<float64>(dataStructure, exactPath, sampledPath);
+  }
+  SECTION("Subsampled Clusters")
+  {
+    runFilter(sampledPath, true, 32);
+    const auto& exact = dataStructure.getDataRefAs<Float64Array>(exactPath);
+    const auto& sampled = dataStructure.getDataRefAs<Float64Array>(sampledPath);
+    for(usize i = 0; i < k_NumTuples; i++)
+    {
+      REQUIRE(sampled[i] > 0.9);
+      REQUIRE(std::abs(sampled[i] - exact[i]) < 0.01);
+    }
+  }
+}
+
+TEST_CASE("SimplnxCore::SilhouetteFilter: Squared Euclidean Large Offset", "[SimplnxCore][SilhouetteFilter]")
+{
+  // Two close blobs far away from the origin; the per cluster sums must not lose the small distances to the large offset
+  constexpr usize k_TuplesPerBlob = 150;
+  constexpr usize k_NumTuples = 2 * k_TuplesPerBlob;
+  constexpr usize k_NumComps = 3;
+  constexpr float64 k_Offset = 1.0e7;
+
+  DataStructure dataStructure;
+  auto* cellData = AttributeMatrix::Create(dataStructure, Constants::k_CellData, {k_NumTuples});
+  auto* values = Float64Array::CreateWithStore<Float64DataStore>(dataStructure, "Values", {k_NumTuples}, {k_NumComps}, cellData->getId());
+  auto* clusterIds = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "ClusterIds", {k_NumTuples}, {1}, cellData->getId());
+  std::mt19937 gen(4321);
+  std::uniform_real_distribution<float64> noise(-1.0, 1.0);
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    const usize blob = i / k_TuplesPerBlob;
+    for(usize comp = 0; comp < k_NumComps; comp++)
+    {
+      (*values)[k_NumComps * i + comp] = k_Offset + noise(gen);
+    }
+    (*values)[k_NumComps * i] += static_cast<float64>(blob) * 3.0;
+    (*clusterIds)[i] = static_cast<int32>(blob) + 1;
+  }
+
+  const DataPath cellDataPath({Constants::k_CellData});
+  const DataPath silhouettePath = cellDataPath.createChildPath("Silhouette");
+
+  SilhouetteFilter filter;
+  Arguments args;
+  args.insertOrAssign(SilhouetteFilter::k_DistanceMetric_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(ClusterUtilities::DistanceMetric::SquaredEuclidean)));
+  args.insertOrAssign(SilhouetteFilter::k_UseMask_Key, std::make_any<bool>(false));
+  args.insertOrAssign(SilhouetteFilter::k_SelectedArrayPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath("Values")));
+  args.insertOrAssign(SilhouetteFilter::k_FeatureIdsArrayPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath("ClusterIds")));
+  args.insertOrAssign(SilhouetteFilter::k_SilhouetteArrayPath_Key, std::make_any<DataPath>(silhouettePath));
+  args.insertOrAssign(SilhouetteFilter::k_UseSampling_Key, std::make_any<bool>(false));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  // Pairwise reference: the mean squared distance of every tuple to each blob
+  const auto& silhouette = dataStructure.getDataRefAs<Float64Array>(silhouettePath);
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    std::array<float64, 2> meanDist = {0.0, 0.0};
+    for(usize j = 0; j < k_NumTuples; j++)
+    {
+      float64 squaredDist = 0.0;
+      for(usize comp = 0; comp < k_NumComps; comp++)
+      {
+        const float64 diff = (*values)[k_NumComps * i + comp] - (*values)[k_NumComps * j + comp];
+        squaredDist += diff * diff;
+      }
+      meanDist[j / k_TuplesPerBlob] += squaredDist / static_cast<float64>(k_TuplesPerBlob);
+    }
+    const usize blob = i / k_TuplesPerBlob;
+    const float64 inClusterDist = meanDist[blob];
+    const float64 outClusterDist = meanDist[1 - blob];
+    const float64 expected = (outClusterDist - inClusterDist) / std::max(outClusterDist, inClusterDist);
+    REQUIRE(std::abs(silhouette[i] - expected) < 1.0e-9);
+  }
+}
@@ -0,0 +1,207 @@
+#include <catch2/catch.hpp>
+
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Parameters/FileSystemPathParameter.hpp"
+#include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
+#include "simplnx/UnitTest/UnitTestCommon.hpp"
+
+#include "SimplnxCore/Filters/WriteVtkXmlFilter.hpp"
+#include "SimplnxCore/SimplnxCore_test_dirs.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+using namespace nx::core;
+
+namespace
+{
+const std::string k_ImageGeomName = "Image";
+const std::string k_TriangleGeomName = "Triangles";
+const SizeVec3 k_Dims = {4, 3, 2};
+
+DataStructure CreateImageDataStructure()
+{
+  DataStructure dataStructure;
+  auto* imageGeom = ImageGeom::Create(dataStructure, k_ImageGeomName);
+  imageGeom->setDimensions(k_Dims);
+  imageGeom->setOrigin({1.0f, 2.0f, 3.0f});
+  imageGeom->setSpacing({0.5f, 0.5f, 0.25f});
+  auto* cellData = AttributeMatrix::Create(dataStructure, ImageGeom::k_CellDataName, {k_Dims[2], k_Dims[1], k_Dims[0]}, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+
+  auto* featureIds = UnitTest::CreateTestDataArray<int32>(dataStructure, "Feature Ids", {k_Dims[2], k_Dims[1], k_Dims[0]}, {1}, cellData->getId());
+  for(usize i = 0; i < featureIds->getSize(); i++)
+  {
+    (*featureIds)[i] = static_cast<int32>(i * 3);
+  }
+  auto* eulers = UnitTest::CreateTestDataArray<float32>(dataStructure, "Eulers", {k_Dims[2], k_Dims[1], k_Dims[0]}, {3}, cellData->getId());
+  for(usize i = 0; i < eulers->getSize(); i++)
+  {
+    (*eulers)[i] = static_cast<float32>(i) * 0.5f;
+  }
+  return dataStructure;
+}
+
+std::string ReadFile(const fs::path& filePath)
+{
+  std::ifstream inStream(filePath, std::ios_base::in | std::ios_base::binary);
+  std::stringstream buffer;
+  buffer << inStream.rdbuf();
+  return buffer.str();
+}
+} // namespace
+
+TEST_CASE("SimplnxCore::WriteVtkXmlFilter: Image Geometry Raw", "[SimplnxCore][WriteVtkXmlFilter]")
+{
+  DataStructure dataStructure = CreateImageDataStructure();
+  const DataPath cellDataPath = DataPath({k_ImageGeomName, ImageGeom::k_CellDataName});
+
+  WriteVtkXmlFilter filter;
+  Arguments args;
+
+  fs::path computedOutputPath(fmt::format("{}/write_vtk_xml_image.vti", unit_test::k_BinaryTestOutputDir));
+
+  args.insertOrAssign(WriteVtkXmlFilter::k_OutputFile_Key, std::make_any<FileSystemPathParameter::ValueType>(computedOutputPath));
+  args.insertOrAssign(WriteVtkXmlFilter::k_CompressData_Key, std::make_any<bool>(false));
+  args.insertOrAssign(WriteVtkXmlFilter::k_InputGeometryPath_Key, std::make_any<DataPath>(DataPath({k_ImageGeomName})));
+  args.insertOrAssign(WriteVtkXmlFilter::k_CellDataArrayPaths_Key,
+                      std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{cellDataPath.createChildPath("Feature Ids"), cellDataPath.createChildPath("Eulers")}));
+  args.insertOrAssign(WriteVtkXmlFilter::k_PointDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  const std::string contents = ReadFile(computedOutputPath);
+  REQUIRE(contents.find("<ImageData WholeExtent=\"0 4 0 3 0 2\" Origin=\"1 2 3\" Spacing=\"0.5 0.5 0.25\">") != std::string::npos);
+  REQUIRE(contents.find("<DataArray type=\"Int32\" Name=\"Feature Ids\" NumberOfComponents=\"1\" format=\"appended\" offset=\"0\"/>") != std::string::npos);
+  // The second array starts after the 8 byte size header and the 24 int32 values of the first
+  REQUIRE(contents.find("<DataArray type=\"Float32\" Name=\"Eulers\" NumberOfComponents=\"3\" format=\"appended\" offset=\"104\"/>") != std::string::npos);
+
+  const usize appendedStart = contents.find("<AppendedData encoding=\"raw\">\n   _");
+  REQUIRE(appendedStart != std::string::npos);
+  const char* appended = contents.data() + appendedStart + std::strlen("<AppendedData encoding=\"raw\">\n   _");
+
+  const auto& featureIds = dataStructure.getDataRefAs<Int32Array>(cellDataPath.createChildPath("Feature Ids"));
+  const auto& eulers = dataStructure.getDataRefAs<Float32Array>(cellDataPath.createChildPath("Eulers"));
+
+  uint64 numBytes = 0;
+  std::memcpy(&numBytes, appended, sizeof(uint64));
+  REQUIRE(numBytes == featureIds.getSize() * sizeof(int32));
+  for(usize i = 0; i < featureIds.getSize(); i++)
+  {
+    int32 value = 0;
+    std::memcpy(&value, appended + sizeof(uint64) + i * sizeof(int32), sizeof(int32));
+    REQUIRE(value == featureIds[i]);
+  }
+
+  appended += 104;
+  std::memcpy(&numBytes, appended, sizeof(uint64));
+  REQUIRE(numBytes == eulers.getSize() * sizeof(float32));
+  for(usize i = 0; i < eulers.getSize(); i++)
+  {
+    float32 value = 0;
+    std::memcpy(&value, appended + sizeof(uint64) + i * sizeof(float32), sizeof(float32));
+    REQUIRE(value == eulers[i]);
+  }
+
+  fs::remove(computedOutputPath);
+}
+
+TEST_CASE("SimplnxCore::WriteVtkXmlFilter: Triangle Geometry Compressed", "[SimplnxCore][WriteVtkXmlFilter]")
+{
+  DataStructure dataStructure;
+  auto* triangleGeom = TriangleGeom::Create(dataStructure, k_TriangleGeomName);
+  auto* vertexData = AttributeMatrix::Create(dataStructure, INodeGeometry0D::k_VertexDataName, {4}, triangleGeom->getId());
+  triangleGeom->setVertexAttributeMatrix(*vertexData);
+  auto* faceData = AttributeMatrix::Create(dataStructure, INodeGeometry2D::k_FaceDataName, {2}, triangleGeom->getId());
+  triangleGeom->setFaceAttributeMatrix(*faceData);
+
+  auto* vertices = UnitTest::CreateTestDataArray<float32>(dataStructure, "Vertices", {4}, {3}, triangleGeom->getId());
+  const std::vector<float32> vertexValues = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+  std::copy(vertexValues.begin(), vertexValues.end(), vertices->begin());
+  triangleGeom->setVertices(*vertices);
+
+  auto* faces = UnitTest::CreateTestDataArray<IGeometry::MeshIndexType>(dataStructure, "Faces", {2}, {3}, triangleGeom->getId());
+  const std::vector<IGeometry::MeshIndexType> faceValues = {0, 1, 2, 0, 2, 3};
+  std::copy(faceValues.begin(), faceValues.end(), faces->begin());
+  triangleGeom->setFaceList(*faces);
+
+  UnitTest::CreateTestDataArray<int32>(dataStructure, "Face Labels", {2}, {2}, faceData->getId());
+  UnitTest::CreateTestDataArray<float64>(dataStructure, "Node Weights", {4}, {1}, vertexData->getId());
+
+  WriteVtkXmlFilter filter;
+  Arguments args;
+
+  const DataPath geomPath({k_TriangleGeomName});
+  fs::path computedOutputPath(fmt::format("{}/write_vtk_xml_triangles.vtu", unit_test::k_BinaryTestOutputDir));
+
+  args.insertOrAssign(WriteVtkXmlFilter::k_OutputFile_Key, std::make_any<FileSystemPathParameter::ValueType>(computedOutputPath));
+  args.insertOrAssign(WriteVtkXmlFilter::k_CompressData_Key, std::make_any<bool>(true));
+  args.insertOrAssign(WriteVtkXmlFilter::k_InputGeometryPath_Key, std::make_any<DataPath>(geomPath));
+  args.insertOrAssign(WriteVtkXmlFilter::k_CellDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{
+                                                                       geomPath.createChildPath(INodeGeometry2D::k_FaceDataName).createChildPath("Face Labels")}));
+  args.insertOrAssign(WriteVtkXmlFilter::k_PointDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{
+                                                                        geomPath.createChildPath(INodeGeometry0D::k_VertexDataName).createChildPath("Node Weights")}));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  const std::string contents = ReadFile(computedOutputPath);
+  REQUIRE(contents.find("compressor=\"vtkZLibDataCompressor\"") != std::string::npos);
+  REQUIRE(contents.find("<Piece NumberOfPoints=\"4\" NumberOfCells=\"2\">") != std::string::npos);
+  REQUIRE(contents.find("Name=\"Node Weights\"") != std::string::npos);
+  REQUIRE(contents.find("Name=\"Face Labels\" NumberOfComponents=\"2\"") != std::string::npos);
+  REQUIRE(contents.find("<DataArray type=\"Int64\" Name=\"connectivity\"") != std::string::npos);
+  REQUIRE(contents.find("<DataArray type=\"UInt8\" Name=\"types\"") != std::string::npos);
+
+  // The first appended block is the compression header of "Node Weights": one block of 4 float64 values
+  const std::string appendedTag = "<AppendedData encoding=\"raw\">\n   _";
+  const usize appendedStart = contents.find(appendedTag);
+  REQUIRE(appendedStart != std::string::npos);
+  std::array<uint64, 3> header = {};
+  std::memcpy(header.data(), contents.data() + appendedStart + appendedTag.size(), sizeof(header));
+  REQUIRE(header[0] == 1);
+  REQUIRE(header[2] == 4 * sizeof(float64));
+
+  fs::remove(computedOutputPath);
+}
+
+TEST_CASE("SimplnxCore::WriteVtkXmlFilter: Invalid Filter Execution", "[SimplnxCore][WriteVtkXmlFilter]")
+{
+  DataStructure dataStructure = CreateImageDataStructure();
+  const DataPath cellDataPath = DataPath({k_ImageGeomName, ImageGeom::k_CellDataName});
+
+  WriteVtkXmlFilter filter;
+  Arguments args;
+
+  args.insertOrAssign(WriteVtkXmlFilter::k_CompressData_Key, std::make_any<bool>(false));
+  args.insertOrAssign(WriteVtkXmlFilter::k_InputGeometryPath_Key, std::make_any<DataPath>(DataPath({k_ImageGeomName})));
+  args.insertOrAssign(WriteVtkXmlFilter::k_CellDataArrayPaths_Key,
+                      std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{cellDataPath.createChildPath("Feature Ids")}));
+  args.insertOrAssign(WriteVtkXmlFilter::k_PointDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+
+  SECTION("Wrong File Extension")
+  {
+    args.insertOrAssign(WriteVtkXmlFilter::k_OutputFile_Key, std::make_any<FileSystemPathParameter::ValueType>(fs::path(fmt::format("{}/write_vtk_xml.vtu", unit_test::k_BinaryTestOutputDir))));
+  }
+  SECTION("Vertex Data On Image Geometry")
+  {
+    args.insertOrAssign(WriteVtkXmlFilter::k_OutputFile_Key, std::make_any<FileSystemPathParameter::ValueType>(fs::path(fmt::format("{}/write_vtk_xml.vti", unit_test::k_BinaryTestOutputDir))));
+    args.insertOrAssign(WriteVtkXmlFilter::k_PointDataArrayPaths_Key,
+                        std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{cellDataPath.createChildPath("Eulers")}));
+  }
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions)
+}
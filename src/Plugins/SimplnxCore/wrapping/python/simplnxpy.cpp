@@ -149,19 +149,278 @@ auto BindVectorParameter(py::handle scope, const char* name)
 #define SIMPLNX_PY_BIND_NUMBER_PARAMETER(scope, className) BindNumberParameter<className>(scope, #className)
 #define SIMPLNX_PY_BIND_VECTOR_PARAMETER(scope, className) BindVectorParameter<className>(scope, #className)
 
+IDataStore::ShapeType GetStoreShape(const IDataStore& store)
+{
+  IDataStore::ShapeType shape = store.getTupleShape();
+  IDataStore::ShapeType componentShape = store.getComponentShape();
+  shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
+  return shape;
+}
+
+IDataStore::ShapeType GetCStrides(const IDataStore::ShapeType& shape)
+{
+  IDataStore::ShapeType strides(shape.size(), 1);
+  for(usize i = shape.size(); i > 1; i--)
+  {
+    strides[i - 2] = strides[i - 1] * shape[i - 1];
+  }
+  return strides;
+}
+
+/**
+ * @brief Returns the chunk layout of the store: how many chunks exist along each dimension of the
+ * combined tuple + component shape. In memory stores are reported as a single chunk.
+ */
+IDataStore::ShapeType GetChunkLayout(const IDataStore& store)
+{
+  const IDataStore::ShapeType shape = GetStoreShape(store);
+  const IDataStore::ShapeType chunkShape = store.getChunkShape().value_or(shape);
+  IDataStore::ShapeType layout(shape.size(), 1);
+  for(usize i = 0; i < shape.size() && i < chunkShape.size(); i++)
+  {
+    layout[i] = chunkShape[i] == 0 ? 1 : (shape[i] + chunkShape[i] - 1) / chunkShape[i];
+  }
+  return layout;
+}
+
+/**
+ * @brief Copies the values of a single chunk, clipped to the bounds of the store, into destination.
+ * destinationStrides are the element strides of destination for each dimension of the store.
+ */
+template <class T>
+void CopyChunkValues(const AbstractDataStore<T>& store, const IDataStore::ShapeType& chunkPosition, T* destination, const IDataStore::ShapeType& destinationStrides)
+{
+  const IDataStore::ShapeType shape = GetStoreShape(store);
+  const usize rank = shape.size();
+  const std::optional<IDataStore::ShapeType> chunkShape = store.getChunkShape();
+  if(!chunkShape.has_value())
+  {
+    // Not chunked, so the only chunk is the whole store
+    const usize size = store.getSize();
+    for(usize i = 0; i < size; i++)
+    {
+      destination[i] = store.getValue(i);
+    }
+    return;
+  }
+
+  const auto chunkValues = store.getChunkValues(chunkPosition);
+  const IDataStore::ShapeType chunkStrides = GetCStrides(*chunkShape);
+  IDataStore::ShapeType extent(rank);
+  for(usize i = 0; i < rank; i++)
+  {
+    extent[i] = std::min((*chunkShape)[i], shape[i] - chunkPosition[i] * (*chunkShape)[i]);
+    if(extent[i] == 0)
+    {
+      return;
+    }
+  }
+
+  IDataStore::ShapeType index(rank, 0);
+  while(true)
+  {
+    usize sourceIndex = 0;
+    usize destinationIndex = 0;
+    for(usize i = 0; i < rank; i++)
+    {
+      sourceIndex += index[i] * chunkStrides[i];
+      destinationIndex += index[i] * destinationStrides[i];
+    }
+    destination[destinationIndex] = chunkValues[sourceIndex];
+
+    usize dim = rank;
+    while(dim > 0)
+    {
+      dim--;
+      if(++index[dim] < extent[dim])
+      {
+        break;
+      }
+      index[dim] = 0;
+      if(dim == 0)
+      {
+        return;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Returns a C ordered numpy copy of any store. Chunked stores are read a chunk at a time.
+ */
+template <class T>
+py::array_t<T, py::array::c_style> CopyStoreToNumpy(const AbstractDataStore<T>& store)
+{
+  const IDataStore::ShapeType shape = GetStoreShape(store);
+  py::array_t<T, py::array::c_style> array(shape);
+  T* destination = array.mutable_data();
+  if(!store.getChunkShape().has_value())
+  {
+    CopyChunkValues(store, {}, destination, {});
+    return array;
+  }
+
+  const IDataStore::ShapeType strides = GetCStrides(shape);
+  const IDataStore::ShapeType chunkShape = store.getChunkShape().value();
+  const IDataStore::ShapeType layout = GetChunkLayout(store);
+  IDataStore::ShapeType chunkPosition(shape.size(), 0);
+  while(true)
+  {
+    usize offset = 0;
+    for(usize i = 0; i < shape.size(); i++)
+    {
+      offset += chunkPosition[i] * chunkShape[i] * strides[i];
+    }
+    CopyChunkValues(store, chunkPosition, destination + offset, strides);
+
+    usize dim = shape.size();
+    while(dim > 0)
+    {
+      dim--;
+      if(++chunkPosition[dim] < layout[dim])
+      {
+        break;
+      }
+      chunkPosition[dim] = 0;
+      if(dim == 0)
+      {
+        return array;
+      }
+    }
+  }
+}
+
+template <class T>
+py::buffer_info CreateBufferInfo(DataStore<T>& dataStore)
+{
+  const IDataStore::ShapeType shape = GetStoreShape(dataStore);
+  std::vector<py::ssize_t> strides;
+  for(usize stride : GetCStrides(shape))
+  {
+    strides.push_back(static_cast<py::ssize_t>(stride * sizeof(T)));
+  }
+  return py::buffer_info(dataStore.data(), static_cast<py::ssize_t>(sizeof(T)), py::format_descriptor<T>::format(), static_cast<py::ssize_t>(shape.size()),
+                         std::vector<py::ssize_t>(shape.cbegin(), shape.cend()), std::move(strides));
+}
+
+template <class T>
+auto BindAbstractDataStore(py::handle scope, const char* name)
+{
+  py::class_<AbstractDataStore<T>, IDataStore, std::shared_ptr<AbstractDataStore<T>>> abstractDataStore(scope, name);
+  abstractDataStore.def_property_readonly("chunk_shape", &AbstractDataStore<T>::getChunkShape, "Chunk shape over the combined tuple and component dimensions, or None if the store is not chunked");
+  abstractDataStore.def(
+      "chunk_positions",
+      [](const AbstractDataStore<T>& store) {
+        const IDataStore::ShapeType layout = GetChunkLayout(store);
+        std::vector<IDataStore::ShapeType> positions;
+        IDataStore::ShapeType position(layout.size(), 0);
+        const usize numChunks = std::accumulate(layout.cbegin(), layout.cend(), static_cast<usize>(1), std::multiplies<>());
+        for(usize chunk = 0; chunk < numChunks; chunk++)
+        {
+          positions.push_back(position);
+          for(usize dim = layout.size(); dim > 0; dim--)
+          {
+            if(++position[dim - 1] < layout[dim - 1])
+            {
+              break;
+            }
+            position[dim - 1] = 0;
+          }
+        }
+        return positions;
+      },
+      "Returns the position of every chunk in C order. In memory stores consist of a single chunk.");
+  abstractDataStore.def(
+      "chunk",
+      [](const AbstractDataStore<T>& store, const IDataStore::ShapeType& chunkPosition) {
+        const IDataStore::ShapeType shape = GetStoreShape(store);
+        const IDataStore::ShapeType chunkShape = store.getChunkShape().value_or(shape);
+        const IDataStore::ShapeType layout = GetChunkLayout(store);
+        if(chunkPosition.size() != shape.size())
+        {
+          throw py::index_error(fmt::format("Chunk position has {} dimensions but the store has {}", chunkPosition.size(), shape.size()));
+        }
+        IDataStore::ShapeType offset(shape.size());
+        IDataStore::ShapeType extent(shape.size());
+        for(usize i = 0; i < shape.size(); i++)
+        {
+          if(chunkPosition[i] >= layout[i])
+          {
+            throw py::index_error(fmt::format("Chunk position {} is out of range for the chunk layout {}", chunkPosition, layout));
+          }
+          offset[i] = chunkPosition[i] * chunkShape[i];
+          extent[i] = std::min(chunkShape[i], shape[i] - offset[i]);
+        }
+        py::array_t<T, py::array::c_style> values(extent);
+        CopyChunkValues(store, chunkPosition, values.mutable_data(), GetCStrides(extent));
+        return py::make_tuple(offset, values);
+      },
+      "Returns (offset, values) for the chunk at the given position. values is a numpy copy of the chunk clipped to the store bounds and offset is the index of its first element.",
+      "chunk_position"_a);
+  abstractDataStore.def(
+      "to_numpy", [](const AbstractDataStore<T>& store) { return CopyStoreToNumpy(store); }, "Returns a numpy copy of the store. Works for every store type, including out-of-core stores.");
+  return abstractDataStore;
+}
+
 template <class T>
 auto BindDataStore(py::handle scope, const char* name)
 {
-  py::class_<DataStore<T>, AbstractDataStore<T>, std::shared_ptr<DataStore<T>>> dataStore(scope, name);
+  py::class_<DataStore<T>, AbstractDataStore<T>, std::shared_ptr<DataStore<T>>> dataStore(scope, name, py::buffer_protocol());
   dataStore.def(py::init<const IDataStore::ShapeType&, const IDataStore::ShapeType&, std::optional<T>>(), "tuple_shape"_a, "component_shape"_a, "init_value"_a = std::optional<T>{});
+  dataStore.def_static(
+      "from_numpy",
+      [](py::array array, const IDataStore::ShapeType& componentShape) {
+        if(!py::isinstance<py::array_t<T>>(array))
+        {
+          throw py::type_error(fmt::format("Expected a numpy array of dtype {} but got {}", py::str(py::dtype::of<T>()).cast<std::string>(), py::str(array.dtype()).cast<std::string>()));
+        }
+        if((array.flags() & py::array::c_style) == 0)
+        {
+          throw py::value_error("The numpy array must be C-contiguous. Use numpy.ascontiguousarray() first.");
+        }
+        if(!array.writeable())
+        {
+          throw py::value_error("The numpy array must be writeable");
+        }
+        if(array.ndim() == 0)
+        {
+          throw py::value_error("The numpy array must have at least one dimension");
+        }
+
+        IDataStore::ShapeType arrayShape(array.shape(), array.shape() + array.ndim());
+        const bool hasComponentAxis = componentShape != IDataStore::ShapeType{1} || (arrayShape.size() > 1 && arrayShape.back() == 1);
+        IDataStore::ShapeType tupleShape = arrayShape;
+        if(hasComponentAxis)
+        {
+          if(arrayShape.size() <= componentShape.size() || !std::equal(componentShape.crbegin(), componentShape.crend(), arrayShape.crbegin()))
+          {
+            throw py::value_error(fmt::format("The trailing dimensions of the numpy array {} do not match the component shape {}", arrayShape, componentShape));
+          }
+          tupleShape.resize(arrayShape.size() - componentShape.size());
+        }
+
+        // The DataStore keeps the numpy array alive and hands the reference back once it no longer uses the buffer
+        auto* owner = new py::object(array);
+        return std::make_shared<DataStore<T>>(static_cast<T*>(array.mutable_data()), std::move(tupleShape), componentShape, [owner](T*) {
+          if(Py_IsInitialized() == 0)
+          {
+            return;
+          }
+          py::gil_scoped_acquire gil;
+          delete owner;
+        });
+      },
+      "Creates a DataStore that uses the memory of a C-contiguous, writeable numpy array without copying it. The numpy array is kept alive for as long as the DataStore uses it. "
+      "Trailing dimensions matching component_shape become the component dimensions; the rest are the tuple dimensions.",
+      "array"_a, "component_shape"_a = IDataStore::ShapeType{1});
+  dataStore.def_buffer([](DataStore<T>& dataStore) { return CreateBufferInfo(dataStore); });
   dataStore.def_property_readonly_static("dtype", []([[maybe_unused]] py::object self) { return py::dtype::of<T>(); });
   dataStore.def(
       "npview",
-      [](DataStore<T>& dataStore) {
-        IDataStore::ShapeType shape = dataStore.getTupleShape();
-        IDataStore::ShapeType componentShape = dataStore.getComponentShape();
-        shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
-        return py::array_t<T, py::array::c_style>(shape, dataStore.data(), py::cast(dataStore));
+      [](py::object self) {
+        // Use the Python object itself as the base so the view keeps the store alive without copying it
+        auto& dataStore = self.cast<DataStore<T>&>();
+        return py::array_t<T, py::array::c_style>(GetStoreShape(dataStore), dataStore.data(), self);
       },
       py::return_value_policy::reference_internal);
   dataStore.def("__getitem__", &DataStore<T>::at);
@@ -173,27 +432,57 @@ auto BindDataStore(py::handle scope, const char* name)
 template <class T>
 auto BindDataArray(py::handle scope, const char* name)
 {
-  py::class_<DataArray<T>, IDataArray, std::shared_ptr<DataArray<T>>> dataArray(scope, name);
+  py::class_<DataArray<T>, IDataArray, std::shared_ptr<DataArray<T>>> dataArray(scope, name, py::buffer_protocol());
   dataArray.def_property_readonly_static("dtype", []([[maybe_unused]] py::object self) { return py::dtype::of<T>(); });
   dataArray.def(
       "npview",
-      [](DataArray<T>& dataArray) {
-        using DataArrayType = DataArray<T>;
+      [](py::object self) {
         using DataStoreType = DataStore<T>;
-        const typename DataArrayType::store_type& abstractDataStore = dataArray.getDataStoreRef();
-        const DataStoreType& dataStore = dynamic_cast<const DataStoreType&>(abstractDataStore);
-        IDataStore::ShapeType shape = dataStore.getTupleShape();
-        IDataStore::ShapeType componentShape = dataStore.getComponentShape();
-        shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
-        return py::array_t<T, py::array::c_style>(shape, dataStore.data(), py::cast(dataStore));
+        auto& dataArray = self.cast<DataArray<T>&>();
+        auto* dataStore = dynamic_cast<DataStoreType*>(dataArray.getDataStore());
+        if(dataStore == nullptr)
+        {
+          throw py::type_error(fmt::format("DataArray '{}' is not stored in memory ({}) and cannot be viewed without copying. Use store.to_numpy() or iterate store.chunk_positions() instead.",
+                                           dataArray.getName(), dataArray.getDataFormat()));
+        }
+        return py::array_t<T, py::array::c_style>(GetStoreShape(*dataStore), dataStore->data(), self);
       },
       py::return_value_policy::reference_internal);
+  dataArray.def_buffer([](DataArray<T>& dataArray) {
+    auto* dataStore = dynamic_cast<DataStore<T>*>(dataArray.getDataStore());
+    if(dataStore != nullptr)
+    {
+      return CreateBufferInfo(*dataStore);
+    }
+    // Out-of-core stores have no contiguous buffer, so expose a read-only snapshot instead.
+    // The Py_buffer keeps the snapshot alive until the consumer releases it.
+    py::array snapshot = CopyStoreToNumpy(dataArray.getDataStoreRef());
+    snapshot.attr("setflags")("write"_a = false);
+    auto* view = new Py_buffer();
+    if(PyObject_GetBuffer(snapshot.ptr(), view, PyBUF_RECORDS_RO) != 0)
+    {
+      delete view;
+      throw py::error_already_set();
+    }
+    return py::buffer_info(view, true);
+  });
+  dataArray.def(
+      "set_store",
+      [](DataArray<T>& dataArray, std::shared_ptr<AbstractDataStore<T>> store) {
+        if(store == nullptr || store->getTupleShape() != dataArray.getTupleShape() || store->getComponentShape() != dataArray.getComponentShape())
+        {
+          throw py::value_error(fmt::format("The new DataStore must have the tuple shape {} and component shape {} of DataArray '{}'", dataArray.getTupleShape(), dataArray.getComponentShape(),
+                                            dataArray.getName()));
+        }
+        dataArray.setDataStore(std::move(store));
+      },
+      "Replaces the DataStore of this DataArray, for example with one created by DataStore.from_numpy(). The shapes must match.", "store"_a);
   return dataArray;
 }
 
 #define SIMPLNX_PY_BIND_DATA_ARRAY(scope, className) BindDataArray<className::value_type>(scope, #className)
 #define SIMPLNX_PY_BIND_DATA_STORE(scope, className) BindDataStore<className::value_type>(scope, #className)
-#define SIMPLNX_PY_BIND_ABSTRACT_DATA_STORE(scope, className) SIMPLNX_PY_BIND_CLASS_VARIADIC(scope, className, IDataStore, std::shared_ptr<className>)
+#define SIMPLNX_PY_BIND_ABSTRACT_DATA_STORE(scope, className) BindAbstractDataStore<className::value_type>(scope, #className)
 
 template <class GeomT>
 auto BindCreateGeometry2DAction(py::handle scope, const char* name)
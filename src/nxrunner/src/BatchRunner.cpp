@@ -0,0 +1,623 @@
+#include "BatchRunner.hpp"
+
+#include "simplnx/Pipeline/Pipeline.hpp"
+#include "simplnx/Pipeline/PipelineFilter.hpp"
+#include "simplnx/Utilities/MemoryUtilities.hpp"
+
+#include <fmt/format.h>
+
+#include <reproc++/drain.hpp>
+#include <reproc++/reproc.hpp>
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+#include <tbb/global_control.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <tuple>
+
+namespace fs = std::filesystem;
+
+using namespace nx::core;
+using namespace nx::core::CLI;
+
+namespace
+{
+constexpr int32 k_ManifestReadError = -130;
+constexpr int32 k_ManifestParseError = -131;
+constexpr int32 k_ManifestKeyError = -132;
+constexpr int32 k_TemplateLoadError = -133;
+constexpr int32 k_TemplatePreflightError = -134;
+constexpr int32 k_OverrideError = -135;
+constexpr int32 k_ItemExecuteError = -136;
+constexpr int32 k_SummaryWriteError = -137;
+constexpr int32 k_ItemExceptionError = -138;
+constexpr int32 k_JobWriteError = -139;
+constexpr int32 k_JobReadError = -140;
+constexpr int32 k_ItemProcessError = -141;
+constexpr int32 k_ItemResultError = -142;
+
+constexpr StringLiteral k_PipelineKey = "pipeline";
+constexpr StringLiteral k_SummaryKey = "summary";
+constexpr StringLiteral k_MaxConcurrentPipelinesKey = "max_concurrent_pipelines";
+constexpr StringLiteral k_MaxThreadsKey = "max_threads";
+constexpr StringLiteral k_MemoryBudgetKey = "memory_budget";
+constexpr StringLiteral k_ItemsKey = "items";
+constexpr StringLiteral k_NameKey = "name";
+constexpr StringLiteral k_OverridesKey = "overrides";
+constexpr StringLiteral k_FilterIndexKey = "filter_index";
+constexpr StringLiteral k_ParameterKey = "key";
+constexpr StringLiteral k_ValueKey = "value";
+constexpr StringLiteral k_VersionKey = "version";
+constexpr StringLiteral k_StatusKey = "status";
+constexpr StringLiteral k_DurationKey = "duration_seconds";
+constexpr StringLiteral k_ErrorsKey = "errors";
+constexpr StringLiteral k_WarningsKey = "warnings";
+constexpr StringLiteral k_SucceededStatus = "succeeded";
+constexpr StringLiteral k_FailedStatus = "failed";
+
+struct ItemSummary
+{
+  bool succeeded = false;
+  float64 seconds = 0.0;
+  nlohmann::json errors = nlohmann::json::array();
+  nlohmann::json warnings = nlohmann::json::array();
+};
+
+nlohmann::json MessageToJson(int32 code, const std::string& message, std::optional<usize> filterIndex = {}, const std::string& filterName = "")
+{
+  nlohmann::json json;
+  json["code"] = code;
+  json["message"] = message;
+  if(filterIndex.has_value())
+  {
+    json["filter_index"] = *filterIndex;
+    json["filter"] = filterName;
+  }
+  return json;
+}
+
+/**
+ * @brief Collects the errors and warnings of the top level filters of a pipeline.
+ */
+void CollectPipelineMessages(const Pipeline& pipeline, nlohmann::json& errors, nlohmann::json& warnings)
+{
+  for(usize index = 0; index < pipeline.size(); index++)
+  {
+    const auto* filterNode = dynamic_cast<const PipelineFilter*>(pipeline.at(index));
+    if(filterNode == nullptr)
+    {
+      continue;
+    }
+    for(const auto& error : filterNode->getErrors())
+    {
+      errors.push_back(MessageToJson(error.code, error.message, index, filterNode->getName()));
+    }
+    for(const auto& warning : filterNode->getWarnings())
+    {
+      warnings.push_back(MessageToJson(warning.code, warning.message, index, filterNode->getName()));
+    }
+  }
+}
+
+/**
+ * @brief Returns the file the output of the process of a batch item is saved to, next to its job file.
+ */
+fs::path BatchItemLogPath(const fs::path& jobPath)
+{
+  return jobPath.parent_path() / fmt::format("{}.log", jobPath.stem().string());
+}
+
+nlohmann::json ItemSummaryToJson(const ItemSummary& summary)
+{
+  nlohmann::json json;
+  json[k_StatusKey.str()] = summary.succeeded ? k_SucceededStatus.str() : k_FailedStatus.str();
+  json[k_DurationKey.str()] = summary.seconds;
+  json[k_ErrorsKey.str()] = summary.errors;
+  json[k_WarningsKey.str()] = summary.warnings;
+  return json;
+}
+
+/**
+ * @brief Reads the result written by ExecuteBatchItem(). Returns an empty optional if there is no valid result.
+ */
+std::optional<ItemSummary> ReadItemResult(const fs::path& jobPath)
+{
+  std::ifstream resultStream(BatchItemResultPath(jobPath));
+  if(!resultStream.is_open())
+  {
+    return {};
+  }
+  nlohmann::json json = nlohmann::json::parse(resultStream, nullptr, false);
+  if(json.is_discarded() || !json.is_object())
+  {
+    return {};
+  }
+
+  ItemSummary summary;
+  try
+  {
+    summary.succeeded = json.value(k_StatusKey.str(), k_FailedStatus.str()) == k_SucceededStatus.view();
+    summary.seconds = json.value(k_DurationKey.str(), 0.0);
+    summary.errors = json.value(k_ErrorsKey.str(), nlohmann::json::array());
+    summary.warnings = json.value(k_WarningsKey.str(), nlohmann::json::array());
+  } catch(const nlohmann::json::exception&)
+  {
+    return {};
+  }
+  return summary;
+}
+
+/**
+ * @brief Executes the job of one batch item in a child runnerPath process, or in this process if runnerPath is empty.
+ */
+ItemSummary ExecuteItem(const fs::path& runnerPath, const fs::path& jobPath)
+{
+  const auto startTime = std::chrono::steady_clock::now();
+  auto failedSummary = [&startTime](int32 code, const std::string& message) {
+    ItemSummary summary;
+    summary.errors.push_back(MessageToJson(code, message));
+    summary.seconds = std::chrono::duration<float64>(std::chrono::steady_clock::now() - startTime).count();
+    return summary;
+  };
+
+  try
+  {
+    int status = 0;
+    if(runnerPath.empty())
+    {
+      ExecuteBatchItem(jobPath);
+    }
+    else
+    {
+      std::vector<std::string> arguments = {runnerPath.string(), k_BatchItemParamLong.str(), jobPath.string()};
+      reproc::process process;
+      std::error_code errorCode = process.start(reproc::arguments(arguments), reproc::options{});
+      if(errorCode)
+      {
+        return failedSummary(k_ItemProcessError, fmt::format("Could not start '{}': {}", runnerPath.string(), errorCode.message()));
+      }
+
+      std::string processOutput;
+      reproc::sink::string sink(processOutput);
+      errorCode = reproc::drain(process, sink, sink);
+      if(!errorCode)
+      {
+        std::tie(status, errorCode) = process.wait(reproc::infinite);
+      }
+
+      // Keep the output of the process next to its job so failures can be diagnosed
+      std::ofstream logStream(BatchItemLogPath(jobPath), std::ios_base::out | std::ios_base::trunc);
+      logStream << processOutput;
+
+      if(errorCode)
+      {
+        return failedSummary(k_ItemProcessError, fmt::format("Error while waiting for the batch item process: {}", errorCode.message()));
+      }
+    }
+
+    std::optional<ItemSummary> summary = ReadItemResult(jobPath);
+    if(!summary.has_value())
+    {
+      std::string message = fmt::format("The batch item did not write a result to '{}'", BatchItemResultPath(jobPath).string());
+      if(!runnerPath.empty())
+      {
+        message += fmt::format(". The process exited with status {}, see '{}'", status, BatchItemLogPath(jobPath).string());
+      }
+      return failedSummary(k_ItemResultError, message);
+    }
+    summary->seconds = std::chrono::duration<float64>(std::chrono::steady_clock::now() - startTime).count();
+    return std::move(*summary);
+  } catch(const std::exception& exception)
+  {
+    return failedSummary(k_ItemExceptionError, fmt::format("Exception while executing the batch item: {}", exception.what()));
+  } catch(...)
+  {
+    return failedSummary(k_ItemExceptionError, "Unknown exception while executing the batch item");
+  }
+}
+} // namespace
+
+namespace nx::core::CLI
+{
+// -----------------------------------------------------------------------------
+MemoryGate::MemoryGate(uint64 budget)
+: m_Budget(budget)
+{
+}
+
+// -----------------------------------------------------------------------------
+void MemoryGate::acquire(uint64 bytes)
+{
+  std::unique_lock lock(m_Mutex);
+  m_Condition.wait(lock, [this, bytes]() { return m_InUse == 0 || m_InUse + bytes <= m_Budget; });
+  m_InUse += bytes;
+}
+
+// -----------------------------------------------------------------------------
+void MemoryGate::release(uint64 bytes)
+{
+  {
+    std::lock_guard lock(m_Mutex);
+    m_InUse -= bytes;
+  }
+  m_Condition.notify_all();
+}
+
+// -----------------------------------------------------------------------------
+uint64 MemoryGate::inUse() const
+{
+  std::lock_guard lock(m_Mutex);
+  return m_InUse;
+}
+
+// -----------------------------------------------------------------------------
+ScopedMemoryReservation::ScopedMemoryReservation(MemoryGate& memoryGate, uint64 bytes)
+: m_MemoryGate(memoryGate)
+, m_Bytes(bytes)
+{
+  m_MemoryGate.acquire(m_Bytes);
+}
+
+// -----------------------------------------------------------------------------
+ScopedMemoryReservation::~ScopedMemoryReservation() noexcept
+{
+  m_MemoryGate.release(m_Bytes);
+}
+
+// -----------------------------------------------------------------------------
+Result<> ApplyOverrides(Pipeline& pipeline, const std::vector<BatchOverride>& overrides)
+{
+  for(const auto& override : overrides)
+  {
+    if(override.filterIndex >= pipeline.size())
+    {
+      return MakeErrorResult(k_OverrideError, fmt::format("Filter index {} is out of range. The pipeline has {} filters.", override.filterIndex, pipeline.size()));
+    }
+    auto* filterNode = dynamic_cast<PipelineFilter*>(pipeline.at(override.filterIndex));
+    if(filterNode == nullptr)
+    {
+      return MakeErrorResult(k_OverrideError, fmt::format("Pipeline node {} is not a filter", override.filterIndex));
+    }
+    Parameters parameters = filterNode->getParameters();
+    if(!parameters.contains(override.key))
+    {
+      return MakeErrorResult(k_OverrideError, fmt::format("Filter {} ({}) has no parameter '{}'", override.filterIndex, filterNode->getName(), override.key));
+    }
+    const auto& parameter = parameters.at(override.key);
+    nlohmann::json parameterJson;
+    parameterJson[k_ValueKey] = override.value;
+    parameterJson[k_VersionKey] = parameter->getVersion();
+    Result<std::any> valueResult = parameter->fromJson(parameterJson);
+    if(valueResult.invalid())
+    {
+      return MakeErrorResult(k_OverrideError,
+                             fmt::format("Invalid value for parameter '{}' of filter {} ({}): {}", override.key, override.filterIndex, filterNode->getName(), valueResult.errors()[0].message));
+    }
+    Arguments arguments = filterNode->getArguments();
+    arguments.insertOrAssign(override.key, std::move(valueResult.value()));
+    filterNode->setArguments(arguments);
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<BatchManifest> ReadBatchManifest(const fs::path& manifestPath)
+{
+  std::ifstream manifestStream(manifestPath);
+  if(!manifestStream.is_open())
+  {
+    return MakeErrorResult<BatchManifest>(k_ManifestReadError, fmt::format("Could not open batch manifest '{}'", manifestPath.string()));
+  }
+
+  nlohmann::json json = nlohmann::json::parse(manifestStream, nullptr, false);
+  if(json.is_discarded() || !json.is_object())
+  {
+    return MakeErrorResult<BatchManifest>(k_ManifestParseError, fmt::format("Batch manifest '{}' is not a valid JSON object", manifestPath.string()));
+  }
+
+  const fs::path manifestDir = fs::absolute(manifestPath).parent_path();
+  auto resolvePath = [&manifestDir](const fs::path& path) { return path.is_absolute() ? path : manifestDir / path; };
+
+  BatchManifest manifest;
+  if(!json.contains(k_PipelineKey.str()) || !json[k_PipelineKey.str()].is_string())
+  {
+    return MakeErrorResult<BatchManifest>(k_ManifestKeyError, fmt::format("Batch manifest must contain the template pipeline path as the string '{}'", k_PipelineKey.view()));
+  }
+  manifest.pipelinePath = resolvePath(json[k_PipelineKey.str()].get<std::string>());
+
+  try
+  {
+    manifest.summaryPath = resolvePath(json.value(k_SummaryKey.str(), manifestPath.stem().string() + "_summary.json"));
+    manifest.maxConcurrentPipelines = std::max<usize>(json.value<usize>(k_MaxConcurrentPipelinesKey.str(), 1), 1);
+    manifest.maxThreads = json.value<usize>(k_MaxThreadsKey.str(), 0);
+    manifest.memoryBudget = json.value<uint64>(k_MemoryBudgetKey.str(), 0);
+  } catch(const nlohmann::json::exception& exception)
+  {
+    return MakeErrorResult<BatchManifest>(k_ManifestKeyError, fmt::format("Batch manifest '{}' has an invalid value: {}", manifestPath.string(), exception.what()));
+  }
+
+  if(!json.contains(k_ItemsKey.str()) || !json[k_ItemsKey.str()].is_array())
+  {
+    return MakeErrorResult<BatchManifest>(k_ManifestKeyError, fmt::format("Batch manifest must contain an array of '{}'", k_ItemsKey.view()));
+  }
+  for(const auto& itemJson : json[k_ItemsKey.str()])
+  {
+    if(!itemJson.is_object())
+    {
+      return MakeErrorResult<BatchManifest>(k_ManifestKeyError, fmt::format("Batch item {} must be a JSON object", manifest.items.size()));
+    }
+    BatchItem item;
+    try
+    {
+      item.name = itemJson.value(k_NameKey.str(), fmt::format("item_{}", manifest.items.size()));
+    } catch(const nlohmann::json::exception& exception)
+    {
+      return MakeErrorResult<BatchManifest>(k_ManifestKeyError, fmt::format("Batch item {} has an invalid '{}': {}", manifest.items.size(), k_NameKey.view(), exception.what()));
+    }
+    if(itemJson.contains(k_OverridesKey.str()))
+    {
+      if(!itemJson[k_OverridesKey.str()].is_array())
+      {
+        return MakeErrorResult<BatchManifest>(k_ManifestKeyError, fmt::format("The '{}' of batch item '{}' must be an array", k_OverridesKey.view(), item.name));
+      }
+      for(const auto& overrideJson : itemJson[k_OverridesKey.str()])
+      {
+        if(!overrideJson.is_object() || !overrideJson.contains(k_FilterIndexKey.str()) || !overrideJson[k_FilterIndexKey.str()].is_number_unsigned() ||
+           !overrideJson.contains(k_ParameterKey.str()) || !overrideJson[k_ParameterKey.str()].is_string() || !overrideJson.contains(k_ValueKey.str()))
+        {
+          return MakeErrorResult<BatchManifest>(k_ManifestKeyError, fmt::format("Override {} of batch item '{}' must contain '{}', '{}' and '{}'", overrideJson.dump(), item.name,
+                                                                                k_FilterIndexKey.view(), k_ParameterKey.view(), k_ValueKey.view()));
+        }
+        item.overrides.push_back(
+            {overrideJson[k_FilterIndexKey.str()].get<usize>(), overrideJson[k_ParameterKey.str()].get<std::string>(), overrideJson[k_ValueKey.str()]});
+      }
+    }
+    manifest.items.push_back(std::move(item));
+  }
+
+  return {std::move(manifest)};
+}
+
+// -----------------------------------------------------------------------------
+fs::path BatchItemResultPath(const fs::path& jobPath)
+{
+  return jobPath.parent_path() / fmt::format("{}_result.json", jobPath.stem().string());
+}
+
+// -----------------------------------------------------------------------------
+Result<> ExecuteBatchItem(const fs::path& jobPath)
+{
+  std::ifstream jobStream(jobPath);
+  if(!jobStream.is_open())
+  {
+    return MakeErrorResult(k_JobReadError, fmt::format("Could not open batch item job '{}'", jobPath.string()));
+  }
+  nlohmann::json jobJson = nlohmann::json::parse(jobStream, nullptr, false);
+  if(jobJson.is_discarded() || !jobJson.is_object() || !jobJson.contains(k_PipelineKey.str()))
+  {
+    return MakeErrorResult(k_JobReadError, fmt::format("Batch item job '{}' is not a valid JSON object with a '{}'", jobPath.string(), k_PipelineKey.view()));
+  }
+
+  ItemSummary summary;
+  const auto startTime = std::chrono::steady_clock::now();
+  try
+  {
+#ifdef SIMPLNX_ENABLE_MULTICORE
+    std::optional<tbb::global_control> threadLimit;
+    const usize maxThreads = jobJson.value<usize>(k_MaxThreadsKey.str(), 0);
+    if(maxThreads > 0)
+    {
+      threadLimit.emplace(tbb::global_control::max_allowed_parallelism, maxThreads);
+    }
+#endif
+
+    Result<Pipeline> loadResult = Pipeline::FromJson(jobJson[k_PipelineKey.str()]);
+    if(loadResult.invalid())
+    {
+      for(const auto& error : loadResult.errors())
+      {
+        summary.errors.push_back(MessageToJson(error.code, error.message));
+      }
+    }
+    else
+    {
+      Pipeline& pipeline = loadResult.value();
+      summary.succeeded = pipeline.execute();
+      CollectPipelineMessages(pipeline, summary.errors, summary.warnings);
+      if(!summary.succeeded && summary.errors.empty())
+      {
+        summary.errors.push_back(MessageToJson(k_ItemExecuteError, "Error executing pipeline"));
+      }
+    }
+  } catch(const std::exception& exception)
+  {
+    summary.succeeded = false;
+    summary.errors.push_back(MessageToJson(k_ItemExceptionError, fmt::format("Exception while executing the pipeline: {}", exception.what())));
+  } catch(...)
+  {
+    summary.succeeded = false;
+    summary.errors.push_back(MessageToJson(k_ItemExceptionError, "Unknown exception while executing the pipeline"));
+  }
+  summary.seconds = std::chrono::duration<float64>(std::chrono::steady_clock::now() - startTime).count();
+
+  const fs::path resultPath = BatchItemResultPath(jobPath);
+  std::ofstream resultStream(resultPath, std::ios_base::out | std::ios_base::trunc);
+  if(!resultStream.is_open())
+  {
+    return MakeErrorResult(k_ItemResultError, fmt::format("Could not write batch item result '{}'", resultPath.string()));
+  }
+  resultStream << ItemSummaryToJson(summary).dump(2);
+
+  if(!summary.succeeded)
+  {
+    return MakeErrorResult(k_ItemExecuteError, fmt::format("Batch item job '{}' failed", jobPath.string()));
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<> ExecuteBatch(const BatchManifest& manifest, const fs::path& runnerPath, const BatchOutputCallback& output)
+{
+  std::mutex outputMutex;
+  auto print = [&output, &outputMutex](const std::string& message) {
+    std::lock_guard lock(outputMutex);
+    try
+    {
+      output(message);
+    } catch(...)
+    {
+      // A failing progress output must not abort the batch or a worker thread
+    }
+  };
+
+  // Load and preflight the template once; every item starts from a copy of this validated pipeline
+  print(fmt::format("Loading template pipeline '{}'", manifest.pipelinePath.string()));
+  Result<Pipeline> loadResult = Pipeline::FromFile(manifest.pipelinePath);
+  if(loadResult.invalid())
+  {
+    return MakeErrorResult(k_TemplateLoadError, fmt::format("Could not load template pipeline '{}': {}", manifest.pipelinePath.string(), loadResult.errors()[0].message));
+  }
+  Pipeline templatePipeline = std::move(loadResult.value());
+
+  const uint64 memoryEstimate = templatePipeline.checkMemoryRequired();
+  if(templatePipeline.hasErrors())
+  {
+    nlohmann::json errors = nlohmann::json::array();
+    nlohmann::json warnings = nlohmann::json::array();
+    CollectPipelineMessages(templatePipeline, errors, warnings);
+    std::string message = fmt::format("Template pipeline '{}' failed to preflight", manifest.pipelinePath.string());
+    for(const auto& error : errors)
+    {
+      message += fmt::format("\n  [{}] {}: {}", error["filter_index"].get<usize>(), error["filter"].get<std::string>(), error["message"].get<std::string>());
+    }
+    return MakeErrorResult(k_TemplatePreflightError, message);
+  }
+
+  // Apply the overrides of every item to its own copy of the template and save it as the job of that item
+  const fs::path jobDir = manifest.summaryPath.parent_path() / fmt::format("{}_items", manifest.summaryPath.stem().string());
+  std::error_code errorCode;
+  fs::create_directories(jobDir, errorCode);
+  if(errorCode)
+  {
+    return MakeErrorResult(k_JobWriteError, fmt::format("Could not create the batch item directory '{}': {}", jobDir.string(), errorCode.message()));
+  }
+
+  std::vector<ItemSummary> summaries(manifest.items.size());
+  std::vector<fs::path> jobPaths(manifest.items.size());
+  for(usize itemIndex = 0; itemIndex < manifest.items.size(); itemIndex++)
+  {
+    auto pipeline = std::unique_ptr<Pipeline>(dynamic_cast<Pipeline*>(templatePipeline.deepCopy().release()));
+    Result<> overrideResult = ApplyOverrides(*pipeline, manifest.items[itemIndex].overrides);
+    if(overrideResult.invalid())
+    {
+      for(const auto& error : overrideResult.errors())
+      {
+        summaries[itemIndex].errors.push_back(MessageToJson(error.code, error.message));
+      }
+      continue;
+    }
+
+    nlohmann::json jobJson;
+    jobJson[k_PipelineKey.str()] = pipeline->toJson();
+    jobJson[k_MaxThreadsKey.str()] = manifest.maxThreads;
+    const fs::path jobPath = jobDir / fmt::format("item_{}.json", itemIndex);
+    std::ofstream jobStream(jobPath, std::ios_base::out | std::ios_base::trunc);
+    if(!jobStream.is_open())
+    {
+      summaries[itemIndex].errors.push_back(MessageToJson(k_JobWriteError, fmt::format("Could not write batch item job '{}'", jobPath.string())));
+      continue;
+    }
+    jobStream << jobJson.dump(2);
+
+    // A result left over from an earlier batch must never be mistaken for the result of this one
+    fs::remove(BatchItemResultPath(jobPath), errorCode);
+    jobPaths[itemIndex] = jobPath;
+  }
+
+  const uint64 memoryBudget = manifest.memoryBudget > 0 ? manifest.memoryBudget : Memory::GetTotalMemory();
+  const usize workerCount = runnerPath.empty() ? 1 : std::min(manifest.maxConcurrentPipelines, manifest.items.size());
+  print(fmt::format("Executing {} items with up to {} concurrent pipelines. Estimated memory per item: {} bytes, budget: {} bytes", manifest.items.size(), workerCount, memoryEstimate,
+                    memoryBudget));
+
+  MemoryGate memoryGate(memoryBudget);
+  std::atomic<usize> nextItem = 0;
+  std::atomic<usize> finishedItems = 0;
+
+  auto worker = [&]() {
+    for(usize itemIndex = nextItem++; itemIndex < manifest.items.size(); itemIndex = nextItem++)
+    {
+      const BatchItem& item = manifest.items[itemIndex];
+      if(!jobPaths[itemIndex].empty())
+      {
+        ScopedMemoryReservation reservation(memoryGate, memoryEstimate);
+        summaries[itemIndex] = ExecuteItem(runnerPath, jobPaths[itemIndex]);
+      }
+
+      const ItemSummary& summary = summaries[itemIndex];
+      print(fmt::format("[{}/{}] {} {} in {:.2f}s", ++finishedItems, manifest.items.size(), item.name, summary.succeeded ? "succeeded" : "FAILED", summary.seconds));
+    }
+  };
+  std::vector<std::thread> workers;
+  for(usize i = 1; i < workerCount; i++)
+  {
+    try
+    {
+      workers.emplace_back(worker);
+    } catch(const std::system_error&)
+    {
+      // Carry on with the workers that could be started
+      break;
+    }
+  }
+  worker();
+  for(auto& thread : workers)
+  {
+    thread.join();
+  }
+
+  // Write the per item summary
+  nlohmann::json summaryJson;
+  summaryJson[k_PipelineKey.str()] = manifest.pipelinePath.string();
+  nlohmann::json itemsJson = nlohmann::json::array();
+  usize failedCount = 0;
+  for(usize itemIndex = 0; itemIndex < manifest.items.size(); itemIndex++)
+  {
+    const ItemSummary& summary = summaries[itemIndex];
+    nlohmann::json itemJson = ItemSummaryToJson(summary);
+    itemJson[k_NameKey.str()] = manifest.items[itemIndex].name;
+    itemJson["index"] = itemIndex;
+    itemsJson.push_back(std::move(itemJson));
+    if(!summary.succeeded)
+    {
+      failedCount++;
+    }
+  }
+  summaryJson[k_ItemsKey.str()] = std::move(itemsJson);
+  summaryJson["succeeded"] = manifest.items.size() - failedCount;
+  summaryJson["failed"] = failedCount;
+
+  std::ofstream summaryStream(manifest.summaryPath, std::ios_base::out | std::ios_base::trunc);
+  if(!summaryStream.is_open())
+  {
+    return MakeErrorResult(k_SummaryWriteError, fmt::format("Could not write batch summary '{}'", manifest.summaryPath.string()));
+  }
+  summaryStream << summaryJson.dump(2);
+  print(fmt::format("Batch summary written to '{}'", manifest.summaryPath.string()));
+
+  if(failedCount > 0)
+  {
+    return MakeErrorResult(k_ItemExecuteError, fmt::format("{} of {} batch items failed", failedCount, manifest.items.size()));
+  }
+  return {};
+}
+} // namespace nx::core::CLI
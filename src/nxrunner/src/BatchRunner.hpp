@@ -0,0 +1,158 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/StringLiteral.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/Pipeline/Pipeline.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace nx::core
+{
+namespace CLI
+{
+/**
+ * @brief nxrunner argument that executes one batch item job file. Used by ExecuteBatch to start the item processes.
+ */
+constexpr StringLiteral k_BatchItemParamLong = "--batch-item";
+
+/**
+ * @brief Replaces the value of one parameter of one filter of the template pipeline.
+ * value uses the same JSON representation as the "value" entry of the pipeline file.
+ */
+struct BatchOverride
+{
+  usize filterIndex = 0;
+  std::string key;
+  nlohmann::json value;
+};
+
+/**
+ * @brief One execution of the template pipeline.
+ */
+struct BatchItem
+{
+  std::string name;
+  std::vector<BatchOverride> overrides;
+};
+
+/**
+ * @brief Contents of a batch manifest file.
+ */
+struct BatchManifest
+{
+  std::filesystem::path pipelinePath;
+  std::filesystem::path summaryPath;
+  usize maxConcurrentPipelines = 1;
+  usize maxThreads = 0;   // Per item; 0 lets the threading library use every core
+  uint64 memoryBudget = 0; // Bytes; 0 uses the total system memory
+  std::vector<BatchItem> items;
+};
+
+using BatchOutputCallback = std::function<void(const std::string&)>;
+
+/**
+ * @brief Counting semaphore over bytes. A reservation larger than the whole budget is
+ * granted once nothing else is running so a single oversized item can still execute.
+ */
+class MemoryGate
+{
+public:
+  explicit MemoryGate(uint64 budget);
+
+  /**
+   * @brief Blocks until the bytes fit in the budget next to the current reservations.
+   * @param bytes
+   */
+  void acquire(uint64 bytes);
+
+  /**
+   * @brief Returns bytes reserved by acquire() and wakes the waiting threads.
+   * @param bytes
+   */
+  void release(uint64 bytes);
+
+  /**
+   * @brief Returns the number of bytes currently reserved.
+   * @return
+   */
+  uint64 inUse() const;
+
+private:
+  uint64 m_Budget = 0;
+  uint64 m_InUse = 0;
+  mutable std::mutex m_Mutex;
+  std::condition_variable m_Condition;
+};
+
+/**
+ * @brief Holds a MemoryGate reservation for its lifetime so the bytes are returned even if the work throws.
+ */
+class ScopedMemoryReservation
+{
+public:
+  ScopedMemoryReservation(MemoryGate& memoryGate, uint64 bytes);
+  ~ScopedMemoryReservation() noexcept;
+
+  ScopedMemoryReservation(const ScopedMemoryReservation&) = delete;
+  ScopedMemoryReservation(ScopedMemoryReservation&&) noexcept = delete;
+  ScopedMemoryReservation& operator=(const ScopedMemoryReservation&) = delete;
+  ScopedMemoryReservation& operator=(ScopedMemoryReservation&&) noexcept = delete;
+
+private:
+  MemoryGate& m_MemoryGate;
+  uint64 m_Bytes = 0;
+};
+
+/**
+ * @brief Reads a batch manifest. Relative paths are resolved against the directory of the manifest.
+ * @param manifestPath
+ * @return
+ */
+Result<BatchManifest> ReadBatchManifest(const std::filesystem::path& manifestPath);
+
+/**
+ * @brief Replaces the parameter values of the filters of a pipeline with the overrides of a batch item.
+ * @param pipeline
+ * @param overrides
+ * @return Errors if an override names a missing filter/parameter or holds an invalid value
+ */
+Result<> ApplyOverrides(Pipeline& pipeline, const std::vector<BatchOverride>& overrides);
+
+/**
+ * @brief Returns the file the result of a batch item is written to, next to its job file.
+ * @param jobPath
+ * @return
+ */
+std::filesystem::path BatchItemResultPath(const std::filesystem::path& jobPath);
+
+/**
+ * @brief Executes one batch item job file written by ExecuteBatch in the current process and writes
+ * its status, duration, errors and warnings to BatchItemResultPath(). This is what `nxrunner --batch-item` runs.
+ * @param jobPath
+ * @return Errors if the job could not be read or the pipeline failed
+ */
+Result<> ExecuteBatchItem(const std::filesystem::path& jobPath);
+
+/**
+ * @brief Loads and preflights the template pipeline once, applies the overrides of every item to its own
+ * copy of the validated pipeline and writes each copy to a job file next to the summary. Every job is then
+ * executed in its own runnerPath process (`nxrunner --batch-item`) because the HDF5 library is not thread safe,
+ * so pipelines can never share a process. Up to maxConcurrentPipelines processes run at the same time as long
+ * as their combined preflight memory estimate fits in the memory budget, and each of them uses at most
+ * maxThreads threads. A JSON summary with one entry per item is written to summaryPath.
+ * @param manifest
+ * @param runnerPath nxrunner executable. If empty, the items are executed one after another in this process.
+ * @param output Receives progress messages. Called from worker threads, but never concurrently.
+ * @return Errors if the template could not be loaded/preflighted or if any item failed
+ */
+Result<> ExecuteBatch(const BatchManifest& manifest, const std::filesystem::path& runnerPath, const BatchOutputCallback& output);
+} // namespace CLI
+} // namespace nx::core
@@ -1,3 +1,4 @@
+#include "BatchRunner.hpp"
 #include "CliObserver.hpp"
 
 #include "simplnx/Common/Result.hpp"
@@ -47,6 +48,7 @@ constexpr StringLiteral k_PreflightParamLong = "--preflight";
 constexpr StringLiteral k_LogFileParamLong = "--logfile";
 constexpr StringLiteral k_ConvertParamLong = "--convert";
 constexpr StringLiteral k_ConvertOutputParamLong = "--convert-output";
+constexpr StringLiteral k_BatchParamLong = "--batch";
 
 constexpr StringLiteral k_HelpParamShort = "-h";
 constexpr StringLiteral k_ExecuteParamShort = "-e";
@@ -54,6 +56,7 @@ constexpr StringLiteral k_PreflightParamShort = "-p";
 constexpr StringLiteral k_LogFileParamShort = "-l";
 constexpr StringLiteral k_ConvertParamShort = "-c";
 constexpr StringLiteral k_ConvertOutputParamShort = "-co";
+constexpr StringLiteral k_BatchParamShort = "-b";
 
 void LoadApp()
 {
@@ -137,7 +140,9 @@ enum class ArgumentType
   Help,
   Logfile,
   Convert,
-  ConvertOutput
+  ConvertOutput,
+  Batch,
+  BatchItem
 };
 
 struct Argument
@@ -236,6 +241,16 @@ Result<CliArguments> ParseParameters(int argc, char* argv[])
       std::string argStr = ParseArgument(argc, argv, index);
       args.emplace_back(ArgumentType::ConvertOutput, argStr);
     }
+    else if(arg == k_BatchParamLong || arg == k_BatchParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::Batch, argStr);
+    }
+    else if(arg == CLI::k_BatchItemParamLong)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::BatchItem, argStr);
+    }
     else
     {
       args.emplace_back(ArgumentType::Invalid, arg);
@@ -435,6 +450,31 @@ Result<> ConvertPipeline(const Argument& arg, bool printConvertedPipeline, bool
   return ConvertResult(std::move(loadPipelineResult));
 }
 
+Result<> ExecuteBatch(const Argument& arg, const fs::path& runnerPath)
+{
+  std::string manifestPath = arg.value;
+  cliOut << "Batch Manifest: " << manifestPath << "\n";
+
+  Result<CLI::BatchManifest> manifestResult = CLI::ReadBatchManifest(manifestPath);
+  if(manifestResult.invalid())
+  {
+    return ConvertResult(std::move(manifestResult));
+  }
+
+  CLI::BatchOutputCallback outputCallback = [](const std::string& message) {
+    cliOut << timestamp() << " " << message;
+    cliOut.endline();
+  };
+  return CLI::ExecuteBatch(manifestResult.value(), runnerPath, outputCallback);
+}
+
+Result<> ExecuteBatchItem(const Argument& arg)
+{
+  std::string jobPath = arg.value;
+  cliOut << "Batch Item Job: " << jobPath << "\n";
+  return CLI::ExecuteBatchItem(jobPath);
+}
+
 void DisplayDefaultHelp()
 {
   cliOut << "Options:\n";
@@ -444,6 +484,8 @@ void DisplayDefaultHelp()
          << "\t Preflight the pipeline at the target filepath. Optionally, create a log file at the specified path.\n";
   cliOut << fmt::format("\t {}|{} <pipeline filepath>  [{}|{} <log filepath>]\t", k_ConvertParamLong, k_ConvertParamShort, k_LogFileParamLong, k_LogFileParamShort)
          << "\t Convert the SIMPL pipeline at the target filepath. Optionally, create a log file at the specified path.";
+  cliOut << fmt::format("\t {}|{} <manifest filepath>  [{}|{} <log filepath>]\t", k_BatchParamLong, k_BatchParamShort, k_LogFileParamLong, k_LogFileParamShort)
+         << "\t Execute a template pipeline once per item of the batch manifest at the target filepath. Optionally, create a log file at the specified path.\n";
   cliOut << fmt::format("\t <operand [argument]>  [{}|{} <log filepath>]\t", k_LogFileParamLong, k_LogFileParamShort) << "\t Creates a log file at the specified path.";
   cliOut.endline();
 }
@@ -480,6 +522,14 @@ void DisplayConvertOutputHelp()
   cliOut.endline();
 }
 
+void DisplayBatchHelp()
+{
+  cliOut << "To execute a batch of parameterized pipelines:\n\t";
+  cliOut << fmt::format("\t {}|{} <manifest filepath>  [{}|{} <log filepath>]\t", k_BatchParamLong, k_BatchParamShort, k_LogFileParamLong, k_LogFileParamShort)
+         << "\t Execute a template pipeline once per item of the batch manifest at the target filepath. Optionally, create a log file at the specified path.";
+  cliOut.endline();
+}
+
 void DisplayLogfileHelp()
 {
   cliOut << "To export output a log file:\n\t";
@@ -512,6 +562,13 @@ Result<> DisplayHelpMenu(const std::vector<Argument>& arguments)
     DisplayConvertOutputHelp();
     return {};
   }
+  case ArgumentType::BatchItem: {
+    [[fallthrough]];
+  }
+  case ArgumentType::Batch: {
+    DisplayBatchHelp();
+    return {};
+  }
   case ArgumentType::Logfile: {
     DisplayLogfileHelp();
     return {};
@@ -583,6 +640,12 @@ int main(int argc, char* argv[])
     case ArgumentType::Execute: {
       [[fallthrough]];
     }
+    case ArgumentType::Batch: {
+      [[fallthrough]];
+    }
+    case ArgumentType::BatchItem: {
+      [[fallthrough]];
+    }
     case ArgumentType::Preflight: {
       break;
     }
@@ -673,6 +736,50 @@ int main(int argc, char* argv[])
       fmt::print("Python exception: {}\n", exception.what());
       return 1;
     }
+#endif
+    catch(const std::exception& exception)
+    {
+      fmt::print("Exception: {}\n", exception.what());
+      return 1;
+    }
+    break;
+  }
+  case ArgumentType::Batch: {
+    try
+    {
+      cliOut << "###### BATCH MODE ########\n";
+      // Every item runs in its own nxrunner process started from this executable
+      const fs::path runnerPath = app->getCurrentDir() / fs::path(argv[0]).filename();
+      auto result = ExecuteBatch(arguments[0], runnerPath);
+      results.push_back(result);
+    }
+#if SIMPLNX_EMBED_PYTHON
+    catch(const py::error_already_set& exception)
+    {
+      fmt::print("Python exception: {}\n", exception.what());
+      return 1;
+    }
+#endif
+    catch(const std::exception& exception)
+    {
+      fmt::print("Exception: {}\n", exception.what());
+      return 1;
+    }
+    break;
+  }
+  case ArgumentType::BatchItem: {
+    try
+    {
+      cliOut << "###### BATCH ITEM MODE ########\n";
+      auto result = ExecuteBatchItem(arguments[0]);
+      results.push_back(result);
+    }
+#if SIMPLNX_EMBED_PYTHON
+    catch(const py::error_already_set& exception)
+    {
+      fmt::print("Python exception: {}\n", exception.what());
+      return 1;
+    }
 #endif
     catch(const std::exception& exception)
     {
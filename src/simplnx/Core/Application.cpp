@@ -75,7 +75,7 @@ std::filesystem::path findCurrentPath()
 #endif
 }
 
-std::string getApplicationName(Application* app)
+std::string getApplicationName(const Application* app)
 {
   return "DREAM3DNX";
 }
@@ -224,6 +224,18 @@ void Application::loadPlugins(const std::filesystem::path& pluginDir, bool verbo
   {
     fmt::print("Loading Plugins from {}\n", pluginDir.string());
   }
+
+  const std::filesystem::path cacheFilePath = getPluginManifestCacheFilePath();
+  if(m_PluginManifestCache == nullptr)
+  {
+    m_PluginManifestCache = std::make_unique<PluginManifestCache>();
+    Result<> cacheResult = m_PluginManifestCache->loadFromFile(cacheFilePath);
+    if(cacheResult.invalid() && verbose)
+    {
+      fmt::print("Ignoring plugin manifest cache: {}\n", cacheResult.errors()[0].message);
+    }
+  }
+
   for(const auto& entry : std::filesystem::directory_iterator(pluginDir))
   {
     std::filesystem::path path = entry.path();
@@ -236,6 +248,15 @@ void Application::loadPlugins(const std::filesystem::path& pluginDir, bool verbo
       loadPlugin(path, verbose);
     }
   }
+
+  if(m_PluginManifestCache->isModified())
+  {
+    Result<> saveResult = m_PluginManifestCache->saveToFile(cacheFilePath);
+    if(saveResult.invalid() && verbose)
+    {
+      fmt::print("Could not save plugin manifest cache: {}\n", saveResult.errors()[0].message);
+    }
+  }
 }
 
 FilterList* Application::getFilterList() const
@@ -243,6 +264,26 @@ FilterList* Application::getFilterList() const
   return m_FilterList.get();
 }
 
+const PluginManifestCache* Application::getPluginManifestCache() const
+{
+  return m_PluginManifestCache.get();
+}
+
+void Application::setPluginManifestCacheFilePath(const std::filesystem::path& filepath)
+{
+  m_PluginManifestCacheFilePath = filepath;
+  m_PluginManifestCache.reset();
+}
+
+std::filesystem::path Application::getPluginManifestCacheFilePath() const
+{
+  if(m_PluginManifestCacheFilePath.empty())
+  {
+    return PluginManifestCache::DefaultFilePath(getApplicationName(this));
+  }
+  return m_PluginManifestCacheFilePath;
+}
+
 std::unordered_set<AbstractPlugin*> Application::getPluginList() const
 {
   return m_FilterList->getLoadedPlugins();
@@ -250,15 +291,7 @@ std::unordered_set<AbstractPlugin*> Application::getPluginList() const
 
 const AbstractPlugin* Application::getPlugin(const Uuid& uuid) const
 {
-  std::unordered_set<AbstractPlugin*> plugins = m_FilterList->getLoadedPlugins();
-  for(const auto* plugin : plugins)
-  {
-    if(plugin->getId() == uuid)
-    {
-      return plugin;
-    }
-  }
-  return nullptr;
+  return m_FilterList->getPlugin(uuid);
 }
 
 Preferences* Application::getPreferences()
@@ -283,6 +316,27 @@ std::shared_ptr<IDataIOManager> Application::getIOManager(const std::string& for
 
 void Application::loadPlugin(const std::filesystem::path& path, bool verbose)
 {
+  // Plugins with an up to date manifest are registered without loading the library
+  const PluginManifest* manifest = nullptr;
+  if(m_PluginManifestCache != nullptr && m_Preferences->lazyPluginLoading())
+  {
+    manifest = m_PluginManifestCache->find(path);
+  }
+  if(manifest != nullptr && !manifest->hasDataIOManagers)
+  {
+    if(verbose)
+    {
+      fmt::print("Registering Plugin: {}\n", path.string());
+    }
+    auto pluginLoader = std::make_shared<LazyPluginLoader>(*manifest);
+    if(getFilterList()->addPlugin(pluginLoader).invalid())
+    {
+      return;
+    }
+    addSimplUuids(manifest->simplToSimplnxUuids, manifest->name);
+    return;
+  }
+
   if(verbose)
   {
     fmt::print("Loading Plugin: {}\n", path.string());
@@ -299,29 +353,47 @@ void Application::loadPlugin(const std::filesystem::path& path, bool verbose)
     return;
   }
 
-  AbstractPlugin::SIMPLMapType simplToSimplnxUuids = plugin->getSimplToSimplnxMap();
-  for(auto const& [simplUuid, simplData] : simplToSimplnxUuids)
+  if(m_PluginManifestCache != nullptr && m_PluginManifestCache->find(path) == nullptr)
+  {
+    Result<PluginManifest> manifestResult = PluginManifest::Create(*plugin, path);
+    if(manifestResult.valid())
+    {
+      m_PluginManifestCache->insert(std::move(manifestResult.value()));
+    }
+  }
+
+  std::vector<std::pair<Uuid, Uuid>> simplToSimplnxUuids;
+  for(auto const& [simplUuid, simplData] : plugin->getSimplToSimplnxMap())
+  {
+    simplToSimplnxUuids.emplace_back(simplUuid, simplData.simplnxUuid);
+  }
+  addSimplUuids(simplToSimplnxUuids, plugin->getName());
+
+  for(const auto& pluginIO : plugin->getDataIOManagers())
+  {
+    m_DataIOCollection->addIOManager(pluginIO);
+  }
+}
+
+void Application::addSimplUuids(const std::vector<std::pair<Uuid, Uuid>>& simplToSimplnxUuids, const std::string& pluginName)
+{
+  for(auto const& [simplUuid, simplnxUuid] : simplToSimplnxUuids)
   {
     for(const auto& uuid : m_Simpl_Uuids)
     {
       if(uuid == simplUuid)
       {
-        throw std::runtime_error(fmt::format("Duplicate UUIDs found in the SIMPL UUID maps! UUID: {} Plugin: {}", simplUuid.str(), plugin->getName()));
+        throw std::runtime_error(fmt::format("Duplicate UUIDs found in the SIMPL UUID maps! UUID: {} Plugin: {}", simplUuid.str(), pluginName));
       }
     }
     m_Simpl_Uuids.push_back(simplUuid);
-    m_Simplnx_Uuids.push_back(simplData.simplnxUuid);
+    m_Simplnx_Uuids.push_back(simplnxUuid);
   }
 
   if(m_Simpl_Uuids.size() != m_Simplnx_Uuids.size())
   {
     throw std::runtime_error(fmt::format("UUID maps are not of the same size! SIMPL UUID Vector size: {} Simplnx UUID Vector size: {}", m_Simpl_Uuids.size(), m_Simplnx_Uuids.size()));
   }
-
-  for(const auto& pluginIO : plugin->getDataIOManagers())
-  {
-    m_DataIOCollection->addIOManager(pluginIO);
-  }
 }
 
 void Application::addDataType(DataObject::Type type, const std::string& name)
@@ -4,6 +4,7 @@
 #include "simplnx/DataStructure/DataObject.hpp"
 #include "simplnx/Filter/FilterList.hpp"
 #include "simplnx/Plugin/AbstractPlugin.hpp"
+#include "simplnx/Plugin/PluginManifestCache.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <filesystem>
@@ -56,6 +57,10 @@ public:
    * @brief Finds and loads plugins in the target directory.
    *
    * Plugins are found by using the file extension of "".
+   * When lazy plugin loading is enabled in the Preferences, plugins whose library is
+   * unchanged since it was recorded in the plugin manifest cache are registered from
+   * the cache and only loaded when one of their filters is first created. Plugins that
+   * provide DataIOManagers are always loaded immediately.
    * @param pluginDir
    */
   void loadPlugins(const std::filesystem::path& pluginDir, bool verbose = false);
@@ -69,6 +74,26 @@ public:
    */
   FilterList* getFilterList() const;
 
+  /**
+   * @brief Returns the plugin manifest cache used by loadPlugins. The cache also
+   * provides the default arguments of every cached filter without creating it.
+   * @return const PluginManifestCache*
+   */
+  const PluginManifestCache* getPluginManifestCache() const;
+
+  /**
+   * @brief Sets the file that loadPlugins reads and writes the plugin manifest cache to.
+   * The cache is read again from the new file on the next call to loadPlugins.
+   * @param filepath
+   */
+  void setPluginManifestCacheFilePath(const std::filesystem::path& filepath);
+
+  /**
+   * @brief Returns the file of the plugin manifest cache. Defaults to PluginManifestCache::DefaultFilePath().
+   * @return std::filesystem::path
+   */
+  std::filesystem::path getPluginManifestCacheFilePath() const;
+
   /**
    * @brief Convenience method to return the loaded plugins
    * @return
@@ -176,6 +201,13 @@ private:
    */
   void loadPlugin(const std::filesystem::path& path, bool verbose = false);
 
+  /**
+   * @brief Records the SIMPL to simplnx filter uuid pairs of a plugin.
+   * @param simplToSimplnxUuids
+   * @param pluginName
+   */
+  void addSimplUuids(const std::vector<std::pair<Uuid, Uuid>>& simplToSimplnxUuids, const std::string& pluginName);
+
   //////////////////
   // Static Variable
   static std::shared_ptr<Application> s_Instance;
@@ -189,5 +221,7 @@ private:
   std::shared_ptr<DataIOCollection> m_DataIOCollection;
   name_type_map m_NamedTypesMap;
   std::unique_ptr<Preferences> m_Preferences = nullptr;
+  std::unique_ptr<PluginManifestCache> m_PluginManifestCache = nullptr;
+  std::filesystem::path m_PluginManifestCacheFilePath = "";
 };
 } // namespace nx::core
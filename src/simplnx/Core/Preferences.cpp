@@ -3,7 +3,10 @@
 #include "simplnx/Plugin/AbstractPlugin.hpp"
 #include "simplnx/Utilities/MemoryUtilities.hpp"
 
+#include <fmt/format.h>
+
 #include <fstream>
+#include <random>
 
 #ifdef _WIN32
 #include <stdio.h>
@@ -29,10 +32,13 @@ constexpr int64 k_ReducedDataStructureSize = 3221225472; // 3 GB
 constexpr int32 k_FailedToCreateDirectory_Code = -585;
 constexpr int32 k_FileDoesNotExist_Code = -586;
 constexpr int32 k_FileCouldNotOpen_Code = -587;
+constexpr int32 k_FileCouldNotParse_Code = -588;
+constexpr int32 k_FileCouldNotReplace_Code = -589;
 
 constexpr StringLiteral k_FailedToCreateDirectory_Message = "Failed to the parent directory when saving Preferences";
 constexpr StringLiteral k_FileDoesNotExist_Message = "Preferences file does not exist";
 constexpr StringLiteral k_FileCouldNotOpen_Message = "Could not open Preferences file";
+constexpr StringLiteral k_FileCouldNotParse_Message = "Preferences file is not valid JSON";
 
 std::filesystem::path getHomeDirectory()
 {
@@ -83,6 +89,8 @@ void Preferences::setDefaultValues()
 #else
   m_DefaultValues[k_ForceOocData_Key] = false;
 #endif
+
+  m_DefaultValues[k_LazyPluginLoading_Key] = true;
 }
 
 std::string Preferences::defaultLargeDataFormat() const
@@ -208,13 +216,33 @@ Result<> Preferences::saveToFile(const std::filesystem::path& filepath) const
     return MakeErrorResult(k_FailedToCreateDirectory_Code, k_FailedToCreateDirectory_Message);
   }
 
-  std::ofstream fileStream(filepath);
-  if(!fileStream.is_open())
+  // Write to a temporary file next to the preferences and swap it in, so that several applications
+  // (e.g. the processes of an nxrunner batch) never read a partially written file
+  std::filesystem::path tempFilePath = filepath;
+  tempFilePath += fmt::format(".{}.tmp", std::random_device{}());
+  std::error_code errorCode;
   {
-    return MakeErrorResult(k_FileCouldNotOpen_Code, k_FileCouldNotOpen_Message);
+    std::ofstream fileStream(tempFilePath, std::ios_base::out | std::ios_base::trunc);
+    if(!fileStream.is_open())
+    {
+      return MakeErrorResult(k_FileCouldNotOpen_Code, k_FileCouldNotOpen_Message);
+    }
+    fileStream << m_Values;
+    fileStream.close();
+    if(fileStream.fail())
+    {
+      std::filesystem::remove(tempFilePath, errorCode);
+      return MakeErrorResult(k_FileCouldNotOpen_Code, k_FileCouldNotOpen_Message);
+    }
   }
 
-  fileStream << m_Values;
+  std::filesystem::rename(tempFilePath, filepath, errorCode);
+  if(errorCode)
+  {
+    std::string message = errorCode.message();
+    std::filesystem::remove(tempFilePath, errorCode);
+    return MakeErrorResult(k_FileCouldNotReplace_Code, fmt::format("Could not replace Preferences file '{}': {}", filepath.string(), message));
+  }
   return {};
 }
 
@@ -230,7 +258,12 @@ Result<> Preferences::loadFromFile(const std::filesystem::path& filepath)
   {
     return MakeErrorResult(k_FileCouldNotOpen_Code, k_FileCouldNotOpen_Message);
   }
-  m_Values = nlohmann::json::parse(fileStream);
+  nlohmann::json values = nlohmann::json::parse(fileStream, nullptr, false);
+  if(values.is_discarded())
+  {
+    return MakeErrorResult(k_FileCouldNotParse_Code, k_FileCouldNotParse_Message);
+  }
+  m_Values = std::move(values);
 
   checkUseOoc();
   return {};
@@ -264,6 +297,16 @@ void Preferences::setForceOocData(bool forceOoc)
   setValue(k_ForceOocData_Key, forceOoc);
 }
 
+bool Preferences::lazyPluginLoading() const
+{
+  return valueAs<bool>(k_LazyPluginLoading_Key);
+}
+
+void Preferences::setLazyPluginLoading(bool lazyLoading)
+{
+  setValue(k_LazyPluginLoading_Key, lazyLoading);
+}
+
 void Preferences::updateMemoryDefaults()
 {
   const uint64 minimumRemaining = 2 * defaultValueAs<uint64>(k_LargeDataSize_Key);
@@ -23,6 +23,7 @@ public:
   static inline constexpr StringLiteral k_PreferredLargeDataFormat_Key = "large_data_format";      // string
   static inline constexpr StringLiteral k_LargeDataStructureSize_Key = "large_datastructure_size"; // bytes
   static inline constexpr StringLiteral k_ForceOocData_Key = "force_ooc_data";                     // boolean
+  static inline constexpr StringLiteral k_LazyPluginLoading_Key = "lazy_plugin_loading";           // boolean
 
   static std::filesystem::path DefaultFilePath(const std::string& applicationName);
 
@@ -85,6 +86,9 @@ public:
 
   void setForceOocData(bool forceOoc);
 
+  bool lazyPluginLoading() const;
+  void setLazyPluginLoading(bool lazyLoading);
+
   void updateMemoryDefaults();
   uint64 largeDataStructureSize() const;
 
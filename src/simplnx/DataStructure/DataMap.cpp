@@ -8,15 +8,30 @@
 
 using namespace nx::core;
 
+std::atomic<uint64> DataMap::s_Generation = 0;
+
+uint64 DataMap::Generation()
+{
+  return s_Generation.load(std::memory_order_acquire);
+}
+
+void DataMap::IncrementGeneration()
+{
+  s_Generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
 DataMap::DataMap() = default;
 DataMap::DataMap(const DataMap& other)
 : m_Map(other.m_Map)
+, m_NameIndex(other.m_NameIndex)
 {
 }
 
 DataMap::DataMap(DataMap&& other) noexcept
 : m_Map(std::move(other.m_Map))
+, m_NameIndex(std::move(other.m_NameIndex))
 {
+  IncrementGeneration();
 }
 
 DataMap::~DataMap() = default;
@@ -52,7 +67,14 @@ bool DataMap::insert(const std::shared_ptr<DataObject>& obj)
     return false;
   }
 
+  auto iter = m_Map.find(obj->getId());
+  if(iter != m_Map.end())
+  {
+    removeFromNameIndex(iter->first, iter->second->getName());
+  }
   m_Map[obj->getId()] = obj;
+  m_NameIndex.emplace(obj->getName(), obj->getId());
+  IncrementGeneration();
   return true;
 }
 
@@ -79,13 +101,76 @@ bool DataMap::erase(const Iterator& iter)
   {
     return false;
   }
+  removeFromNameIndex(iter->first, iter->second->getName());
   m_Map.erase(iter);
+  IncrementGeneration();
   return true;
 }
 
 void DataMap::clear()
 {
   m_Map.clear();
+  m_NameIndex.clear();
+  IncrementGeneration();
+}
+
+std::optional<DataMap::IdType> DataMap::findKey(const std::string& name) const
+{
+  auto [first, last] = m_NameIndex.equal_range(name);
+  if(first == last)
+  {
+    return std::nullopt;
+  }
+  IdType key = first->second;
+  for(auto iter = std::next(first); iter != last; ++iter)
+  {
+    key = std::min(key, iter->second);
+  }
+  return key;
+}
+
+void DataMap::rebuildNameIndex()
+{
+  m_NameIndex.clear();
+  m_NameIndex.reserve(m_Map.size());
+  for(const auto& [identifier, data] : m_Map)
+  {
+    m_NameIndex.emplace(data->getName(), identifier);
+  }
+}
+
+void DataMap::removeFromNameIndex(IdType identifier, const std::string& name)
+{
+  auto [first, last] = m_NameIndex.equal_range(name);
+  for(auto iter = first; iter != last; ++iter)
+  {
+    if(iter->second == identifier)
+    {
+      m_NameIndex.erase(iter);
+      return;
+    }
+  }
+}
+
+void DataMap::updateName(const DataObject* obj, const std::string& previousName)
+{
+  if(obj == nullptr)
+  {
+    return;
+  }
+  auto [first, last] = m_NameIndex.equal_range(previousName);
+  for(auto iter = first; iter != last; ++iter)
+  {
+    auto mapIter = m_Map.find(iter->second);
+    if(mapIter != m_Map.end() && mapIter->second.get() == obj)
+    {
+      const IdType identifier = iter->second;
+      m_NameIndex.erase(iter);
+      m_NameIndex.emplace(obj->getName(), identifier);
+      IncrementGeneration();
+      return;
+    }
+  }
 }
 
 std::vector<DataMap::IdType> DataMap::getKeys() const
@@ -141,14 +226,7 @@ std::vector<std::string> DataMap::getNames() const
 
 bool DataMap::contains(const std::string& name) const
 {
-  for(auto& iter : m_Map)
-  {
-    if(iter.second->getName() == name)
-    {
-      return true;
-    }
-  }
-  return false;
+  return m_NameIndex.find(name) != m_NameIndex.end();
 }
 
 bool DataMap::contains(const DataObject* obj) const
@@ -185,26 +263,22 @@ const DataObject* DataMap::operator[](IdType key) const
 
 DataObject* DataMap::operator[](const std::string& name)
 {
-  for(auto& iter : m_Map)
+  auto iter = find(name);
+  if(iter == end())
   {
-    if(iter.second->getName() == name)
-    {
-      return iter.second.get();
-    }
+    return nullptr;
   }
-  return nullptr;
+  return iter->second.get();
 }
 
 const DataObject* DataMap::operator[](const std::string& name) const
 {
-  for(auto& iter : m_Map)
+  auto iter = find(name);
+  if(iter == end())
   {
-    if(iter.second->getName() == name)
-    {
-      return iter.second.get();
-    }
+    return nullptr;
   }
-  return nullptr;
+  return iter->second.get();
 }
 
 DataObject& DataMap::at(const std::string& name)
@@ -239,26 +313,22 @@ DataMap::ConstIterator DataMap::find(IdType identifier) const
 
 DataMap::Iterator DataMap::find(const std::string& name)
 {
-  for(auto iter = begin(); iter != end(); iter++)
+  std::optional<IdType> key = findKey(name);
+  if(!key.has_value())
   {
-    if((*iter).second->getName() == name)
-    {
-      return iter;
-    }
+    return end();
   }
-  return end();
+  return m_Map.find(*key);
 }
 
 DataMap::ConstIterator DataMap::find(const std::string& name) const
 {
-  for(auto iter = begin(); iter != end(); iter++)
+  std::optional<IdType> key = findKey(name);
+  if(!key.has_value())
   {
-    if((*iter).second->getName() == name)
-    {
-      return iter;
-    }
+    return end();
   }
-  return end();
+  return m_Map.find(*key);
 }
 
 void DataMap::setDataStructure(DataStructure* dataStr)
@@ -280,6 +350,7 @@ void DataMap::setDataStructure(DataStructure* dataStr)
     m_Map[key] = shareData;
     dataStr->setData(key, shareData);
   }
+  IncrementGeneration();
 }
 
 DataMap::Iterator DataMap::begin()
@@ -308,6 +379,8 @@ DataMap& DataMap::operator=(const DataMap& rhs)
     DataObject* copy = rhs.m_Map.at(key)->shallowCopy();
     m_Map[key] = std::shared_ptr<DataObject>(copy);
   }
+  m_NameIndex = rhs.m_NameIndex;
+  IncrementGeneration();
 
   return *this;
 }
@@ -315,6 +388,8 @@ DataMap& DataMap::operator=(const DataMap& rhs)
 DataMap& DataMap::operator=(DataMap&& rhs) noexcept
 {
   m_Map = std::move(rhs.m_Map);
+  m_NameIndex = std::move(rhs.m_NameIndex);
+  IncrementGeneration();
   return *this;
 }
 
@@ -341,4 +416,6 @@ void DataMap::updateIds(const std::unordered_map<DataObject::IdType, DataObject:
   {
     m_Map[updatedValue.first] = updatedValue.second;
   }
+  rebuildNameIndex();
+  IncrementGeneration();
 }
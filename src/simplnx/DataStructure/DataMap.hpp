@@ -3,6 +3,7 @@
 #include "simplnx/Common/Types.hpp"
 #include "simplnx/simplnx_export.hpp"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <optional>
@@ -21,6 +22,10 @@ class DataPath;
  * @brief The DataMap class is used to handle lookup and storage of DataObjects
  * using the objects' ID values or names. The DataMap class is primarily used
  * within the BaseGroup and DataStructure classes as a consistent.
+ *
+ * Lookups by name go through a hash index of the contained names instead of
+ * comparing every entry. The index is kept up to date by the insert, remove
+ * and rename paths.
  */
 class SIMPLNX_EXPORT DataMap
 {
@@ -29,6 +34,15 @@ public:
   using MapType = std::map<IdType, std::shared_ptr<DataObject>>;
   using Iterator = typename MapType::iterator;
   using ConstIterator = typename MapType::const_iterator;
+  using NameIndexType = std::unordered_multimap<std::string, IdType>;
+
+  /**
+   * @brief Returns a counter that is incremented every time any DataMap changes
+   * its contents or the names of its contents. Caches of resolved names or
+   * paths compare against this value to know when they are out of date.
+   * @return uint64
+   */
+  static uint64 Generation();
 
   /**
    * @brief Constructs an empty DataMap.
@@ -291,7 +305,41 @@ public:
    */
   void updateIds(const std::unordered_map<IdType, IdType>& updatedIdsMap);
 
+  /**
+   * @brief Updates the name index after the target DataObject has been renamed.
+   * Does nothing if the DataObject was not indexed under the previous name.
+   * Called by DataObject::rename.
+   * @param obj
+   * @param previousName
+   */
+  void updateName(const DataObject* obj, const std::string& previousName);
+
 private:
+  /**
+   * @brief Returns the ID of the DataObject with the specified name. If more
+   * than one DataObject has that name, the smallest ID is returned to match
+   * the iteration order of the map.
+   * @param name
+   * @return std::optional<IdType>
+   */
+  std::optional<IdType> findKey(const std::string& name) const;
+
+  /**
+   * @brief Rebuilds the name index from the contents of the map.
+   */
+  void rebuildNameIndex();
+
+  /**
+   * @brief Removes the index entry for the specified ID and name.
+   * @param identifier
+   * @param name
+   */
+  void removeFromNameIndex(IdType identifier, const std::string& name);
+
+  static void IncrementGeneration();
+
   MapType m_Map;
+  NameIndexType m_NameIndex;
+  static std::atomic<uint64> s_Generation;
 };
 } // namespace nx::core
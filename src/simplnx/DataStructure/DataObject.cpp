@@ -206,7 +206,25 @@ bool DataObject::rename(const std::string& name)
     return false;
   }
 
+  if(name == m_Name)
+  {
+    return true;
+  }
+
+  const std::string previousName = m_Name;
   m_Name = name;
+
+  // Keep the name index of every DataMap holding this object in sync
+  DataStructure* dataStructurePtr = getDataStructure();
+  for(IdType parentId : m_ParentList)
+  {
+    auto* baseGroupPtr = dataStructurePtr->getDataAs<BaseGroup>(parentId);
+    if(baseGroupPtr != nullptr)
+    {
+      baseGroupPtr->getDataMap().updateName(this, previousName);
+    }
+  }
+  dataStructurePtr->m_RootGroup.updateName(this, previousName);
   return true;
 }
 
@@ -29,15 +29,29 @@ DataPath::DataPath(std::vector<std::string> path)
     }
     m_Path.push_back(item);
   }
+  updateHash();
 }
 
 DataPath::DataPath(const DataPath& rhs) = default;
 
-DataPath::DataPath(DataPath&& rhs) noexcept = default;
+DataPath::DataPath(DataPath&& rhs) noexcept
+: m_Path(std::move(rhs.m_Path))
+, m_Hash(rhs.m_Hash)
+{
+  rhs.m_Path.clear();
+  rhs.m_Hash = 0;
+}
 
 DataPath& DataPath::operator=(const DataPath& rhs) = default;
 
-DataPath& DataPath::operator=(DataPath&& rhs) noexcept = default;
+DataPath& DataPath::operator=(DataPath&& rhs) noexcept
+{
+  m_Path = std::move(rhs.m_Path);
+  m_Hash = rhs.m_Hash;
+  rhs.m_Path.clear();
+  rhs.m_Hash = 0;
+  return *this;
+}
 
 DataPath::~DataPath() noexcept = default;
 
@@ -144,12 +158,29 @@ bool DataPath::attemptRename(const DataPath& oldPath, const DataPath& newPath)
   {
     m_Path[i] = newPath.m_Path[i];
   }
+  updateHash();
   return true;
 }
 
+usize DataPath::getHash() const
+{
+  return m_Hash;
+}
+
+void DataPath::updateHash()
+{
+  // Boost style hash_combine of the names; the empty path hashes to 0
+  usize hash = 0;
+  for(const auto& name : m_Path)
+  {
+    hash ^= std::hash<std::string>{}(name) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+  }
+  m_Hash = hash;
+}
+
 bool DataPath::operator==(const DataPath& rhs) const
 {
-  return m_Path == rhs.m_Path;
+  return m_Hash == rhs.m_Hash && m_Path == rhs.m_Path;
 }
 
 bool DataPath::operator!=(const DataPath& rhs) const
@@ -3,6 +3,7 @@
 #include "simplnx/Common/Types.hpp"
 #include "simplnx/simplnx_export.hpp"
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -17,6 +18,9 @@ namespace nx::core
  * to a DataObject, but by providing a path, it is possible to extrapolate
  * which set of siblings a user may be interested in or iterate over a data
  * group with common children names.
+ *
+ * The hash of the path is computed once when the path is created so that
+ * DataPaths can be used as keys and compared cheaply in lookup caches.
  */
 class SIMPLNX_EXPORT DataPath
 {
@@ -143,6 +147,12 @@ public:
    */
   bool attemptRename(const DataPath& oldPath, const DataPath& newPath);
 
+  /**
+   * @brief Returns the precomputed hash of the path. Equal paths have equal hashes.
+   * @return usize
+   */
+  usize getHash() const;
+
   /**
    * @brief Checks equality between two DataPaths.
    * @param rhs
@@ -186,6 +196,21 @@ public:
   std::string toString(std::string_view div = "/") const;
 
 private:
+  /**
+   * @brief Recomputes m_Hash from the current path.
+   */
+  void updateHash();
+
   std::vector<std::string> m_Path;
+  usize m_Hash = 0;
 };
 } // namespace nx::core
+
+template <>
+struct std::hash<nx::core::DataPath>
+{
+  std::size_t operator()(const nx::core::DataPath& path) const noexcept
+  {
+    return path.getHash();
+  }
+};
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <numeric>
@@ -32,6 +33,7 @@ public:
   using reference = typename AbstractDataStore<T>::reference;
   using const_reference = typename AbstractDataStore<T>::const_reference;
   using ShapeType = typename IDataStore::ShapeType;
+  using ReleaseBufferFunction = std::function<void(value_type*)>;
 
   static constexpr const char k_DataStore[] = "DataStore";
   static constexpr const char k_DataObjectId[] = "DataObjectId";
@@ -79,7 +81,7 @@ public:
   : parent_type()
   , m_ComponentShape(std::move(componentShape))
   , m_TupleShape(std::move(tupleShape))
-  , m_Data(std::move(buffer))
+  , m_Data(buffer.release(), &DeleteOwnedBuffer)
   , m_NumComponents(std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
   , m_NumTuples(std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
   {
@@ -87,6 +89,27 @@ public:
     m_InitValue = GetMudflap<T>();
   }
 
+  /**
+   * @brief Constructs a DataStore that uses an externally owned buffer in place, without copying it.
+   * The buffer must hold at least product(tupleShape) * product(componentShape) contiguous values.
+   * releaseBuffer is called exactly once when the DataStore lets go of the buffer: on destruction,
+   * or when resizeTuples() changes the element count and the values move into a DataStore owned allocation.
+   * @param buffer
+   * @param tupleShape
+   * @param componentShape
+   * @param releaseBuffer
+   */
+  DataStore(value_type* buffer, ShapeType tupleShape, ShapeType componentShape, ReleaseBufferFunction releaseBuffer)
+  : parent_type()
+  , m_ComponentShape(std::move(componentShape))
+  , m_TupleShape(std::move(tupleShape))
+  , m_Data(buffer, std::move(releaseBuffer))
+  , m_NumComponents(std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
+  , m_NumTuples(std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
+  {
+    m_InitValue = GetMudflap<T>();
+  }
+
   /**
    * @brief Copy constructor
    * @param other
@@ -102,7 +125,7 @@ public:
     const usize count = other.getSize();
     auto* data = new value_type[count];
     std::memcpy(data, other.m_Data.get(), count * sizeof(T));
-    m_Data.reset(data);
+    setOwnedBuffer(data);
   }
 
   /**
@@ -230,7 +253,7 @@ public:
     if(m_Data.get() == nullptr) // Data was never allocated
     {
       auto data = new value_type[newSize];
-      m_Data.reset(data);
+      setOwnedBuffer(data);
       return;
     }
 
@@ -258,7 +281,7 @@ public:
       data[i] = initValue;
     }
 
-    m_Data.reset(data);
+    setOwnedBuffer(data);
   }
 
   /**
@@ -373,9 +396,26 @@ public:
   }
 
 private:
+  using BufferPointer = std::unique_ptr<value_type[], ReleaseBufferFunction>;
+
+  static void DeleteOwnedBuffer(value_type* buffer)
+  {
+    delete[] buffer;
+  }
+
+  /**
+   * @brief Replaces the current buffer, releasing it through its own release function,
+   * with one allocated by the DataStore using new[].
+   * @param data
+   */
+  void setOwnedBuffer(value_type* data)
+  {
+    m_Data = BufferPointer(data, &DeleteOwnedBuffer);
+  }
+
   ShapeType m_ComponentShape;
   ShapeType m_TupleShape;
-  std::unique_ptr<value_type[]> m_Data = nullptr;
+  BufferPointer m_Data = nullptr;
   size_t m_NumComponents = {0};
   size_t m_NumTuples = {0};
   std::optional<T> m_InitValue;
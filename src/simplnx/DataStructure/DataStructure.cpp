@@ -266,12 +266,51 @@ DataObject* DataStructure::getData(const std::optional<DataObject::IdType>& iden
   return iter->second.lock().get();
 }
 
+const DataObject* DataStructure::findResolvedPath(const DataPath& path) const
+{
+  // Another thread is using the cache; resolving the path directly is cheaper than waiting
+  std::unique_lock<std::mutex> lock(m_ResolvedPathsMutex, std::try_to_lock);
+  if(!lock.owns_lock())
+  {
+    return nullptr;
+  }
+  const ResolvedPathEntry& entry = m_ResolvedPaths[path.getHash() % k_ResolvedPathCacheSize];
+  if(entry.dataObject == nullptr || entry.generation != DataMap::Generation() || entry.path != path)
+  {
+    return nullptr;
+  }
+  return entry.dataObject;
+}
+
+void DataStructure::storeResolvedPath(const DataPath& path, const DataObject* dataObject, uint64 generation) const
+{
+  if(dataObject == nullptr)
+  {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(m_ResolvedPathsMutex, std::try_to_lock);
+  if(!lock.owns_lock())
+  {
+    return;
+  }
+  ResolvedPathEntry& entry = m_ResolvedPaths[path.getHash() % k_ResolvedPathCacheSize];
+  entry.path = path;
+  entry.dataObject = dataObject;
+  entry.generation = generation;
+}
+
 DataObject* DataStructure::getData(const DataPath& path)
 {
   if(path.empty())
   {
     return nullptr;
   }
+  if(const DataObject* cachedObject = findResolvedPath(path); cachedObject != nullptr)
+  {
+    // The cache is shared with the const overload; the DataObjects themselves are owned non-const
+    return const_cast<DataObject*>(cachedObject);
+  }
+  const uint64 generation = DataMap::Generation();
   DataObject* targetObject = m_RootGroup[path[0]];
   for(usize index = 1; index < path.getLength(); index++)
   {
@@ -292,6 +331,7 @@ DataObject* DataStructure::getData(const DataPath& path)
     targetObject = childObject;
   }
 
+  storeResolvedPath(path, targetObject, generation);
   return targetObject;
 }
 
@@ -351,6 +391,11 @@ const DataObject* DataStructure::getData(const DataPath& path) const
   {
     return nullptr;
   }
+  if(const DataObject* cachedObject = findResolvedPath(path); cachedObject != nullptr)
+  {
+    return cachedObject;
+  }
+  const uint64 generation = DataMap::Generation();
   const DataObject* targetObject = m_RootGroup[path[0]];
   for(usize index = 1; index < path.getLength(); index++)
   {
@@ -371,6 +416,7 @@ const DataObject* DataStructure::getData(const DataPath& path) const
     targetObject = childObject;
   }
 
+  storeResolvedPath(path, targetObject, generation);
   return targetObject;
 }
 
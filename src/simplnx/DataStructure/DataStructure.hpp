@@ -3,15 +3,18 @@
 #include "simplnx/Common/Result.hpp"
 #include "simplnx/DataStructure/DataMap.hpp"
 #include "simplnx/DataStructure/DataObject.hpp"
+#include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/DataStructure/LinkedPath.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <nod/nod.hpp>
 #include <nonstd/expected.hpp>
 
+#include <array>
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -1021,6 +1024,34 @@ private:
    */
   void notify(const std::shared_ptr<AbstractDataStructureMessage>& msg);
 
+  /**
+   * @brief Returns the DataObject previously resolved for the given path or
+   * nullptr if the path is not cached or any DataMap has changed since.
+   * @param path
+   * @return const DataObject*
+   */
+  const DataObject* findResolvedPath(const DataPath& path) const;
+
+  /**
+   * @brief Caches the DataObject resolved for the given path. The generation
+   * must be read from DataMap::Generation() before the path was resolved.
+   * @param path
+   * @param dataObject
+   * @param generation
+   */
+  void storeResolvedPath(const DataPath& path, const DataObject* dataObject, uint64 generation) const;
+
+  /**
+   * @brief One slot of the direct mapped cache of resolved DataPaths.
+   */
+  struct ResolvedPathEntry
+  {
+    DataPath path;
+    const DataObject* dataObject = nullptr;
+    uint64 generation = 0;
+  };
+  static inline constexpr usize k_ResolvedPathCacheSize = 64;
+
   ////////////
   // Variables
   SignalType m_Signal;
@@ -1028,5 +1059,7 @@ private:
   DataMap m_RootGroup;
   bool m_IsValid = false;
   DataObject::IdType m_NextId = 1;
+  mutable std::array<ResolvedPathEntry, k_ResolvedPathCacheSize> m_ResolvedPaths;
+  mutable std::mutex m_ResolvedPathsMutex;
 };
 } // namespace nx::core
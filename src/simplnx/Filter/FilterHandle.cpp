@@ -11,6 +11,15 @@ FilterHandle::FilterHandle(const FilterIdType& filterId, const PluginIdType& plu
 {
 }
 
+FilterHandle::FilterHandle(const FilterIdType& filterId, const PluginIdType& pluginId, std::string filterName, std::string className, std::vector<std::string> defaultTags)
+: m_FilterName(std::move(filterName))
+, m_ClassName(std::move(className))
+, m_DefaultTags(std::move(defaultTags))
+, m_FilterId(filterId)
+, m_PluginId(pluginId)
+{
+}
+
 FilterHandle::FilterHandle(const IFilter& filter, const PluginIdType& pluginId)
 : m_FilterName(filter.humanName())
 , m_ClassName(filter.className())
@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace nx::core
 {
@@ -48,6 +49,17 @@ public:
    */
   FilterHandle(const FilterIdType& filterId, const PluginIdType& pluginId);
 
+  /**
+   * @brief Constructs a FilterHandle from previously recorded filter information
+   * without instantiating the filter. Used to restore handles from the plugin manifest cache.
+   * @param filterId
+   * @param pluginId
+   * @param filterName
+   * @param className
+   * @param defaultTags
+   */
+  FilterHandle(const FilterIdType& filterId, const PluginIdType& pluginId, std::string filterName, std::string className, std::vector<std::string> defaultTags);
+
   /**
    * @brief Copy constructor
    * @param rhs
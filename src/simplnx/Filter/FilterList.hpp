@@ -86,6 +86,14 @@ public:
    */
   AbstractPlugin* getPlugin(const FilterHandle& handle) const;
 
+  /**
+   * @brief Returns the plugin that provides the conversion for the SIMPL filter with the given uuid.
+   * Only that plugin is loaded if it was registered lazily. Returns nullptr if no plugin provides it.
+   * @param simplFilterId
+   * @return AbstractPlugin*
+   */
+  AbstractPlugin* getPluginBySimplFilterId(const Uuid& simplFilterId) const;
+
   /**
    * @brief
    * @param uuid
@@ -145,11 +153,20 @@ public:
   void removePlugin(const Uuid& pluginId);
 
   /**
-   * @brief Returns a set of pointers to loaded plugins.
+   * @brief Returns a set of pointers to the available plugins. Plugins that were
+   * registered lazily are loaded by this call.
    * @return std::unordered_set<AbstractPlugin*>
    */
   std::unordered_set<AbstractPlugin*> getLoadedPlugins() const;
 
+  /**
+   * @brief Returns true if the library of the plugin with the given uuid has been loaded.
+   * Unlike getPlugin(), this never loads a plugin that was registered lazily.
+   * @param pluginId
+   * @return bool
+   */
+  bool isPluginLoaded(const Uuid& pluginId) const;
+
   /**
    * @brief Returns a pointer to the plugin with the specified ID. Returns
    * nullptr if no plugin with the given ID is found.
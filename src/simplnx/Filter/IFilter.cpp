@@ -1,5 +1,6 @@
 #include "IFilter.hpp"
 
+#include "simplnx/Common/StringLiteral.hpp"
 #include "simplnx/Filter/DataParameter.hpp"
 #include "simplnx/Filter/ValueParameter.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
@@ -14,6 +15,8 @@ using namespace nx::core;
 
 namespace
 {
+constexpr StringLiteral k_ParametersVersionKey = "parameters_version";
+
 template <class T>
 void moveResult(nx::core::Result<T>& result, std::vector<nx::core::Error>& errors, std::vector<nx::core::Warning>& warnings)
 {
@@ -248,7 +251,7 @@ IFilter::ExecuteResult IFilter::execute(DataStructure& dataStructure, const Argu
 nlohmann::json IFilter::toJson(const Arguments& args) const
 {
   nlohmann::json json;
-  json["parameters_version"] = parametersVersion();
+  json[k_ParametersVersionKey] = parametersVersion();
   Parameters params = parameters();
   for(const auto& [name, param] : params)
   {
@@ -329,9 +332,23 @@ Result<Arguments> IFilter::fromJson(const nlohmann::json& json) const
     return {nonstd::make_unexpected(std::move(errors))};
   }
 
+  VersionType version = parametersVersion();
+  if(json.contains(k_ParametersVersionKey) && json[k_ParametersVersionKey].is_number_integer())
+  {
+    version = json[k_ParametersVersionKey].get<VersionType>();
+  }
+  if(version < parametersVersion())
+  {
+    updateArgumentsFromVersion(args, version);
+  }
+
   return {std::move(args), std::move(warnings)};
 }
 
+void IFilter::updateArgumentsFromVersion(Arguments& args, VersionType version) const
+{
+}
+
 std::vector<std::string> IFilter::defaultTags() const
 {
   return {};
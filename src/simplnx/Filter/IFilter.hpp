@@ -229,6 +229,16 @@ protected:
    */
   virtual Result<> executeImpl(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
                                const std::atomic_bool& shouldCancel) const = 0;
+
+  /**
+   * @brief Filters that change the meaning of their parameters between parameters versions may override this
+   * function to update arguments read from JSON that was written with an older version. Runs after every
+   * parameter has been read; parameters missing from the JSON hold their default values.
+   * The default implementation does nothing.
+   * @param args
+   * @param version The parameters version the JSON was written with
+   */
+  virtual void updateArgumentsFromVersion(Arguments& args, VersionType version) const;
 };
 
 using FilterCreationFunc = std::function<IFilter::UniquePointer()>;
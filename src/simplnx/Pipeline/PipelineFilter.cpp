@@ -4,6 +4,7 @@
 #include "simplnx/Filter/FilterList.hpp"
 #include "simplnx/Pipeline/Messaging/FilterPreflightMessage.hpp"
 #include "simplnx/Pipeline/Messaging/OutputRenamedMessage.hpp"
+#include "simplnx/Pipeline/PreflightCache.hpp"
 
 #include <nlohmann/json.hpp>
 
@@ -45,16 +46,17 @@ nlohmann::json CreateFilterJson(std::string_view uuid, std::string_view name, nl
 
 std::optional<AbstractPlugin::SIMPLData> FindComplexConversionFromSIMPL(const Uuid& uuid, const FilterList& filterList)
 {
-  auto plugins = filterList.getLoadedPlugins();
-  for(const auto* plugin : plugins)
+  const AbstractPlugin* plugin = filterList.getPluginBySimplFilterId(uuid);
+  if(plugin == nullptr)
   {
-    auto filterMap = plugin->getSimplToSimplnxMap();
-    if(filterMap.count(uuid) > 0)
-    {
-      return filterMap.at(uuid);
-    }
+    return {};
+  }
+  auto filterMap = plugin->getSimplToSimplnxMap();
+  if(filterMap.count(uuid) == 0)
+  {
+    return {};
   }
-  return {};
+  return filterMap.at(uuid);
 }
 } // namespace
 
@@ -148,6 +150,28 @@ bool PipelineFilter::preflight(DataStructure& dataStructure, RenamedPaths& renam
 
   IFilter::MessageHandler messageHandler{[this](const IFilter::Message& message) { this->notifyFilterMessage(message); }};
 
+  // The same arguments on an input with the same metadata produce the same preflight result,
+  // so the stored preflight structure is reused instead of preflighting the filter again.
+  std::optional<uint64> preflightCacheKey;
+  if(m_Filter != nullptr)
+  {
+    preflightCacheKey = PreflightCache::CreateKey(dataStructure, *m_Filter, getArguments());
+  }
+  if(preflightCacheKey.has_value() && preflightCacheKey == m_PreflightCacheKey && isPreflighted())
+  {
+    dataStructure = getPreflightStructure();
+    // Nothing was created again, so nothing was renamed
+    renamedPaths.clear();
+    sendFilterFaultMessage(m_Index, getFaultState());
+    if(!m_Warnings.empty())
+    {
+      sendFilterFaultDetailMessage(m_Index, m_Warnings, m_Errors);
+    }
+    sendFilterRunStateMessage(m_Index, RunState::Idle);
+    return !hasErrors();
+  }
+  m_PreflightCacheKey.reset();
+
   clearFaultState();
   if(m_Filter == nullptr)
   {
@@ -218,6 +242,7 @@ bool PipelineFilter::preflight(DataStructure& dataStructure, RenamedPaths& renam
   m_DataModifiedActions = result.outputActions.value().modifiedActions;
 
   setPreflightStructure(dataStructure);
+  m_PreflightCacheKey = preflightCacheKey;
   sendFilterFaultMessage(m_Index, getFaultState());
   if(!m_Warnings.empty() || !m_Errors.empty())
   {
@@ -243,6 +268,8 @@ bool PipelineFilter::execute(DataStructure& dataStructure, const std::atomic_boo
   m_Warnings.clear();
   m_Errors.clear();
   clearFaultState();
+  // Executing replaces the preflight messages and values, so the next preflight must not reuse them
+  m_PreflightCacheKey.reset();
 
   IFilter::MessageHandler messageHandler{[this](const IFilter::Message& message) { this->notifyFilterMessage(message); }};
 
@@ -5,6 +5,8 @@
 
 #include <nod/nod.hpp>
 
+#include <optional>
+
 namespace nx::core
 {
 class FilterHandle;
@@ -236,5 +238,6 @@ private:
   std::vector<IFilter::PreflightValue> m_PreflightValues;
   std::vector<DataPath> m_CreatedPaths;
   std::vector<DataObjectModification> m_DataModifiedActions;
+  std::optional<uint64> m_PreflightCacheKey; // Input DataStructure metadata + arguments of the last successful preflight
 };
 } // namespace nx::core
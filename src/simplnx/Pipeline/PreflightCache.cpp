@@ -0,0 +1,301 @@
+#include "PreflightCache.hpp"
+
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/Geometry/IGridGeometry.hpp"
+#include "simplnx/DataStructure/Geometry/INodeGeometry3D.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/DataStructure/Geometry/RectGridGeom.hpp"
+#include "simplnx/DataStructure/IArray.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <any>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+/**
+ * @brief 64 bit FNV-1a hash fed one value at a time.
+ */
+class MetadataHasher
+{
+public:
+  template <class T>
+  void add(const T& value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    addBytes(reinterpret_cast<const uint8*>(&value), sizeof(T));
+  }
+
+  void add(const std::string& value)
+  {
+    add(value.size());
+    addBytes(reinterpret_cast<const uint8*>(value.data()), value.size());
+  }
+
+  template <class T>
+  void add(const std::vector<T>& values)
+  {
+    add(values.size());
+    for(const auto& value : values)
+    {
+      add(value);
+    }
+  }
+
+  template <class T>
+  void add(const std::optional<T>& value)
+  {
+    add(value.has_value());
+    if(value.has_value())
+    {
+      add(*value);
+    }
+  }
+
+  uint64 value() const
+  {
+    return m_Hash;
+  }
+
+private:
+  void addBytes(const uint8* bytes, usize count)
+  {
+    for(usize i = 0; i < count; i++)
+    {
+      m_Hash ^= bytes[i];
+      m_Hash *= k_Prime;
+    }
+  }
+
+  static constexpr uint64 k_OffsetBasis = 14695981039346656037ULL;
+  static constexpr uint64 k_Prime = 1099511628211ULL;
+
+  uint64 m_Hash = k_OffsetBasis;
+};
+
+void AddGeometry(MetadataHasher& hasher, const IGeometry& geometry)
+{
+  hasher.add(geometry.getGeomType());
+  hasher.add(geometry.getUnits());
+  hasher.add(geometry.getElementSizesId());
+
+  if(const auto* gridGeom = dynamic_cast<const IGridGeometry*>(&geometry); gridGeom != nullptr)
+  {
+    SizeVec3 dimensions = gridGeom->getDimensions();
+    hasher.add(std::vector<usize>{dimensions[0], dimensions[1], dimensions[2]});
+    hasher.add(gridGeom->getCellDataId());
+  }
+  if(const auto* imageGeom = dynamic_cast<const ImageGeom*>(&geometry); imageGeom != nullptr)
+  {
+    FloatVec3 spacing = imageGeom->getSpacing();
+    FloatVec3 origin = imageGeom->getOrigin();
+    hasher.add(std::vector<float32>{spacing[0], spacing[1], spacing[2], origin[0], origin[1], origin[2]});
+  }
+  if(const auto* rectGridGeom = dynamic_cast<const RectGridGeom*>(&geometry); rectGridGeom != nullptr)
+  {
+    hasher.add(rectGridGeom->getXBoundsId());
+    hasher.add(rectGridGeom->getYBoundsId());
+    hasher.add(rectGridGeom->getZBoundsId());
+  }
+  if(const auto* nodeGeom0D = dynamic_cast<const INodeGeometry0D*>(&geometry); nodeGeom0D != nullptr)
+  {
+    hasher.add(nodeGeom0D->getSharedVertexDataArrayId());
+    hasher.add(nodeGeom0D->getVertexAttributeMatrixId());
+  }
+  if(const auto* nodeGeom1D = dynamic_cast<const INodeGeometry1D*>(&geometry); nodeGeom1D != nullptr)
+  {
+    hasher.add(nodeGeom1D->getEdgeListDataArrayId());
+    hasher.add(nodeGeom1D->getEdgeAttributeMatrixId());
+  }
+  if(const auto* nodeGeom2D = dynamic_cast<const INodeGeometry2D*>(&geometry); nodeGeom2D != nullptr)
+  {
+    hasher.add(nodeGeom2D->getFaceListDataArrayId());
+    hasher.add(nodeGeom2D->getFaceAttributeMatrixId());
+  }
+  if(const auto* nodeGeom3D = dynamic_cast<const INodeGeometry3D*>(&geometry); nodeGeom3D != nullptr)
+  {
+    hasher.add(nodeGeom3D->getPolyhedronListId());
+    hasher.add(nodeGeom3D->getPolyhedraAttributeMatrixId());
+  }
+}
+
+template <class T, class... Ts>
+bool AddAnyValueAs(MetadataHasher& hasher, const std::any& value, uint8 typeIndex = 0)
+{
+  if(const auto* typedValue = std::any_cast<T>(&value); typedValue != nullptr)
+  {
+    hasher.add(typeIndex);
+    hasher.add(*typedValue);
+    return true;
+  }
+  if constexpr(sizeof...(Ts) > 0)
+  {
+    return AddAnyValueAs<Ts...>(hasher, value, typeIndex + 1);
+  }
+  else
+  {
+    return false;
+  }
+}
+
+/**
+ * @brief Hashes a Metadata value. Returns false if the value has a type that cannot be hashed.
+ */
+bool AddMetadataValue(MetadataHasher& hasher, const std::any& value)
+{
+  hasher.add(value.has_value());
+  if(!value.has_value())
+  {
+    return true;
+  }
+  return AddAnyValueAs<bool, int8, uint8, int16, uint16, int32, uint32, int64, uint64, float32, float64, std::string, std::vector<int8>, std::vector<uint8>, std::vector<int16>, std::vector<uint16>,
+                       std::vector<int32>, std::vector<uint32>, std::vector<int64>, std::vector<uint64>, std::vector<float32>, std::vector<float64>, std::vector<std::string>>(hasher, value);
+}
+
+void AddFileStamps(MetadataHasher& hasher, const nlohmann::json& json)
+{
+  if(json.is_string())
+  {
+    const auto& string = json.get_ref<const std::string&>();
+    if(string.empty())
+    {
+      return;
+    }
+    std::error_code errorCode;
+    std::filesystem::path path(string);
+    if(!std::filesystem::exists(path, errorCode))
+    {
+      return;
+    }
+    auto modifiedTime = std::filesystem::last_write_time(path, errorCode);
+    if(!errorCode)
+    {
+      hasher.add(static_cast<int64>(modifiedTime.time_since_epoch().count()));
+    }
+    if(std::filesystem::is_regular_file(path, errorCode))
+    {
+      auto fileSize = std::filesystem::file_size(path, errorCode);
+      if(!errorCode)
+      {
+        hasher.add(static_cast<uint64>(fileSize));
+      }
+    }
+    return;
+  }
+  if(json.is_structured())
+  {
+    for(const auto& item : json)
+    {
+      AddFileStamps(hasher, item);
+    }
+  }
+}
+} // namespace
+
+namespace nx::core::PreflightCache
+{
+// -----------------------------------------------------------------------------
+std::optional<uint64> HashDataStructureMetadata(const DataStructure& dataStructure)
+{
+  MetadataHasher hasher;
+  hasher.add(dataStructure.getNextId());
+
+  std::vector<DataObject::IdType> dataIds = dataStructure.getAllDataObjectIds();
+  std::sort(dataIds.begin(), dataIds.end());
+  for(DataObject::IdType dataId : dataIds)
+  {
+    const DataObject* dataObject = dataStructure.getData(dataId);
+    if(dataObject == nullptr)
+    {
+      continue;
+    }
+    hasher.add(dataId);
+    hasher.add(dataObject->getDataObjectType());
+    hasher.add(dataObject->getName());
+
+    std::vector<DataObject::IdType> parentIds;
+    for(DataObject::IdType parentId : dataObject->getParentIds())
+    {
+      parentIds.push_back(parentId);
+    }
+    std::sort(parentIds.begin(), parentIds.end());
+    hasher.add(parentIds);
+
+    for(const auto& [key, value] : dataObject->getMetadata())
+    {
+      hasher.add(key);
+      if(!AddMetadataValue(hasher, value))
+      {
+        return {};
+      }
+    }
+
+    if(const auto* array = dynamic_cast<const IArray*>(dataObject); array != nullptr)
+    {
+      hasher.add(array->getArrayType());
+      hasher.add(array->getTupleShape());
+      hasher.add(array->getComponentShape());
+    }
+    if(const auto* dataArray = dynamic_cast<const IDataArray*>(dataObject); dataArray != nullptr)
+    {
+      hasher.add(dataArray->getDataType());
+      hasher.add(dataArray->getDataFormat());
+    }
+    if(const auto* attributeMatrix = dynamic_cast<const AttributeMatrix*>(dataObject); attributeMatrix != nullptr)
+    {
+      hasher.add(attributeMatrix->getShape());
+    }
+    if(const auto* geometry = dynamic_cast<const IGeometry*>(dataObject); geometry != nullptr)
+    {
+      AddGeometry(hasher, *geometry);
+    }
+  }
+  return hasher.value();
+}
+
+// -----------------------------------------------------------------------------
+std::optional<uint64> HashArguments(const IFilter& filter, const Arguments& args)
+{
+  nlohmann::json argsJson;
+  try
+  {
+    argsJson = filter.toJson(args);
+  } catch(const std::exception&)
+  {
+    return {};
+  }
+
+  MetadataHasher hasher;
+  hasher.add(filter.uuid());
+  hasher.add(argsJson.dump());
+  AddFileStamps(hasher, argsJson);
+  return hasher.value();
+}
+
+// -----------------------------------------------------------------------------
+std::optional<uint64> CreateKey(const DataStructure& dataStructure, const IFilter& filter, const Arguments& args)
+{
+  std::optional<uint64> argumentsHash = HashArguments(filter, args);
+  if(!argumentsHash.has_value())
+  {
+    return {};
+  }
+  std::optional<uint64> dataStructureHash = HashDataStructureMetadata(dataStructure);
+  if(!dataStructureHash.has_value())
+  {
+    return {};
+  }
+  MetadataHasher hasher;
+  hasher.add(*dataStructureHash);
+  hasher.add(*argumentsHash);
+  return hasher.value();
+}
+} // namespace nx::core::PreflightCache
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/Filter/Arguments.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <optional>
+
+namespace nx::core::PreflightCache
+{
+/**
+ * @brief Hashes the metadata of every DataObject in the DataStructure: ids, names,
+ * types, hierarchy, Metadata keys and values, array shapes and data types and geometry
+ * definitions. The values stored in arrays are not part of the hash. Two DataStructures
+ * with the same hash preflight identically. Returns an empty optional if a Metadata
+ * value has a type that cannot be hashed.
+ * @param dataStructure
+ * @return std::optional<uint64>
+ */
+SIMPLNX_EXPORT std::optional<uint64> HashDataStructureMetadata(const DataStructure& dataStructure);
+
+/**
+ * @brief Hashes the JSON representation of the arguments. Any string argument that
+ * names an existing file or directory also contributes its modification time and size
+ * so that filters reading from disk are preflighted again when the file changes.
+ * Returns an empty optional if the arguments could not be serialized.
+ * @param filter
+ * @param args
+ * @return std::optional<uint64>
+ */
+SIMPLNX_EXPORT std::optional<uint64> HashArguments(const IFilter& filter, const Arguments& args);
+
+/**
+ * @brief Returns the key identifying a preflight of the filter with the given arguments
+ * on the given input DataStructure, or an empty optional if the preflight cannot be cached.
+ * @param dataStructure
+ * @param filter
+ * @param args
+ * @return std::optional<uint64>
+ */
+SIMPLNX_EXPORT std::optional<uint64> CreateKey(const DataStructure& dataStructure, const IFilter& filter, const Arguments& args);
+} // namespace nx::core::PreflightCache
@@ -2,6 +2,7 @@
 
 #include <fmt/core.h>
 
+#include <algorithm>
 #include <memory>
 
 // fmt >= 8.0.0
@@ -156,3 +157,79 @@ const AbstractPlugin* PluginLoader::getPlugin() const
 {
   return m_Plugin.get();
 }
+
+LazyPluginLoader::LazyPluginLoader(PluginManifest manifest)
+: IPluginLoader()
+, m_Manifest(std::move(manifest))
+{
+}
+
+LazyPluginLoader::~LazyPluginLoader() noexcept = default;
+
+AbstractPlugin* LazyPluginLoader::load() const
+{
+  std::lock_guard lock(m_Mutex);
+  if(m_Loader == nullptr)
+  {
+    m_Loader = std::make_unique<PluginLoader>(m_Manifest.libraryPath);
+  }
+  return m_Loader->getPlugin();
+}
+
+bool LazyPluginLoader::isLoaded() const
+{
+  std::lock_guard lock(m_Mutex);
+  return m_Loader != nullptr && m_Loader->isLoaded();
+}
+
+bool LazyPluginLoader::isAvailable() const
+{
+  std::lock_guard lock(m_Mutex);
+  return m_Loader == nullptr || m_Loader->isLoaded();
+}
+
+AbstractPlugin* LazyPluginLoader::getPlugin()
+{
+  return load();
+}
+
+const AbstractPlugin* LazyPluginLoader::getPlugin() const
+{
+  return load();
+}
+
+Uuid LazyPluginLoader::getPluginId() const
+{
+  return m_Manifest.pluginId;
+}
+
+std::string LazyPluginLoader::getPluginName() const
+{
+  return m_Manifest.name;
+}
+
+AbstractPlugin::FilterContainerType LazyPluginLoader::getFilterHandles() const
+{
+  AbstractPlugin::FilterContainerType handles;
+  for(const auto& filter : m_Manifest.filters)
+  {
+    handles.insert(filter.handle);
+  }
+  return handles;
+}
+
+bool LazyPluginLoader::containsFilterId(const Uuid& filterId) const
+{
+  return std::any_of(m_Manifest.filters.cbegin(), m_Manifest.filters.cend(), [&filterId](const FilterManifest& filter) { return filter.handle.getFilterId() == filterId; });
+}
+
+bool LazyPluginLoader::containsSimplFilterId(const Uuid& simplFilterId) const
+{
+  return std::any_of(m_Manifest.simplToSimplnxUuids.cbegin(), m_Manifest.simplToSimplnxUuids.cend(),
+                     [&simplFilterId](const std::pair<Uuid, Uuid>& uuids) { return uuids.first == simplFilterId; });
+}
+
+const PluginManifest& LazyPluginLoader::getManifest() const
+{
+  return m_Manifest;
+}
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "simplnx/Plugin/AbstractPlugin.hpp"
+#include "simplnx/Plugin/PluginManifestCache.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <string>
 
 namespace nx::core
 {
@@ -19,6 +22,45 @@ public:
 
   virtual const AbstractPlugin* getPlugin() const = 0;
 
+  /**
+   * @brief Returns true if the plugin is loaded or can be loaded on demand.
+   * @return bool
+   */
+  virtual bool isAvailable() const
+  {
+    return isLoaded();
+  }
+
+  /**
+   * @brief Returns the ID of the plugin. Loaders that know the plugin without
+   * loading it override the following accessors so they do not force a load.
+   * @return Uuid
+   */
+  virtual Uuid getPluginId() const
+  {
+    return getPlugin()->getId();
+  }
+
+  virtual std::string getPluginName() const
+  {
+    return getPlugin()->getName();
+  }
+
+  virtual AbstractPlugin::FilterContainerType getFilterHandles() const
+  {
+    return getPlugin()->getFilterHandles();
+  }
+
+  virtual bool containsFilterId(const Uuid& filterId) const
+  {
+    return getPlugin()->containsFilterId(filterId);
+  }
+
+  virtual bool containsSimplFilterId(const Uuid& simplFilterId) const
+  {
+    return getPlugin()->getSimplToSimplnxMap().count(simplFilterId) > 0;
+  }
+
 protected:
   IPluginLoader() = default;
 };
@@ -107,4 +149,71 @@ private:
   void* m_Handle = nullptr;
   std::shared_ptr<AbstractPlugin> m_Plugin;
 };
+
+/**
+ * @class LazyPluginLoader
+ * @brief The LazyPluginLoader class registers a plugin from its cached PluginManifest
+ * and defers loading the library until the plugin itself is first requested, which
+ * normally happens when one of its filters is created. Loading is thread safe.
+ */
+class SIMPLNX_EXPORT LazyPluginLoader : public IPluginLoader
+{
+public:
+  LazyPluginLoader(PluginManifest manifest);
+
+  ~LazyPluginLoader() noexcept override;
+
+  /**
+   * @brief Returns true if the library has been loaded successfully.
+   * @return bool
+   */
+  bool isLoaded() const override;
+
+  /**
+   * @brief Returns true unless a previous attempt to load the library failed.
+   * @return bool
+   */
+  bool isAvailable() const override;
+
+  /**
+   * @brief Loads the library on first use and returns the plugin. Returns nullptr if the library could not be loaded.
+   * @return AbstractPlugin*
+   */
+  AbstractPlugin* getPlugin() override;
+
+  /**
+   * @brief Loads the library on first use and returns the plugin. Returns nullptr if the library could not be loaded.
+   * @return AbstractPlugin*
+   */
+  const AbstractPlugin* getPlugin() const override;
+
+  Uuid getPluginId() const override;
+
+  std::string getPluginName() const override;
+
+  AbstractPlugin::FilterContainerType getFilterHandles() const override;
+
+  bool containsFilterId(const Uuid& filterId) const override;
+
+  bool containsSimplFilterId(const Uuid& simplFilterId) const override;
+
+  /**
+   * @brief Returns the manifest the loader was created from.
+   * @return const PluginManifest&
+   */
+  const PluginManifest& getManifest() const;
+
+private:
+  /**
+   * @brief Loads the library the first time it is called and returns the plugin.
+   * @return AbstractPlugin*
+   */
+  AbstractPlugin* load() const;
+
+  ////////////
+  // Variables
+  PluginManifest m_Manifest;
+  mutable std::mutex m_Mutex;
+  mutable std::unique_ptr<PluginLoader> m_Loader;
+};
 } // namespace nx::core
@@ -0,0 +1,341 @@
+#include "PluginManifestCache.hpp"
+
+#include "simplnx/Core/Preferences.hpp"
+#include "simplnx/Plugin/AbstractPlugin.hpp"
+
+#include <fmt/core.h>
+
+#include <fstream>
+#include <random>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr StringLiteral k_DefaultFileName = "plugin_manifest_cache.json";
+
+constexpr StringLiteral k_VersionKey = "version";
+constexpr StringLiteral k_PluginsKey = "plugins";
+constexpr StringLiteral k_LibraryPathKey = "library_path";
+constexpr StringLiteral k_LibraryModifiedTimeKey = "library_modified_time";
+constexpr StringLiteral k_LibrarySizeKey = "library_size";
+constexpr StringLiteral k_PluginIdKey = "plugin_uuid";
+constexpr StringLiteral k_NameKey = "name";
+constexpr StringLiteral k_DescriptionKey = "description";
+constexpr StringLiteral k_VendorKey = "vendor";
+constexpr StringLiteral k_HasDataIOManagersKey = "has_data_io_managers";
+constexpr StringLiteral k_FiltersKey = "filters";
+constexpr StringLiteral k_FilterIdKey = "uuid";
+constexpr StringLiteral k_FilterNameKey = "human_name";
+constexpr StringLiteral k_ClassNameKey = "class_name";
+constexpr StringLiteral k_DefaultTagsKey = "default_tags";
+constexpr StringLiteral k_ParametersKey = "parameters";
+constexpr StringLiteral k_SimplUuidsKey = "simpl_uuids";
+
+constexpr int32 k_FileCouldNotReplace_Code = -594;
+constexpr int32 k_LibraryStatError = -595;
+constexpr int32 k_FilterCreationError = -596;
+constexpr int32 k_ManifestParseError = -597;
+constexpr int32 k_FailedToCreateDirectory_Code = -598;
+constexpr int32 k_FileCouldNotOpen_Code = -599;
+
+Result<std::pair<int64, uint64>> GetLibraryStamp(const std::filesystem::path& libraryPath)
+{
+  std::error_code errorCode;
+  auto modifiedTime = std::filesystem::last_write_time(libraryPath, errorCode);
+  if(errorCode)
+  {
+    return MakeErrorResult<std::pair<int64, uint64>>(k_LibraryStatError, fmt::format("Could not read the modification time of '{}': {}", libraryPath.string(), errorCode.message()));
+  }
+  auto fileSize = std::filesystem::file_size(libraryPath, errorCode);
+  if(errorCode)
+  {
+    return MakeErrorResult<std::pair<int64, uint64>>(k_LibraryStatError, fmt::format("Could not read the size of '{}': {}", libraryPath.string(), errorCode.message()));
+  }
+  return {std::make_pair(static_cast<int64>(modifiedTime.time_since_epoch().count()), static_cast<uint64>(fileSize))};
+}
+
+Result<Uuid> ReadUuid(const nlohmann::json& json, StringLiteral key)
+{
+  std::optional<Uuid> uuid = Uuid::FromString(json.at(key.str()).get<std::string>());
+  if(!uuid.has_value())
+  {
+    return MakeErrorResult<Uuid>(k_ManifestParseError, fmt::format("'{}' is not a valid uuid", json.at(key.str()).get<std::string>()));
+  }
+  return {*uuid};
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Result<PluginManifest> PluginManifest::Create(const AbstractPlugin& plugin, const std::filesystem::path& libraryPath)
+{
+  auto stampResult = GetLibraryStamp(libraryPath);
+  if(stampResult.invalid())
+  {
+    return ConvertInvalidResult<PluginManifest>(std::move(stampResult));
+  }
+
+  PluginManifest manifest;
+  manifest.libraryPath = libraryPath;
+  manifest.libraryModifiedTime = stampResult.value().first;
+  manifest.librarySize = stampResult.value().second;
+  manifest.pluginId = plugin.getId();
+  manifest.name = plugin.getName();
+  manifest.description = plugin.getDescription();
+  manifest.vendor = plugin.getVendor();
+  manifest.hasDataIOManagers = !plugin.getDataIOManagers().empty();
+
+  for(const auto& handle : plugin.getFilterHandles())
+  {
+    IFilter::UniquePointer filter = plugin.createFilter(handle.getFilterId());
+    if(filter == nullptr)
+    {
+      return MakeErrorResult<PluginManifest>(k_FilterCreationError, fmt::format("Could not create filter '{}' of plugin '{}'", handle.getClassName(), plugin.getName()));
+    }
+    manifest.filters.push_back({handle, filter->toJson(filter->getDefaultArguments())});
+  }
+
+  for(const auto& [simplUuid, simplData] : plugin.getSimplToSimplnxMap())
+  {
+    manifest.simplToSimplnxUuids.emplace_back(simplUuid, simplData.simplnxUuid);
+  }
+
+  return {std::move(manifest)};
+}
+
+// -----------------------------------------------------------------------------
+Result<PluginManifest> PluginManifest::FromJson(const nlohmann::json& json)
+{
+  try
+  {
+    PluginManifest manifest;
+    manifest.libraryPath = json.at(k_LibraryPathKey.str()).get<std::string>();
+    manifest.libraryModifiedTime = json.at(k_LibraryModifiedTimeKey.str()).get<int64>();
+    manifest.librarySize = json.at(k_LibrarySizeKey.str()).get<uint64>();
+    auto pluginIdResult = ReadUuid(json, k_PluginIdKey);
+    if(pluginIdResult.invalid())
+    {
+      return ConvertInvalidResult<PluginManifest>(std::move(pluginIdResult));
+    }
+    manifest.pluginId = pluginIdResult.value();
+    manifest.name = json.at(k_NameKey.str()).get<std::string>();
+    manifest.description = json.at(k_DescriptionKey.str()).get<std::string>();
+    manifest.vendor = json.at(k_VendorKey.str()).get<std::string>();
+    manifest.hasDataIOManagers = json.at(k_HasDataIOManagersKey.str()).get<bool>();
+
+    for(const auto& filterJson : json.at(k_FiltersKey.str()))
+    {
+      auto filterIdResult = ReadUuid(filterJson, k_FilterIdKey);
+      if(filterIdResult.invalid())
+      {
+        return ConvertInvalidResult<PluginManifest>(std::move(filterIdResult));
+      }
+      FilterHandle handle(filterIdResult.value(), manifest.pluginId, filterJson.at(k_FilterNameKey.str()).get<std::string>(), filterJson.at(k_ClassNameKey.str()).get<std::string>(),
+                          filterJson.at(k_DefaultTagsKey.str()).get<std::vector<std::string>>());
+      manifest.filters.push_back({std::move(handle), filterJson.at(k_ParametersKey.str())});
+    }
+
+    for(const auto& [simplUuidString, simplnxUuidJson] : json.at(k_SimplUuidsKey.str()).items())
+    {
+      std::optional<Uuid> simplUuid = Uuid::FromString(simplUuidString);
+      std::optional<Uuid> simplnxUuid = Uuid::FromString(simplnxUuidJson.get<std::string>());
+      if(!simplUuid.has_value() || !simplnxUuid.has_value())
+      {
+        return MakeErrorResult<PluginManifest>(k_ManifestParseError, fmt::format("Invalid SIMPL uuid mapping '{}' in plugin '{}'", simplUuidString, manifest.name));
+      }
+      manifest.simplToSimplnxUuids.emplace_back(*simplUuid, *simplnxUuid);
+    }
+    return {std::move(manifest)};
+  } catch(const nlohmann::json::exception& exception)
+  {
+    return MakeErrorResult<PluginManifest>(k_ManifestParseError, fmt::format("Could not read plugin manifest: {}", exception.what()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+bool PluginManifest::isCurrent() const
+{
+  auto stampResult = GetLibraryStamp(libraryPath);
+  if(stampResult.invalid())
+  {
+    return false;
+  }
+  return stampResult.value().first == libraryModifiedTime && stampResult.value().second == librarySize;
+}
+
+// -----------------------------------------------------------------------------
+nlohmann::json PluginManifest::toJson() const
+{
+  nlohmann::json json;
+  json[k_LibraryPathKey.str()] = libraryPath.string();
+  json[k_LibraryModifiedTimeKey.str()] = libraryModifiedTime;
+  json[k_LibrarySizeKey.str()] = librarySize;
+  json[k_PluginIdKey.str()] = pluginId.str();
+  json[k_NameKey.str()] = name;
+  json[k_DescriptionKey.str()] = description;
+  json[k_VendorKey.str()] = vendor;
+  json[k_HasDataIOManagersKey.str()] = hasDataIOManagers;
+
+  nlohmann::json filtersJson = nlohmann::json::array();
+  for(const auto& filter : filters)
+  {
+    nlohmann::json filterJson;
+    filterJson[k_FilterIdKey.str()] = filter.handle.getFilterId().str();
+    filterJson[k_FilterNameKey.str()] = filter.handle.getFilterName();
+    filterJson[k_ClassNameKey.str()] = filter.handle.getClassName();
+    filterJson[k_DefaultTagsKey.str()] = filter.handle.getDefaultTags();
+    filterJson[k_ParametersKey.str()] = filter.parameters;
+    filtersJson.push_back(std::move(filterJson));
+  }
+  json[k_FiltersKey.str()] = std::move(filtersJson);
+
+  nlohmann::json simplUuidsJson = nlohmann::json::object();
+  for(const auto& [simplUuid, simplnxUuid] : simplToSimplnxUuids)
+  {
+    simplUuidsJson[simplUuid.str()] = simplnxUuid.str();
+  }
+  json[k_SimplUuidsKey.str()] = std::move(simplUuidsJson);
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+std::filesystem::path PluginManifestCache::DefaultFilePath(const std::string& applicationName)
+{
+  return Preferences::DefaultFilePath(applicationName).parent_path() / k_DefaultFileName.str();
+}
+
+// -----------------------------------------------------------------------------
+Result<> PluginManifestCache::loadFromFile(const std::filesystem::path& filepath)
+{
+  m_Manifests.clear();
+  m_Modified = false;
+
+  if(!std::filesystem::exists(filepath))
+  {
+    return {};
+  }
+
+  std::ifstream fileStream(filepath);
+  if(!fileStream.is_open())
+  {
+    return MakeErrorResult(k_FileCouldNotOpen_Code, fmt::format("Could not open plugin manifest cache '{}'", filepath.string()));
+  }
+
+  nlohmann::json json = nlohmann::json::parse(fileStream, nullptr, false);
+  if(json.is_discarded() || !json.is_object() || json.value(k_VersionKey.str(), uint64{0}) != k_Version || !json.contains(k_PluginsKey.str()))
+  {
+    // Stale or damaged caches are rebuilt from the plugins themselves
+    return {};
+  }
+
+  for(const auto& manifestJson : json[k_PluginsKey.str()])
+  {
+    auto manifestResult = PluginManifest::FromJson(manifestJson);
+    if(manifestResult.invalid())
+    {
+      m_Manifests.clear();
+      return ConvertResult(std::move(manifestResult));
+    }
+    PluginManifest& manifest = manifestResult.value();
+    std::error_code errorCode;
+    if(!std::filesystem::exists(manifest.libraryPath, errorCode))
+    {
+      // Drop plugins that were removed so the cache does not grow forever; the next save writes the pruned cache
+      m_Modified = true;
+      continue;
+    }
+    std::string key = manifest.libraryPath.string();
+    m_Manifests[key] = std::move(manifest);
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<> PluginManifestCache::saveToFile(const std::filesystem::path& filepath)
+{
+  std::error_code errorCode;
+  std::filesystem::create_directories(filepath.parent_path(), errorCode);
+  if(errorCode)
+  {
+    return MakeErrorResult(k_FailedToCreateDirectory_Code, fmt::format("Could not create the directory for the plugin manifest cache '{}': {}", filepath.string(), errorCode.message()));
+  }
+
+  nlohmann::json json;
+  json[k_VersionKey.str()] = k_Version;
+  nlohmann::json pluginsJson = nlohmann::json::array();
+  for(const auto& [libraryPath, manifest] : m_Manifests)
+  {
+    pluginsJson.push_back(manifest.toJson());
+  }
+  json[k_PluginsKey.str()] = std::move(pluginsJson);
+
+  // Write to a temporary file next to the cache and swap it in, so that a crash or a second
+  // application saving at the same time can never leave a partially written cache behind
+  std::filesystem::path tempFilePath = filepath;
+  tempFilePath += fmt::format(".{}.tmp", std::random_device{}());
+  {
+    std::ofstream fileStream(tempFilePath, std::ios_base::out | std::ios_base::trunc);
+    if(!fileStream.is_open())
+    {
+      return MakeErrorResult(k_FileCouldNotOpen_Code, fmt::format("Could not write plugin manifest cache '{}'", tempFilePath.string()));
+    }
+    fileStream << json.dump();
+    fileStream.close();
+    if(fileStream.fail())
+    {
+      std::filesystem::remove(tempFilePath, errorCode);
+      return MakeErrorResult(k_FileCouldNotOpen_Code, fmt::format("Could not write plugin manifest cache '{}'", tempFilePath.string()));
+    }
+  }
+
+  std::filesystem::rename(tempFilePath, filepath, errorCode);
+  if(errorCode)
+  {
+    std::string message = errorCode.message();
+    std::filesystem::remove(tempFilePath, errorCode);
+    return MakeErrorResult(k_FileCouldNotReplace_Code, fmt::format("Could not replace plugin manifest cache '{}': {}", filepath.string(), message));
+  }
+  m_Modified = false;
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+const PluginManifest* PluginManifestCache::find(const std::filesystem::path& libraryPath) const
+{
+  auto iter = m_Manifests.find(libraryPath.string());
+  if(iter == m_Manifests.end() || !iter->second.isCurrent())
+  {
+    return nullptr;
+  }
+  return &iter->second;
+}
+
+// -----------------------------------------------------------------------------
+const FilterManifest* PluginManifestCache::findFilter(const Uuid& filterId) const
+{
+  for(const auto& [libraryPath, manifest] : m_Manifests)
+  {
+    for(const auto& filter : manifest.filters)
+    {
+      if(filter.handle.getFilterId() == filterId)
+      {
+        return &filter;
+      }
+    }
+  }
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+void PluginManifestCache::insert(PluginManifest manifest)
+{
+  std::string key = manifest.libraryPath.string();
+  m_Manifests.insert_or_assign(std::move(key), std::move(manifest));
+  m_Modified = true;
+}
+
+// -----------------------------------------------------------------------------
+bool PluginManifestCache::isModified() const
+{
+  return m_Modified;
+}
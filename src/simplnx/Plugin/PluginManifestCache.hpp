@@ -0,0 +1,145 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/Common/Uuid.hpp"
+#include "simplnx/Filter/FilterHandle.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace nx::core
+{
+class AbstractPlugin;
+
+/**
+ * @brief Cached description of a single filter: its handle and the JSON of its
+ * default arguments, in the same format used by pipeline files.
+ */
+struct SIMPLNX_EXPORT FilterManifest
+{
+  FilterHandle handle;
+  nlohmann::json parameters;
+};
+
+/**
+ * @brief Everything the Application needs to know about a plugin library to register
+ * it without loading it. A manifest is only valid for the exact library file it was
+ * created from; any change to the modification time or size of the file invalidates it.
+ */
+struct SIMPLNX_EXPORT PluginManifest
+{
+  std::filesystem::path libraryPath;
+  int64 libraryModifiedTime = 0;
+  uint64 librarySize = 0;
+
+  Uuid pluginId;
+  std::string name;
+  std::string description;
+  std::string vendor;
+  std::vector<FilterManifest> filters;
+  std::vector<std::pair<Uuid, Uuid>> simplToSimplnxUuids;
+  bool hasDataIOManagers = false;
+
+  /**
+   * @brief Creates the manifest of a loaded plugin. Every filter of the plugin is
+   * instantiated once to record its default arguments.
+   * @param plugin
+   * @param libraryPath
+   * @return
+   */
+  static Result<PluginManifest> Create(const AbstractPlugin& plugin, const std::filesystem::path& libraryPath);
+
+  /**
+   * @brief Reads a manifest from the JSON written by toJson().
+   * @param json
+   * @return
+   */
+  static Result<PluginManifest> FromJson(const nlohmann::json& json);
+
+  /**
+   * @brief Returns true if the library file still has the modification time and size recorded in the manifest.
+   * @return
+   */
+  bool isCurrent() const;
+
+  nlohmann::json toJson() const;
+};
+
+/**
+ * @class PluginManifestCache
+ * @brief Persisted collection of PluginManifests keyed by plugin library path. The
+ * Application uses it to register plugins at startup without loading their libraries;
+ * the library of a plugin is then only loaded the first time one of its filters is created.
+ */
+class SIMPLNX_EXPORT PluginManifestCache
+{
+public:
+  static inline constexpr uint64 k_Version = 1;
+
+  /**
+   * @brief Returns the location of the cache file, next to the preferences file of the application.
+   * @param applicationName
+   * @return
+   */
+  static std::filesystem::path DefaultFilePath(const std::string& applicationName);
+
+  PluginManifestCache() = default;
+  ~PluginManifestCache() noexcept = default;
+
+  /**
+   * @brief Replaces the contents of the cache with the manifests stored in the file.
+   * A missing file, a file written by a different cache version or an unreadable file
+   * result in an empty cache. Manifests of libraries that no longer exist are dropped
+   * and mark the cache as modified.
+   * @param filepath
+   * @return
+   */
+  Result<> loadFromFile(const std::filesystem::path& filepath);
+
+  /**
+   * @brief Writes the cache to a temporary file and then renames it over the file, so that
+   * readers never see a partially written cache. Clears the modified flag.
+   * @param filepath
+   * @return
+   */
+  Result<> saveToFile(const std::filesystem::path& filepath);
+
+  /**
+   * @brief Returns the manifest for the library if one exists and the library has not changed since it was recorded.
+   * Returns nullptr otherwise.
+   * @param libraryPath
+   * @return
+   */
+  const PluginManifest* find(const std::filesystem::path& libraryPath) const;
+
+  /**
+   * @brief Returns the cached information of the filter with the given uuid. Returns nullptr if no cached plugin provides it.
+   * @param filterId
+   * @return
+   */
+  const FilterManifest* findFilter(const Uuid& filterId) const;
+
+  /**
+   * @brief Adds or replaces the manifest for manifest.libraryPath.
+   * @param manifest
+   */
+  void insert(PluginManifest manifest);
+
+  /**
+   * @brief Returns true if manifests were added or pruned since the cache was loaded or saved.
+   * @return
+   */
+  bool isModified() const;
+
+private:
+  std::map<std::string, PluginManifest> m_Manifests;
+  bool m_Modified = false;
+};
+} // namespace nx::core
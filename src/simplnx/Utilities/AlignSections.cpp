@@ -1,104 +1,108 @@
 #include "AlignSections.hpp"
 
-#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
-#include <chrono>
-
 using namespace nx::core;
 
 namespace
 {
 // -----------------------------------------------------------------------------
-template <typename T>
+struct ShiftSliceFunctor
+{
+  /**
+   * @brief Shifts one slice of the array in place. The slice is walked away from the
+   * direction of the shift so every tuple is read before it is overwritten.
+   */
+  template <typename T>
+  void operator()(IDataArray& iDataArray, const SizeVec3& dims, usize slice, int64_t xShift, int64_t yShift)
+  {
+    auto& dataArray = static_cast<DataArray<T>&>(iDataArray);
+    T var = static_cast<T>(0);
+
+    for(size_t yIndex = 0; yIndex < dims[1]; yIndex++)
+    {
+      for(size_t xIndex = 0; xIndex < dims[0]; xIndex++)
+      {
+        int64_t xspot = 0;
+        int64_t yspot = 0;
+        if(yShift >= 0)
+        {
+          yspot = static_cast<int64_t>(yIndex);
+        }
+        else if(yShift < 0)
+        {
+          yspot = static_cast<int64_t>(dims[1]) - 1 - static_cast<int64_t>(yIndex);
+        }
+        if(xShift >= 0)
+        {
+          xspot = static_cast<int64_t>(xIndex);
+        }
+        else if(xShift < 0)
+        {
+          xspot = static_cast<int64_t>(dims[0]) - 1 - static_cast<int64_t>(xIndex);
+        }
+        int64_t newPosition = (slice * dims[0] * dims[1]) + (yspot * dims[0]) + xspot;
+        int64_t currentPosition = (slice * dims[0] * dims[1]) + ((yspot + yShift) * dims[0]) + (xspot + xShift);
+        if((yspot + yShift) >= 0 && (yspot + yShift) <= static_cast<int64_t>(dims[1]) - 1 && (xspot + xShift) >= 0 && (xspot + xShift) <= static_cast<int64_t>(dims[0]) - 1)
+        {
+          dataArray.copyTuple(static_cast<size_t>(currentPosition), static_cast<size_t>(newPosition));
+        }
+        if((yspot + yShift) < 0 || (yspot + yShift) > static_cast<int64_t>(dims[1] - 1) || (xspot + xShift) < 0 || (xspot + xShift) > static_cast<int64_t>(dims[0]) - 1)
+        {
+          dataArray.initializeTuple(newPosition, var);
+        }
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Applies the shifts of a range of slices to every selected array. Each slice only
+ * moves data within itself so the slices can be processed in parallel, and each slice is
+ * touched once for all of the arrays.
+ */
 class AlignSectionsTransferDataImpl
 {
 public:
-  AlignSectionsTransferDataImpl() = delete;
-  AlignSectionsTransferDataImpl(const AlignSectionsTransferDataImpl&) = default;     // Copy Constructor Default Implemented
-  AlignSectionsTransferDataImpl(AlignSectionsTransferDataImpl&&) noexcept = default; // Move Constructor Default Implemented
-
-  AlignSectionsTransferDataImpl(AlignSections* filter, SizeVec3 dims, std::vector<int64_t> xShifts, std::vector<int64_t> yShifts, IDataArray& dataArray)
+  AlignSectionsTransferDataImpl(AlignSections* filter, const SizeVec3& dims, const std::vector<int64_t>& xShifts, const std::vector<int64_t>& yShifts, const std::vector<IDataArray*>& dataArrays)
   : m_Filter(filter)
-  , m_Dims(std::move(dims))
-  , m_Xshifts(std::move(xShifts))
-  , m_Yshifts(std::move(yShifts))
-  , m_DataArray(static_cast<DataArray<T>&>(dataArray))
+  , m_Dims(dims)
+  , m_Xshifts(xShifts)
+  , m_Yshifts(yShifts)
+  , m_DataArrays(dataArrays)
   {
   }
 
-  ~AlignSectionsTransferDataImpl() = default;
-
-  AlignSectionsTransferDataImpl& operator=(const AlignSectionsTransferDataImpl&) = delete; // Copy Assignment Not Implemented
-  AlignSectionsTransferDataImpl& operator=(AlignSectionsTransferDataImpl&&) = delete;      // Move Assignment Not Implemented
-
-  void operator()() const
+  void operator()(const Range& range) const
   {
-    T var = static_cast<T>(0);
-
-    auto start = std::chrono::steady_clock::now();
-
-    for(size_t i = 1; i < m_Dims[2]; i++)
+    for(size_t i = range.min(); i < range.max(); i++)
     {
-      auto now = std::chrono::steady_clock::now();
-      // Only send updates every 1 second
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-      {
-        std::string message = fmt::format("Processing {}: {}% completed", m_DataArray.getName(), static_cast<int32>(100 * (static_cast<float>(i) / static_cast<float>(m_Dims[2]))));
-        m_Filter->updateProgress(message);
-        start = std::chrono::steady_clock::now();
-      }
       if(m_Filter->getCancel())
       {
         return;
       }
+      // A slice without a shift stays as it is
+      if(m_Xshifts[i] == 0 && m_Yshifts[i] == 0)
+      {
+        continue;
+      }
       size_t slice = (m_Dims[2] - 1) - i;
-      for(size_t yIndex = 0; yIndex < m_Dims[1]; yIndex++)
+      for(IDataArray* dataArray : m_DataArrays)
       {
-        for(size_t xIndex = 0; xIndex < m_Dims[0]; xIndex++)
-        {
-          int64_t xspot = 0;
-          int64_t yspot = 0;
-          if(m_Yshifts[i] >= 0)
-          {
-            yspot = static_cast<int64_t>(yIndex);
-          }
-          else if(m_Yshifts[i] < 0)
-          {
-            yspot = static_cast<int64_t>(m_Dims[1]) - 1 - static_cast<int64_t>(yIndex);
-          }
-          if(m_Xshifts[i] >= 0)
-          {
-            xspot = static_cast<int64_t>(xIndex);
-          }
-          else if(m_Xshifts[i] < 0)
-          {
-            xspot = static_cast<int64_t>(m_Dims[0]) - 1 - static_cast<int64_t>(xIndex);
-          }
-          int64_t newPosition = (slice * m_Dims[0] * m_Dims[1]) + (yspot * m_Dims[0]) + xspot;
-          int64_t currentPosition = (slice * m_Dims[0] * m_Dims[1]) + ((yspot + m_Yshifts[i]) * m_Dims[0]) + (xspot + m_Xshifts[i]);
-          if((yspot + m_Yshifts[i]) >= 0 && (yspot + m_Yshifts[i]) <= static_cast<int64_t>(m_Dims[1]) - 1 && (xspot + m_Xshifts[i]) >= 0 &&
-             (xspot + m_Xshifts[i]) <= static_cast<int64_t>(m_Dims[0]) - 1)
-          {
-            m_DataArray.copyTuple(static_cast<size_t>(currentPosition), static_cast<size_t>(newPosition));
-          }
-          if((yspot + m_Yshifts[i]) < 0 || (yspot + m_Yshifts[i]) > static_cast<int64_t>(m_Dims[1] - 1) || (xspot + m_Xshifts[i]) < 0 || (xspot + m_Xshifts[i]) > static_cast<int64_t>(m_Dims[0]) - 1)
-          {
-            m_DataArray.initializeTuple(newPosition, var);
-          }
-        }
+        ExecuteDataFunction(ShiftSliceFunctor{}, dataArray->getDataType(), *dataArray, m_Dims, slice, m_Xshifts[i], m_Yshifts[i]);
       }
     }
   }
 
 private:
   AlignSections* m_Filter = nullptr;
-  SizeVec3 m_Dims;
-  std::vector<int64_t> m_Xshifts;
-  std::vector<int64_t> m_Yshifts;
-  nx::core::DataArray<T>& m_DataArray;
+  const SizeVec3& m_Dims;
+  const std::vector<int64_t>& m_Xshifts;
+  const std::vector<int64_t>& m_Yshifts;
+  const std::vector<IDataArray*>& m_DataArrays;
 };
 } // namespace
 
@@ -146,22 +150,20 @@ Result<> AlignSections::execute(const SizeVec3& udims)
 
   // Now Adjust the actual DataArrays
   std::vector<DataPath> selectedCellArrays = getSelectedDataPaths();
-
-  ParallelTaskAlgorithm taskRunner;
-
+  std::vector<IDataArray*> cellArrays;
+  IParallelAlgorithm::AlgorithmArrays algorithmArrays;
   for(const auto& cellArrayPath : selectedCellArrays)
   {
-    if(m_ShouldCancel)
-    {
-      return {};
-    }
-
-    m_MessageHandler(fmt::format("Updating DataArray '{}'", cellArrayPath.toString()));
-    auto& cellArray = m_DataStructure.getDataRefAs<IDataArray>(cellArrayPath);
-    ExecuteParallelFunction<AlignSectionsTransferDataImpl>(cellArray.getDataType(), taskRunner, this, udims, xShifts, yShifts, cellArray);
+    auto* cellArrayPtr = m_DataStructure.getDataAs<IDataArray>(cellArrayPath);
+    cellArrays.push_back(cellArrayPtr);
+    algorithmArrays.push_back(cellArrayPtr);
   }
-  // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
-  taskRunner.wait();
+
+  m_MessageHandler(fmt::format("Updating {} DataArrays", cellArrays.size()));
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, udims[2]);
+  dataAlg.requireArraysInMemory(algorithmArrays);
+  dataAlg.execute(AlignSectionsTransferDataImpl(this, udims, xShifts, yShifts, cellArrays));
 
   return {};
 }
@@ -4,6 +4,7 @@
 #include "simplnx/simplnx_export.hpp"
 
 #include <cmath>
+#include <vector>
 
 namespace nx::core::ClusterUtilities
 {
@@ -134,4 +135,32 @@ float64 GetDistance(const leftDataType& leftVector, usize leftOffset, const righ
   // Return the correct primitive type for distance
   return dist;
 }
+
+/**
+ * @brief Returns the positions of an evenly spaced subset of at most maxSamples out of numMembers members. Used to
+ * draw the same share from every cluster (stratified sampling) without depending on a random number generator.
+ * @param numMembers
+ * @param maxSamples
+ * @return positions in ascending order
+ */
+inline std::vector<usize> StratifiedSamplePositions(usize numMembers, usize maxSamples)
+{
+  std::vector<usize> positions;
+  if(numMembers <= maxSamples)
+  {
+    positions.resize(numMembers);
+    for(usize i = 0; i < numMembers; i++)
+    {
+      positions[i] = i;
+    }
+    return positions;
+  }
+  positions.resize(maxSamples);
+  const float64 stride = static_cast<float64>(numMembers) / static_cast<float64>(maxSamples);
+  for(usize i = 0; i < maxSamples; i++)
+  {
+    positions[i] = static_cast<usize>(static_cast<float64>(i) * stride);
+  }
+  return positions;
+}
 } // namespace nx::core::ClusterUtilities
@@ -958,6 +958,31 @@ SIMPLNX_EXPORT std::unique_ptr<MaskCompare> InstantiateMaskCompare(DataStructure
  */
 SIMPLNX_EXPORT std::unique_ptr<MaskCompare> InstantiateMaskCompare(IDataArray& maskArrayPtr);
 
+/**
+ * @brief Returns the raw buffer behind the store if it is an in-memory DataStore, nullptr otherwise.
+ * Bulk copies can use the returned pointer directly and fall back to the virtual store API when it is null.
+ * @param store
+ * @return
+ */
+template <class T>
+const T* GetInMemoryDataPointer(const AbstractDataStore<T>& store)
+{
+  const auto* dataStore = dynamic_cast<const DataStore<T>*>(&store);
+  return dataStore == nullptr ? nullptr : dataStore->data();
+}
+
+/**
+ * @brief Returns the raw buffer behind the store if it is an in-memory DataStore, nullptr otherwise.
+ * @param store
+ * @return
+ */
+template <class T>
+T* GetInMemoryDataPointer(AbstractDataStore<T>& store)
+{
+  auto* dataStore = dynamic_cast<DataStore<T>*>(&store);
+  return dataStore == nullptr ? nullptr : dataStore->data();
+}
+
 template <typename T>
 class CopyTupleUsingIndexList
 {
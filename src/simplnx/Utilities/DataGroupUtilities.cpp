@@ -2,6 +2,7 @@
 
 #include "simplnx/DataStructure/AttributeMatrix.hpp"
 #include "simplnx/DataStructure/BaseGroup.hpp"
+#include "simplnx/Utilities/FeatureCompactionUtilities.hpp"
 
 namespace nx::core
 {
@@ -17,110 +18,70 @@ bool RemoveInactiveObjects(DataStructure& dataStructure, const DataPath& feature
   }
   const DataMap& featureDataMap = featureLevelBaseGroup->getDataMap();
 
-  // Loop over all the paths from the feature group and remove the data arrays that do NOT have the
-  // same number of Tuples as the 'activeObjects' vector
-  std::vector<std::shared_ptr<IDataArray>> matchingDataArrayPtrs;
+  // Only compact the DataArrays that have the same number of Tuples as the 'activeObjects' vector
+  std::vector<IDataArray*> matchingArrayPtrs;
 
   for(const auto& entry : featureDataMap)
   {
-    std::shared_ptr<DataObject> dataObject = entry.second;
-    std::shared_ptr<IDataArray> dataArray = std::dynamic_pointer_cast<IDataArray>(dataObject);
-    if(nullptr != dataArray)
+    auto* dataArray = dynamic_cast<IDataArray*>(entry.second.get());
+    if(nullptr != dataArray && dataArray->getNumberOfTuples() == activeObjects.size())
     {
-      if(dataArray->getNumberOfTuples() == activeObjects.size())
-      {
-        matchingDataArrayPtrs.push_back(dataArray);
-      }
+      matchingArrayPtrs.push_back(dataArray);
     }
   }
   size_t totalTuples = currentFeatureCount;
-  if(activeObjects.size() == totalTuples)
+  if(activeObjects.size() != totalTuples)
   {
-    size_t goodCount = 1;
-    std::vector<size_t> newNames(totalTuples, 0);
-    std::vector<size_t> removeList;
-    std::vector<size_t> keepList;
-    keepList.reserve(activeObjects.size());
+    return false;
+  }
 
-    for(int32_t i = 1; i < activeObjects.size(); i++)
+  std::vector<int32> featureIdMap = FeatureCompaction::CreateFeatureIdMap(activeObjects);
+  usize keptCount = 0;
+  for(usize i = 1; i < activeObjects.size(); i++)
+  {
+    if(activeObjects[i])
     {
-      if(activeObjects[i])
-      {
-        newNames[i] = goodCount;
-        goodCount++;
-        keepList.push_back(i);
-      }
-      else
-      {
-        removeList.push_back(i);
-        newNames[i] = 0;
-      }
+      keptCount++;
     }
+  }
 
-    std::vector<usize> newShape = {keepList.size() + 1};
-    if(!removeList.empty())
+  std::vector<usize> newShape = {keptCount + 1};
+  if(keptCount + 1 != totalTuples)
+  {
+    FeatureCompaction::CompactFeatureArrays(matchingArrayPtrs, activeObjects, shouldCancel);
+    if(shouldCancel)
     {
-      for(const auto& dataArray : matchingDataArrayPtrs)
-      {
-        if(shouldCancel)
-        {
-          return false;
-        }
-        // Do the update "in place". This works because the keepList _should_ be sorted lowest to
-        // highest. So we are constantly grabbing values from further in the array and copying
-        // them to location to the front of the array.
-        size_t destIdx = 1;
-        for(const auto& keepIdx : keepList)
-        {
-          dataArray->copyTuple(keepIdx, destIdx);
-          destIdx++;
-        }
-        // Now chop off the end of the copy and modified array
-        // dataArray->getIDataStore()->resizeTuples(newShape);
-      }
+      return false;
+    }
 
-      // Loop over all the points and correct all the feature names
-      size_t totalPoints = cellFeatureIds.getNumberOfTuples();
-      bool featureIdsChanged = false;
-      for(size_t i = 0; i < totalPoints; i++)
-      {
-        if(cellFeatureIds[i] >= 0 && cellFeatureIds[i] < newNames.size())
-        {
-          cellFeatureIds[i] = static_cast<int32_t>(newNames[cellFeatureIds[i]]);
-          featureIdsChanged = true;
-        }
-        if(shouldCancel)
-        {
-          return false;
-        }
-      }
+    // Correct all the feature ids of the cells
+    bool featureIdsChanged = FeatureCompaction::RemapFeatureIds(cellFeatureIds, featureIdMap, shouldCancel);
+    if(shouldCancel)
+    {
+      return false;
+    }
 
-      if(featureIdsChanged)
+    if(featureIdsChanged)
+    {
+      auto result = GetAllChildDataPaths(dataStructure, featureDataGroupPath, DataObject::Type::NeighborList);
+      if(result.has_value())
       {
-        auto result = GetAllChildDataPaths(dataStructure, featureDataGroupPath, DataObject::Type::NeighborList);
-        if(result.has_value())
+        std::vector<DataPath> neighborListDataPaths = result.value();
+        for(const auto& neighborListDataPath : neighborListDataPaths)
         {
-          std::vector<DataPath> neighborListDataPaths = result.value();
-          for(const auto& neighborListDataPath : neighborListDataPaths)
-          {
-            messageHandler(
-                nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, fmt::format("NeighborList '{}' will be removed from the DataStructure.", neighborListDataPath.toString())});
-          }
+          messageHandler(
+              nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, fmt::format("NeighborList '{}' will be removed from the DataStructure.", neighborListDataPath.toString())});
         }
       }
     }
-
-    // Now resize the attribute matrix, which will resize the DataArrays contained
-    // in the attribute matrix
-    auto* featureAttMatrixPtr = dataStructure.getDataAs<AttributeMatrix>(featureDataGroupPath);
-    if(featureAttMatrixPtr != nullptr)
-    {
-      featureAttMatrixPtr->resizeTuples(newShape);
-    }
   }
-  else
+
+  // Now resize the attribute matrix, which will resize the arrays contained
+  // in the attribute matrix
+  auto* featureAttMatrixPtr = dataStructure.getDataAs<AttributeMatrix>(featureDataGroupPath);
+  if(featureAttMatrixPtr != nullptr)
   {
-    return false;
+    featureAttMatrixPtr->resizeTuples(newShape);
   }
   return true;
 }
@@ -15,7 +15,10 @@ namespace nx::core
 /**
  * @brief RemoveInactiveObjects This assumes a single Dimension TupleShape, i.e., a Linear array, (1D)
  *
- * NeighborLists are NO LONGER Removed. That is the responsibility of the filter.
+ * Every DataArray of the feature group is compacted in one gather pass and the cell feature
+ * ids are renumbered in parallel (see FeatureCompactionUtilities.hpp). The entries of the
+ * NeighborLists refer to the old feature ids, so NeighborLists are NOT compacted, removed or
+ * corrected here. That is the responsibility of the filter.
  *
  * @param dataStructure
  * @param featureDataGroupPath
@@ -0,0 +1,351 @@
+#include "FeatureCompactionUtilities.hpp"
+
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <array>
+#include <chrono>
+
+using namespace nx::core;
+
+namespace
+{
+/**
+ * @brief Returns the face neighbor of the cell whose feature is the most common among
+ * the face neighbors, or -1 if no face neighbor belongs to a feature.
+ */
+int64 FindMajorityNeighbor(const Int32AbstractDataStore& featureIds, const std::array<int64, 3>& dims, int64 cell)
+{
+  const int64 sliceSize = dims[0] * dims[1];
+  const int64 i = cell % dims[0];
+  const int64 j = (cell / dims[0]) % dims[1];
+  const int64 k = cell / sliceSize;
+
+  const std::array<int64, 6> offsets = {-sliceSize, -dims[0], -1, 1, dims[0], sliceSize};
+  const std::array<bool, 6> inside = {k > 0, j > 0, i > 0, i < dims[0] - 1, j < dims[1] - 1, k < dims[2] - 1};
+
+  std::array<int32, 6> features = {};
+  std::array<int32, 6> hits = {};
+  usize numFeatures = 0;
+  int32 most = 0;
+  int64 majorityNeighbor = -1;
+  for(usize l = 0; l < offsets.size(); l++)
+  {
+    if(!inside[l])
+    {
+      continue;
+    }
+    const int64 neighbor = cell + offsets[l];
+    const int32 feature = featureIds.getValue(neighbor);
+    if(feature < 0)
+    {
+      continue;
+    }
+    usize slot = 0;
+    while(slot < numFeatures && features[slot] != feature)
+    {
+      slot++;
+    }
+    if(slot == numFeatures)
+    {
+      features[slot] = feature;
+      numFeatures++;
+    }
+    hits[slot]++;
+    if(hits[slot] > most)
+    {
+      most = hits[slot];
+      majorityNeighbor = neighbor;
+    }
+  }
+  return majorityNeighbor;
+}
+
+/**
+ * @brief Copies the tuple of the chosen neighbor into every cell of the frontier that found one.
+ */
+class CopyNeighborTuplesImpl
+{
+public:
+  CopyNeighborTuplesImpl(IDataArray& cellArray, const std::vector<int64>& frontier, const std::vector<int64>& neighbors)
+  : m_CellArray(cellArray)
+  , m_Frontier(frontier)
+  , m_Neighbors(neighbors)
+  {
+  }
+
+  void operator()() const
+  {
+    for(usize index = 0; index < m_Frontier.size(); index++)
+    {
+      if(m_Neighbors[index] >= 0)
+      {
+        m_CellArray.copyTuple(static_cast<usize>(m_Neighbors[index]), static_cast<usize>(m_Frontier[index]));
+      }
+    }
+  }
+
+private:
+  IDataArray& m_CellArray;
+  const std::vector<int64>& m_Frontier;
+  const std::vector<int64>& m_Neighbors;
+};
+
+/**
+ * @brief Moves the tuples of the kept features to the front of a single feature array.
+ */
+class GatherFeatureTuplesImpl
+{
+public:
+  GatherFeatureTuplesImpl(IDataArray& featureArray, const std::vector<usize>& keepList, const std::atomic_bool& shouldCancel)
+  : m_FeatureArray(featureArray)
+  , m_KeepList(keepList)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()() const
+  {
+    if(m_ShouldCancel)
+    {
+      return;
+    }
+    // The keep list is sorted, so every source tuple is at or after its destination and
+    // is read before anything is written over it.
+    usize destIdx = 1;
+    for(usize keepIdx : m_KeepList)
+    {
+      if(keepIdx != destIdx)
+      {
+        m_FeatureArray.copyTuple(keepIdx, destIdx);
+      }
+      destIdx++;
+    }
+  }
+
+private:
+  IDataArray& m_FeatureArray;
+  const std::vector<usize>& m_KeepList;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
+namespace nx::core::FeatureCompaction
+{
+// -----------------------------------------------------------------------------
+std::vector<int32> CreateFeatureIdMap(const std::vector<bool>& activeObjects)
+{
+  std::vector<int32> featureIdMap(activeObjects.size(), 0);
+  int32 nextId = 1;
+  for(usize i = 1; i < activeObjects.size(); i++)
+  {
+    if(activeObjects[i])
+    {
+      featureIdMap[i] = nextId;
+      nextId++;
+    }
+  }
+  return featureIdMap;
+}
+
+// -----------------------------------------------------------------------------
+void ReplaceInactiveFeatureIds(Int32AbstractDataStore& featureIds, const std::vector<bool>& activeObjects, int32 replacementId, const std::atomic_bool& shouldCancel)
+{
+  const auto numFeatures = static_cast<int64>(activeObjects.size());
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, featureIds.getNumberOfTuples());
+  dataAlg.requireStoresInMemory({&featureIds});
+  dataAlg.execute([&](const Range& range) {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(shouldCancel)
+      {
+        return;
+      }
+      const int32 featureId = featureIds.getValue(i);
+      if(featureId >= 0 && featureId < numFeatures && !activeObjects[featureId])
+      {
+        featureIds.setValue(i, replacementId);
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+bool RemapFeatureIds(Int32AbstractDataStore& featureIds, const std::vector<int32>& featureIdMap, const std::atomic_bool& shouldCancel)
+{
+  const auto numFeatures = static_cast<int64>(featureIdMap.size());
+  std::atomic_bool featureIdsChanged = false;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, featureIds.getNumberOfTuples());
+  dataAlg.requireStoresInMemory({&featureIds});
+  dataAlg.execute([&](const Range& range) {
+    bool rangeChanged = false;
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(shouldCancel)
+      {
+        return;
+      }
+      const int32 featureId = featureIds.getValue(i);
+      if(featureId >= 0 && featureId < numFeatures)
+      {
+        featureIds.setValue(i, featureIdMap[featureId]);
+        rangeChanged = true;
+      }
+    }
+    if(rangeChanged)
+    {
+      featureIdsChanged = true;
+    }
+  });
+  return featureIdsChanged;
+}
+
+// -----------------------------------------------------------------------------
+void CompactFeatureArrays(const std::vector<IDataArray*>& featureArrays, const std::vector<bool>& activeObjects, const std::atomic_bool& shouldCancel)
+{
+  std::vector<usize> keepList;
+  keepList.reserve(activeObjects.size());
+  for(usize i = 1; i < activeObjects.size(); i++)
+  {
+    if(activeObjects[i])
+    {
+      keepList.push_back(i);
+    }
+  }
+  if(keepList.size() + 1 == activeObjects.size())
+  {
+    return;
+  }
+
+  ParallelTaskAlgorithm taskRunner;
+  taskRunner.requireArraysInMemory(IParallelAlgorithm::AlgorithmArrays(featureArrays.begin(), featureArrays.end()));
+  for(IDataArray* featureArray : featureArrays)
+  {
+    taskRunner.execute(GatherFeatureTuplesImpl(*featureArray, keepList, shouldCancel));
+  }
+  taskRunner.wait();
+}
+
+// -----------------------------------------------------------------------------
+Result<> AssignBadCellsToNeighbors(const SizeVec3& dimensions, Int32AbstractDataStore& featureIds, const std::vector<IDataArray*>& cellArrays, const IFilter::MessageHandler& messageHandler,
+                                   const std::atomic_bool& shouldCancel)
+{
+  const usize totalPoints = featureIds.getNumberOfTuples();
+  if(dimensions[0] * dimensions[1] * dimensions[2] != totalPoints)
+  {
+    return MakeErrorResult(k_DimensionMismatchError,
+                           fmt::format("The geometry dimensions {}x{}x{} do not match the {} cells of the Feature Ids array", dimensions[0], dimensions[1], dimensions[2], totalPoints));
+  }
+  for(const IDataArray* cellArray : cellArrays)
+  {
+    if(cellArray->getNumberOfTuples() != totalPoints)
+    {
+      return MakeErrorResult(k_CellArrayTupleMismatchError,
+                             fmt::format("Cell array '{}' has {} tuples but the Feature Ids array has {} tuples", cellArray->getName(), cellArray->getNumberOfTuples(), totalPoints));
+    }
+  }
+
+  const std::array<int64, 3> dims = {static_cast<int64>(dimensions[0]), static_cast<int64>(dimensions[1]), static_cast<int64>(dimensions[2])};
+  const int64 sliceSize = dims[0] * dims[1];
+
+  IParallelAlgorithm::AlgorithmArrays constCellArrays(cellArrays.begin(), cellArrays.end());
+
+  // The first frontier is every bad cell. After that, a bad cell can only find a good
+  // neighbor if one of its neighbors was filled in the previous pass.
+  std::vector<int64> frontier;
+  for(usize i = 0; i < totalPoints; i++)
+  {
+    if(featureIds.getValue(i) < 0)
+    {
+      frontier.push_back(static_cast<int64>(i));
+    }
+  }
+  std::vector<uint8> queued(frontier.empty() ? 0 : totalPoints, 0);
+  std::vector<int64> neighbors;
+  std::vector<int64> nextFrontier;
+
+  usize passCount = 0;
+  auto start = std::chrono::steady_clock::now();
+  while(!frontier.empty())
+  {
+    if(shouldCancel)
+    {
+      return {};
+    }
+    passCount++;
+    auto now = std::chrono::steady_clock::now();
+    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    {
+      messageHandler(IFilter::Message{IFilter::Message::Type::Info, fmt::format("Assigning {} cells to neighboring features (pass {})", frontier.size(), passCount)});
+      start = now;
+    }
+
+    // Every cell of the frontier votes against the same, unmodified featureIds
+    neighbors.assign(frontier.size(), -1);
+    ParallelDataAlgorithm voteAlg;
+    voteAlg.setRange(0, frontier.size());
+    voteAlg.requireStoresInMemory({&featureIds});
+    voteAlg.execute([&](const Range& range) {
+      for(usize index = range.min(); index < range.max(); index++)
+      {
+        queued[frontier[index]] = 0;
+        neighbors[index] = FindMajorityNeighbor(featureIds, dims, frontier[index]);
+      }
+    });
+
+    // Sources are good cells and destinations are bad cells, so no copy reads a tuple written in this pass
+    ParallelTaskAlgorithm taskRunner;
+    taskRunner.requireArraysInMemory(constCellArrays);
+    for(IDataArray* cellArray : cellArrays)
+    {
+      taskRunner.execute(CopyNeighborTuplesImpl(*cellArray, frontier, neighbors));
+    }
+    taskRunner.wait();
+
+    for(usize index = 0; index < frontier.size(); index++)
+    {
+      if(neighbors[index] >= 0)
+      {
+        featureIds.setValue(frontier[index], featureIds.getValue(neighbors[index]));
+      }
+    }
+
+    nextFrontier.clear();
+    for(usize index = 0; index < frontier.size(); index++)
+    {
+      if(neighbors[index] < 0)
+      {
+        continue;
+      }
+      const int64 cell = frontier[index];
+      const int64 i = cell % dims[0];
+      const int64 j = (cell / dims[0]) % dims[1];
+      const int64 k = cell / sliceSize;
+      const std::array<int64, 6> offsets = {-sliceSize, -dims[0], -1, 1, dims[0], sliceSize};
+      const std::array<bool, 6> inside = {k > 0, j > 0, i > 0, i < dims[0] - 1, j < dims[1] - 1, k < dims[2] - 1};
+      for(usize l = 0; l < offsets.size(); l++)
+      {
+        if(!inside[l])
+        {
+          continue;
+        }
+        const int64 neighbor = cell + offsets[l];
+        if(queued[neighbor] == 0 && featureIds.getValue(neighbor) < 0)
+        {
+          queued[neighbor] = 1;
+          nextFrontier.push_back(neighbor);
+        }
+      }
+    }
+    frontier.swap(nextFrontier);
+  }
+
+  return {};
+}
+} // namespace nx::core::FeatureCompaction
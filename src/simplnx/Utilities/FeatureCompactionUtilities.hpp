@@ -0,0 +1,88 @@
+#pragma once
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <atomic>
+#include <vector>
+
+/**
+ * @brief Shared engine behind the filters that remove features from a segmented image
+ * (RemoveFlaggedFeatures, RequireMinimumSizeFeatures, RequireMinNumNeighbors, ...).
+ *
+ * Removing features happens in three steps:
+ *   1. The cells of the removed features are marked bad (ReplaceInactiveFeatureIds).
+ *   2. Optionally, the bad cells are grown over by their neighboring features (AssignBadCellsToNeighbors).
+ *   3. The surviving features are renumbered 1..N and every feature level array is compacted to
+ *      match (CreateFeatureIdMap, RemapFeatureIds, CompactFeatureArrays).
+ */
+namespace nx::core::FeatureCompaction
+{
+inline constexpr int32 k_DimensionMismatchError = -4810;
+inline constexpr int32 k_CellArrayTupleMismatchError = -4811;
+
+/**
+ * @brief Returns the old-to-new feature id map for the given active flags. Feature 0 and
+ * every inactive feature map to 0; the active features are numbered 1..N in their original order.
+ * @param activeObjects
+ * @return
+ */
+SIMPLNX_EXPORT std::vector<int32> CreateFeatureIdMap(const std::vector<bool>& activeObjects);
+
+/**
+ * @brief Replaces, in parallel, the id of every cell belonging to an inactive feature with the replacement value.
+ * Cell ids outside of [0, activeObjects.size()) are left untouched.
+ * @param featureIds
+ * @param activeObjects
+ * @param replacementId
+ * @param shouldCancel
+ */
+SIMPLNX_EXPORT void ReplaceInactiveFeatureIds(Int32AbstractDataStore& featureIds, const std::vector<bool>& activeObjects, int32 replacementId, const std::atomic_bool& shouldCancel);
+
+/**
+ * @brief Applies the map produced by CreateFeatureIdMap to every cell in parallel. Cell ids
+ * outside of [0, featureIdMap.size()) are left untouched.
+ * @param featureIds
+ * @param featureIdMap
+ * @param shouldCancel
+ * @return true if at least one cell id was remapped
+ */
+SIMPLNX_EXPORT bool RemapFeatureIds(Int32AbstractDataStore& featureIds, const std::vector<int32>& featureIdMap, const std::atomic_bool& shouldCancel);
+
+/**
+ * @brief Moves the tuples of the active features to the front of every array in a single
+ * gather pass so that tuple i of each array belongs to new feature id i. The arrays are
+ * processed concurrently. The arrays are not resized, that is left to the owning AttributeMatrix.
+ * NeighborLists are not compacted: their entries refer to other features by their old ids,
+ * so the filters delete them instead.
+ * @param featureArrays
+ * @param activeObjects
+ * @param shouldCancel
+ */
+SIMPLNX_EXPORT void CompactFeatureArrays(const std::vector<IDataArray*>& featureArrays, const std::vector<bool>& activeObjects, const std::atomic_bool& shouldCancel);
+
+/**
+ * @brief Grows the surrounding features into every cell with a negative feature id.
+ *
+ * Each bad cell takes every cellArrays tuple of the face neighbor whose feature appears most
+ * often among its (up to) six face neighbors, ties going to the first feature found. Only the
+ * bad cells that touch a cell filled in the previous pass are looked at again, so the work is
+ * proportional to the number of bad cells instead of the image size times the number of passes.
+ * Bad cells that can never be reached by a good feature keep their negative id.
+ *
+ * featureIds is updated even if its array is not part of cellArrays.
+ * @param dimensions
+ * @param featureIds
+ * @param cellArrays
+ * @param messageHandler
+ * @param shouldCancel
+ * @return
+ */
+SIMPLNX_EXPORT Result<> AssignBadCellsToNeighbors(const SizeVec3& dimensions, Int32AbstractDataStore& featureIds, const std::vector<IDataArray*>& cellArrays,
+                                                  const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel);
+} // namespace nx::core::FeatureCompaction
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "simplnx/Common/Range.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace nx::core::FeatureReduction
+{
+/**
+ * @brief Upper bound on the number of voxel blocks a reduction is split into.
+ */
+inline constexpr usize k_MaxBlockCount = 64;
+
+/**
+ * @brief Smallest number of voxels worth giving its own block.
+ */
+inline constexpr usize k_MinVoxelsPerBlock = 32768;
+
+/**
+ * @brief Upper bound, in bytes, on the memory used by the per block accumulators.
+ */
+inline constexpr usize k_AccumulatorMemoryBudget = 256ULL * 1024ULL * 1024ULL;
+
+/**
+ * @brief Compensated (Kahan) running sum. Two partial sums can be merged without
+ * throwing away the low order bits each of them has been carrying.
+ */
+struct KahanSum
+{
+  float64 sum = 0.0;
+  float64 compensation = 0.0;
+
+  void add(float64 value)
+  {
+    const float64 y = value - compensation;
+    const float64 t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+  }
+
+  void merge(const KahanSum& other)
+  {
+    add(-other.compensation);
+    add(other.sum);
+  }
+
+  float64 value() const
+  {
+    return sum;
+  }
+};
+
+/**
+ * @brief Returns the number of voxel blocks a reduction over numVoxels voxels and numFeatures
+ * accumulators of accumulatorSize bytes is split into. The count only depends on the data
+ * size, never on the number of threads, so the merged result is reproducible run to run.
+ * @param numVoxels
+ * @param numFeatures
+ * @param accumulatorSize
+ * @return
+ */
+inline usize ComputeBlockCount(usize numVoxels, usize numFeatures, usize accumulatorSize)
+{
+  const usize bytesPerBlock = std::max<usize>(numFeatures * accumulatorSize, 1);
+  usize blockCount = std::min(k_MaxBlockCount, numVoxels / k_MinVoxelsPerBlock);
+  blockCount = std::min(blockCount, k_AccumulatorMemoryBudget / bytesPerBlock);
+  return std::max<usize>(blockCount, 1);
+}
+
+/**
+ * @brief Group-by-feature reduction over a voxel range.
+ *
+ * The voxels [0, numVoxels) are cut into contiguous blocks (see ComputeBlockCount). Every block
+ * owns a private vector of numFeatures accumulators, initialized to identity, that
+ * accumulateBlock(AccumulatorT* accumulators, usize voxelBegin, usize voxelEnd) fills in.
+ * Blocks run in parallel. The partial results are then folded together feature by feature
+ * with merge(AccumulatorT& target, const AccumulatorT& source), always in block order, so
+ * the result does not depend on how the blocks were scheduled.
+ *
+ * accumulateBlock is responsible for ignoring feature ids outside of [0, numFeatures).
+ * If shouldCancel is set the remaining blocks are skipped and the result is incomplete.
+ * @param numVoxels
+ * @param numFeatures
+ * @param identity
+ * @param accumulateBlock
+ * @param merge
+ * @param shouldCancel
+ * @param requiredArrays Arrays read by accumulateBlock; used to fall back to serial execution for out-of-core data
+ * @return One merged accumulator per feature
+ */
+template <class AccumulatorT, class BlockFunctionT, class MergeFunctionT>
+std::vector<AccumulatorT> ReduceByFeature(usize numVoxels, usize numFeatures, const AccumulatorT& identity, const BlockFunctionT& accumulateBlock, const MergeFunctionT& merge,
+                                          const std::atomic_bool& shouldCancel, const IParallelAlgorithm::AlgorithmArrays& requiredArrays = {})
+{
+  const usize blockCount = ComputeBlockCount(numVoxels, numFeatures, sizeof(AccumulatorT));
+  const usize voxelsPerBlock = (numVoxels + blockCount - 1) / blockCount;
+
+  std::vector<std::vector<AccumulatorT>> blockAccumulators(blockCount);
+
+  ParallelDataAlgorithm blockAlg;
+  blockAlg.setRange(0, blockCount);
+  blockAlg.requireArraysInMemory(requiredArrays);
+  blockAlg.execute([&](const Range& range) {
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      std::vector<AccumulatorT>& accumulators = blockAccumulators[block];
+      accumulators.assign(numFeatures, identity);
+      if(shouldCancel)
+      {
+        continue;
+      }
+      const usize voxelBegin = std::min(block * voxelsPerBlock, numVoxels);
+      const usize voxelEnd = std::min(voxelBegin + voxelsPerBlock, numVoxels);
+      accumulateBlock(accumulators.data(), voxelBegin, voxelEnd);
+    }
+  });
+
+  if(blockCount > 1)
+  {
+    ParallelDataAlgorithm mergeAlg;
+    mergeAlg.setRange(0, numFeatures);
+    mergeAlg.execute([&](const Range& range) {
+      for(usize featureId = range.min(); featureId < range.max(); featureId++)
+      {
+        AccumulatorT& target = blockAccumulators[0][featureId];
+        for(usize block = 1; block < blockCount; block++)
+        {
+          merge(target, blockAccumulators[block][featureId]);
+        }
+      }
+    });
+  }
+
+  return std::move(blockAccumulators[0]);
+}
+} // namespace nx::core::FeatureReduction
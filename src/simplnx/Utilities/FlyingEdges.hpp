@@ -47,10 +47,13 @@ Supporting Paper: https://www.researchgate.net/publication/308703724_Flying_edge
 #include "simplnx/Common/TypesUtility.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <algorithm>
 #include <array>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace util
@@ -604,6 +607,86 @@ const nx::core::uint8 edgeVertices[12][2] = { {0,1}, {1,2}, {3,2},
 
 namespace nx::core
 {
+/**
+ * @brief Interpolates an array of the image onto the points created by FlyingEdgesAlgorithm.
+ * The values are taken at the two grid points of the cut edge that produced the point.
+ */
+class AbstractFlyingEdgesInterpolator
+{
+public:
+  virtual ~AbstractFlyingEdgesInterpolator() = default;
+
+  AbstractFlyingEdgesInterpolator(const AbstractFlyingEdgesInterpolator&) = delete;
+  AbstractFlyingEdgesInterpolator(AbstractFlyingEdgesInterpolator&&) noexcept = delete;
+  AbstractFlyingEdgesInterpolator& operator=(const AbstractFlyingEdgesInterpolator&) = delete;
+  AbstractFlyingEdgesInterpolator& operator=(AbstractFlyingEdgesInterpolator&&) noexcept = delete;
+
+  /**
+   * @brief Writes the value of the point at pointIndex.
+   * @param pointIndex Index of the created point
+   * @param firstIndex Index of the first grid point of the cut edge
+   * @param secondIndex Index of the second grid point of the cut edge
+   * @param weight Position of the point along the edge, 0 at the first grid point and 1 at the second
+   */
+  virtual void interpolate(usize pointIndex, usize firstIndex, usize secondIndex, float64 weight) = 0;
+
+  virtual const IDataStore& getSourceStore() const = 0;
+  virtual const IDataStore& getDestinationStore() const = 0;
+
+protected:
+  AbstractFlyingEdgesInterpolator() = default;
+};
+
+/**
+ * @brief Floating point arrays are interpolated linearly. Integer and boolean arrays take the
+ * value of the closer grid point so that labels are never mixed.
+ */
+template <typename U>
+class FlyingEdgesInterpolator : public AbstractFlyingEdgesInterpolator
+{
+public:
+  FlyingEdgesInterpolator(const AbstractDataStore<U>& source, AbstractDataStore<U>& destination)
+  : m_Source(source)
+  , m_Destination(destination)
+  , m_NumComps(source.getNumberOfComponents())
+  {
+  }
+
+  ~FlyingEdgesInterpolator() override = default;
+
+  void interpolate(usize pointIndex, usize firstIndex, usize secondIndex, float64 weight) override
+  {
+    for(usize comp = 0; comp < m_NumComps; comp++)
+    {
+      const U first = m_Source[firstIndex * m_NumComps + comp];
+      const U second = m_Source[secondIndex * m_NumComps + comp];
+      if constexpr(std::is_floating_point_v<U>)
+      {
+        m_Destination[pointIndex * m_NumComps + comp] = static_cast<U>(first + weight * (second - first));
+      }
+      else
+      {
+        m_Destination[pointIndex * m_NumComps + comp] = weight < 0.5 ? first : second;
+      }
+    }
+  }
+
+  const IDataStore& getSourceStore() const override
+  {
+    return m_Source;
+  }
+
+  const IDataStore& getDestinationStore() const override
+  {
+    return m_Destination;
+  }
+
+private:
+  const AbstractDataStore<U>& m_Source;
+  AbstractDataStore<U>& m_Destination;
+  usize m_NumComps = 1;
+};
+
 template <typename T>
 class FlyingEdgesAlgorithm
 {
@@ -611,7 +694,14 @@ class FlyingEdgesAlgorithm
   using TCube = std::array<T, 8>;
 
 public:
-  FlyingEdgesAlgorithm(const ImageGeom& image, const AbstractDataStore<T>& dataStore, const T isoVal, TriangleGeom& triangleGeom, Float32AbstractDataStore& normals)
+  using InterpolatorsType = std::vector<std::shared_ptr<AbstractFlyingEdgesInterpolator>>;
+
+  /**
+   * @param interpolators Arrays of the image that are interpolated onto the created points in pass 4.
+   * Their destination arrays must be sized to the number of points before pass 4 runs.
+   */
+  FlyingEdgesAlgorithm(const ImageGeom& image, const AbstractDataStore<T>& dataStore, const T isoVal, TriangleGeom& triangleGeom, Float32AbstractDataStore& normals,
+                       InterpolatorsType interpolators = {})
   : m_Image(image)
   , m_DataStore(dataStore)
   , m_IsoVal(isoVal)
@@ -626,6 +716,7 @@ public:
   , m_TrisStore(m_TriangleGeom.getFaces()->getDataStoreRef())
   , m_PointsStore(m_TriangleGeom.getVertices()->getDataStoreRef())
   , m_NormalsStore(normals)
+  , m_Interpolators(std::move(interpolators))
   {
   }
 
@@ -640,45 +731,14 @@ public:
     //  - find the locations for computational trimming, xl and xr
     //  To properly find xl and xr, have to check along the x-axis,
     //  the y-axis and the z-axis!
-    for(usize k = 0; k != m_NZ; ++k)
-    {
-      for(usize j = 0; j != m_NY; ++j)
-      {
-        auto curEdgeCases = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j);
-        T curPointValue = m_DataStore[m_NX * (k * m_NY + j)];
-
-        std::array<bool, 2> isGE = {};
-        isGE[0] = (curPointValue >= m_IsoVal);
-        for(int i = 1; i != m_NX; ++i)
-        {
-          isGE[i % 2] = (m_DataStore[(m_NX * (k * m_NY + j)) + i] >= m_IsoVal);
-
-          curEdgeCases[i - 1] = calcCaseEdge(isGE[(i + 1) % 2], isGE[i % 2]);
-        }
-      }
-    }
-
-    for(usize k = 0; k != m_NZ; ++k)
-    {
-      for(usize j = 0; j != m_NY; ++j)
-      {
-        GridEdge& curGridEdge = m_GridEdges[k * m_NY + j];
-        curGridEdge.xl = m_NX;
-        for(int i = 1; i != m_NX; ++i)
-        {
-          // If the edge is cut
-          if(isCutEdge(i - 1, j, k))
-          {
-            if(curGridEdge.xl == m_NX)
-            {
-              curGridEdge.xl = i - 1;
-            }
-
-            curGridEdge.xr = i;
-          }
-        }
-      }
-    }
+    // Every (j, k) row is independent, so both steps run over blocks of rows.
+    // The trim values read the edge cases of the neighboring rows and have
+    // to wait until all the edge cases are set.
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, m_NY * m_NZ);
+    dataAlg.requireStoresInMemory({&m_DataStore});
+    dataAlg.execute(RowBlockImpl<&FlyingEdgesAlgorithm::computeEdgeCases>(this));
+    dataAlg.execute(RowBlockImpl<&FlyingEdgesAlgorithm::computeTrimValues>(this));
   }
   ///////////////////////////////////////////////////////////////////////////////
 
@@ -690,121 +750,11 @@ public:
     // For each (j, k):
     //  - for each cube (i, j, k) calculate caseId and number of GridEdge cuts
     //    in the x, y and z direction.
-    for(usize k = 0; k != m_NZ - 1; ++k)
-    {
-      for(usize j = 0; j != m_NY - 1; ++j)
-      {
-        // find adjusted trim values
-        usize xl, xr;
-        calcTrimValues(xl, xr, j, k); // xl, xr set in this function
-
-        // ge0 is owned by this (i, j, k). ge1, ge2 and ge3 are only used for
-        // boundary cells.
-        GridEdge& ge0 = m_GridEdges[k * m_NY + j];
-        GridEdge& ge1 = m_GridEdges[k * m_NY + j + 1];
-        GridEdge& ge2 = m_GridEdges[(k + 1) * m_NY + j];
-        GridEdge& ge3 = m_GridEdges[(k + 1) * m_NY + j + 1];
-
-        // ec0, ec1, ec2 and ec3 were set in pass 1. They are used
-        // to calculate the cell caseId.
-        auto const& ec0 = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j);
-        auto const& ec1 = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j + 1);
-        auto const& ec2 = m_EdgeCases.begin() + (m_NX - 1) * ((k + 1) * m_NY + j);
-        auto const& ec3 = m_EdgeCases.begin() + (m_NX - 1) * ((k + 1) * m_NY + j + 1);
-
-        // Count the number of triangles along this row of cubes.
-        usize& curTriCounter = *(m_TriCounter.begin() + k * (m_NY - 1) + static_cast<int64>(j));
-
-        auto curCubeCaseIds = m_CubeCases.begin() + (m_NX - 1) * (k * (m_NY - 1) + j);
-
-        bool isYEnd = (j == m_NY - 2);
-        bool isZEnd = (k == m_NZ - 2);
-
-        for(usize i = xl; i != xr; ++i)
-        {
-          bool isXEnd = (i == m_NX - 2);
-
-          // using m_EdgeCases from pass 2, compute m_CubeCases for this cube
-          uint8 caseId = calcCubeCase(ec0[static_cast<int64>(i)], ec1[static_cast<int64>(i)], ec2[static_cast<int64>(i)], ec3[static_cast<int64>(i)]);
-
-          curCubeCaseIds[static_cast<int64>(i)] = caseId;
-
-          // If the cube has no triangles through it
-          if(caseId == 0 || caseId == 255)
-          {
-            continue;
-          }
-
-          curTriCounter += util::numTris[caseId];
-
-          const uint8* isCut = util::isCut[caseId]; // size 12
-
-          ge0.xstart += isCut[0];
-          ge0.ystart += isCut[3];
-          ge0.zstart += isCut[8];
-
-          // Note: Each 'gridCell' contains four m_GridEdges running along it,
-          //       ge0, ge1, ge2 and ge3. Each gridCell can access its own
-          //       ge0 but ge1, ge2 and ge3 are owned by other gridCells.
-          //       Accessing ge1, ge2 and ge3 leads to a race condition
-          //       unless gridCell is along the boundary of the image.
-          //
-          //       To really make sense of the indices, it helps to draw
-          //       out the following picture of a cube with the appropriate
-          //       labels:
-          //         v0 is at (i,   j,   k)
-          //         v1       (i+1, j,   k)
-          //         v2       (i+1, j+1, k)
-          //         v3       (i,   j+1, k)
-          //         v4       (i,   j,   k+1)
-          //         v5       (i+1, j,   k+1)
-          //         v6       (i+1, j+1, k+1)
-          //         v7       (i,   j+1, k+1)
-          //         e0  connects v0 to v1 and is parallel to the x-axis
-          //         e1           v1    v2                        y
-          //         e2           v2    v3                        x
-          //         e3           v0    v3                        y
-          //         e4           v4    v5                        x
-          //         e5           v5    v6                        y
-          //         e6           v6    v7                        x
-          //         e7           v4    v7                        y
-          //         e8           v0    v4                        z
-          //         e9           v1    v5                        z
-          //         e10          v3    v7                        z
-          //         e11          v2    v6                        z
-
-          // Handle cubes along the edge of the image
-          if(isXEnd)
-          {
-            ge0.ystart += isCut[1];
-            ge0.zstart += isCut[9];
-          }
-          if(isYEnd)
-          {
-            ge1.xstart += isCut[2];
-            ge1.zstart += isCut[10];
-          }
-          if(isZEnd)
-          {
-            ge2.xstart += isCut[4];
-            ge2.ystart += isCut[7];
-          }
-
-          if(isXEnd and isYEnd)
-          {
-            ge1.zstart += isCut[11];
-          }
-          if(isXEnd and isZEnd)
-          {
-            ge2.ystart += isCut[5];
-          }
-          if(isYEnd and isZEnd)
-          {
-            ge3.xstart += isCut[6];
-          }
-        }
-      }
-    }
+    // Every row of cubes only writes to its own GridEdge (and to GridEdges
+    // that no other row owns along the boundary), so rows run in parallel.
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, (m_NY - 1) * (m_NZ - 1));
+    dataAlg.execute(RowBlockImpl<&FlyingEdgesAlgorithm::computeCubeCases>(this));
   }
   ///////////////////////////////////////////////////////////////////////////////
 
@@ -900,266 +850,489 @@ public:
     //  - For each cube at i, fill out points, normals and triangles owned by
     //    the cube. Each cube is in charge of filling out e0, e3 and e8. Only
     //    in edge cases does it also fill out other edges.
-    for(usize k = 0; k != m_NZ - 1; ++k)
+    // Pass 3 gave every row its own range of points and triangles, so rows
+    // write straight into the preallocated geometry arrays in parallel.
+    IParallelAlgorithm::AlgorithmStores stores = {&m_DataStore, &m_PointsStore, &m_TrisStore, &m_NormalsStore};
+    for(const auto& interpolator : m_Interpolators)
     {
-      for(usize j = 0; j != m_NY - 1; ++j)
-      {
-        // find adjusted trim values
-        usize xl, xr;
-        calcTrimValues(xl, xr, j, k); // xl, xr set in this function
+      stores.push_back(&interpolator->getSourceStore());
+      stores.push_back(&interpolator->getDestinationStore());
+    }
 
-        if(xl == xr)
-          continue;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, (m_NY - 1) * (m_NZ - 1));
+    dataAlg.requireStoresInMemory(stores);
+    dataAlg.execute(RowBlockImpl<&FlyingEdgesAlgorithm::generateRows>(this));
+  }
+  ///////////////////////////////////////////////////////////////////////////////
 
-        usize triIdx = m_TriCounter[k * (m_NY - 1) + j];
-        auto curCubeCaseIds = m_CubeCases.begin() + (m_NX - 1) * (k * (m_NY - 1) + j);
+private:
+  ///////////////////// MEMBER VARIABLES /////////////////////
+  // Offsets of the eight cube vertices from (i, j, k), in the order used by getValCube
+  static inline constexpr std::array<std::array<usize, 3>, 8> k_CubeVertexOffsets = {{{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}}};
 
-        GridEdge const& ge0 = m_GridEdges[k * m_NY + j];
-        GridEdge const& ge1 = m_GridEdges[k * m_NY + j + 1];
-        GridEdge const& ge2 = m_GridEdges[(k + 1) * m_NY + j];
-        GridEdge const& ge3 = m_GridEdges[(k + 1) * m_NY + j + 1];
+  struct GridEdge
+  {
+    GridEdge()
+    : xl(0)
+    , xr(0)
+    , xstart(0)
+    , ystart(0)
+    , zstart(0)
+    {
+    }
 
-        usize x0counter = 0;
-        usize y0counter = 0;
-        usize z0counter = 0;
+    // trim values
+    // set on pass 1
+    usize xl;
+    usize xr;
 
-        usize x1counter = 0;
-        usize z1counter = 0;
+    // modified on pass 2
+    // set on pass 3
+    usize xstart;
+    usize ystart;
+    usize zstart;
+  };
 
-        usize x2counter = 0;
-        usize y2counter = 0;
+  const ImageGeom& m_Image;
+  const AbstractDataStore<T>& m_DataStore;
+  const T m_IsoVal;
+  TriangleGeom& m_TriangleGeom;
 
-        usize x3counter = 0;
+  usize const m_NX; //
+  usize const m_NY; // for indexing
+  usize const m_NZ; //
 
-        bool isYEnd = (j == m_NY - 2);
-        bool isZEnd = (k == m_NZ - 2);
+  std::vector<GridEdge> m_GridEdges; // size of m_NY*m_NZ
+  std::vector<usize> m_TriCounter;   // size of (m_NY-1)*(m_NZ-1)
 
-        for(usize i = xl; i != xr; ++i)
-        {
-          bool isXEnd = (i == m_NX - 2);
+  std::vector<uint8> m_EdgeCases; // size (m_NX-1)*m_NY*m_NZ
+  std::vector<uint8> m_CubeCases; // size (m_NX-1)*(m_NY-1)*(m_NZ-1)
 
-          uint8 caseId = curCubeCaseIds[static_cast<int64>(i)];
+  AbstractDataStore<IGeometry::SharedVertexList::value_type>& m_PointsStore; //
+  AbstractDataStore<IGeometry::SharedTriList::value_type>& m_TrisStore;      //
+  Float32AbstractDataStore& m_NormalsStore;                                  // The output
+  InterpolatorsType m_Interpolators;
 
-          if(caseId == 0 || caseId == 255)
-          {
-            continue;
-          }
+  /////////////////////////////////////////////////////////////
 
-          const uint8* isCut = util::isCut[caseId]; // has 12 elements
+  ///////////////////////////////////////////////////////////////////////////////
+  // Row block kernels of the passes
+  ///////////////////////////////////////////////////////////////////////////////
 
-          // Most of the information contained in pointCube, isoValCube
-          // and gradCube will be used--but not necessarily all. It has
-          // not been tested whether obtaining only the information
-          // needed will provide a significant speedup--but
-          // most likely not.
-          cube pointCube = getPosCube(i, j, k);
-          TCube isoValCube = getValCube(i, j, k);
-          cube gradCube = getGradCube(i, j, k);
+  /**
+   * @brief Runs one of the row kernels below over a block of rows for ParallelDataAlgorithm.
+   */
+  template <void (FlyingEdgesAlgorithm::*RowKernel)(usize, usize)>
+  class RowBlockImpl
+  {
+  public:
+    explicit RowBlockImpl(FlyingEdgesAlgorithm* algorithm)
+    : m_Algorithm(algorithm)
+    {
+    }
 
-          // Add Points and normals.
-          // Calculate global indices for triangles
-          std::array<usize, 12> globalIdxs = {};
+    void operator()(const Range& range) const
+    {
+      (m_Algorithm->*RowKernel)(range.min(), range.max());
+    }
 
-          if(isCut[0])
-          {
-            usize idx = ge0.xstart + x0counter;
-            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 0, idx * 3);
-            globalIdxs[0] = idx;
-            ++x0counter;
-          }
+  private:
+    FlyingEdgesAlgorithm* m_Algorithm = nullptr;
+  };
 
-          if(isCut[3])
-          {
-            usize idx = ge0.ystart + y0counter;
-            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 3, idx * 3);
-            globalIdxs[3] = idx;
-            ++y0counter;
-          }
+  /**
+   * @brief Pass 1: Fills m_EdgeCases for the grid rows [rowStart, rowEnd), rows being indexed by k * m_NY + j.
+   */
+  void computeEdgeCases(usize rowStart, usize rowEnd)
+  {
+    for(usize row = rowStart; row < rowEnd; row++)
+    {
+      auto curEdgeCases = m_EdgeCases.begin() + (m_NX - 1) * row;
+      T curPointValue = m_DataStore[m_NX * row];
 
-          if(isCut[8])
-          {
-            usize idx = ge0.zstart + z0counter;
-            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 8, idx * 3);
-            globalIdxs[8] = idx;
-            ++z0counter;
-          }
+      std::array<bool, 2> isGE = {};
+      isGE[0] = (curPointValue >= m_IsoVal);
+      for(usize i = 1; i != m_NX; ++i)
+      {
+        isGE[i % 2] = (m_DataStore[(m_NX * row) + i] >= m_IsoVal);
 
-          // Note:
-          //   e1, e5, e9 and e11 will be visited in the next iteration
-          //   when they are e3, e7, e8 and 10 respectively. So don't
-          //   increment their counters. When the cube is an edge cube,
-          //   their counters don't need to be incremented because they
-          //   won't be used again.
+        curEdgeCases[i - 1] = calcCaseEdge(isGE[(i + 1) % 2], isGE[i % 2]);
+      }
+    }
+  }
 
-          // Manage boundary cases if needed, otherwise just update
-          // globalIdx.
-          if(isCut[1])
+  /**
+   * @brief Pass 1: Finds the trim values xl and xr of the grid rows [rowStart, rowEnd).
+   */
+  void computeTrimValues(usize rowStart, usize rowEnd)
+  {
+    for(usize row = rowStart; row < rowEnd; row++)
+    {
+      const usize k = row / m_NY;
+      const usize j = row % m_NY;
+      GridEdge& curGridEdge = m_GridEdges[row];
+      curGridEdge.xl = m_NX;
+      for(usize i = 1; i != m_NX; ++i)
+      {
+        // If the edge is cut
+        if(isCutEdge(i - 1, j, k))
+        {
+          if(curGridEdge.xl == m_NX)
           {
-            usize idx = ge0.ystart + y0counter;
-            if(isXEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 1, idx * 3);
-              // y0counter counter doesn't need to be incremented
-              // because it won't be used again.
-            }
-            globalIdxs[1] = idx;
+            curGridEdge.xl = i - 1;
           }
 
-          if(isCut[9])
+          curGridEdge.xr = i;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Pass 2: Computes the cube cases and counts the triangles and cut edges of the cube rows [rowStart, rowEnd),
+   * rows being indexed by k * (m_NY - 1) + j.
+   */
+  void computeCubeCases(usize rowStart, usize rowEnd)
+  {
+    for(usize row = rowStart; row < rowEnd; row++)
+    {
+      const usize k = row / (m_NY - 1);
+      const usize j = row % (m_NY - 1);
+
+      // find adjusted trim values
+      usize xl, xr;
+      calcTrimValues(xl, xr, j, k); // xl, xr set in this function
+
+      // ge0 is owned by this (i, j, k). ge1, ge2 and ge3 are only used for
+      // boundary cells.
+      GridEdge& ge0 = m_GridEdges[k * m_NY + j];
+      GridEdge& ge1 = m_GridEdges[k * m_NY + j + 1];
+      GridEdge& ge2 = m_GridEdges[(k + 1) * m_NY + j];
+      GridEdge& ge3 = m_GridEdges[(k + 1) * m_NY + j + 1];
+
+      // ec0, ec1, ec2 and ec3 were set in pass 1. They are used
+      // to calculate the cell caseId.
+      auto const& ec0 = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j);
+      auto const& ec1 = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j + 1);
+      auto const& ec2 = m_EdgeCases.begin() + (m_NX - 1) * ((k + 1) * m_NY + j);
+      auto const& ec3 = m_EdgeCases.begin() + (m_NX - 1) * ((k + 1) * m_NY + j + 1);
+
+      // Count the number of triangles along this row of cubes.
+      usize& curTriCounter = *(m_TriCounter.begin() + k * (m_NY - 1) + static_cast<int64>(j));
+
+      auto curCubeCaseIds = m_CubeCases.begin() + (m_NX - 1) * (k * (m_NY - 1) + j);
+
+      bool isYEnd = (j == m_NY - 2);
+      bool isZEnd = (k == m_NZ - 2);
+
+      for(usize i = xl; i != xr; ++i)
+      {
+        bool isXEnd = (i == m_NX - 2);
+
+        // using m_EdgeCases from pass 2, compute m_CubeCases for this cube
+        uint8 caseId = calcCubeCase(ec0[static_cast<int64>(i)], ec1[static_cast<int64>(i)], ec2[static_cast<int64>(i)], ec3[static_cast<int64>(i)]);
+
+        curCubeCaseIds[static_cast<int64>(i)] = caseId;
+
+        // If the cube has no triangles through it
+        if(caseId == 0 || caseId == 255)
+        {
+          continue;
+        }
+
+        curTriCounter += util::numTris[caseId];
+
+        const uint8* isCut = util::isCut[caseId]; // size 12
+
+        ge0.xstart += isCut[0];
+        ge0.ystart += isCut[3];
+        ge0.zstart += isCut[8];
+
+        // Note: Each 'gridCell' contains four m_GridEdges running along it,
+        //       ge0, ge1, ge2 and ge3. Each gridCell can access its own
+        //       ge0 but ge1, ge2 and ge3 are owned by other gridCells.
+        //       Accessing ge1, ge2 and ge3 leads to a race condition
+        //       unless gridCell is along the boundary of the image.
+        //
+        //       To really make sense of the indices, it helps to draw
+        //       out the following picture of a cube with the appropriate
+        //       labels:
+        //         v0 is at (i,   j,   k)
+        //         v1       (i+1, j,   k)
+        //         v2       (i+1, j+1, k)
+        //         v3       (i,   j+1, k)
+        //         v4       (i,   j,   k+1)
+        //         v5       (i+1, j,   k+1)
+        //         v6       (i+1, j+1, k+1)
+        //         v7       (i,   j+1, k+1)
+        //         e0  connects v0 to v1 and is parallel to the x-axis
+        //         e1           v1    v2                        y
+        //         e2           v2    v3                        x
+        //         e3           v0    v3                        y
+        //         e4           v4    v5                        x
+        //         e5           v5    v6                        y
+        //         e6           v6    v7                        x
+        //         e7           v4    v7                        y
+        //         e8           v0    v4                        z
+        //         e9           v1    v5                        z
+        //         e10          v3    v7                        z
+        //         e11          v2    v6                        z
+
+        // Handle cubes along the edge of the image
+        if(isXEnd)
+        {
+          ge0.ystart += isCut[1];
+          ge0.zstart += isCut[9];
+        }
+        if(isYEnd)
+        {
+          ge1.xstart += isCut[2];
+          ge1.zstart += isCut[10];
+        }
+        if(isZEnd)
+        {
+          ge2.xstart += isCut[4];
+          ge2.ystart += isCut[7];
+        }
+
+        if(isXEnd and isYEnd)
+        {
+          ge1.zstart += isCut[11];
+        }
+        if(isXEnd and isZEnd)
+        {
+          ge2.ystart += isCut[5];
+        }
+        if(isYEnd and isZEnd)
+        {
+          ge3.xstart += isCut[6];
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Pass 4: Generates the points, normals, interpolated values and triangles of the cube rows [rowStart, rowEnd).
+   */
+  void generateRows(usize rowStart, usize rowEnd)
+  {
+    for(usize row = rowStart; row < rowEnd; row++)
+    {
+      const usize k = row / (m_NY - 1);
+      const usize j = row % (m_NY - 1);
+
+      // find adjusted trim values
+      usize xl, xr;
+      calcTrimValues(xl, xr, j, k); // xl, xr set in this function
+
+      if(xl == xr)
+      {
+        continue;
+      }
+
+      usize triIdx = m_TriCounter[k * (m_NY - 1) + j];
+      auto curCubeCaseIds = m_CubeCases.begin() + (m_NX - 1) * (k * (m_NY - 1) + j);
+
+      GridEdge const& ge0 = m_GridEdges[k * m_NY + j];
+      GridEdge const& ge1 = m_GridEdges[k * m_NY + j + 1];
+      GridEdge const& ge2 = m_GridEdges[(k + 1) * m_NY + j];
+      GridEdge const& ge3 = m_GridEdges[(k + 1) * m_NY + j + 1];
+
+      usize x0counter = 0;
+      usize y0counter = 0;
+      usize z0counter = 0;
+
+      usize x1counter = 0;
+      usize z1counter = 0;
+
+      usize x2counter = 0;
+      usize y2counter = 0;
+
+      usize x3counter = 0;
+
+      bool isYEnd = (j == m_NY - 2);
+      bool isZEnd = (k == m_NZ - 2);
+
+      for(usize i = xl; i != xr; ++i)
+      {
+        bool isXEnd = (i == m_NX - 2);
+
+        uint8 caseId = curCubeCaseIds[static_cast<int64>(i)];
+
+        if(caseId == 0 || caseId == 255)
+        {
+          continue;
+        }
+
+        const uint8* isCut = util::isCut[caseId]; // has 12 elements
+
+        // Most of the information contained in pointCube, isoValCube
+        // and gradCube will be used--but not necessarily all. It has
+        // not been tested whether obtaining only the information
+        // needed will provide a significant speedup--but
+        // most likely not.
+        cube pointCube = getPosCube(i, j, k);
+        TCube isoValCube = getValCube(i, j, k);
+        cube gradCube = getGradCube(i, j, k);
+
+        // Add Points and normals.
+        // Calculate global indices for triangles
+        std::array<usize, 12> globalIdxs = {};
+
+        if(isCut[0])
+        {
+          usize idx = ge0.xstart + x0counter;
+          InterpolateIntoArrays(pointCube, gradCube, isoValCube, 0, idx, i, j, k);
+          globalIdxs[0] = idx;
+          ++x0counter;
+        }
+
+        if(isCut[3])
+        {
+          usize idx = ge0.ystart + y0counter;
+          InterpolateIntoArrays(pointCube, gradCube, isoValCube, 3, idx, i, j, k);
+          globalIdxs[3] = idx;
+          ++y0counter;
+        }
+
+        if(isCut[8])
+        {
+          usize idx = ge0.zstart + z0counter;
+          InterpolateIntoArrays(pointCube, gradCube, isoValCube, 8, idx, i, j, k);
+          globalIdxs[8] = idx;
+          ++z0counter;
+        }
+
+        // Note:
+        //   e1, e5, e9 and e11 will be visited in the next iteration
+        //   when they are e3, e7, e8 and 10 respectively. So don't
+        //   increment their counters. When the cube is an edge cube,
+        //   their counters don't need to be incremented because they
+        //   won't be used again.
+
+        // Manage boundary cases if needed, otherwise just update
+        // globalIdx.
+        if(isCut[1])
+        {
+          usize idx = ge0.ystart + y0counter;
+          if(isXEnd)
           {
-            usize idx = ge0.zstart + z0counter;
-            if(isXEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 9, idx * 3);
-              // z0counter doesn't need to in incremented.
-            }
-            globalIdxs[9] = idx;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 1, idx, i, j, k);
+            // y0counter counter doesn't need to be incremented
+            // because it won't be used again.
           }
+          globalIdxs[1] = idx;
+        }
 
-          if(isCut[2])
+        if(isCut[9])
+        {
+          usize idx = ge0.zstart + z0counter;
+          if(isXEnd)
           {
-            usize idx = ge1.xstart + x1counter;
-            if(isYEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 2, idx * 3);
-            }
-            globalIdxs[2] = idx;
-            ++x1counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 9, idx, i, j, k);
+            // z0counter doesn't need to in incremented.
           }
+          globalIdxs[9] = idx;
+        }
 
-          if(isCut[10])
+        if(isCut[2])
+        {
+          usize idx = ge1.xstart + x1counter;
+          if(isYEnd)
           {
-            usize idx = ge1.zstart + z1counter;
-            if(isYEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 10, idx * 3);
-            }
-            globalIdxs[10] = idx;
-            ++z1counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 2, idx, i, j, k);
           }
+          globalIdxs[2] = idx;
+          ++x1counter;
+        }
 
-          if(isCut[4])
+        if(isCut[10])
+        {
+          usize idx = ge1.zstart + z1counter;
+          if(isYEnd)
           {
-            usize idx = ge2.xstart + x2counter;
-            if(isZEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 4, idx * 3);
-            }
-            globalIdxs[4] = idx;
-            ++x2counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 10, idx, i, j, k);
           }
+          globalIdxs[10] = idx;
+          ++z1counter;
+        }
 
-          if(isCut[7])
+        if(isCut[4])
+        {
+          usize idx = ge2.xstart + x2counter;
+          if(isZEnd)
           {
-            usize idx = ge2.ystart + y2counter;
-            if(isZEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 7, idx * 3);
-            }
-            globalIdxs[7] = idx;
-            ++y2counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 4, idx, i, j, k);
           }
+          globalIdxs[4] = idx;
+          ++x2counter;
+        }
 
-          if(isCut[11])
+        if(isCut[7])
+        {
+          usize idx = ge2.ystart + y2counter;
+          if(isZEnd)
           {
-            usize idx = ge1.zstart + z1counter;
-            if(isXEnd and isYEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 11, idx * 3);
-              // z1counter does not need to be incremented.
-            }
-            globalIdxs[11] = idx;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 7, idx, i, j, k);
           }
+          globalIdxs[7] = idx;
+          ++y2counter;
+        }
 
-          if(isCut[5])
+        if(isCut[11])
+        {
+          usize idx = ge1.zstart + z1counter;
+          if(isXEnd and isYEnd)
           {
-            usize idx = ge2.ystart + y2counter;
-            if(isXEnd and isZEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 5, idx * 3);
-              // y2 counter does not need to be incremented.
-            }
-            globalIdxs[5] = idx;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 11, idx, i, j, k);
+            // z1counter does not need to be incremented.
           }
+          globalIdxs[11] = idx;
+        }
 
-          if(isCut[6])
+        if(isCut[5])
+        {
+          usize idx = ge2.ystart + y2counter;
+          if(isXEnd and isZEnd)
           {
-            usize idx = ge3.xstart + x3counter;
-            if(isYEnd and isZEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 6, idx * 3);
-            }
-            globalIdxs[6] = idx;
-            ++x3counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 5, idx, i, j, k);
+            // y2 counter does not need to be incremented.
           }
+          globalIdxs[5] = idx;
+        }
 
-          // Add triangles
-          const char* caseTri = util::caseTriangles[caseId]; // size 16
-          for(int idx = 0; caseTri[idx] != -1; idx += 3)
+        if(isCut[6])
+        {
+          usize idx = ge3.xstart + x3counter;
+          if(isYEnd and isZEnd)
           {
-            m_TrisStore[triIdx * 3] = globalIdxs[caseTri[idx]];
-            m_TrisStore[triIdx * 3 + 1] = globalIdxs[caseTri[idx + 1]];
-            m_TrisStore[triIdx * 3 + 2] = globalIdxs[caseTri[idx + 2]];
-            triIdx++;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 6, idx, i, j, k);
           }
+          globalIdxs[6] = idx;
+          ++x3counter;
+        }
+
+        // Add triangles
+        const char* caseTri = util::caseTriangles[caseId]; // size 16
+        for(int idx = 0; caseTri[idx] != -1; idx += 3)
+        {
+          m_TrisStore[triIdx * 3] = globalIdxs[caseTri[idx]];
+          m_TrisStore[triIdx * 3 + 1] = globalIdxs[caseTri[idx + 1]];
+          m_TrisStore[triIdx * 3 + 2] = globalIdxs[caseTri[idx + 2]];
+          triIdx++;
         }
       }
     }
   }
-  ///////////////////////////////////////////////////////////////////////////////
-
-private:
-  ///////////////////// MEMBER VARIABLES /////////////////////
-  struct GridEdge
-  {
-    GridEdge()
-    : xl(0)
-    , xr(0)
-    , xstart(0)
-    , ystart(0)
-    , zstart(0)
-    {
-    }
-
-    // trim values
-    // set on pass 1
-    usize xl;
-    usize xr;
-
-    // modified on pass 2
-    // set on pass 3
-    usize xstart;
-    usize ystart;
-    usize zstart;
-  };
-
-  const ImageGeom& m_Image;
-  const AbstractDataStore<T>& m_DataStore;
-  const T m_IsoVal;
-  TriangleGeom& m_TriangleGeom;
-
-  usize const m_NX; //
-  usize const m_NY; // for indexing
-  usize const m_NZ; //
-
-  std::vector<GridEdge> m_GridEdges; // size of m_NY*m_NZ
-  std::vector<usize> m_TriCounter;   // size of (m_NY-1)*(m_NZ-1)
-
-  std::vector<uint8> m_EdgeCases; // size (m_NX-1)*m_NY*m_NZ
-  std::vector<uint8> m_CubeCases; // size (m_NX-1)*(m_NY-1)*(m_NZ-1)
-
-  AbstractDataStore<IGeometry::SharedVertexList::value_type>& m_PointsStore; //
-  AbstractDataStore<IGeometry::SharedTriList::value_type>& m_TrisStore;      //
-  Float32AbstractDataStore& m_NormalsStore;                                  // The output
-
-  /////////////////////////////////////////////////////////////
 
   ///////////////////////////////////////////////////////////////////////////////
   // Private helper functions
   ///////////////////////////////////////////////////////////////////////////////
 
-  void InterpolateIntoArrays(cube& pointCube, cube& gradCube, TCube& isoValCube, uint8 edgeNum, usize idx)
+  void InterpolateIntoArrays(cube& pointCube, cube& gradCube, TCube& isoValCube, uint8 edgeNum, usize pointIdx, usize i, usize j, usize k)
   {
+    const usize idx = pointIdx * 3;
     auto pointsArray = interpolateOnCube(pointCube, isoValCube, edgeNum);
 
     m_PointsStore[idx] = pointsArray[0];
@@ -1171,6 +1344,22 @@ private:
     m_NormalsStore[idx] = normalsArray[0];
     m_NormalsStore[idx + 1] = normalsArray[1];
     m_NormalsStore[idx + 2] = normalsArray[2];
+
+    if(m_Interpolators.empty())
+    {
+      return;
+    }
+    // The weight is computed in floating point even for integer contour arrays
+    const uint8 v0 = util::edgeVertices[edgeNum][0];
+    const uint8 v1 = util::edgeVertices[edgeNum][1];
+    const float64 difference = static_cast<float64>(isoValCube[v1]) - static_cast<float64>(isoValCube[v0]);
+    const float64 weight = difference == 0.0 ? 0.0 : (static_cast<float64>(m_IsoVal) - static_cast<float64>(isoValCube[v0])) / difference;
+    const usize firstIndex = getDataIndex(i + k_CubeVertexOffsets[v0][0], j + k_CubeVertexOffsets[v0][1], k + k_CubeVertexOffsets[v0][2]);
+    const usize secondIndex = getDataIndex(i + k_CubeVertexOffsets[v1][0], j + k_CubeVertexOffsets[v1][1], k + k_CubeVertexOffsets[v1][2]);
+    for(const auto& interpolator : m_Interpolators)
+    {
+      interpolator->interpolate(pointIdx, firstIndex, secondIndex, weight);
+    }
   }
 
   [[nodiscard]] bool isCutEdge(usize const& i, usize const& j, usize const& k) const
@@ -1368,7 +1557,12 @@ private:
 
   inline T getData(usize i, usize j, usize k) const
   {
-    return m_DataStore[k * m_NX * m_NY + j * m_NX + i];
+    return m_DataStore[getDataIndex(i, j, k)];
+  }
+
+  inline usize getDataIndex(usize i, usize j, usize k) const
+  {
+    return k * m_NX * m_NY + j * m_NX + i;
   }
 
   [[nodiscard]] std::array<float32, 3> computeGradient(usize i, usize j, usize k) const
@@ -2,11 +2,17 @@
 
 #include "simplnx/Common/AtomicFile.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
 #include <chrono>
-#include <iomanip>
 #include <ostream>
 #include <string>
+#include <string_view>
+#include <thread>
 
 namespace fs = std::filesystem;
 using namespace nx::core;
@@ -15,6 +21,206 @@ namespace // for nonmember functions
 {
 const std::array<std::string, 5> k_DelimiterStrings = {" ", ";", ",", ":", "\t"}; // Don't reorder
 
+// Target size of the text produced for a single block of rows. Each block is formatted
+// into its own reusable buffer, so this also bounds the memory held per worker.
+constexpr usize k_TargetBlockBytes = 1024 * 1024;
+// Rough number of characters a single formatted value occupies, used to size blocks
+constexpr usize k_EstimatedCharsPerValue = 12;
+constexpr int64 k_ProgressIntervalMs = 1000;
+
+using TextBuffer = fmt::memory_buffer;
+
+/**
+ * @brief Appends a string to the text buffer without any formatting
+ * @param buffer The buffer to append to
+ * @param text The characters to append
+ */
+inline void AppendText(TextBuffer& buffer, std::string_view text)
+{
+  buffer.append(text.data(), text.data() + text.size());
+}
+
+/**
+ * @brief Appends a single value to the text buffer. Integers go through std::to_chars, floating
+ * point values use the shortest round-trip representation. The output matches what the previous
+ * std::ostream based implementation produced.
+ * @tparam ScalarType The primitive type of the value
+ * @param buffer The buffer to append to
+ * @param value The value to format
+ */
+template <typename ScalarType>
+inline void AppendValue(TextBuffer& buffer, ScalarType value)
+{
+  if constexpr(std::is_same_v<ScalarType, bool>)
+  {
+    buffer.push_back(value ? '1' : '0');
+  }
+  else if constexpr(std::is_floating_point_v<ScalarType>)
+  {
+    fmt::format_to(std::back_inserter(buffer), "{}", value);
+  }
+  else
+  {
+    // int8/uint8 are written as numbers and not as characters
+    std::array<char, 24> chars = {};
+    auto result = std::to_chars(chars.data(), chars.data() + chars.size(), static_cast<std::conditional_t<sizeof(ScalarType) == 1, int32, ScalarType>>(value));
+    buffer.append(chars.data(), result.ptr);
+  }
+}
+
+/**
+ * @brief Appends a single value to the text buffer using a fixed number of significant digits for
+ * floating point values (equivalent to std::setprecision(8 or 16) with std::noshowpoint).
+ * @tparam ScalarType The primitive type of the value
+ * @param buffer The buffer to append to
+ * @param value The value to format
+ */
+template <typename ScalarType>
+inline void AppendFixedPrecisionValue(TextBuffer& buffer, ScalarType value)
+{
+  if constexpr(std::is_same_v<ScalarType, float32>)
+  {
+    fmt::format_to(std::back_inserter(buffer), "{:.8g}", value);
+  }
+  else if constexpr(std::is_same_v<ScalarType, float64>)
+  {
+    fmt::format_to(std::back_inserter(buffer), "{:.16g}", value);
+  }
+  else
+  {
+    AppendValue(buffer, value);
+  }
+}
+
+/**
+ * @brief Computes how many rows go into a single formatted block
+ * @param valuesPerRow The (estimated) number of values written per row
+ */
+usize ComputeRowsPerBlock(usize valuesPerRow)
+{
+  return std::max(k_TargetBlockBytes / (std::max(valuesPerRow, usize{1}) * k_EstimatedCharsPerValue), usize{1});
+}
+
+/**
+ * @brief Sends "Processing X: N% completed" messages at most once per interval. It is meant to be
+ * polled once per block of rows instead of once per value.
+ */
+class ProgressThrottle
+{
+public:
+  ProgressThrottle(const IFilter::MessageHandler& mesgHandler, std::string name, usize total)
+  : m_MessageHandler(mesgHandler)
+  , m_Name(std::move(name))
+  , m_Total(total)
+  , m_Start(std::chrono::steady_clock::now())
+  {
+  }
+
+  void update(usize current)
+  {
+    auto now = std::chrono::steady_clock::now();
+    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - m_Start).count() > k_ProgressIntervalMs)
+    {
+      auto string = fmt::format("Processing {}: {}% completed", m_Name, static_cast<int32>(100 * static_cast<float>(current) / static_cast<float>(m_Total)));
+      m_MessageHandler(IFilter::Message::Type::Info, string);
+      m_Start = now;
+    }
+  }
+
+private:
+  const IFilter::MessageHandler& m_MessageHandler;
+  std::string m_Name;
+  usize m_Total = 0;
+  std::chrono::steady_clock::time_point m_Start;
+};
+
+/**
+ * @brief Formats a batch of consecutive row blocks, each block into its own buffer
+ * @tparam FormatRowsFunc Callable with the signature void(TextBuffer&, usize rowStart, usize rowEnd)
+ */
+template <typename FormatRowsFunc>
+class FormatBlocksImpl
+{
+public:
+  FormatBlocksImpl(std::vector<TextBuffer>& buffers, const FormatRowsFunc& formatRows, usize firstBlock, usize rowStart, usize rowEnd, usize rowsPerBlock)
+  : m_Buffers(buffers)
+  , m_FormatRows(formatRows)
+  , m_FirstBlock(firstBlock)
+  , m_RowStart(rowStart)
+  , m_RowEnd(rowEnd)
+  , m_RowsPerBlock(rowsPerBlock)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      TextBuffer& buffer = m_Buffers[block - m_FirstBlock];
+      buffer.clear();
+      const usize blockStart = m_RowStart + block * m_RowsPerBlock;
+      const usize blockEnd = std::min(blockStart + m_RowsPerBlock, m_RowEnd);
+      m_FormatRows(buffer, blockStart, blockEnd);
+    }
+  }
+
+private:
+  std::vector<TextBuffer>& m_Buffers;
+  const FormatRowsFunc& m_FormatRows;
+  usize m_FirstBlock = 0;
+  usize m_RowStart = 0;
+  usize m_RowEnd = 0;
+  usize m_RowsPerBlock = 1;
+};
+
+/**
+ * @brief Splits the rows [rowStart, rowEnd) into blocks, formats batches of blocks in parallel
+ * into reusable text buffers and writes the finished buffers to the stream in row order.
+ * @tparam FormatRowsFunc Callable with the signature void(TextBuffer&, usize rowStart, usize rowEnd)
+ * @param outputStrm The stream to write to
+ * @param rowStart The first row to write
+ * @param rowEnd One past the last row to write
+ * @param rowsPerBlock The number of rows formatted into a single buffer
+ * @param runParallel Whether the blocks of a batch may be formatted concurrently
+ * @param formatRows The row formatter. Must be safe to call concurrently when runParallel is true
+ * @param progress The progress throttle to update after each batch
+ * @param shouldCancel The atomic boolean that determines cancel
+ */
+template <typename FormatRowsFunc>
+void WriteRowBlocks(std::ostream& outputStrm, usize rowStart, usize rowEnd, usize rowsPerBlock, bool runParallel, const FormatRowsFunc& formatRows, ProgressThrottle& progress,
+                    const std::atomic_bool& shouldCancel)
+{
+  if(rowEnd <= rowStart)
+  {
+    return;
+  }
+  const usize numBlocks = (rowEnd - rowStart + rowsPerBlock - 1) / rowsPerBlock;
+  const usize blocksPerBatch = runParallel ? std::max(static_cast<usize>(std::thread::hardware_concurrency()) * 2, usize{1}) : 1;
+
+  std::vector<TextBuffer> buffers(std::min(blocksPerBatch, numBlocks));
+  for(usize batchStart = 0; batchStart < numBlocks; batchStart += buffers.size())
+  {
+    const usize batchEnd = std::min(batchStart + buffers.size(), numBlocks);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(batchStart, batchEnd);
+    dataAlg.setParallelizationEnabled(runParallel && (batchEnd - batchStart) > 1);
+    dataAlg.execute(FormatBlocksImpl<FormatRowsFunc>(buffers, formatRows, batchStart, rowStart, rowEnd, rowsPerBlock));
+
+    for(usize block = batchStart; block < batchEnd; block++)
+    {
+      const TextBuffer& buffer = buffers[block - batchStart];
+      outputStrm.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    progress.update(std::min(rowStart + batchEnd * rowsPerBlock, rowEnd) - rowStart);
+    if(shouldCancel)
+    {
+      return;
+    }
+  }
+}
+
 /**
  * @brief implicit writing of **NeighborList**'s elements to outputStrm
  * @tparam ScalarType The primitive type attacthed to **NeighborList**
@@ -33,8 +239,7 @@ struct PrintNeighborList
                       bool hasIndex = false, bool hasHeader = false)
   {
     auto& neighborList = *dynamic_cast<NeighborList<ScalarType>*>(inputNeighborList);
-    auto start = std::chrono::steady_clock::now();
-    auto numLists = neighborList.getNumberOfLists();
+    const usize numLists = neighborList.getNumberOfLists();
 
     if(hasHeader)
     {
@@ -44,84 +249,39 @@ struct PrintNeighborList
       }
       outputStrm << "Element Count" << delimiter << inputNeighborList->getName() << "\n";
     }
-    if(hasIndex)
+
+    usize totalEntries = 0;
+    for(usize list = 0; list < numLists; list++)
     {
-      for(size_t list = 0; list < numLists; list++)
-      {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-        {
-          auto string = fmt::format("Processing {}: {}% completed", neighborList.getName(), static_cast<int32>(100 * static_cast<float>(list) / static_cast<float>(numLists)));
-          mesgHandler(IFilter::Message::Type::Info, string);
-          start = now;
-          if(shouldCancel)
-          {
-            return {};
-          }
-        }
-        const auto& grain = neighborList.getListReference(list);
-        outputStrm << list << delimiter << grain.size() << delimiter;
-        for(size_t index = 0; index < grain.size(); index++)
-        {
-          if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-          {
-            outputStrm << static_cast<int32>(grain[index]);
-          }
-          else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-          {
-            outputStrm << fmt::format("{}", grain[index]);
-          }
-          else
-          {
-            outputStrm << grain[index];
-          }
-          if(index != grain.size() - 1)
-          {
-            outputStrm << delimiter;
-          }
-        }
-        outputStrm << "\n";
-      }
+      totalEntries += static_cast<usize>(neighborList.getListSize(static_cast<int32>(list)));
     }
-    else // no index
-    {
-      for(size_t list = 0; list < neighborList.getNumberOfLists(); list++)
+    const usize rowsPerBlock = ComputeRowsPerBlock(2 + totalEntries / std::max(numLists, usize{1}));
+
+    auto formatRows = [&neighborList, &delimiter, hasIndex](TextBuffer& buffer, usize rowStart, usize rowEnd) {
+      for(usize list = rowStart; list < rowEnd; list++)
       {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+        const auto& grain = neighborList.getListReference(static_cast<int32>(list));
+        if(hasIndex)
         {
-          auto string = fmt::format("Processing {}: {}% completed", neighborList.getName(), static_cast<int32>(static_cast<float>(list) / static_cast<float>(numLists)));
-          mesgHandler(IFilter::Message::Type::Info, string);
-          start = now;
-          if(shouldCancel)
-          {
-            return {};
-          }
+          AppendValue(buffer, list);
+          AppendText(buffer, delimiter);
         }
-        const auto& grain = neighborList.getListReference(list);
-        outputStrm << grain.size() << delimiter;
-        for(size_t index = 0; index < grain.size(); index++)
+        AppendValue(buffer, grain.size());
+        AppendText(buffer, delimiter);
+        for(usize index = 0; index < grain.size(); index++)
         {
-          if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-          {
-            outputStrm << static_cast<int32>(grain[index]);
-          }
-          else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-          {
-            outputStrm << fmt::format("{}", grain[index]);
-          }
-          else
-          {
-            outputStrm << grain[index];
-          }
+          AppendValue(buffer, grain[index]);
           if(index != grain.size() - 1)
           {
-            outputStrm << delimiter;
+            AppendText(buffer, delimiter);
           }
         }
-        outputStrm << "\n";
+        buffer.push_back('\n');
       }
-    }
+    };
+
+    ProgressThrottle progress(mesgHandler, neighborList.getName(), numLists);
+    WriteRowBlocks(outputStrm, 0, numLists, rowsPerBlock, true, formatRows, progress, shouldCancel);
     return {};
   }
 };
@@ -142,53 +302,37 @@ struct PrintDataArray
   Result<> operator()(std::ostream& outputStrm, IDataArray* inputDataArray, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, const std::string& delimiter = ",",
                       int32 componentsPerLine = 0)
   {
-    auto& dataStore = inputDataArray->template getIDataStoreRefAs<AbstractDataStore<ScalarType>>();
-    auto start = std::chrono::steady_clock::now();
-    auto numTuples = dataStore.getNumberOfTuples();
+    const auto& dataStore = inputDataArray->template getIDataStoreRefAs<AbstractDataStore<ScalarType>>();
+    const usize numTuples = dataStore.getNumberOfTuples();
+    const usize numComps = dataStore.getNumberOfComponents();
     auto maxLine = static_cast<size_t>(componentsPerLine);
     if(componentsPerLine == 0)
     {
-      maxLine = static_cast<size_t>(dataStore.getNumberOfComponents());
+      maxLine = static_cast<size_t>(numComps);
     }
 
-    usize numComps = dataStore.getNumberOfComponents();
-    for(size_t tuple = 0; tuple < numTuples; tuple++)
-    {
-      auto now = std::chrono::steady_clock::now();
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-      {
-        auto string = fmt::format("Processing {}: {}% completed", inputDataArray->getName(), static_cast<int32>(100 * static_cast<float>(tuple) / static_cast<float>(numTuples)));
-        mesgHandler(IFilter::Message::Type::Info, string);
-        start = now;
-        if(shouldCancel)
-        {
-          return {};
-        }
-      }
-      for(size_t index = 0; index < numComps; index++)
+    auto formatRows = [&dataStore, &delimiter, numComps, maxLine](TextBuffer& buffer, usize rowStart, usize rowEnd) {
+      for(usize tuple = rowStart; tuple < rowEnd; tuple++)
       {
-        if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-        {
-          outputStrm << static_cast<int32>(dataStore[tuple * numComps + index]);
-        }
-        else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-        {
-          outputStrm << fmt::format("{}", dataStore[tuple * numComps + index]);
-        }
-        else
-        {
-          outputStrm << dataStore[tuple * numComps + index];
-        }
-        if(index != maxLine - 1)
-        {
-          outputStrm << delimiter;
-        }
-        else
+        for(usize index = 0; index < numComps; index++)
         {
-          outputStrm << "\n";
+          AppendValue(buffer, dataStore[tuple * numComps + index]);
+          if(index != maxLine - 1)
+          {
+            AppendText(buffer, delimiter);
+          }
+          else
+          {
+            buffer.push_back('\n');
+          }
         }
       }
-    }
+    };
+
+    // Out-of-core stores are formatted serially so chunks are visited in order
+    const bool runParallel = dataStore.getDataFormat().empty();
+    ProgressThrottle progress(mesgHandler, inputDataArray->getName(), numTuples);
+    WriteRowBlocks(outputStrm, 0, numTuples, ComputeRowsPerBlock(numComps), runParallel, formatRows, progress, shouldCancel);
     return {};
   }
 };
@@ -205,25 +349,18 @@ struct PrintDataArray
 Result<> PrintStringArray(std::ostream& outputStrm, const StringArray& inputStringArray, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                           const std::string& delimiter = ",")
 {
-  auto start = std::chrono::steady_clock::now();
-  auto numTuples = inputStringArray.getNumberOfTuples();
+  const usize numTuples = inputStringArray.getNumberOfTuples();
 
-  for(size_t tuple = 0; tuple < numTuples; tuple++)
-  {
-    auto now = std::chrono::steady_clock::now();
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+  auto formatRows = [&inputStringArray](TextBuffer& buffer, usize rowStart, usize rowEnd) {
+    for(usize tuple = rowStart; tuple < rowEnd; tuple++)
     {
-      auto string = fmt::format("Processing {}: {}% completed", inputStringArray.getName(), static_cast<int32>(100 * static_cast<float>(tuple) / static_cast<float>(numTuples)));
-      mesgHandler(IFilter::Message::Type::Info, string);
-      start = now;
-      if(shouldCancel)
-      {
-        return {};
-      }
+      AppendText(buffer, inputStringArray[tuple]);
+      buffer.push_back('\n');
     }
-    outputStrm << inputStringArray[tuple] << "\n";
-  }
+  };
 
+  ProgressThrottle progress(mesgHandler, inputStringArray.getName(), numTuples);
+  WriteRowBlocks(outputStrm, 0, numTuples, ComputeRowsPerBlock(2), true, formatRows, progress, shouldCancel);
   return {};
 }
 
@@ -232,8 +369,10 @@ class ITupleWriter
 public:
   ITupleWriter() = default;
   virtual ~ITupleWriter() = default;
-  virtual void write(std::ostream& outputStrm, usize tupleIndex) const = 0;
+  virtual void write(TextBuffer& buffer, usize tupleIndex) const = 0;
   virtual void writeHeader(std::ostream& outputStrm) const = 0;
+  virtual usize getNumberOfComponents() const = 0;
+  virtual bool isInMemory() const = 0;
 };
 
 class StringTupleWriter : public ITupleWriter
@@ -254,9 +393,11 @@ public:
   StringTupleWriter& operator=(const StringTupleWriter&) = delete;
   StringTupleWriter& operator=(StringTupleWriter&&) noexcept = delete;
 
-  void write(std::ostream& outputStrm, usize tupleIndex) const override
+  void write(TextBuffer& buffer, usize tupleIndex) const override
   {
-    outputStrm << m_Delimiter << m_DataArray[tupleIndex] << m_Delimiter;
+    AppendText(buffer, m_Delimiter);
+    AppendText(buffer, m_DataArray[tupleIndex]);
+    AppendText(buffer, m_Delimiter);
   }
 
   void writeHeader(std::ostream& outputStrm) const override
@@ -264,6 +405,16 @@ public:
     outputStrm << m_DataArray.getName();
   }
 
+  usize getNumberOfComponents() const override
+  {
+    return 1;
+  }
+
+  bool isInMemory() const override
+  {
+    return true;
+  }
+
 private:
   const DataArrayType& m_DataArray;
   const std::string m_Delimiter = "'";
@@ -284,29 +435,14 @@ public:
   }
   ~TupleWriter() override = default;
 
-  void write(std::ostream& outputStrm, usize tupleIndex) const override
+  void write(TextBuffer& buffer, usize tupleIndex) const override
   {
     for(usize comp = 0; comp < m_NumComps; comp++)
     {
-      if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-      {
-        outputStrm << static_cast<int32>(m_DataStore[tupleIndex * m_NumComps + comp]);
-      }
-      else if constexpr(std::is_same_v<ScalarType, float32>)
-      {
-        outputStrm << std::setprecision(8) << std::noshowpoint << m_DataStore[tupleIndex * m_NumComps + comp];
-      }
-      else if constexpr(std::is_same_v<ScalarType, float64>)
-      {
-        outputStrm << std::setprecision(16) << std::noshowpoint << m_DataStore[tupleIndex * m_NumComps + comp];
-      }
-      else
-      {
-        outputStrm << m_DataStore[tupleIndex * m_NumComps + comp];
-      }
+      AppendFixedPrecisionValue(buffer, m_DataStore[tupleIndex * m_NumComps + comp]);
       if(comp < m_NumComps - 1)
       {
-        outputStrm << m_Delimiter;
+        AppendText(buffer, m_Delimiter);
       }
     }
   }
@@ -331,10 +467,20 @@ public:
     }
   }
 
+  usize getNumberOfComponents() const override
+  {
+    return m_NumComps;
+  }
+
+  bool isInMemory() const override
+  {
+    return m_DataStore.getDataFormat().empty();
+  }
+
 private:
-  const std::string m_Name;
   const AbstractDataStore<ScalarType>& m_DataStore;
-  const std::string& m_Delimiter = ",";
+  const std::string m_Name;
+  const std::string m_Delimiter = ",";
   usize m_NumComps = 1;
 };
 
@@ -502,7 +648,6 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
 {
   const auto& firstDataArray = dataStructure.getDataRefAs<IArray>(objectPaths[0]);
   usize numTuples = firstDataArray.getNumberOfTuples();
-  auto start = std::chrono::steady_clock::now();
 
   // Create our wrapper classes for each DataArray
   std::vector<std::shared_ptr<ITupleWriter>> writers;
@@ -563,38 +708,46 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
     return;
   }
 
-  // Loop on ever tuple using our predefined writer for each data array
+  // Format blocks of tuples using our predefined writer for each data array
   size_t writerIndexStart = 0;
   if(!writeFirstIndex)
   {
     writerIndexStart = 1;
   }
-  for(usize tupleIndex = writerIndexStart; tupleIndex < numTuples; tupleIndex++)
+  usize valuesPerRow = includeIndex ? 1 : 0;
+  bool runParallel = true;
+  for(const auto& writer : writers)
   {
-    auto now = std::chrono::steady_clock::now();
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    valuesPerRow += writer->getNumberOfComponents();
+    runParallel = runParallel && writer->isInMemory();
+  }
+
+  auto formatRows = [&writers, &delimiter, includeIndex](TextBuffer& buffer, usize rowStart, usize rowEnd) {
+    const usize numWriters = writers.size();
+    for(usize tupleIndex = rowStart; tupleIndex < rowEnd; tupleIndex++)
     {
-      auto string = fmt::format("Printing tuples: {}% completed", static_cast<int32>(100 * static_cast<float>(tupleIndex) / static_cast<float>(numTuples)));
-      mesgHandler(IFilter::Message::Type::Info, string);
-      start = now;
-      if(shouldCancel)
+      if(includeIndex)
       {
-        return;
+        AppendValue(buffer, tupleIndex);
+        AppendText(buffer, delimiter);
       }
-    }
-    if(includeIndex)
-    {
-      outputStrm << tupleIndex << delimiter;
-    }
-    for(size_t writerIndex = 0; writerIndex < writersCount; writerIndex++)
-    {
-      writers[writerIndex]->write(outputStrm, tupleIndex);
-      if(writerIndex != writersCount - 1)
+      for(usize writerIndex = 0; writerIndex < numWriters; writerIndex++)
       {
-        outputStrm << delimiter;
+        writers[writerIndex]->write(buffer, tupleIndex);
+        if(writerIndex != numWriters - 1)
+        {
+          AppendText(buffer, delimiter);
+        }
       }
+      buffer.push_back('\n');
     }
-    outputStrm << '\n';
+  };
+
+  ProgressThrottle progress(mesgHandler, "tuples", numTuples);
+  WriteRowBlocks(outputStrm, writerIndexStart, numTuples, ComputeRowsPerBlock(valuesPerRow), runParallel, formatRows, progress, shouldCancel);
+  if(shouldCancel)
+  {
+    return;
   }
 
   if(!neighborLists.empty())
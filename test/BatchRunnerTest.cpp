@@ -0,0 +1,399 @@
+#include "BatchRunner.hpp"
+
+#include "simplnx/Core/Application.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Parameters/NumberParameter.hpp"
+#include "simplnx/Parameters/StringParameter.hpp"
+#include "simplnx/Pipeline/PipelineFilter.hpp"
+#include "simplnx/Plugin/AbstractPlugin.hpp"
+#include "simplnx/Plugin/PluginLoader.hpp"
+#include "simplnx/unit_test/simplnx_test_dirs.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace fs = std::filesystem;
+using namespace nx::core;
+using namespace nx::core::CLI;
+
+namespace
+{
+/**
+ * @brief Writes its value to its output file. Fails to preflight with a negative value.
+ */
+class BatchTestFilter : public IFilter
+{
+public:
+  static constexpr Uuid k_ID = *Uuid::FromString("3b1f8f5c-2f0e-4b8a-9d3c-6a1e5c7d9b20");
+  static constexpr StringLiteral k_Value_Key = "value";
+  static constexpr StringLiteral k_OutputFile_Key = "output_file";
+  static constexpr int32 k_NegativeValueError = -1000;
+
+  BatchTestFilter() = default;
+  ~BatchTestFilter() override = default;
+
+  std::string name() const override
+  {
+    return "BatchTestFilter";
+  }
+
+  std::string className() const override
+  {
+    return "BatchTestFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    return k_ID;
+  }
+
+  std::string humanName() const override
+  {
+    return "Batch Test Filter";
+  }
+
+  std::vector<std::string> defaultTags() const override
+  {
+    return {};
+  }
+
+  Parameters parameters() const override
+  {
+    Parameters params;
+    params.insert(std::make_unique<Int32Parameter>(k_Value_Key, "Value", "Value written to the output file", 0));
+    params.insert(std::make_unique<StringParameter>(k_OutputFile_Key, "Output File", "File the value is written to", ""));
+    return params;
+  }
+
+  VersionType parametersVersion() const override
+  {
+    return 1;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<BatchTestFilter>();
+  }
+
+protected:
+  PreflightResult preflightImpl(const DataStructure& data, const Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    if(args.value<int32>(k_Value_Key) < 0)
+    {
+      return {MakeErrorResult<OutputActions>(k_NegativeValueError, "Value must not be negative")};
+    }
+    return {};
+  }
+
+  Result<> executeImpl(DataStructure& data, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    std::ofstream outputStream(args.value<std::string>(k_OutputFile_Key), std::ios_base::out | std::ios_base::trunc);
+    outputStream << args.value<int32>(k_Value_Key);
+    return {};
+  }
+};
+
+class BatchTestPlugin : public AbstractPlugin
+{
+public:
+  static constexpr AbstractPlugin::IdType k_ID = *Uuid::FromString("7c4d2a91-0e6b-4f3a-8b5d-1f9e2c3a4b60");
+
+  BatchTestPlugin()
+  : AbstractPlugin(k_ID, "BatchTestPlugin", "", "")
+  {
+    addFilter([]() { return std::make_unique<BatchTestFilter>(); });
+  }
+  ~BatchTestPlugin() override = default;
+
+  BatchTestPlugin(const BatchTestPlugin&) = delete;
+  BatchTestPlugin(BatchTestPlugin&&) = delete;
+
+  BatchTestPlugin& operator=(const BatchTestPlugin&) = delete;
+  BatchTestPlugin& operator=(BatchTestPlugin&&) = delete;
+
+  SIMPLMapType getSimplToSimplnxMap() const override
+  {
+    return {};
+  }
+};
+
+const fs::path k_OutputDir = fs::path(unit_test::k_BinaryTestOutputDir.view()) / "BatchRunnerTest";
+
+/**
+ * @brief Registers the batch test plugin and returns a pipeline holding a single BatchTestFilter.
+ */
+Pipeline CreateTemplatePipeline()
+{
+  FilterList* filterList = Application::GetOrCreateInstance()->getFilterList();
+  if(!filterList->containsPlugin(BatchTestPlugin::k_ID))
+  {
+    filterList->addPlugin(std::make_shared<InMemoryPluginLoader>(std::make_shared<BatchTestPlugin>()));
+  }
+  REQUIRE(filterList->containsPlugin(BatchTestPlugin::k_ID));
+
+  Arguments args;
+  args.insert(BatchTestFilter::k_Value_Key, int32{1});
+  args.insert(BatchTestFilter::k_OutputFile_Key, (k_OutputDir / "template_output.txt").string());
+
+  Pipeline pipeline;
+  REQUIRE(pipeline.push_back(FilterHandle(BatchTestFilter::k_ID, BatchTestPlugin::k_ID), args));
+  return pipeline;
+}
+
+std::string ReadFile(const fs::path& path)
+{
+  std::ifstream stream(path);
+  REQUIRE(stream.is_open());
+  return {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+}
+
+fs::path WriteManifest(const std::string& fileName, const std::string& contents)
+{
+  fs::create_directories(k_OutputDir);
+  const fs::path manifestPath = k_OutputDir / fileName;
+  std::ofstream manifestStream(manifestPath, std::ios_base::out | std::ios_base::trunc);
+  manifestStream << contents;
+  return manifestPath;
+}
+
+int32 FirstErrorCode(const Result<BatchManifest>& result)
+{
+  REQUIRE(result.invalid());
+  return result.errors()[0].code;
+}
+} // namespace
+
+TEST_CASE("nxrunner::BatchRunner: Read Manifest", "[nxrunner][BatchRunner]")
+{
+  const fs::path manifestPath = WriteManifest("valid_manifest.json", R"({
+    "pipeline": "template.d3dpipeline",
+    "max_concurrent_pipelines": 0,
+    "memory_budget": 1024,
+    "items": [
+      {"name": "first", "overrides": [{"filter_index": 1, "key": "spacing", "value": [1.0, 2.0, 3.0]}]},
+      {}
+    ]
+  })");
+
+  Result<BatchManifest> result = ReadBatchManifest(manifestPath);
+  REQUIRE(result.valid());
+  const BatchManifest& manifest = result.value();
+  REQUIRE(manifest.pipelinePath == manifestPath.parent_path() / "template.d3dpipeline");
+  REQUIRE(manifest.summaryPath == manifestPath.parent_path() / "valid_manifest_summary.json");
+  REQUIRE(manifest.maxConcurrentPipelines == 1);
+  REQUIRE(manifest.maxThreads == 0);
+  REQUIRE(manifest.memoryBudget == 1024);
+  REQUIRE(manifest.items.size() == 2);
+  REQUIRE(manifest.items[0].name == "first");
+  REQUIRE(manifest.items[0].overrides.size() == 1);
+  REQUIRE(manifest.items[0].overrides[0].filterIndex == 1);
+  REQUIRE(manifest.items[0].overrides[0].key == "spacing");
+  REQUIRE(manifest.items[1].name == "item_1");
+  REQUIRE(manifest.items[1].overrides.empty());
+}
+
+TEST_CASE("nxrunner::BatchRunner: Malformed Manifest", "[nxrunner][BatchRunner]")
+{
+  REQUIRE(FirstErrorCode(ReadBatchManifest(k_OutputDir / "does_not_exist.json")) == -130);
+
+  REQUIRE(FirstErrorCode(ReadBatchManifest(WriteManifest("not_json.json", R"({"pipeline": )"))) == -131);
+  REQUIRE(FirstErrorCode(ReadBatchManifest(WriteManifest("not_object.json", R"(["template.d3dpipeline"])"))) == -131);
+
+  std::string contents;
+  SECTION("Missing pipeline")
+  {
+    contents = R"({"items": []})";
+  }
+  SECTION("Pipeline is not a string")
+  {
+    contents = R"({"pipeline": 5, "items": []})";
+  }
+  SECTION("Invalid option value")
+  {
+    contents = R"({"pipeline": "template.d3dpipeline", "max_threads": "all", "items": []})";
+  }
+  SECTION("Missing items")
+  {
+    contents = R"({"pipeline": "template.d3dpipeline"})";
+  }
+  SECTION("Item is not an object")
+  {
+    contents = R"({"pipeline": "template.d3dpipeline", "items": [5]})";
+  }
+  SECTION("Item name is not a string")
+  {
+    contents = R"({"pipeline": "template.d3dpipeline", "items": [{"name": 5}]})";
+  }
+  SECTION("Overrides is not an array")
+  {
+    contents = R"({"pipeline": "template.d3dpipeline", "items": [{"overrides": 5}]})";
+  }
+  SECTION("Override without value")
+  {
+    contents = R"({"pipeline": "template.d3dpipeline", "items": [{"overrides": [{"filter_index": 0, "key": "spacing"}]}]})";
+  }
+  SECTION("Negative filter index")
+  {
+    contents = R"({"pipeline": "template.d3dpipeline", "items": [{"overrides": [{"filter_index": -1, "key": "spacing", "value": 1}]}]})";
+  }
+  REQUIRE(FirstErrorCode(ReadBatchManifest(WriteManifest("malformed_manifest.json", contents))) == -132);
+}
+
+TEST_CASE("nxrunner::BatchRunner: MemoryGate", "[nxrunner][BatchRunner]")
+{
+  MemoryGate memoryGate(100);
+
+  SECTION("Reservations that fit do not wait")
+  {
+    memoryGate.acquire(60);
+    memoryGate.acquire(40);
+    REQUIRE(memoryGate.inUse() == 100);
+    memoryGate.release(60);
+    memoryGate.release(40);
+    REQUIRE(memoryGate.inUse() == 0);
+  }
+
+  SECTION("An oversized reservation runs alone")
+  {
+    {
+      ScopedMemoryReservation reservation(memoryGate, 500);
+      REQUIRE(memoryGate.inUse() == 500);
+    }
+    REQUIRE(memoryGate.inUse() == 0);
+  }
+
+  SECTION("A reservation waits for the budget")
+  {
+    std::atomic_bool acquired = false;
+    std::thread waiter;
+    {
+      ScopedMemoryReservation reservation(memoryGate, 60);
+      waiter = std::thread([&memoryGate, &acquired]() {
+        ScopedMemoryReservation secondReservation(memoryGate, 60);
+        acquired = true;
+      });
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      CHECK_FALSE(acquired);
+    }
+    waiter.join();
+    REQUIRE(acquired);
+    REQUIRE(memoryGate.inUse() == 0);
+  }
+
+  SECTION("A reservation is returned when the work throws")
+  {
+    try
+    {
+      ScopedMemoryReservation reservation(memoryGate, 60);
+      throw std::runtime_error("Item failed");
+    } catch(const std::runtime_error&)
+    {
+    }
+    REQUIRE(memoryGate.inUse() == 0);
+  }
+}
+
+TEST_CASE("nxrunner::BatchRunner: Apply Overrides", "[nxrunner][BatchRunner]")
+{
+  Pipeline pipeline = CreateTemplatePipeline();
+  auto* filterNode = dynamic_cast<PipelineFilter*>(pipeline.at(0));
+  REQUIRE(filterNode != nullptr);
+
+  SECTION("Valid override")
+  {
+    Result<> result = ApplyOverrides(pipeline, {{0, std::string(BatchTestFilter::k_Value_Key), 5}});
+    REQUIRE(result.valid());
+    REQUIRE(filterNode->getArguments().value<int32>(BatchTestFilter::k_Value_Key) == 5);
+    REQUIRE(filterNode->getArguments().value<std::string>(BatchTestFilter::k_OutputFile_Key) == (k_OutputDir / "template_output.txt").string());
+  }
+
+  SECTION("Invalid overrides")
+  {
+    std::vector<BatchOverride> overrides;
+    SECTION("Filter index out of range")
+    {
+      overrides = {{1, std::string(BatchTestFilter::k_Value_Key), 5}};
+    }
+    SECTION("Unknown parameter")
+    {
+      overrides = {{0, "does_not_exist", 5}};
+    }
+    SECTION("Invalid value")
+    {
+      overrides = {{0, std::string(BatchTestFilter::k_Value_Key), "five"}};
+    }
+    Result<> result = ApplyOverrides(pipeline, overrides);
+    REQUIRE(result.invalid());
+    REQUIRE(result.errors()[0].code == -135);
+    REQUIRE(filterNode->getArguments().value<int32>(BatchTestFilter::k_Value_Key) == 1);
+  }
+}
+
+TEST_CASE("nxrunner::BatchRunner: Execute Batch", "[nxrunner][BatchRunner]")
+{
+  Pipeline templatePipeline = CreateTemplatePipeline();
+  const fs::path templatePath = k_OutputDir / "batch_template.d3dpipeline";
+  {
+    std::ofstream templateStream(templatePath, std::ios_base::out | std::ios_base::trunc);
+    templateStream << templatePipeline.toJson().dump(2);
+  }
+  const fs::path secondOutputPath = k_OutputDir / "second_output.txt";
+  const fs::path jobDir = k_OutputDir / "batch_summary_items";
+  fs::remove(secondOutputPath);
+  fs::remove_all(jobDir);
+
+  nlohmann::json manifestJson;
+  manifestJson["pipeline"] = templatePath.filename().string();
+  manifestJson["summary"] = "batch_summary.json";
+  manifestJson["items"] = nlohmann::json::array({
+      {{"name", "second"}, {"overrides", {{{"filter_index", 0}, {"key", "value"}, {"value", 2}}, {{"filter_index", 0}, {"key", "output_file"}, {"value", secondOutputPath.string()}}}}},
+      {{"name", "negative"}, {"overrides", {{{"filter_index", 0}, {"key", "value"}, {"value", -1}}}}},
+      {{"name", "unknown_parameter"}, {"overrides", {{{"filter_index", 0}, {"key", "does_not_exist"}, {"value", 3}}}}},
+  });
+  Result<BatchManifest> manifestResult = ReadBatchManifest(WriteManifest("batch_manifest.json", manifestJson.dump(2)));
+  REQUIRE(manifestResult.valid());
+  const BatchManifest& manifest = manifestResult.value();
+
+  // Without an nxrunner executable the items run one after another in this process
+  std::vector<std::string> messages;
+  Result<> result = ExecuteBatch(manifest, {}, [&messages](const std::string& message) { messages.push_back(message); });
+  REQUIRE(result.invalid());
+  REQUIRE(result.errors()[0].code == -136);
+  REQUIRE(!messages.empty());
+
+  // Only the overridden item wrote its own output; the template arguments were left alone
+  REQUIRE(ReadFile(secondOutputPath) == "2");
+
+  nlohmann::json summaryJson = nlohmann::json::parse(ReadFile(manifest.summaryPath));
+  REQUIRE(summaryJson["succeeded"].get<usize>() == 1);
+  REQUIRE(summaryJson["failed"].get<usize>() == 2);
+  const auto& items = summaryJson["items"];
+  REQUIRE(items.size() == 3);
+
+  REQUIRE(items[0]["name"] == "second");
+  REQUIRE(items[0]["status"] == "succeeded");
+  REQUIRE(items[0]["errors"].empty());
+
+  REQUIRE(items[1]["name"] == "negative");
+  REQUIRE(items[1]["status"] == "failed");
+  REQUIRE(!items[1]["errors"].empty());
+  REQUIRE(items[1]["errors"][0]["code"].get<int32>() == BatchTestFilter::k_NegativeValueError);
+
+  REQUIRE(items[2]["name"] == "unknown_parameter");
+  REQUIRE(items[2]["status"] == "failed");
+  REQUIRE(items[2]["errors"][0]["code"].get<int32>() == -135);
+
+  // Each item that could be set up was saved as a job with the overridden pipeline
+  REQUIRE(fs::exists(jobDir / "item_0.json"));
+  REQUIRE(fs::exists(BatchItemResultPath(jobDir / "item_0.json")));
+  REQUIRE(fs::exists(jobDir / "item_1.json"));
+  REQUIRE(!fs::exists(jobDir / "item_2.json"));
+}
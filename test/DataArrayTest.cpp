@@ -148,3 +148,30 @@ TEST_CASE("Copy DataStore", "DataArray")
     REQUIRE(dataStore[i] == dataStore2[i]);
   }
 }
+
+TEST_CASE("DataStore External Buffer", "[simplnx][DataStore]")
+{
+  std::vector<int32> externalBuffer = {0, 1, 2, 3, 4, 5};
+  usize releaseCount = 0;
+  {
+    DataStore<int32> dataStore(externalBuffer.data(), {2}, {3}, [&releaseCount](int32*) { releaseCount++; });
+    REQUIRE(dataStore.data() == externalBuffer.data());
+    REQUIRE(dataStore.getComponentValue(1, 2) == 5);
+
+    dataStore[0] = 42;
+    REQUIRE(externalBuffer[0] == 42);
+
+    // Reshaping without changing the element count keeps using the external buffer
+    dataStore.resizeTuples({1, 2});
+    REQUIRE(dataStore.data() == externalBuffer.data());
+    REQUIRE(releaseCount == 0);
+
+    // Growing moves the values into a DataStore owned allocation and gives the external buffer back
+    dataStore.resizeTuples({4});
+    REQUIRE(dataStore.data() != externalBuffer.data());
+    REQUIRE(releaseCount == 1);
+    REQUIRE(dataStore[0] == 42);
+    REQUIRE(dataStore[5] == 5);
+  }
+  REQUIRE(releaseCount == 1);
+}
@@ -65,3 +65,22 @@ TEST_CASE("Simplnx::Invalid DataPath Creation", "[Simplnx][DataPath]")
   DataPath fromInvalidVector({"", "", ""});
   REQUIRE(fromInvalidVector.toString().empty());
 }
+
+TEST_CASE("Simplnx::DataPath Hash", "[Simplnx][DataPath]")
+{
+  const DataPath path1({"Path1", "Path2"});
+  const DataPath path2 = DataPath({"Path1"}).createChildPath("Path2");
+  REQUIRE(path1 == path2);
+  REQUIRE(path1.getHash() == path2.getHash());
+  REQUIRE(std::hash<DataPath>{}(path1) == path1.getHash());
+  REQUIRE(DataPath{}.getHash() == DataPath::FromString("/").value().getHash());
+
+  DataPath renamedPath({"Path1", "Path2", "Path3"});
+  REQUIRE(renamedPath.attemptRename(DataPath({"Path1", "Path2"}), DataPath({"Path1", "Renamed"})));
+  REQUIRE(renamedPath == DataPath({"Path1", "Renamed", "Path3"}));
+  REQUIRE(renamedPath.getHash() == DataPath({"Path1", "Renamed", "Path3"}).getHash());
+
+  DataPath movedPath = path1;
+  DataPath movedToPath = std::move(movedPath);
+  REQUIRE(movedToPath == path1);
+}
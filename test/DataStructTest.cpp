@@ -652,6 +652,49 @@ TEST_CASE("LinkedPathTest")
   REQUIRE(!linkedPath.isValid());
 }
 
+TEST_CASE("DataMapNameIndexTest")
+{
+  DataStructure dataStr;
+  auto group = DataGroup::Create(dataStr, "Foo");
+  auto child1 = DataGroup::Create(dataStr, "Bar1", group->getId());
+  auto child2 = DataGroup::Create(dataStr, "Bar2", group->getId());
+  auto grandchild = DataGroup::Create(dataStr, "Bazz", child1->getId());
+
+  const DataPath grandPath({"Foo", "Bar1", "Bazz"});
+  REQUIRE(dataStr.getData(grandPath) == grandchild);
+  // Second lookup is served from the resolved path cache
+  REQUIRE(dataStr.getData(grandPath) == grandchild);
+
+  // Renaming updates the name index of the parent and invalidates cached paths
+  REQUIRE(grandchild->rename("Bazz2"));
+  REQUIRE(dataStr.getData(grandPath) == nullptr);
+  REQUIRE(dataStr.getData(DataPath({"Foo", "Bar1", "Bazz2"})) == grandchild);
+  REQUIRE(child1->contains("Bazz2"));
+  REQUIRE(!child1->contains("Bazz"));
+
+  // Top level objects are indexed in the root group
+  REQUIRE(group->rename("Foo2"));
+  REQUIRE(dataStr.getData(DataPath({"Foo"})) == nullptr);
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar2"})) == child2);
+  REQUIRE(DataGroup::Create(dataStr, "Foo") != nullptr);
+
+  // Objects with several parents are renamed in every parent
+  REQUIRE(dataStr.setAdditionalParent(grandchild->getId(), child2->getId()));
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar2", "Bazz2"})) == grandchild);
+  REQUIRE(grandchild->rename("Bazz3"));
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar1", "Bazz3"})) == grandchild);
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar2", "Bazz3"})) == grandchild);
+
+  REQUIRE(dataStr.removeParent(grandchild->getId(), child1->getId()));
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar1", "Bazz3"})) == nullptr);
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar2", "Bazz3"})) == grandchild);
+
+  // Removed names can be reused
+  REQUIRE(child2->remove("Bazz3"));
+  REQUIRE(!child2->contains("Bazz3"));
+  REQUIRE(DataGroup::Create(dataStr, "Bazz3", child2->getId()) != nullptr);
+}
+
 /**
  * @brief Tests IDataStructureListener usage
  */
@@ -0,0 +1,106 @@
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
+#include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/FeatureCompactionUtilities.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+using namespace nx::core;
+
+TEST_CASE("Simplnx::FeatureCompaction::AssignBadCellsToNeighbors", "[Simplnx][FeatureCompaction]")
+{
+  std::atomic_bool shouldCancel = false;
+  IFilter::MessageHandler messageHandler{[](const IFilter::Message&) {}};
+
+  // 5 x 3 x 1 image. The center bad cell only touches other bad cells and is filled in a second pass.
+  // clang-format off
+  const std::vector<int32> input = {
+      1,  1, -1,  2, 2,
+      1, -1, -1, -1, 2,
+      3,  3, -1,  2, 2};
+  const std::vector<int32> expected = {
+      1, 1, 1, 2, 2,
+      1, 1, 1, 2, 2,
+      3, 3, 3, 2, 2};
+  // clang-format on
+
+  DataStructure dataStructure;
+  auto* featureIdsArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "FeatureIds", {input.size()}, {1});
+  auto* valuesArray = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Values", {input.size()}, {1});
+  auto& featureIds = featureIdsArray->getDataStoreRef();
+  auto& values = valuesArray->getDataStoreRef();
+  for(usize i = 0; i < input.size(); i++)
+  {
+    featureIds[i] = input[i];
+    values[i] = input[i] < 0 ? -1.0f : static_cast<float32>(input[i]) * 10.0f;
+  }
+
+  // featureIds is not passed as a cell array on purpose, it must be updated regardless
+  Result<> result = FeatureCompaction::AssignBadCellsToNeighbors(SizeVec3{5, 3, 1}, featureIds, {valuesArray}, messageHandler, shouldCancel);
+  REQUIRE(result.valid());
+  for(usize i = 0; i < expected.size(); i++)
+  {
+    REQUIRE(featureIds[i] == expected[i]);
+    REQUIRE(values[i] == static_cast<float32>(expected[i]) * 10.0f);
+  }
+
+  // A region no good feature can reach is left alone instead of looping forever
+  DataStore<int32> allBad({4}, {1}, -1);
+  result = FeatureCompaction::AssignBadCellsToNeighbors(SizeVec3{2, 2, 1}, allBad, {}, messageHandler, shouldCancel);
+  REQUIRE(result.valid());
+  REQUIRE(allBad[0] == -1);
+
+  result = FeatureCompaction::AssignBadCellsToNeighbors(SizeVec3{2, 2, 2}, allBad, {}, messageHandler, shouldCancel);
+  REQUIRE(result.invalid());
+}
+
+TEST_CASE("Simplnx::FeatureCompaction::RemoveInactiveObjects", "[Simplnx][FeatureCompaction]")
+{
+  std::atomic_bool shouldCancel = false;
+  IFilter::MessageHandler messageHandler{[](const IFilter::Message&) {}};
+
+  DataStructure dataStructure;
+  auto* featureAM = AttributeMatrix::Create(dataStructure, "Feature Data", {5});
+  auto* sizesArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Sizes", {5}, {1}, featureAM->getId());
+  auto* neighborList = NeighborList<int32>::Create(dataStructure, "Neighbors", 5, featureAM->getId());
+  auto& sizes = sizesArray->getDataStoreRef();
+  for(usize i = 0; i < 5; i++)
+  {
+    sizes[i] = static_cast<int32>(i) * 100;
+    neighborList->setList(static_cast<int32>(i), std::make_shared<std::vector<int32>>(i, static_cast<int32>(i)));
+  }
+
+  Int32DataStore cellFeatureIds({8}, {1}, 0);
+  const std::vector<int32> cellInput = {0, 1, 2, 3, 4, 4, 2, -1};
+  for(usize i = 0; i < cellInput.size(); i++)
+  {
+    cellFeatureIds[i] = cellInput[i];
+  }
+
+  const std::vector<bool> activeObjects = {true, true, false, true, false};
+  REQUIRE(FeatureCompaction::CreateFeatureIdMap(activeObjects) == std::vector<int32>{0, 1, 0, 2, 0});
+
+  REQUIRE(RemoveInactiveObjects(dataStructure, DataPath({"Feature Data"}), activeObjects, cellFeatureIds, 5, messageHandler, shouldCancel));
+
+  REQUIRE(featureAM->getNumTuples() == 3);
+  REQUIRE(sizesArray->getNumberOfTuples() == 3);
+  REQUIRE(sizes[1] == 100);
+  REQUIRE(sizes[2] == 300);
+
+  // NeighborLists hold old feature ids, so their lists are not moved; the filters delete them
+  REQUIRE(neighborList->getNumberOfTuples() == 3);
+  REQUIRE(neighborList->getListSize(1) == 1);
+  REQUIRE(neighborList->getListSize(2) == 2);
+
+  const std::vector<int32> cellExpected = {0, 1, 0, 2, 0, 0, 0, -1};
+  for(usize i = 0; i < cellExpected.size(); i++)
+  {
+    REQUIRE(cellFeatureIds[i] == cellExpected[i]);
+  }
+}
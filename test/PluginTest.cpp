@@ -2,11 +2,14 @@
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/Filter/FilterHandle.hpp"
 #include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Plugin/PluginManifestCache.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 #include "simplnx/unit_test/simplnx_test_dirs.hpp"
 
 #include <catch2/catch.hpp>
 
+#include <filesystem>
+#include <fstream>
 #include <sstream>
 #include <string>
 
@@ -105,3 +108,108 @@ TEST_CASE("Test Singleton")
   Application::DeleteInstance();
   REQUIRE(Application::Instance() == nullptr);
 }
+
+TEST_CASE("Test Plugin Manifest Cache")
+{
+  // Use a private cache file so the test neither depends on nor changes the cache of the user
+  const std::filesystem::path cacheFilePath = std::filesystem::path(unit_test::k_BinaryTestOutputDir.view()) / "PluginTest" / "plugin_manifest_cache.json";
+  std::filesystem::remove(cacheFilePath);
+
+  {
+    auto app = Application::GetOrCreateInstance();
+    app->setPluginManifestCacheFilePath(cacheFilePath);
+    app->getPreferences()->setLazyPluginLoading(true);
+    app->loadPlugins(unit_test::k_BuildDir.view());
+    REQUIRE(std::filesystem::exists(cacheFilePath));
+
+    const PluginManifestCache* manifestCache = app->getPluginManifestCache();
+    REQUIRE(manifestCache != nullptr);
+    const FilterManifest* filterManifest = manifestCache->findFilter(k_TestFilterId);
+    REQUIRE(filterManifest != nullptr);
+    REQUIRE(filterManifest->handle.getFilterName() == "Test Filter");
+    REQUIRE(filterManifest->handle.getPluginId() == k_TestOnePluginId);
+
+    Application::DeleteInstance();
+  }
+
+  // The second Application registers the plugins from the cache written by the first one
+  auto app = Application::GetOrCreateInstance();
+  app->setPluginManifestCacheFilePath(cacheFilePath);
+  app->getPreferences()->setLazyPluginLoading(true);
+  app->loadPlugins(unit_test::k_BuildDir.view());
+
+  auto* filterListPtr = app->getFilterList();
+  REQUIRE(filterListPtr->containsPlugin(k_TestOnePluginId));
+  REQUIRE(filterListPtr->containsPlugin(k_TestTwoPluginId));
+  REQUIRE_FALSE(filterListPtr->isPluginLoaded(k_TestOnePluginId));
+  REQUIRE_FALSE(filterListPtr->isPluginLoaded(k_TestTwoPluginId));
+
+  // Searching only uses the cached filter handles
+  auto searchResults = filterListPtr->search("Test Filter 2");
+  REQUIRE(searchResults.size() == 1);
+  REQUIRE(searchResults[0].getFilterId() == k_Test2FilterId);
+  REQUIRE_FALSE(filterListPtr->isPluginLoaded(k_TestTwoPluginId));
+
+  // Creating a filter loads its plugin and no other
+  DataStructure dataStructure;
+  IFilter::UniquePointer filter = filterListPtr->createFilter(k_Test2FilterId);
+  REQUIRE(filter != nullptr);
+  REQUIRE(filter->humanName() == "Test Filter 2");
+  filter->execute(dataStructure, {});
+
+  REQUIRE(filterListPtr->isPluginLoaded(k_TestTwoPluginId));
+  REQUIRE_FALSE(filterListPtr->isPluginLoaded(k_TestOnePluginId));
+
+  Application::DeleteInstance();
+}
+
+TEST_CASE("Test Plugin Manifest Cache Pruning")
+{
+  const std::filesystem::path outputDir = std::filesystem::path(unit_test::k_BinaryTestOutputDir.view()) / "PluginTest";
+  const std::filesystem::path libraryPath = outputDir / "RemovedPlugin.simplnx";
+  const std::filesystem::path cacheFilePath = outputDir / "pruned_plugin_manifest_cache.json";
+  std::filesystem::create_directories(outputDir);
+  {
+    std::ofstream libraryStream(libraryPath, std::ios_base::out | std::ios_base::trunc);
+    libraryStream << "not a real plugin";
+  }
+
+  PluginManifest manifest;
+  manifest.libraryPath = libraryPath;
+  manifest.pluginId = k_TestOnePluginId;
+  manifest.name = "RemovedPlugin";
+
+  PluginManifestCache manifestCache;
+  manifestCache.insert(manifest);
+  REQUIRE(manifestCache.isModified());
+  REQUIRE(manifestCache.saveToFile(cacheFilePath).valid());
+  REQUIRE_FALSE(manifestCache.isModified());
+
+  // Only the cache itself is left in the directory; the temporary file was renamed over it
+  usize numCacheFiles = 0;
+  for(const auto& entry : std::filesystem::directory_iterator(outputDir))
+  {
+    if(StringUtilities::starts_with(entry.path().filename().string(), cacheFilePath.filename().string()))
+    {
+      numCacheFiles++;
+    }
+  }
+  REQUIRE(numCacheFiles == 1);
+
+  // The library still exists, so its manifest is kept
+  REQUIRE(manifestCache.loadFromFile(cacheFilePath).valid());
+  REQUIRE_FALSE(manifestCache.isModified());
+
+  // Once the library is removed its manifest is dropped on load
+  std::filesystem::remove(libraryPath);
+  REQUIRE(manifestCache.loadFromFile(cacheFilePath).valid());
+  REQUIRE(manifestCache.isModified());
+  REQUIRE(manifestCache.saveToFile(cacheFilePath).valid());
+
+  PluginManifestCache reloadedCache;
+  REQUIRE(reloadedCache.loadFromFile(cacheFilePath).valid());
+  REQUIRE_FALSE(reloadedCache.isModified());
+  std::ifstream cacheStream(cacheFilePath);
+  nlohmann::json cacheJson = nlohmann::json::parse(cacheStream);
+  REQUIRE(cacheJson["plugins"].empty());
+}
@@ -11,6 +11,7 @@ set(SIMPLNX_PYTHON_TESTS
   "geometry_examples" 
   "import_d3d"      # Dependent on 'basic_ebsd_ipf' running first
   "import_hdf5"     # Dependent on 'basic_ebsd_ipf' running first
+  "numpy_data_store"
   "output_file" 
   "pipeline" 
   "read_csv_file"
@@ -0,0 +1,148 @@
+"""
+Important Note
+==============
+
+This python file can be used as an example of how to hand existing numpy arrays to
+DREAM3D-NX without copying them and how to read arrays back chunk by chunk. If you
+plan to use the codes below (and you are welcome to), there are a few things that
+you, the developer, should take note of:
+
+Import Statements
+-----------------
+
+You will most likely *NOT* need to include the following code:
+
+   .. code:: python
+
+      import simplnx_test_dirs as nxtest
+
+Filter Error Detection
+----------------------
+
+In each section of code a filter is created and executed immediately. This may or
+may *not* be what you want to do. You can also preflight the filter to verify the
+correctness of the filters before executing the filter **although** this is done
+for you when the filter is executed. As such, you will want to check the 'result'
+variable to see if there are any errors or warnings. If there **are** any then
+you, as the developer, should act appropriately on the errors or warnings.
+More specifically, this bit of code:
+
+   .. code:: python
+
+      nxtest.check_filter_result(nxor.ReadAngDataFilter, result)
+
+is used by the simplnx unit testing framework and should be replaced by your own
+error checking code. You are welcome to look up the function definition and use
+that.
+
+"""
+import simplnx as nx
+import simplnx_test_dirs as nxtest
+
+import numpy as np
+
+#------------------------------------------------------------------------------
+# DataStore.from_numpy() splits the numpy shape into tuple and component dimensions
+#------------------------------------------------------------------------------
+# A single value with the default component shape is one tuple with one component
+store = nx.Float32DataStore.from_numpy(np.array([5.0], dtype=np.float32))
+assert store.tdims == [1]
+assert store.cdims == [1]
+
+store = nx.Float32DataStore.from_numpy(np.zeros((4,), dtype=np.float32))
+assert store.tdims == [4]
+assert store.cdims == [1]
+
+# A trailing axis of length 1 is the component axis
+store = nx.Float32DataStore.from_numpy(np.zeros((4, 1), dtype=np.float32))
+assert store.tdims == [4]
+assert store.cdims == [1]
+
+store = nx.Float32DataStore.from_numpy(np.zeros((4, 5, 3), dtype=np.float32), component_shape=[3])
+assert store.tdims == [4, 5]
+assert store.cdims == [3]
+
+# The store uses the memory of the numpy array
+values = np.zeros((6,), dtype=np.int32)
+store = nx.Int32DataStore.from_numpy(values)
+values[2] = 42
+assert store[2] == 42
+
+# Invalid arrays are rejected
+try:
+  nx.Float32DataStore.from_numpy(np.zeros((4, 2), dtype=np.float32), component_shape=[3])
+  raise AssertionError('A component shape that does not match the array must be rejected')
+except ValueError:
+  pass
+
+try:
+  nx.Float32DataStore.from_numpy(np.zeros((4,), dtype=np.float64))
+  raise AssertionError('An array of the wrong dtype must be rejected')
+except TypeError:
+  pass
+
+try:
+  nx.Float32DataStore.from_numpy(np.zeros((4, 6), dtype=np.float32)[:, ::2])
+  raise AssertionError('A non C-contiguous array must be rejected')
+except ValueError:
+  pass
+
+#------------------------------------------------------------------------------
+# DataArray.set_store() replaces the data of an existing DataArray
+#------------------------------------------------------------------------------
+data_structure = nx.DataStructure()
+array_path = nx.DataPath(['data'])
+result = nx.CreateDataArrayFilter.execute(data_structure,
+                                          numeric_type_index=nx.NumericType.float32,
+                                          component_count=2,
+                                          tuple_dimensions=[[3, 4]],
+                                          output_array_path=array_path,
+                                          initialization_value_str='0')
+nxtest.check_filter_result(nx.CreateDataArrayFilter, result)
+
+data_array = data_structure[array_path]
+shape = tuple(data_array.tdims) + tuple(data_array.cdims)
+values = np.arange(np.prod(shape), dtype=np.float32).reshape(shape)
+data_array.set_store(nx.Float32DataStore.from_numpy(values, component_shape=data_array.cdims))
+assert np.array_equal(data_array.npview(), values)
+
+# Changes on either side are visible on the other
+values[0, 0, 0] = -1.0
+assert data_array.npview()[0, 0, 0] == -1.0
+data_array.npview()[1, 1, 1] = -2.0
+assert values[1, 1, 1] == -2.0
+
+# A store with a different shape is rejected
+try:
+  data_array.set_store(nx.Float32DataStore.from_numpy(np.zeros((5, 2), dtype=np.float32), component_shape=[2]))
+  raise AssertionError('A store with a different shape must be rejected')
+except ValueError:
+  pass
+
+#------------------------------------------------------------------------------
+# Chunk access works for every store; an in memory store is a single chunk
+#------------------------------------------------------------------------------
+store = data_array.store
+assert store.chunk_shape is None
+assert np.array_equal(store.to_numpy(), values)
+
+positions = store.chunk_positions()
+assert positions == [[0] * len(shape)]
+offset, chunk_values = store.chunk(positions[0])
+assert offset == [0] * len(shape)
+assert np.array_equal(chunk_values, values)
+
+try:
+  store.chunk([1] * len(shape))
+  raise AssertionError('A chunk position outside the chunk layout must be rejected')
+except IndexError:
+  pass
+
+# Gathering every chunk reproduces the whole array
+gathered = np.zeros_like(values)
+for position in store.chunk_positions():
+  offset, chunk_values = store.chunk(position)
+  gathered[tuple(slice(o, o + n) for o, n in zip(offset, chunk_values.shape))] = chunk_values
+assert np.array_equal(gathered, values)
+
+print('numpy DataStore interop and chunk access work as expected')